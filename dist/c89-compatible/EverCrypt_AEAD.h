@@ -37,6 +37,8 @@
 #include "EverCrypt_AutoConfig2.h"
 #include "EverCrypt_Error.h"
 #include "Hacl_Spec.h"
+#include "Hacl_AES_GCM_CT.h"
+#include "Hacl_AES_GCM_NI.h"
 
 
 typedef struct EverCrypt_AEAD_state_s_s EverCrypt_AEAD_state_s;
@@ -0,0 +1,871 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "Hacl_AES_GCM_CT.h"
+
+/* Bitsliced AES, after the ct64 implementation of BearSSL. Four blocks are processed at once
+   in eight 64-bit words: q[i] holds bit i of every byte of the four blocks. The bytes are
+   ordered so that ShiftRows is a permutation within each word and MixColumns a few
+   rotations. */
+
+/* The S-box circuit of Boyar and Peralta (https://eprint.iacr.org/2009/191): 113 gates, and
+   no lookups. x0 is the most significant bit of each byte, x7 the least significant. */
+static void sub_bytes(uint64_t *q)
+{
+  uint64_t x0 = q[7U];
+  uint64_t x1 = q[6U];
+  uint64_t x2 = q[5U];
+  uint64_t x3 = q[4U];
+  uint64_t x4 = q[3U];
+  uint64_t x5 = q[2U];
+  uint64_t x6 = q[1U];
+  uint64_t x7 = q[0U];
+  /* Top linear transformation. */
+  uint64_t y14 = x3 ^ x5;
+  uint64_t y13 = x0 ^ x6;
+  uint64_t y9 = x0 ^ x3;
+  uint64_t y8 = x0 ^ x5;
+  uint64_t t0 = x1 ^ x2;
+  uint64_t y1 = t0 ^ x7;
+  uint64_t y4 = y1 ^ x3;
+  uint64_t y12 = y13 ^ y14;
+  uint64_t y2 = y1 ^ x0;
+  uint64_t y5 = y1 ^ x6;
+  uint64_t y3 = y5 ^ y8;
+  uint64_t t1 = x4 ^ y12;
+  uint64_t y15 = t1 ^ x5;
+  uint64_t y20 = t1 ^ x1;
+  uint64_t y6 = y15 ^ x7;
+  uint64_t y10 = y15 ^ t0;
+  uint64_t y11 = y20 ^ y9;
+  uint64_t y7 = x7 ^ y11;
+  uint64_t y17 = y10 ^ y11;
+  uint64_t y19 = y10 ^ y8;
+  uint64_t y16 = t0 ^ y11;
+  uint64_t y21 = y13 ^ y16;
+  uint64_t y18 = x0 ^ y16;
+  /* Non-linear section. */
+  uint64_t t2 = y12 & y15;
+  uint64_t t3 = y3 & y6;
+  uint64_t t4 = t3 ^ t2;
+  uint64_t t5 = y4 & x7;
+  uint64_t t6 = t5 ^ t2;
+  uint64_t t7 = y13 & y16;
+  uint64_t t8 = y5 & y1;
+  uint64_t t9 = t8 ^ t7;
+  uint64_t t10 = y2 & y7;
+  uint64_t t11 = t10 ^ t7;
+  uint64_t t12 = y9 & y11;
+  uint64_t t13 = y14 & y17;
+  uint64_t t14 = t13 ^ t12;
+  uint64_t t15 = y8 & y10;
+  uint64_t t16 = t15 ^ t12;
+  uint64_t t17 = t4 ^ t14;
+  uint64_t t18 = t6 ^ t16;
+  uint64_t t19 = t9 ^ t14;
+  uint64_t t20 = t11 ^ t16;
+  uint64_t t21 = t17 ^ y20;
+  uint64_t t22 = t18 ^ y19;
+  uint64_t t23 = t19 ^ y21;
+  uint64_t t24 = t20 ^ y18;
+  uint64_t t25 = t21 ^ t22;
+  uint64_t t26 = t21 & t23;
+  uint64_t t27 = t24 ^ t26;
+  uint64_t t28 = t25 & t27;
+  uint64_t t29 = t28 ^ t22;
+  uint64_t t30 = t23 ^ t24;
+  uint64_t t31 = t22 ^ t26;
+  uint64_t t32 = t31 & t30;
+  uint64_t t33 = t32 ^ t24;
+  uint64_t t34 = t23 ^ t33;
+  uint64_t t35 = t27 ^ t33;
+  uint64_t t36 = t24 & t35;
+  uint64_t t37 = t36 ^ t34;
+  uint64_t t38 = t27 ^ t36;
+  uint64_t t39 = t29 & t38;
+  uint64_t t40 = t25 ^ t39;
+  uint64_t t41 = t40 ^ t37;
+  uint64_t t42 = t29 ^ t33;
+  uint64_t t43 = t29 ^ t40;
+  uint64_t t44 = t33 ^ t37;
+  uint64_t t45 = t42 ^ t41;
+  uint64_t z0 = t44 & y15;
+  uint64_t z1 = t37 & y6;
+  uint64_t z2 = t33 & x7;
+  uint64_t z3 = t43 & y16;
+  uint64_t z4 = t40 & y1;
+  uint64_t z5 = t29 & y7;
+  uint64_t z6 = t42 & y11;
+  uint64_t z7 = t45 & y17;
+  uint64_t z8 = t41 & y10;
+  uint64_t z9 = t44 & y12;
+  uint64_t z10 = t37 & y3;
+  uint64_t z11 = t33 & y4;
+  uint64_t z12 = t43 & y13;
+  uint64_t z13 = t40 & y5;
+  uint64_t z14 = t29 & y2;
+  uint64_t z15 = t42 & y9;
+  uint64_t z16 = t45 & y14;
+  uint64_t z17 = t41 & y8;
+  /* Bottom linear transformation. */
+  uint64_t t46 = z15 ^ z16;
+  uint64_t t47 = z10 ^ z11;
+  uint64_t t48 = z5 ^ z13;
+  uint64_t t49 = z9 ^ z10;
+  uint64_t t50 = z2 ^ z12;
+  uint64_t t51 = z2 ^ z5;
+  uint64_t t52 = z7 ^ z8;
+  uint64_t t53 = z0 ^ z3;
+  uint64_t t54 = z6 ^ z7;
+  uint64_t t55 = z16 ^ z17;
+  uint64_t t56 = z12 ^ t48;
+  uint64_t t57 = t50 ^ t53;
+  uint64_t t58 = z4 ^ t46;
+  uint64_t t59 = z3 ^ t54;
+  uint64_t t60 = t46 ^ t57;
+  uint64_t t61 = z14 ^ t57;
+  uint64_t t62 = t52 ^ t58;
+  uint64_t t63 = t49 ^ t58;
+  uint64_t t64 = z4 ^ t59;
+  uint64_t t65 = t61 ^ t62;
+  uint64_t t66 = z1 ^ t63;
+  uint64_t s0 = t59 ^ t63;
+  uint64_t s6 = t56 ^ ~t62;
+  uint64_t s7 = t48 ^ ~t60;
+  uint64_t t67 = t64 ^ t65;
+  uint64_t s3 = t53 ^ t66;
+  uint64_t s4 = t51 ^ t66;
+  uint64_t s5 = t47 ^ t65;
+  uint64_t s1 = t64 ^ ~s3;
+  uint64_t s2 = t55 ^ ~t67;
+  q[7U] = s0;
+  q[6U] = s1;
+  q[5U] = s2;
+  q[4U] = s3;
+  q[3U] = s4;
+  q[2U] = s5;
+  q[1U] = s6;
+  q[0U] = s7;
+}
+
+static inline void swap_bits(uint64_t cl, uint64_t ch, uint32_t s, uint64_t *x, uint64_t *y)
+{
+  uint64_t a = x[0U];
+  uint64_t b = y[0U];
+  x[0U] = (a & cl) | (b & cl) << s;
+  y[0U] = (a & ch) >> s | (b & ch);
+}
+
+/* Transposes the 8x8 bit matrices spread over q: an involution between bytes packed in words
+   and the bitsliced representation. */
+static void ortho(uint64_t *q)
+{
+  {
+    uint32_t i;
+    for (i = (uint32_t)0U; i < (uint32_t)8U; i = i + (uint32_t)2U)
+    {
+      swap_bits((uint64_t)0x5555555555555555U,
+        (uint64_t)0xAAAAAAAAAAAAAAAAU,
+        (uint32_t)1U,
+        q + i,
+        q + i + (uint32_t)1U);
+    }
+  }
+  {
+    uint32_t i;
+    for (i = (uint32_t)0U; i < (uint32_t)2U; i++)
+    {
+      swap_bits((uint64_t)0x3333333333333333U,
+        (uint64_t)0xCCCCCCCCCCCCCCCCU,
+        (uint32_t)2U,
+        q + i,
+        q + i + (uint32_t)2U);
+      swap_bits((uint64_t)0x3333333333333333U,
+        (uint64_t)0xCCCCCCCCCCCCCCCCU,
+        (uint32_t)2U,
+        q + i + (uint32_t)4U,
+        q + i + (uint32_t)6U);
+    }
+  }
+  {
+    uint32_t i;
+    for (i = (uint32_t)0U; i < (uint32_t)4U; i++)
+    {
+      swap_bits((uint64_t)0x0F0F0F0F0F0F0F0FU,
+        (uint64_t)0xF0F0F0F0F0F0F0F0U,
+        (uint32_t)4U,
+        q + i,
+        q + i + (uint32_t)4U);
+    }
+  }
+}
+
+/* Spreads the four little-endian words of a block over two words, one byte out of two. */
+static inline void interleave_in(uint64_t *q0, uint64_t *q1, uint32_t *w)
+{
+  uint64_t x[4U] = { 0U };
+  {
+    uint32_t i;
+    for (i = (uint32_t)0U; i < (uint32_t)4U; i++)
+    {
+      uint64_t y = (uint64_t)w[i];
+      y = (y | y << (uint32_t)16U) & (uint64_t)0x0000FFFF0000FFFFU;
+      y = (y | y << (uint32_t)8U) & (uint64_t)0x00FF00FF00FF00FFU;
+      x[i] = y;
+    }
+  }
+  q0[0U] = x[0U] | x[2U] << (uint32_t)8U;
+  q1[0U] = x[1U] | x[3U] << (uint32_t)8U;
+}
+
+static inline void interleave_out(uint32_t *w, uint64_t q0, uint64_t q1)
+{
+  uint64_t x[4U] = { 0U };
+  x[0U] = q0 & (uint64_t)0x00FF00FF00FF00FFU;
+  x[1U] = q1 & (uint64_t)0x00FF00FF00FF00FFU;
+  x[2U] = q0 >> (uint32_t)8U & (uint64_t)0x00FF00FF00FF00FFU;
+  x[3U] = q1 >> (uint32_t)8U & (uint64_t)0x00FF00FF00FF00FFU;
+  {
+    uint32_t i;
+    for (i = (uint32_t)0U; i < (uint32_t)4U; i++)
+    {
+      uint64_t y = (x[i] | x[i] >> (uint32_t)8U) & (uint64_t)0x0000FFFF0000FFFFU;
+      w[i] = (uint32_t)y | (uint32_t)(y >> (uint32_t)16U);
+    }
+  }
+}
+
+static inline void add_round_key(uint64_t *q, uint64_t *sk)
+{
+  uint32_t i;
+  for (i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    q[i] = q[i] ^ sk[i];
+  }
+}
+
+static inline void shift_rows(uint64_t *q)
+{
+  uint32_t i;
+  for (i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    uint64_t x = q[i];
+    q[i] =
+      (x & (uint64_t)0x000000000000FFFFU)
+      | (x & (uint64_t)0x00000000FFF00000U) >> (uint32_t)4U
+      | (x & (uint64_t)0x00000000000F0000U) << (uint32_t)12U
+      | (x & (uint64_t)0x0000FF0000000000U) >> (uint32_t)8U
+      | (x & (uint64_t)0x000000FF00000000U) << (uint32_t)8U
+      | (x & (uint64_t)0xF000000000000000U) >> (uint32_t)12U
+      | (x & (uint64_t)0x0FFF000000000000U) << (uint32_t)4U;
+  }
+}
+
+static inline uint64_t rotr32(uint64_t x)
+{
+  return x << (uint32_t)32U | x >> (uint32_t)32U;
+}
+
+static inline void mix_columns(uint64_t *q)
+{
+  uint64_t r[8U] = { 0U };
+  {
+    uint32_t i;
+    for (i = (uint32_t)0U; i < (uint32_t)8U; i++)
+    {
+      r[i] = q[i] >> (uint32_t)16U | q[i] << (uint32_t)48U;
+    }
+  }
+  {
+    uint64_t q0 = q[0U];
+    uint64_t q1 = q[1U];
+    uint64_t q2 = q[2U];
+    uint64_t q3 = q[3U];
+    uint64_t q4 = q[4U];
+    uint64_t q5 = q[5U];
+    uint64_t q6 = q[6U];
+    uint64_t q7 = q[7U];
+    q[0U] = q7 ^ r[7U] ^ r[0U] ^ rotr32(q0 ^ r[0U]);
+    q[1U] = q0 ^ r[0U] ^ q7 ^ r[7U] ^ r[1U] ^ rotr32(q1 ^ r[1U]);
+    q[2U] = q1 ^ r[1U] ^ r[2U] ^ rotr32(q2 ^ r[2U]);
+    q[3U] = q2 ^ r[2U] ^ q7 ^ r[7U] ^ r[3U] ^ rotr32(q3 ^ r[3U]);
+    q[4U] = q3 ^ r[3U] ^ q7 ^ r[7U] ^ r[4U] ^ rotr32(q4 ^ r[4U]);
+    q[5U] = q4 ^ r[4U] ^ r[5U] ^ rotr32(q5 ^ r[5U]);
+    q[6U] = q5 ^ r[5U] ^ r[6U] ^ rotr32(q6 ^ r[6U]);
+    q[7U] = q6 ^ r[6U] ^ r[7U] ^ rotr32(q7 ^ r[7U]);
+  }
+}
+
+/* Encrypts the four blocks of b (64 bytes) in place, with the bitsliced round keys sk. */
+static void aes4(uint64_t *sk, uint32_t nr, uint8_t *b)
+{
+  uint32_t w[16U] = { 0U };
+  uint64_t q[8U] = { 0U };
+  {
+    uint32_t i;
+    for (i = (uint32_t)0U; i < (uint32_t)16U; i++)
+    {
+      w[i] = load32_le(b + (uint32_t)4U * i);
+    }
+  }
+  {
+    uint32_t i;
+    for (i = (uint32_t)0U; i < (uint32_t)4U; i++)
+    {
+      interleave_in(q + i, q + i + (uint32_t)4U, w + (uint32_t)4U * i);
+    }
+  }
+  ortho(q);
+  add_round_key(q, sk);
+  {
+    uint32_t r;
+    for (r = (uint32_t)1U; r < nr; r++)
+    {
+      sub_bytes(q);
+      shift_rows(q);
+      mix_columns(q);
+      add_round_key(q, sk + (uint32_t)8U * r);
+    }
+  }
+  sub_bytes(q);
+  shift_rows(q);
+  add_round_key(q, sk + (uint32_t)8U * nr);
+  ortho(q);
+  {
+    uint32_t i;
+    for (i = (uint32_t)0U; i < (uint32_t)4U; i++)
+    {
+      interleave_out(w + (uint32_t)4U * i, q[i], q[i + (uint32_t)4U]);
+    }
+  }
+  {
+    uint32_t i;
+    for (i = (uint32_t)0U; i < (uint32_t)16U; i++)
+    {
+      store32_le(b + (uint32_t)4U * i, w[i]);
+    }
+  }
+}
+
+static uint32_t sub_word(uint32_t x)
+{
+  uint64_t q[8U] = { 0U };
+  q[0U] = (uint64_t)x;
+  ortho(q);
+  sub_bytes(q);
+  ortho(q);
+  return (uint32_t)q[0U];
+}
+
+static const
+uint8_t
+rcon[10U] =
+  {
+    (uint8_t)0x01U, (uint8_t)0x02U, (uint8_t)0x04U, (uint8_t)0x08U, (uint8_t)0x10U,
+    (uint8_t)0x20U, (uint8_t)0x40U, (uint8_t)0x80U, (uint8_t)0x1bU, (uint8_t)0x36U
+  };
+
+/* Each round key is stored compressed, in two words: as it is the same for the four blocks, a
+   bitsliced round key only has two distinct bits out of every eight. */
+void Hacl_AES_GCM_CT_key_expansion(uint32_t nr, uint8_t *key, uint8_t *round_keys)
+{
+  uint32_t w[60U] = { 0U };
+  uint32_t nk = nr - (uint32_t)6U;
+  uint32_t nw = (uint32_t)4U * (nr + (uint32_t)1U);
+  {
+    uint32_t i;
+    for (i = (uint32_t)0U; i < nk; i++)
+    {
+      w[i] = load32_le(key + (uint32_t)4U * i);
+    }
+  }
+  {
+    uint32_t i;
+    for (i = nk; i < nw; i++)
+    {
+      uint32_t tmp = w[i - (uint32_t)1U];
+      uint32_t j = i % nk;
+      if (j == (uint32_t)0U)
+      {
+        tmp = tmp << (uint32_t)24U | tmp >> (uint32_t)8U;
+        tmp = sub_word(tmp) ^ (uint32_t)rcon[i / nk - (uint32_t)1U];
+      }
+      else if (nk > (uint32_t)6U && j == (uint32_t)4U)
+      {
+        tmp = sub_word(tmp);
+      }
+      w[i] = w[i - nk] ^ tmp;
+    }
+  }
+  {
+    uint32_t r;
+    for (r = (uint32_t)0U; r <= nr; r++)
+    {
+      uint64_t q[8U] = { 0U };
+      interleave_in(q, q + (uint32_t)4U, w + (uint32_t)4U * r);
+      q[1U] = q[0U];
+      q[2U] = q[0U];
+      q[3U] = q[0U];
+      q[5U] = q[4U];
+      q[6U] = q[4U];
+      q[7U] = q[4U];
+      ortho(q);
+      {
+        uint64_t
+        c0 =
+          (q[0U] & (uint64_t)0x1111111111111111U)
+          | (q[1U] & (uint64_t)0x2222222222222222U)
+          | (q[2U] & (uint64_t)0x4444444444444444U)
+          | (q[3U] & (uint64_t)0x8888888888888888U);
+        uint64_t
+        c1 =
+          (q[4U] & (uint64_t)0x1111111111111111U)
+          | (q[5U] & (uint64_t)0x2222222222222222U)
+          | (q[6U] & (uint64_t)0x4444444444444444U)
+          | (q[7U] & (uint64_t)0x8888888888888888U);
+        store64_le(round_keys + (uint32_t)16U * r, c0);
+        store64_le(round_keys + (uint32_t)16U * r + (uint32_t)8U, c1);
+      }
+    }
+  }
+  Lib_Memzero0_memzero(w, (uint32_t)60U * sizeof (w[0U]));
+}
+
+/* Expands the compressed round keys into 8 * (nr + 1) words. */
+static void load_round_keys(uint32_t nr, uint8_t *round_keys, uint64_t *sk)
+{
+  uint32_t u;
+  for (u = (uint32_t)0U; u < (uint32_t)2U * (nr + (uint32_t)1U); u++)
+  {
+    uint64_t x = load64_le(round_keys + (uint32_t)8U * u);
+    uint64_t x0 = x & (uint64_t)0x1111111111111111U;
+    uint64_t x1 = (x & (uint64_t)0x2222222222222222U) >> (uint32_t)1U;
+    uint64_t x2 = (x & (uint64_t)0x4444444444444444U) >> (uint32_t)2U;
+    uint64_t x3 = (x & (uint64_t)0x8888888888888888U) >> (uint32_t)3U;
+    sk[(uint32_t)4U * u] = (x0 << (uint32_t)4U) - x0;
+    sk[(uint32_t)4U * u + (uint32_t)1U] = (x1 << (uint32_t)4U) - x1;
+    sk[(uint32_t)4U * u + (uint32_t)2U] = (x2 << (uint32_t)4U) - x2;
+    sk[(uint32_t)4U * u + (uint32_t)3U] = (x3 << (uint32_t)4U) - x3;
+  }
+}
+
+/* Writes the keystream of the four counter blocks c .. c + 3 to ks (64 bytes). */
+static inline void ctr4(uint64_t *sk, uint32_t nr, uint8_t *j0, uint32_t c, uint8_t *ks)
+{
+  {
+    uint32_t i;
+    for (i = (uint32_t)0U; i < (uint32_t)4U; i++)
+    {
+      memcpy(ks + (uint32_t)16U * i, j0, (uint32_t)12U * sizeof (j0[0U]));
+      store32_be(ks + (uint32_t)16U * i + (uint32_t)12U, c + i);
+    }
+  }
+  aes4(sk, nr, ks);
+}
+
+/* GHASH without carry-less multiplication, after the ctmul64 implementation of BearSSL.
+   Field elements are pairs of big-endian words, most significant first. */
+
+/* The carry-less product of the low 64 bits of x and y, with integer multiplications: each
+   operand keeps one bit out of four, so that carries fall into the holes and are masked
+   out. */
+static inline uint64_t bmul64(uint64_t x, uint64_t y)
+{
+  uint64_t x0 = x & (uint64_t)0x1111111111111111U;
+  uint64_t x1 = x & (uint64_t)0x2222222222222222U;
+  uint64_t x2 = x & (uint64_t)0x4444444444444444U;
+  uint64_t x3 = x & (uint64_t)0x8888888888888888U;
+  uint64_t y0 = y & (uint64_t)0x1111111111111111U;
+  uint64_t y1 = y & (uint64_t)0x2222222222222222U;
+  uint64_t y2 = y & (uint64_t)0x4444444444444444U;
+  uint64_t y3 = y & (uint64_t)0x8888888888888888U;
+  uint64_t z0 = (x0 * y0 ^ x1 * y3 ^ x2 * y2 ^ x3 * y1) & (uint64_t)0x1111111111111111U;
+  uint64_t z1 = (x0 * y1 ^ x1 * y0 ^ x2 * y3 ^ x3 * y2) & (uint64_t)0x2222222222222222U;
+  uint64_t z2 = (x0 * y2 ^ x1 * y1 ^ x2 * y0 ^ x3 * y3) & (uint64_t)0x4444444444444444U;
+  uint64_t z3 = (x0 * y3 ^ x1 * y2 ^ x2 * y1 ^ x3 * y0) & (uint64_t)0x8888888888888888U;
+  return z0 | z1 | z2 | z3;
+}
+
+static inline uint64_t rev64(uint64_t x)
+{
+  x =
+    (x & (uint64_t)0x5555555555555555U) << (uint32_t)1U
+    | (x >> (uint32_t)1U & (uint64_t)0x5555555555555555U);
+  x =
+    (x & (uint64_t)0x3333333333333333U) << (uint32_t)2U
+    | (x >> (uint32_t)2U & (uint64_t)0x3333333333333333U);
+  x =
+    (x & (uint64_t)0x0F0F0F0F0F0F0F0FU) << (uint32_t)4U
+    | (x >> (uint32_t)4U & (uint64_t)0x0F0F0F0F0F0F0F0FU);
+  x =
+    (x & (uint64_t)0x00FF00FF00FF00FFU) << (uint32_t)8U
+    | (x >> (uint32_t)8U & (uint64_t)0x00FF00FF00FF00FFU);
+  x =
+    (x & (uint64_t)0x0000FFFF0000FFFFU) << (uint32_t)16U
+    | (x >> (uint32_t)16U & (uint64_t)0x0000FFFF0000FFFFU);
+  return x << (uint32_t)32U | x >> (uint32_t)32U;
+}
+
+/* The operands of the Karatsuba multiplication by H: its low and high halves and their sum,
+   then the bit-reversals of these, which yield the upper halves of the products. */
+static inline void load_hkey(uint8_t *hkey, uint64_t *h)
+{
+  uint64_t h1 = load64_be(hkey);
+  uint64_t h0 = load64_be(hkey + (uint32_t)8U);
+  h[0U] = h0;
+  h[1U] = h1;
+  h[2U] = h0 ^ h1;
+  h[3U] = rev64(h0);
+  h[4U] = rev64(h1);
+  h[5U] = h[3U] ^ h[4U];
+}
+
+/* y = y * H */
+static inline void gf128_mul(uint64_t *y, uint64_t *h)
+{
+  uint64_t y1 = y[0U];
+  uint64_t y0 = y[1U];
+  uint64_t y0r = rev64(y0);
+  uint64_t y1r = rev64(y1);
+  uint64_t z0 = bmul64(y0, h[0U]);
+  uint64_t z1 = bmul64(y1, h[1U]);
+  uint64_t z2 = bmul64(y0 ^ y1, h[2U]);
+  uint64_t z0h = bmul64(y0r, h[3U]);
+  uint64_t z1h = bmul64(y1r, h[4U]);
+  uint64_t z2h = bmul64(y0r ^ y1r, h[5U]);
+  z2 = z2 ^ z0 ^ z1;
+  z2h = z2h ^ z0h ^ z1h;
+  z0h = rev64(z0h) >> (uint32_t)1U;
+  z1h = rev64(z1h) >> (uint32_t)1U;
+  z2h = rev64(z2h) >> (uint32_t)1U;
+  {
+    uint64_t v0 = z0;
+    uint64_t v1 = z0h ^ z2;
+    uint64_t v2 = z1 ^ z2h;
+    uint64_t v3 = z1h;
+    /* The operands are bit-reflected: shift the product left by one. */
+    v3 = v3 << (uint32_t)1U | v2 >> (uint32_t)63U;
+    v2 = v2 << (uint32_t)1U | v1 >> (uint32_t)63U;
+    v1 = v1 << (uint32_t)1U | v0 >> (uint32_t)63U;
+    v0 = v0 << (uint32_t)1U;
+    /* Reduce modulo x^128 + x^7 + x^2 + x + 1. */
+    v2 = v2 ^ v0 ^ v0 >> (uint32_t)1U ^ v0 >> (uint32_t)2U ^ v0 >> (uint32_t)7U;
+    v1 = v1 ^ v0 << (uint32_t)63U ^ v0 << (uint32_t)62U ^ v0 << (uint32_t)57U;
+    v3 = v3 ^ v1 ^ v1 >> (uint32_t)1U ^ v1 >> (uint32_t)2U ^ v1 >> (uint32_t)7U;
+    v2 = v2 ^ v1 << (uint32_t)63U ^ v1 << (uint32_t)62U ^ v1 << (uint32_t)57U;
+    y[0U] = v3;
+    y[1U] = v2;
+  }
+}
+
+static inline void ghash_block(uint64_t *y, uint64_t *h, uint8_t *b)
+{
+  y[0U] = y[0U] ^ load64_be(b);
+  y[1U] = y[1U] ^ load64_be(b + (uint32_t)8U);
+  gf128_mul(y, h);
+}
+
+/* Absorbs blocks of data; len is a multiple of 16. */
+static inline void ghash_blocks(uint64_t *y, uint64_t *h, uint32_t len, uint8_t *data)
+{
+  uint32_t i;
+  for (i = (uint32_t)0U; i < len; i = i + (uint32_t)16U)
+  {
+    ghash_block(y, h, data + i);
+  }
+}
+
+/* Absorbs the first len bytes of buf, zero-padded to a block. */
+static inline void ghash_padded(uint64_t *y, uint64_t *h, uint32_t len, uint8_t *buf)
+{
+  uint8_t block[16U] = { 0U };
+  memcpy(block, buf, len * sizeof (buf[0U]));
+  ghash_block(y, h, block);
+}
+
+/* Absorbs any pending partial block of additional data, once the text starts. */
+static inline void flush_aad(Hacl_AES_GCM_CT_state *st, uint64_t *h, uint64_t *acc)
+{
+  uint32_t off = (uint32_t)(st->ad_len % (uint64_t)16U);
+  if (off != (uint32_t)0U)
+  {
+    ghash_padded(acc, h, off, st->buf);
+  }
+}
+
+/* CTR and GHASH over the ciphertext, four blocks of keystream at a time. For decryption, every
+   input block is hashed before the corresponding output block is written, so that out may
+   alias in. */
+static void
+crypt(Hacl_AES_GCM_CT_state *st, bool enc, uint32_t len, uint8_t *out, uint8_t *in)
+{
+  if (len == (uint32_t)0U)
+  {
+    return;
+  }
+  {
+    uint64_t sk[120U] = { 0U };
+    uint64_t h[6U] = { 0U };
+    uint64_t acc[2U] = { 0U };
+    uint32_t nr = st->nr;
+    load_round_keys(nr, st->round_keys, sk);
+    load_hkey(st->hkey, h);
+    acc[0U] = load64_be(st->acc);
+    acc[1U] = load64_be(st->acc + (uint32_t)8U);
+    if (st->text_len == (uint64_t)0U)
+    {
+      flush_aad(st, h, acc);
+    }
+    {
+      uint32_t c0 = load32_be(st->j0 + (uint32_t)12U) + (uint32_t)1U;
+      uint32_t off = (uint32_t)(st->text_len % (uint64_t)16U);
+      uint32_t i = (uint32_t)0U;
+      if (off != (uint32_t)0U)
+      {
+        /* Finish the partial block left over by the previous call. */
+        uint32_t n = (uint32_t)16U - off;
+        if (len < n)
+        {
+          n = len;
+        }
+        {
+          uint32_t j;
+          for (j = (uint32_t)0U; j < n; j++)
+          {
+            uint8_t x = in[j];
+            uint8_t y = x ^ st->ks[off + j];
+            out[j] = y;
+            st->buf[off + j] = enc ? y : x;
+          }
+        }
+        i = n;
+        if (off + n == (uint32_t)16U)
+        {
+          ghash_block(acc, h, st->buf);
+        }
+      }
+      {
+        /* From here on, block i of the call is block c - c0 of the message. */
+        uint32_t c = c0 + (uint32_t)((st->text_len + (uint64_t)i) / (uint64_t)16U);
+        uint8_t ks[64U] = { 0U };
+        while (i < len)
+        {
+          ctr4(sk, nr, st->j0, c, ks);
+          c = c + (uint32_t)4U;
+          {
+            uint32_t n = len - i;
+            if (n > (uint32_t)64U)
+            {
+              n = (uint32_t)64U;
+            }
+            {
+              uint32_t j = (uint32_t)0U;
+              for (; j + (uint32_t)16U <= n; j = j + (uint32_t)16U)
+              {
+                uint8_t *ct = enc ? out + i + j : in + i + j;
+                if (!enc)
+                {
+                  ghash_block(acc, h, ct);
+                }
+                {
+                  uint32_t k;
+                  for (k = (uint32_t)0U; k < (uint32_t)16U; k++)
+                  {
+                    out[i + j + k] = in[i + j + k] ^ ks[j + k];
+                  }
+                }
+                if (enc)
+                {
+                  ghash_block(acc, h, ct);
+                }
+              }
+              if (j < n)
+              {
+                /* Start a partial block, and keep its keystream for the next call. */
+                memcpy(st->ks, ks + j, (uint32_t)16U * sizeof (ks[0U]));
+                {
+                  uint32_t k;
+                  for (k = (uint32_t)0U; k < n - j; k++)
+                  {
+                    uint8_t x = in[i + j + k];
+                    uint8_t y = x ^ st->ks[k];
+                    out[i + j + k] = y;
+                    st->buf[k] = enc ? y : x;
+                  }
+                }
+              }
+            }
+            i = i + n;
+          }
+        }
+        st->text_len = st->text_len + (uint64_t)len;
+        store64_be(st->acc, acc[0U]);
+        store64_be(st->acc + (uint32_t)8U, acc[1U]);
+        Lib_Memzero0_memzero(sk, (uint32_t)120U * sizeof (sk[0U]));
+        Lib_Memzero0_memzero(ks, (uint32_t)64U * sizeof (ks[0U]));
+      }
+    }
+  }
+}
+
+void
+Hacl_AES_GCM_CT_init(
+  Hacl_AES_GCM_CT_state *st,
+  uint32_t nr,
+  uint8_t *round_keys,
+  uint8_t *iv,
+  uint32_t iv_len
+)
+{
+  st->round_keys = round_keys;
+  st->nr = nr;
+  st->ad_len = (uint64_t)0U;
+  st->text_len = (uint64_t)0U;
+  {
+    uint64_t sk[120U] = { 0U };
+    load_round_keys(nr, round_keys, sk);
+    {
+      uint8_t b[64U] = { 0U };
+      if (iv_len == (uint32_t)12U)
+      {
+        memcpy(st->j0, iv, (uint32_t)12U * sizeof (iv[0U]));
+        store32_be(st->j0 + (uint32_t)12U, (uint32_t)1U);
+        /* H = E(0) and the tag mask E(J0), in a single pass. */
+        memcpy(b + (uint32_t)16U, st->j0, (uint32_t)16U * sizeof (st->j0[0U]));
+        aes4(sk, nr, b);
+        memcpy(st->hkey, b, (uint32_t)16U * sizeof (b[0U]));
+        memcpy(st->ek0, b + (uint32_t)16U, (uint32_t)16U * sizeof (b[0U]));
+      }
+      else
+      {
+        aes4(sk, nr, b);
+        memcpy(st->hkey, b, (uint32_t)16U * sizeof (b[0U]));
+        {
+          /* J0 = GHASH(iv || 0^s || 0^64 || [len(iv)]_64) */
+          uint64_t h[6U] = { 0U };
+          uint64_t acc[2U] = { 0U };
+          load_hkey(st->hkey, h);
+          {
+            uint32_t full = iv_len / (uint32_t)16U * (uint32_t)16U;
+            ghash_blocks(acc, h, full, iv);
+            if (full < iv_len)
+            {
+              ghash_padded(acc, h, iv_len - full, iv + full);
+            }
+            acc[1U] = acc[1U] ^ (uint64_t)iv_len * (uint64_t)8U;
+            gf128_mul(acc, h);
+            store64_be(st->j0, acc[0U]);
+            store64_be(st->j0 + (uint32_t)8U, acc[1U]);
+            memset(b, 0U, (uint32_t)64U * sizeof (b[0U]));
+            memcpy(b, st->j0, (uint32_t)16U * sizeof (st->j0[0U]));
+            aes4(sk, nr, b);
+            memcpy(st->ek0, b, (uint32_t)16U * sizeof (b[0U]));
+          }
+        }
+      }
+      memset(st->acc, 0U, (uint32_t)16U * sizeof (st->acc[0U]));
+      Lib_Memzero0_memzero(sk, (uint32_t)120U * sizeof (sk[0U]));
+      Lib_Memzero0_memzero(b, (uint32_t)64U * sizeof (b[0U]));
+    }
+  }
+}
+
+void Hacl_AES_GCM_CT_aad(Hacl_AES_GCM_CT_state *st, uint32_t len, uint8_t *ad)
+{
+  uint64_t h[6U] = { 0U };
+  uint64_t acc[2U] = { 0U };
+  load_hkey(st->hkey, h);
+  acc[0U] = load64_be(st->acc);
+  acc[1U] = load64_be(st->acc + (uint32_t)8U);
+  {
+    uint32_t off = (uint32_t)(st->ad_len % (uint64_t)16U);
+    uint32_t i = (uint32_t)0U;
+    if (off != (uint32_t)0U)
+    {
+      i = (uint32_t)16U - off;
+      if (len < i)
+      {
+        i = len;
+      }
+      memcpy(st->buf + off, ad, i * sizeof (ad[0U]));
+      if (off + i == (uint32_t)16U)
+      {
+        ghash_block(acc, h, st->buf);
+      }
+    }
+    {
+      uint32_t full = (len - i) / (uint32_t)16U * (uint32_t)16U;
+      ghash_blocks(acc, h, full, ad + i);
+      i = i + full;
+      memcpy(st->buf, ad + i, (len - i) * sizeof (ad[0U]));
+      st->ad_len = st->ad_len + (uint64_t)len;
+      store64_be(st->acc, acc[0U]);
+      store64_be(st->acc + (uint32_t)8U, acc[1U]);
+    }
+  }
+}
+
+void
+Hacl_AES_GCM_CT_encrypt(Hacl_AES_GCM_CT_state *st, uint32_t len, uint8_t *out, uint8_t *text)
+{
+  crypt(st, true, len, out, text);
+}
+
+void
+Hacl_AES_GCM_CT_decrypt(Hacl_AES_GCM_CT_state *st, uint32_t len, uint8_t *out, uint8_t *cipher)
+{
+  crypt(st, false, len, out, cipher);
+}
+
+void Hacl_AES_GCM_CT_finish(Hacl_AES_GCM_CT_state *st, uint8_t *tag)
+{
+  uint64_t h[6U] = { 0U };
+  uint64_t acc[2U] = { 0U };
+  load_hkey(st->hkey, h);
+  acc[0U] = load64_be(st->acc);
+  acc[1U] = load64_be(st->acc + (uint32_t)8U);
+  {
+    uint32_t off = (uint32_t)(st->text_len % (uint64_t)16U);
+    if (st->text_len == (uint64_t)0U)
+    {
+      flush_aad(st, h, acc);
+    }
+    else if (off != (uint32_t)0U)
+    {
+      ghash_padded(acc, h, off, st->buf);
+    }
+  }
+  acc[0U] = acc[0U] ^ st->ad_len * (uint64_t)8U;
+  acc[1U] = acc[1U] ^ st->text_len * (uint64_t)8U;
+  gf128_mul(acc, h);
+  store64_be(tag, acc[0U]);
+  store64_be(tag + (uint32_t)8U, acc[1U]);
+  {
+    uint32_t i;
+    for (i = (uint32_t)0U; i < (uint32_t)16U; i++)
+    {
+      tag[i] = tag[i] ^ st->ek0[i];
+    }
+  }
+}
@@ -66,6 +66,30 @@ Spec_Agile_AEAD_alg EverCrypt_AEAD_alg_of_state(EverCrypt_AEAD_state_s *s)
       {
         return Spec_Agile_AEAD_AES256_GCM;
       }
+    case Spec_Cipher_Expansion_Hacl_AES128:
+      {
+        return Spec_Agile_AEAD_AES128_GCM;
+      }
+    case Spec_Cipher_Expansion_Hacl_AES256:
+      {
+        return Spec_Agile_AEAD_AES256_GCM;
+      }
+    case Spec_Cipher_Expansion_Hacl_AES128_NI:
+      {
+        return Spec_Agile_AEAD_AES128_GCM;
+      }
+    case Spec_Cipher_Expansion_Hacl_AES256_NI:
+      {
+        return Spec_Agile_AEAD_AES256_GCM;
+      }
+    case Spec_Cipher_Expansion_Hacl_XCHACHA20:
+      {
+        return Spec_Agile_AEAD_XCHACHA20_POLY1305;
+      }
+    case Spec_Cipher_Expansion_Hacl_AES256_SIV_NI:
+      {
+        return Spec_Agile_AEAD_AES256_GCM_SIV;
+      }
     default:
       {
         KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
@@ -74,13 +98,18 @@ Spec_Agile_AEAD_alg EverCrypt_AEAD_alg_of_state(EverCrypt_AEAD_state_s *s)
   }
 }
 
+/* Both ChaCha20-Poly1305 and XChaCha20-Poly1305 keep the raw 32-byte key. */
 static EverCrypt_Error_error_code
-create_in_chacha20_poly1305(EverCrypt_AEAD_state_s **dst, uint8_t *k)
+create_in_chacha20_poly1305(
+  Spec_Cipher_Expansion_impl i,
+  EverCrypt_AEAD_state_s **dst,
+  uint8_t *k
+)
 {
   uint8_t *ek = KRML_HOST_CALLOC((uint32_t)32U, sizeof (uint8_t));
   KRML_CHECK_SIZE(sizeof (EverCrypt_AEAD_state_s), (uint32_t)1U);
   EverCrypt_AEAD_state_s *p = KRML_HOST_MALLOC(sizeof (EverCrypt_AEAD_state_s));
-  p[0U] = ((EverCrypt_AEAD_state_s){ .impl = Spec_Cipher_Expansion_Hacl_CHACHA20, .ek = ek });
+  p[0U] = ((EverCrypt_AEAD_state_s){ .impl = i, .ek = ek });
   memcpy(ek, k, (uint32_t)32U * sizeof (k[0U]));
   dst[0U] = p;
   return EverCrypt_Error_Success;
@@ -94,10 +123,11 @@ create_in_aes128_gcm(EverCrypt_AEAD_state_s **dst, uint8_t *k)
   bool has_avx = EverCrypt_AutoConfig2_has_avx();
   bool has_sse = EverCrypt_AutoConfig2_has_sse();
   bool has_movbe = EverCrypt_AutoConfig2_has_movbe();
+  bool vale = EverCrypt_AutoConfig2_wants_vale();
   #if EVERCRYPT_TARGETCONFIG_X64
-  if (has_aesni && has_pclmulqdq && has_avx && has_sse && has_movbe)
+  if (has_aesni && has_pclmulqdq && has_avx && has_sse && has_movbe && vale)
   {
-    uint8_t *ek = KRML_HOST_CALLOC((uint32_t)480U, sizeof (uint8_t));
+    uint8_t *ek = KRML_HOST_CALLOC((uint32_t)304U, sizeof (uint8_t));
     uint8_t *keys_b = ek;
     uint8_t *hkeys_b = ek + (uint32_t)176U;
     uint64_t scrut = aes128_key_expansion(k, keys_b);
@@ -109,7 +139,30 @@ create_in_aes128_gcm(EverCrypt_AEAD_state_s **dst, uint8_t *k)
     return EverCrypt_Error_Success;
   }
   #endif
-  return EverCrypt_Error_UnsupportedAlgorithm;
+  /* Without Vale (not compiled in, as on x86, or disabled), or without the other extensions that
+     it needs, AES-NI and PCLMULQDQ are still used through Hacl_AES_GCM_NI. Its expanded key has
+     the size of the Vale one. */
+  #if EVERCRYPT_TARGETCONFIG_X64 || EVERCRYPT_TARGETCONFIG_X86
+  if (has_aesni && has_pclmulqdq && has_sse)
+  {
+    uint8_t *ek = KRML_HOST_CALLOC((uint32_t)304U, sizeof (uint8_t));
+    Hacl_AES_GCM_NI_key_expansion((uint32_t)10U, k, ek);
+    KRML_CHECK_SIZE(sizeof (EverCrypt_AEAD_state_s), (uint32_t)1U);
+    EverCrypt_AEAD_state_s *p = KRML_HOST_MALLOC(sizeof (EverCrypt_AEAD_state_s));
+    p[0U] = ((EverCrypt_AEAD_state_s){ .impl = Spec_Cipher_Expansion_Hacl_AES128_NI, .ek = ek });
+    *dst = p;
+    return EverCrypt_Error_Success;
+  }
+  #endif
+  /* Elsewhere, fall back onto the portable, constant-time Hacl_AES_GCM_CT. Its key schedule is
+     smaller than the Vale expanded key, so EverCrypt_AEAD_size covers both. */
+  uint8_t *ek = KRML_HOST_CALLOC((uint32_t)176U, sizeof (uint8_t));
+  Hacl_AES_GCM_CT_key_expansion((uint32_t)10U, k, ek);
+  KRML_CHECK_SIZE(sizeof (EverCrypt_AEAD_state_s), (uint32_t)1U);
+  EverCrypt_AEAD_state_s *p = KRML_HOST_MALLOC(sizeof (EverCrypt_AEAD_state_s));
+  p[0U] = ((EverCrypt_AEAD_state_s){ .impl = Spec_Cipher_Expansion_Hacl_AES128, .ek = ek });
+  *dst = p;
+  return EverCrypt_Error_Success;
 }
 
 static EverCrypt_Error_error_code
@@ -120,10 +173,11 @@ create_in_aes256_gcm(EverCrypt_AEAD_state_s **dst, uint8_t *k)
   bool has_avx = EverCrypt_AutoConfig2_has_avx();
   bool has_sse = EverCrypt_AutoConfig2_has_sse();
   bool has_movbe = EverCrypt_AutoConfig2_has_movbe();
+  bool vale = EverCrypt_AutoConfig2_wants_vale();
   #if EVERCRYPT_TARGETCONFIG_X64
-  if (has_aesni && has_pclmulqdq && has_avx && has_sse && has_movbe)
+  if (has_aesni && has_pclmulqdq && has_avx && has_sse && has_movbe && vale)
   {
-    uint8_t *ek = KRML_HOST_CALLOC((uint32_t)544U, sizeof (uint8_t));
+    uint8_t *ek = KRML_HOST_CALLOC((uint32_t)368U, sizeof (uint8_t));
     uint8_t *keys_b = ek;
     uint8_t *hkeys_b = ek + (uint32_t)240U;
     uint64_t scrut = aes256_key_expansion(k, keys_b);
@@ -135,6 +189,48 @@ create_in_aes256_gcm(EverCrypt_AEAD_state_s **dst, uint8_t *k)
     return EverCrypt_Error_Success;
   }
   #endif
+  #if EVERCRYPT_TARGETCONFIG_X64 || EVERCRYPT_TARGETCONFIG_X86
+  if (has_aesni && has_pclmulqdq && has_sse)
+  {
+    uint8_t *ek = KRML_HOST_CALLOC((uint32_t)368U, sizeof (uint8_t));
+    Hacl_AES_GCM_NI_key_expansion((uint32_t)14U, k, ek);
+    KRML_CHECK_SIZE(sizeof (EverCrypt_AEAD_state_s), (uint32_t)1U);
+    EverCrypt_AEAD_state_s *p = KRML_HOST_MALLOC(sizeof (EverCrypt_AEAD_state_s));
+    p[0U] = ((EverCrypt_AEAD_state_s){ .impl = Spec_Cipher_Expansion_Hacl_AES256_NI, .ek = ek });
+    *dst = p;
+    return EverCrypt_Error_Success;
+  }
+  #endif
+  uint8_t *ek = KRML_HOST_CALLOC((uint32_t)240U, sizeof (uint8_t));
+  Hacl_AES_GCM_CT_key_expansion((uint32_t)14U, k, ek);
+  KRML_CHECK_SIZE(sizeof (EverCrypt_AEAD_state_s), (uint32_t)1U);
+  EverCrypt_AEAD_state_s *p = KRML_HOST_MALLOC(sizeof (EverCrypt_AEAD_state_s));
+  p[0U] = ((EverCrypt_AEAD_state_s){ .impl = Spec_Cipher_Expansion_Hacl_AES256, .ek = ek });
+  *dst = p;
+  return EverCrypt_Error_Success;
+}
+
+/* AES-256-GCM-SIV only has an AES-NI and PCLMULQDQ implementation. The state holds the round
+   keys of the key-generating key; the per-nonce keys are derived by each call. */
+static EverCrypt_Error_error_code
+create_in_aes256_gcm_siv(EverCrypt_AEAD_state_s **dst, uint8_t *k)
+{
+  bool has_aesni = EverCrypt_AutoConfig2_has_aesni();
+  bool has_pclmulqdq = EverCrypt_AutoConfig2_has_pclmulqdq();
+  bool has_sse = EverCrypt_AutoConfig2_has_sse();
+  #if EVERCRYPT_TARGETCONFIG_X64 || EVERCRYPT_TARGETCONFIG_X86
+  if (has_aesni && has_pclmulqdq && has_sse)
+  {
+    uint8_t *ek = KRML_HOST_CALLOC((uint32_t)240U, sizeof (uint8_t));
+    Hacl_AES_GCM_NI_siv_key_expansion(k, ek);
+    KRML_CHECK_SIZE(sizeof (EverCrypt_AEAD_state_s), (uint32_t)1U);
+    EverCrypt_AEAD_state_s *p = KRML_HOST_MALLOC(sizeof (EverCrypt_AEAD_state_s));
+    p[0U] =
+      ((EverCrypt_AEAD_state_s){ .impl = Spec_Cipher_Expansion_Hacl_AES256_SIV_NI, .ek = ek });
+    *dst = p;
+    return EverCrypt_Error_Success;
+  }
+  #endif
   return EverCrypt_Error_UnsupportedAlgorithm;
 }
 
@@ -153,7 +249,217 @@ EverCrypt_AEAD_create_in(Spec_Agile_AEAD_alg a, EverCrypt_AEAD_state_s **dst, ui
       }
     case Spec_Agile_AEAD_CHACHA20_POLY1305:
       {
-        return create_in_chacha20_poly1305(dst, k);
+        return create_in_chacha20_poly1305(Spec_Cipher_Expansion_Hacl_CHACHA20, dst, k);
+      }
+    case Spec_Agile_AEAD_XCHACHA20_POLY1305:
+      {
+        return create_in_chacha20_poly1305(Spec_Cipher_Expansion_Hacl_XCHACHA20, dst, k);
+      }
+    case Spec_Agile_AEAD_AES256_GCM_SIV:
+      {
+        return create_in_aes256_gcm_siv(dst, k);
+      }
+    default:
+      {
+        return EverCrypt_Error_UnsupportedAlgorithm;
+      }
+  }
+}
+
+/* Caller-provided storage holds the state record first, then the expanded key at the next
+   multiple of 16 bytes. */
+static uint32_t ek_offset()
+{
+  uint32_t len = (uint32_t)sizeof (EverCrypt_AEAD_state_s);
+  return (len + (uint32_t)15U) / (uint32_t)16U * (uint32_t)16U;
+}
+
+uint32_t EverCrypt_AEAD_size(Spec_Agile_AEAD_alg a)
+{
+  switch (a)
+  {
+    case Spec_Agile_AEAD_AES128_GCM:
+      {
+        return ek_offset() + (uint32_t)304U;
+      }
+    case Spec_Agile_AEAD_AES256_GCM:
+      {
+        return ek_offset() + (uint32_t)368U;
+      }
+    case Spec_Agile_AEAD_CHACHA20_POLY1305:
+    case Spec_Agile_AEAD_XCHACHA20_POLY1305:
+      {
+        return ek_offset() + (uint32_t)32U;
+      }
+    case Spec_Agile_AEAD_AES256_GCM_SIV:
+      {
+        return ek_offset() + (uint32_t)240U;
+      }
+    default:
+      {
+        return (uint32_t)0U;
+      }
+  }
+}
+
+static EverCrypt_Error_error_code
+init_in_place_chacha20_poly1305(
+  Spec_Cipher_Expansion_impl i,
+  uint8_t *mem,
+  EverCrypt_AEAD_state_s **dst,
+  uint8_t *k
+)
+{
+  uint8_t *ek = mem + ek_offset();
+  EverCrypt_AEAD_state_s *p = (EverCrypt_AEAD_state_s *)mem;
+  p[0U] = ((EverCrypt_AEAD_state_s){ .impl = i, .ek = ek });
+  memcpy(ek, k, (uint32_t)32U * sizeof (k[0U]));
+  dst[0U] = p;
+  return EverCrypt_Error_Success;
+}
+
+static EverCrypt_Error_error_code
+init_in_place_aes128_gcm(uint8_t *mem, EverCrypt_AEAD_state_s **dst, uint8_t *k)
+{
+  bool has_aesni = EverCrypt_AutoConfig2_has_aesni();
+  bool has_pclmulqdq = EverCrypt_AutoConfig2_has_pclmulqdq();
+  bool has_avx = EverCrypt_AutoConfig2_has_avx();
+  bool has_sse = EverCrypt_AutoConfig2_has_sse();
+  bool has_movbe = EverCrypt_AutoConfig2_has_movbe();
+  bool vale = EverCrypt_AutoConfig2_wants_vale();
+  #if EVERCRYPT_TARGETCONFIG_X64
+  if (has_aesni && has_pclmulqdq && has_avx && has_sse && has_movbe && vale)
+  {
+    uint8_t *ek = mem + ek_offset();
+    uint8_t *keys_b = ek;
+    uint8_t *hkeys_b = ek + (uint32_t)176U;
+    uint64_t scrut = aes128_key_expansion(k, keys_b);
+    uint64_t scrut0 = aes128_keyhash_init(keys_b, hkeys_b);
+    EverCrypt_AEAD_state_s *p = (EverCrypt_AEAD_state_s *)mem;
+    p[0U] = ((EverCrypt_AEAD_state_s){ .impl = Spec_Cipher_Expansion_Vale_AES128, .ek = ek });
+    *dst = p;
+    return EverCrypt_Error_Success;
+  }
+  #endif
+  #if EVERCRYPT_TARGETCONFIG_X64 || EVERCRYPT_TARGETCONFIG_X86
+  if (has_aesni && has_pclmulqdq && has_sse)
+  {
+    uint8_t *ek = mem + ek_offset();
+    Hacl_AES_GCM_NI_key_expansion((uint32_t)10U, k, ek);
+    EverCrypt_AEAD_state_s *p = (EverCrypt_AEAD_state_s *)mem;
+    p[0U] = ((EverCrypt_AEAD_state_s){ .impl = Spec_Cipher_Expansion_Hacl_AES128_NI, .ek = ek });
+    *dst = p;
+    return EverCrypt_Error_Success;
+  }
+  #endif
+  uint8_t *ek = mem + ek_offset();
+  Hacl_AES_GCM_CT_key_expansion((uint32_t)10U, k, ek);
+  EverCrypt_AEAD_state_s *p = (EverCrypt_AEAD_state_s *)mem;
+  p[0U] = ((EverCrypt_AEAD_state_s){ .impl = Spec_Cipher_Expansion_Hacl_AES128, .ek = ek });
+  *dst = p;
+  return EverCrypt_Error_Success;
+}
+
+static EverCrypt_Error_error_code
+init_in_place_aes256_gcm(uint8_t *mem, EverCrypt_AEAD_state_s **dst, uint8_t *k)
+{
+  bool has_aesni = EverCrypt_AutoConfig2_has_aesni();
+  bool has_pclmulqdq = EverCrypt_AutoConfig2_has_pclmulqdq();
+  bool has_avx = EverCrypt_AutoConfig2_has_avx();
+  bool has_sse = EverCrypt_AutoConfig2_has_sse();
+  bool has_movbe = EverCrypt_AutoConfig2_has_movbe();
+  bool vale = EverCrypt_AutoConfig2_wants_vale();
+  #if EVERCRYPT_TARGETCONFIG_X64
+  if (has_aesni && has_pclmulqdq && has_avx && has_sse && has_movbe && vale)
+  {
+    uint8_t *ek = mem + ek_offset();
+    uint8_t *keys_b = ek;
+    uint8_t *hkeys_b = ek + (uint32_t)240U;
+    uint64_t scrut = aes256_key_expansion(k, keys_b);
+    uint64_t scrut0 = aes256_keyhash_init(keys_b, hkeys_b);
+    EverCrypt_AEAD_state_s *p = (EverCrypt_AEAD_state_s *)mem;
+    p[0U] = ((EverCrypt_AEAD_state_s){ .impl = Spec_Cipher_Expansion_Vale_AES256, .ek = ek });
+    *dst = p;
+    return EverCrypt_Error_Success;
+  }
+  #endif
+  #if EVERCRYPT_TARGETCONFIG_X64 || EVERCRYPT_TARGETCONFIG_X86
+  if (has_aesni && has_pclmulqdq && has_sse)
+  {
+    uint8_t *ek = mem + ek_offset();
+    Hacl_AES_GCM_NI_key_expansion((uint32_t)14U, k, ek);
+    EverCrypt_AEAD_state_s *p = (EverCrypt_AEAD_state_s *)mem;
+    p[0U] = ((EverCrypt_AEAD_state_s){ .impl = Spec_Cipher_Expansion_Hacl_AES256_NI, .ek = ek });
+    *dst = p;
+    return EverCrypt_Error_Success;
+  }
+  #endif
+  uint8_t *ek = mem + ek_offset();
+  Hacl_AES_GCM_CT_key_expansion((uint32_t)14U, k, ek);
+  EverCrypt_AEAD_state_s *p = (EverCrypt_AEAD_state_s *)mem;
+  p[0U] = ((EverCrypt_AEAD_state_s){ .impl = Spec_Cipher_Expansion_Hacl_AES256, .ek = ek });
+  *dst = p;
+  return EverCrypt_Error_Success;
+}
+
+static EverCrypt_Error_error_code
+init_in_place_aes256_gcm_siv(uint8_t *mem, EverCrypt_AEAD_state_s **dst, uint8_t *k)
+{
+  bool has_aesni = EverCrypt_AutoConfig2_has_aesni();
+  bool has_pclmulqdq = EverCrypt_AutoConfig2_has_pclmulqdq();
+  bool has_sse = EverCrypt_AutoConfig2_has_sse();
+  #if EVERCRYPT_TARGETCONFIG_X64 || EVERCRYPT_TARGETCONFIG_X86
+  if (has_aesni && has_pclmulqdq && has_sse)
+  {
+    uint8_t *ek = mem + ek_offset();
+    Hacl_AES_GCM_NI_siv_key_expansion(k, ek);
+    EverCrypt_AEAD_state_s *p = (EverCrypt_AEAD_state_s *)mem;
+    p[0U] =
+      ((EverCrypt_AEAD_state_s){ .impl = Spec_Cipher_Expansion_Hacl_AES256_SIV_NI, .ek = ek });
+    *dst = p;
+    return EverCrypt_Error_Success;
+  }
+  #endif
+  return EverCrypt_Error_UnsupportedAlgorithm;
+}
+
+EverCrypt_Error_error_code
+EverCrypt_AEAD_init_in_place(
+  Spec_Agile_AEAD_alg a,
+  void *mem,
+  EverCrypt_AEAD_state_s **dst,
+  uint8_t *k
+)
+{
+  switch (a)
+  {
+    case Spec_Agile_AEAD_AES128_GCM:
+      {
+        return init_in_place_aes128_gcm((uint8_t *)mem, dst, k);
+      }
+    case Spec_Agile_AEAD_AES256_GCM:
+      {
+        return init_in_place_aes256_gcm((uint8_t *)mem, dst, k);
+      }
+    case Spec_Agile_AEAD_CHACHA20_POLY1305:
+      {
+        return
+          init_in_place_chacha20_poly1305(Spec_Cipher_Expansion_Hacl_CHACHA20,
+            (uint8_t *)mem,
+            dst,
+            k);
+      }
+    case Spec_Agile_AEAD_XCHACHA20_POLY1305:
+      {
+        return
+          init_in_place_chacha20_poly1305(Spec_Cipher_Expansion_Hacl_XCHACHA20,
+            (uint8_t *)mem,
+            dst,
+            k);
+      }
+    case Spec_Agile_AEAD_AES256_GCM_SIV:
+      {
+        return init_in_place_aes256_gcm_siv((uint8_t *)mem, dst, k);
       }
     default:
       {
@@ -162,6 +468,33 @@ EverCrypt_AEAD_create_in(Spec_Agile_AEAD_alg a, EverCrypt_AEAD_state_s **dst, ui
   }
 }
 
+#if EVERCRYPT_TARGETCONFIG_X64
+/* The initial counter block J0 for the Vale kernels, which take it byte-reversed. A 12-byte
+   IV needs no hashing: J0 is the IV followed by a 32-bit counter of 1, so it is built directly
+   instead of going through compute_iv_stdcall. */
+static inline void vale_iv(uint8_t *iv, uint32_t iv_len, uint8_t *hkeys_b, uint8_t *tmp_iv)
+{
+  if (iv_len == (uint32_t)12U)
+  {
+    tmp_iv[0U] = (uint8_t)1U;
+    tmp_iv[1U] = (uint8_t)0U;
+    tmp_iv[2U] = (uint8_t)0U;
+    tmp_iv[3U] = (uint8_t)0U;
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)12U; i++)
+    {
+      tmp_iv[(uint32_t)15U - i] = iv[i];
+    }
+    return;
+  }
+  uint32_t len = iv_len / (uint32_t)16U;
+  uint32_t bytes_len = len * (uint32_t)16U;
+  uint8_t *iv_b = iv;
+  memcpy(tmp_iv, iv + bytes_len, iv_len % (uint32_t)16U * sizeof (iv[0U]));
+  uint64_t
+  uu____0 = compute_iv_stdcall(iv_b, (uint64_t)iv_len, (uint64_t)len, tmp_iv, tmp_iv, hkeys_b);
+}
+#endif
+
 static EverCrypt_Error_error_code
 encrypt_aes128_gcm(
   EverCrypt_AEAD_state_s *s,
@@ -186,17 +519,12 @@ encrypt_aes128_gcm(
   }
   EverCrypt_AEAD_state_s scrut = *s;
   uint8_t *ek = scrut.ek;
-  uint8_t *scratch_b = ek + (uint32_t)304U;
+  uint8_t scratch_b[176U] = { 0U };
   uint8_t *ek1 = ek;
   uint8_t *keys_b = ek1;
   uint8_t *hkeys_b = ek1 + (uint32_t)176U;
   uint8_t tmp_iv[16U] = { 0U };
-  uint32_t len = iv_len / (uint32_t)16U;
-  uint32_t bytes_len = len * (uint32_t)16U;
-  uint8_t *iv_b = iv;
-  memcpy(tmp_iv, iv + bytes_len, iv_len % (uint32_t)16U * sizeof (iv[0U]));
-  uint64_t
-  uu____0 = compute_iv_stdcall(iv_b, (uint64_t)iv_len, (uint64_t)len, tmp_iv, tmp_iv, hkeys_b);
+  vale_iv(iv, iv_len, hkeys_b, tmp_iv);
   uint8_t *inout_b = scratch_b;
   uint8_t *abytes_b = scratch_b + (uint32_t)16U;
   uint8_t *scratch_b1 = scratch_b + (uint32_t)32U;
@@ -308,17 +636,12 @@ encrypt_aes256_gcm(
   }
   EverCrypt_AEAD_state_s scrut = *s;
   uint8_t *ek = scrut.ek;
-  uint8_t *scratch_b = ek + (uint32_t)368U;
+  uint8_t scratch_b[176U] = { 0U };
   uint8_t *ek1 = ek;
   uint8_t *keys_b = ek1;
   uint8_t *hkeys_b = ek1 + (uint32_t)240U;
   uint8_t tmp_iv[16U] = { 0U };
-  uint32_t len = iv_len / (uint32_t)16U;
-  uint32_t bytes_len = len * (uint32_t)16U;
-  uint8_t *iv_b = iv;
-  memcpy(tmp_iv, iv + bytes_len, iv_len % (uint32_t)16U * sizeof (iv[0U]));
-  uint64_t
-  uu____0 = compute_iv_stdcall(iv_b, (uint64_t)iv_len, (uint64_t)len, tmp_iv, tmp_iv, hkeys_b);
+  vale_iv(iv, iv_len, hkeys_b, tmp_iv);
   uint8_t *inout_b = scratch_b;
   uint8_t *abytes_b = scratch_b + (uint32_t)16U;
   uint8_t *scratch_b1 = scratch_b + (uint32_t)32U;
@@ -406,73 +729,241 @@ encrypt_aes256_gcm(
   #endif
 }
 
-EverCrypt_Error_error_code
-EverCrypt_AEAD_encrypt(
-  EverCrypt_AEAD_state_s *s,
-  uint8_t *iv,
-  uint32_t iv_len,
-  uint8_t *ad,
-  uint32_t ad_len,
-  uint8_t *plain,
-  uint32_t plain_len,
-  uint8_t *cipher,
-  uint8_t *tag
-)
+/* Outside of the Vale one-shot kernels, AES-GCM runs on a streaming engine, held in the union of
+   an EverCrypt_AEAD_stream: Hacl_AES_GCM_NI, with either the round keys at the start of the Vale
+   expanded key or its own expanded key, or the portable Hacl_AES_GCM_CT. */
+static uint32_t gcm_rounds(Spec_Cipher_Expansion_impl i)
 {
-  if (s == NULL)
-  {
-    return EverCrypt_Error_InvalidKey;
-  }
-  EverCrypt_AEAD_state_s scrut = *s;
-  Spec_Cipher_Expansion_impl i = scrut.impl;
-  uint8_t *ek = scrut.ek;
   switch (i)
   {
-    case Spec_Cipher_Expansion_Vale_AES128:
-      {
-        return encrypt_aes128_gcm(s, iv, iv_len, ad, ad_len, plain, plain_len, cipher, tag);
-      }
     case Spec_Cipher_Expansion_Vale_AES256:
+    case Spec_Cipher_Expansion_Hacl_AES256:
+    case Spec_Cipher_Expansion_Hacl_AES256_NI:
       {
-        return encrypt_aes256_gcm(s, iv, iv_len, ad, ad_len, plain, plain_len, cipher, tag);
-      }
-    case Spec_Cipher_Expansion_Hacl_CHACHA20:
-      {
-        if (iv_len != (uint32_t)12U)
-        {
-          return EverCrypt_Error_InvalidIVLength;
-        }
-        EverCrypt_Chacha20Poly1305_aead_encrypt(ek, iv, ad_len, ad, plain_len, plain, cipher, tag);
-        return EverCrypt_Error_Success;
+        return (uint32_t)14U;
       }
     default:
       {
-        KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
-        KRML_HOST_EXIT(253U);
+        return (uint32_t)10U;
       }
   }
 }
 
-EverCrypt_Error_error_code
-EverCrypt_AEAD_encrypt_expand_aes128_gcm(
-  uint8_t *k,
+static bool gcm_is_ct(Spec_Cipher_Expansion_impl i)
+{
+  return i == Spec_Cipher_Expansion_Hacl_AES128 || i == Spec_Cipher_Expansion_Hacl_AES256;
+}
+
+static void
+gcm_init(
+  EverCrypt_AEAD_stream *st,
+  Spec_Cipher_Expansion_impl i,
+  uint8_t *ek,
   uint8_t *iv,
-  uint32_t iv_len,
-  uint8_t *ad,
-  uint32_t ad_len,
-  uint8_t *plain,
-  uint32_t plain_len,
-  uint8_t *cipher,
-  uint8_t *tag
+  uint32_t iv_len
 )
 {
-  bool has_pclmulqdq = EverCrypt_AutoConfig2_has_pclmulqdq();
-  bool has_avx = EverCrypt_AutoConfig2_has_avx();
-  bool has_sse = EverCrypt_AutoConfig2_has_sse();
+  if (gcm_is_ct(i))
+  {
+    Hacl_AES_GCM_CT_init(&st->u.gcm_ct, gcm_rounds(i), ek, iv, iv_len);
+  }
+  else if (i == Spec_Cipher_Expansion_Hacl_AES128_NI || i == Spec_Cipher_Expansion_Hacl_AES256_NI)
+  {
+    Hacl_AES_GCM_NI_init_expanded(&st->u.gcm, gcm_rounds(i), ek, iv, iv_len);
+  }
+  else
+  {
+    Hacl_AES_GCM_NI_init_vale(&st->u.gcm, gcm_rounds(i), ek, iv, iv_len);
+  }
+}
+
+static void
+gcm_aad(EverCrypt_AEAD_stream *st, Spec_Cipher_Expansion_impl i, uint32_t len, uint8_t *ad)
+{
+  if (gcm_is_ct(i))
+  {
+    Hacl_AES_GCM_CT_aad(&st->u.gcm_ct, len, ad);
+  }
+  else
+  {
+    Hacl_AES_GCM_NI_aad(&st->u.gcm, len, ad);
+  }
+}
+
+static void
+gcm_crypt(
+  EverCrypt_AEAD_stream *st,
+  Spec_Cipher_Expansion_impl i,
+  bool enc,
+  uint32_t len,
+  uint8_t *out,
+  uint8_t *in
+)
+{
+  if (gcm_is_ct(i))
+  {
+    if (enc)
+    {
+      Hacl_AES_GCM_CT_encrypt(&st->u.gcm_ct, len, out, in);
+    }
+    else
+    {
+      Hacl_AES_GCM_CT_decrypt(&st->u.gcm_ct, len, out, in);
+    }
+  }
+  else if (enc)
+  {
+    Hacl_AES_GCM_NI_encrypt(&st->u.gcm, len, out, in);
+  }
+  else
+  {
+    Hacl_AES_GCM_NI_decrypt(&st->u.gcm, len, out, in);
+  }
+}
+
+static uint64_t gcm_text_len(EverCrypt_AEAD_stream *st, Spec_Cipher_Expansion_impl i)
+{
+  if (gcm_is_ct(i))
+  {
+    return st->u.gcm_ct.text_len;
+  }
+  return st->u.gcm.text_len;
+}
+
+static void gcm_finish(EverCrypt_AEAD_stream *st, Spec_Cipher_Expansion_impl i, uint8_t *tag)
+{
+  if (gcm_is_ct(i))
+  {
+    Hacl_AES_GCM_CT_finish(&st->u.gcm_ct, tag);
+  }
+  else
+  {
+    Hacl_AES_GCM_NI_finish(&st->u.gcm, tag);
+  }
+}
+
+/* The one-shot entry points for the streaming engines: the whole message in a single chunk. */
+static EverCrypt_Error_error_code
+encrypt_aes_gcm_engine(
+  EverCrypt_AEAD_state_s *s,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint8_t *ad,
+  uint32_t ad_len,
+  uint8_t *plain,
+  uint32_t plain_len,
+  uint8_t *cipher,
+  uint8_t *tag
+)
+{
+  if (iv_len == (uint32_t)0U)
+  {
+    return EverCrypt_Error_InvalidIVLength;
+  }
+  EverCrypt_AEAD_state_s scrut = *s;
+  Spec_Cipher_Expansion_impl impl = scrut.impl;
+  EverCrypt_AEAD_stream st;
+  gcm_init(&st, impl, scrut.ek, iv, iv_len);
+  gcm_aad(&st, impl, ad_len, ad);
+  gcm_crypt(&st, impl, true, plain_len, cipher, plain);
+  gcm_finish(&st, impl, tag);
+  Lib_Memzero0_memzero(&st, sizeof (st));
+  return EverCrypt_Error_Success;
+}
+
+EverCrypt_Error_error_code
+EverCrypt_AEAD_encrypt(
+  EverCrypt_AEAD_state_s *s,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint8_t *ad,
+  uint32_t ad_len,
+  uint8_t *plain,
+  uint32_t plain_len,
+  uint8_t *cipher,
+  uint8_t *tag
+)
+{
+  if (s == NULL)
+  {
+    return EverCrypt_Error_InvalidKey;
+  }
+  EverCrypt_AEAD_state_s scrut = *s;
+  Spec_Cipher_Expansion_impl i = scrut.impl;
+  uint8_t *ek = scrut.ek;
+  switch (i)
+  {
+    case Spec_Cipher_Expansion_Vale_AES128:
+      {
+        return encrypt_aes128_gcm(s, iv, iv_len, ad, ad_len, plain, plain_len, cipher, tag);
+      }
+    case Spec_Cipher_Expansion_Vale_AES256:
+      {
+        return encrypt_aes256_gcm(s, iv, iv_len, ad, ad_len, plain, plain_len, cipher, tag);
+      }
+    case Spec_Cipher_Expansion_Hacl_AES128:
+    case Spec_Cipher_Expansion_Hacl_AES256:
+    case Spec_Cipher_Expansion_Hacl_AES128_NI:
+    case Spec_Cipher_Expansion_Hacl_AES256_NI:
+      {
+        return encrypt_aes_gcm_engine(s, iv, iv_len, ad, ad_len, plain, plain_len, cipher, tag);
+      }
+    case Spec_Cipher_Expansion_Hacl_CHACHA20:
+      {
+        if (iv_len != (uint32_t)12U)
+        {
+          return EverCrypt_Error_InvalidIVLength;
+        }
+        EverCrypt_Chacha20Poly1305_aead_encrypt(ek, iv, ad_len, ad, plain_len, plain, cipher, tag);
+        return EverCrypt_Error_Success;
+      }
+    case Spec_Cipher_Expansion_Hacl_XCHACHA20:
+      {
+        if (iv_len != (uint32_t)24U)
+        {
+          return EverCrypt_Error_InvalidIVLength;
+        }
+        EverCrypt_Chacha20Poly1305_xaead_encrypt(ek, iv, ad_len, ad, plain_len, plain, cipher, tag);
+        return EverCrypt_Error_Success;
+      }
+    case Spec_Cipher_Expansion_Hacl_AES256_SIV_NI:
+      {
+        if (iv_len != (uint32_t)12U)
+        {
+          return EverCrypt_Error_InvalidIVLength;
+        }
+        Hacl_AES_GCM_NI_siv_encrypt(ek, iv, ad_len, ad, plain_len, cipher, plain, tag);
+        return EverCrypt_Error_Success;
+      }
+    default:
+      {
+        KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
+        KRML_HOST_EXIT(253U);
+      }
+  }
+}
+
+EverCrypt_Error_error_code
+EverCrypt_AEAD_encrypt_expand_aes128_gcm(
+  uint8_t *k,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint8_t *ad,
+  uint32_t ad_len,
+  uint8_t *plain,
+  uint32_t plain_len,
+  uint8_t *cipher,
+  uint8_t *tag
+)
+{
+  bool has_pclmulqdq = EverCrypt_AutoConfig2_has_pclmulqdq();
+  bool has_avx = EverCrypt_AutoConfig2_has_avx();
+  bool has_sse = EverCrypt_AutoConfig2_has_sse();
   bool has_movbe = EverCrypt_AutoConfig2_has_movbe();
   bool has_aesni = EverCrypt_AutoConfig2_has_aesni();
+  bool vale = EverCrypt_AutoConfig2_wants_vale();
   #if EVERCRYPT_TARGETCONFIG_X64
-  if (has_aesni && has_pclmulqdq && has_avx && has_sse && has_movbe)
+  if (has_aesni && has_pclmulqdq && has_avx && has_sse && has_movbe && vale)
   {
     uint8_t ek[480U] = { 0U };
     uint8_t *keys_b0 = ek;
@@ -499,12 +990,7 @@ EverCrypt_AEAD_encrypt_expand_aes128_gcm(
       uint8_t *keys_b = ek1;
       uint8_t *hkeys_b = ek1 + (uint32_t)176U;
       uint8_t tmp_iv[16U] = { 0U };
-      uint32_t len = iv_len / (uint32_t)16U;
-      uint32_t bytes_len = len * (uint32_t)16U;
-      uint8_t *iv_b = iv;
-      memcpy(tmp_iv, iv + bytes_len, iv_len % (uint32_t)16U * sizeof (iv[0U]));
-      uint64_t
-      uu____0 = compute_iv_stdcall(iv_b, (uint64_t)iv_len, (uint64_t)len, tmp_iv, tmp_iv, hkeys_b);
+      vale_iv(iv, iv_len, hkeys_b, tmp_iv);
       uint8_t *inout_b = scratch_b;
       uint8_t *abytes_b = scratch_b + (uint32_t)16U;
       uint8_t *scratch_b1 = scratch_b + (uint32_t)32U;
@@ -589,7 +1075,19 @@ EverCrypt_AEAD_encrypt_expand_aes128_gcm(
     return EverCrypt_Error_Success;
   }
   #endif
-  return EverCrypt_Error_UnsupportedAlgorithm;
+  #if EVERCRYPT_TARGETCONFIG_X64 || EVERCRYPT_TARGETCONFIG_X86
+  if (has_aesni && has_pclmulqdq && has_sse)
+  {
+    uint8_t ek[304U] = { 0U };
+    Hacl_AES_GCM_NI_key_expansion((uint32_t)10U, k, ek);
+    EverCrypt_AEAD_state_s p = { .impl = Spec_Cipher_Expansion_Hacl_AES128_NI, .ek = ek };
+    return encrypt_aes_gcm_engine(&p, iv, iv_len, ad, ad_len, plain, plain_len, cipher, tag);
+  }
+  #endif
+  uint8_t ek[176U] = { 0U };
+  Hacl_AES_GCM_CT_key_expansion((uint32_t)10U, k, ek);
+  EverCrypt_AEAD_state_s p = { .impl = Spec_Cipher_Expansion_Hacl_AES128, .ek = ek };
+  return encrypt_aes_gcm_engine(&p, iv, iv_len, ad, ad_len, plain, plain_len, cipher, tag);
 }
 
 EverCrypt_Error_error_code
@@ -610,8 +1108,9 @@ EverCrypt_AEAD_encrypt_expand_aes256_gcm(
   bool has_sse = EverCrypt_AutoConfig2_has_sse();
   bool has_movbe = EverCrypt_AutoConfig2_has_movbe();
   bool has_aesni = EverCrypt_AutoConfig2_has_aesni();
+  bool vale = EverCrypt_AutoConfig2_wants_vale();
   #if EVERCRYPT_TARGETCONFIG_X64
-  if (has_aesni && has_pclmulqdq && has_avx && has_sse && has_movbe)
+  if (has_aesni && has_pclmulqdq && has_avx && has_sse && has_movbe && vale)
   {
     uint8_t ek[544U] = { 0U };
     uint8_t *keys_b0 = ek;
@@ -638,12 +1137,7 @@ EverCrypt_AEAD_encrypt_expand_aes256_gcm(
       uint8_t *keys_b = ek1;
       uint8_t *hkeys_b = ek1 + (uint32_t)240U;
       uint8_t tmp_iv[16U] = { 0U };
-      uint32_t len = iv_len / (uint32_t)16U;
-      uint32_t bytes_len = len * (uint32_t)16U;
-      uint8_t *iv_b = iv;
-      memcpy(tmp_iv, iv + bytes_len, iv_len % (uint32_t)16U * sizeof (iv[0U]));
-      uint64_t
-      uu____0 = compute_iv_stdcall(iv_b, (uint64_t)iv_len, (uint64_t)len, tmp_iv, tmp_iv, hkeys_b);
+      vale_iv(iv, iv_len, hkeys_b, tmp_iv);
       uint8_t *inout_b = scratch_b;
       uint8_t *abytes_b = scratch_b + (uint32_t)16U;
       uint8_t *scratch_b1 = scratch_b + (uint32_t)32U;
@@ -728,7 +1222,19 @@ EverCrypt_AEAD_encrypt_expand_aes256_gcm(
     return EverCrypt_Error_Success;
   }
   #endif
-  return EverCrypt_Error_UnsupportedAlgorithm;
+  #if EVERCRYPT_TARGETCONFIG_X64 || EVERCRYPT_TARGETCONFIG_X86
+  if (has_aesni && has_pclmulqdq && has_sse)
+  {
+    uint8_t ek[368U] = { 0U };
+    Hacl_AES_GCM_NI_key_expansion((uint32_t)14U, k, ek);
+    EverCrypt_AEAD_state_s p = { .impl = Spec_Cipher_Expansion_Hacl_AES256_NI, .ek = ek };
+    return encrypt_aes_gcm_engine(&p, iv, iv_len, ad, ad_len, plain, plain_len, cipher, tag);
+  }
+  #endif
+  uint8_t ek[240U] = { 0U };
+  Hacl_AES_GCM_CT_key_expansion((uint32_t)14U, k, ek);
+  EverCrypt_AEAD_state_s p = { .impl = Spec_Cipher_Expansion_Hacl_AES256, .ek = ek };
+  return encrypt_aes_gcm_engine(&p, iv, iv_len, ad, ad_len, plain, plain_len, cipher, tag);
 }
 
 EverCrypt_Error_error_code
@@ -754,6 +1260,59 @@ EverCrypt_AEAD_encrypt_expand_chacha20_poly1305(
   return EverCrypt_Error_Success;
 }
 
+EverCrypt_Error_error_code
+EverCrypt_AEAD_encrypt_expand_xchacha20_poly1305(
+  uint8_t *k,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint8_t *ad,
+  uint32_t ad_len,
+  uint8_t *plain,
+  uint32_t plain_len,
+  uint8_t *cipher,
+  uint8_t *tag
+)
+{
+  if (iv_len != (uint32_t)24U)
+  {
+    return EverCrypt_Error_InvalidIVLength;
+  }
+  EverCrypt_Chacha20Poly1305_xaead_encrypt(k, iv, ad_len, ad, plain_len, plain, cipher, tag);
+  return EverCrypt_Error_Success;
+}
+
+EverCrypt_Error_error_code
+EverCrypt_AEAD_encrypt_expand_aes256_gcm_siv(
+  uint8_t *k,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint8_t *ad,
+  uint32_t ad_len,
+  uint8_t *plain,
+  uint32_t plain_len,
+  uint8_t *cipher,
+  uint8_t *tag
+)
+{
+  bool has_aesni = EverCrypt_AutoConfig2_has_aesni();
+  bool has_pclmulqdq = EverCrypt_AutoConfig2_has_pclmulqdq();
+  bool has_sse = EverCrypt_AutoConfig2_has_sse();
+  #if EVERCRYPT_TARGETCONFIG_X64 || EVERCRYPT_TARGETCONFIG_X86
+  if (has_aesni && has_pclmulqdq && has_sse)
+  {
+    if (iv_len != (uint32_t)12U)
+    {
+      return EverCrypt_Error_InvalidIVLength;
+    }
+    uint8_t ek[240U] = { 0U };
+    Hacl_AES_GCM_NI_siv_key_expansion(k, ek);
+    Hacl_AES_GCM_NI_siv_encrypt(ek, iv, ad_len, ad, plain_len, cipher, plain, tag);
+    return EverCrypt_Error_Success;
+  }
+  #endif
+  return EverCrypt_Error_UnsupportedAlgorithm;
+}
+
 EverCrypt_Error_error_code
 EverCrypt_AEAD_encrypt_expand(
   Spec_Agile_AEAD_alg a,
@@ -809,6 +1368,32 @@ EverCrypt_AEAD_encrypt_expand(
             cipher,
             tag);
       }
+    case Spec_Agile_AEAD_XCHACHA20_POLY1305:
+      {
+        return
+          EverCrypt_AEAD_encrypt_expand_xchacha20_poly1305(k,
+            iv,
+            iv_len,
+            ad,
+            ad_len,
+            plain,
+            plain_len,
+            cipher,
+            tag);
+      }
+    case Spec_Agile_AEAD_AES256_GCM_SIV:
+      {
+        return
+          EverCrypt_AEAD_encrypt_expand_aes256_gcm_siv(k,
+            iv,
+            iv_len,
+            ad,
+            ad_len,
+            plain,
+            plain_len,
+            cipher,
+            tag);
+      }
     default:
       {
         KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
@@ -817,41 +1402,233 @@ EverCrypt_AEAD_encrypt_expand(
   }
 }
 
+static uint64_t iov_length(uint32_t cnt, EverCrypt_Helpers_iovec *v)
+{
+  uint64_t len = (uint64_t)0U;
+  for (uint32_t i = (uint32_t)0U; i < cnt; i++)
+  {
+    len = len + (uint64_t)v[i].len;
+  }
+  return len;
+}
+
+/* Runs the bytes of in through st, in chunks that fit both the current input and output
+   segments. The caller has checked that both lists have the same total length. */
+static void
+gcm_iov(
+  EverCrypt_AEAD_stream *st,
+  Spec_Cipher_Expansion_impl impl,
+  bool enc,
+  uint32_t out_cnt,
+  EverCrypt_Helpers_iovec *out,
+  uint32_t in_cnt,
+  EverCrypt_Helpers_iovec *in
+)
+{
+  uint32_t i = (uint32_t)0U;
+  uint32_t j = (uint32_t)0U;
+  uint32_t in_off = (uint32_t)0U;
+  uint32_t out_off = (uint32_t)0U;
+  while (i < in_cnt && j < out_cnt)
+  {
+    uint32_t len = in[i].len - in_off;
+    if (out[j].len - out_off < len)
+    {
+      len = out[j].len - out_off;
+    }
+    gcm_crypt(st, impl, enc, len, out[j].base + out_off, in[i].base + in_off);
+    in_off = in_off + len;
+    out_off = out_off + len;
+    if (in_off == in[i].len)
+    {
+      i++;
+      in_off = (uint32_t)0U;
+    }
+    if (out_off == out[j].len)
+    {
+      j++;
+      out_off = (uint32_t)0U;
+    }
+  }
+}
+
+/* The Vale AES-GCM kernels only take contiguous buffers, so scattered messages go through
+   the streaming engine instead, with the same keys. */
 static EverCrypt_Error_error_code
-decrypt_aes128_gcm(
+crypt_iov_aes_gcm(
   EverCrypt_AEAD_state_s *s,
+  bool enc,
   uint8_t *iv,
   uint32_t iv_len,
-  uint8_t *ad,
-  uint32_t ad_len,
-  uint8_t *cipher,
-  uint32_t cipher_len,
-  uint8_t *tag,
-  uint8_t *dst
+  uint32_t ad_cnt,
+  EverCrypt_Helpers_iovec *ad,
+  uint32_t in_cnt,
+  EverCrypt_Helpers_iovec *in,
+  uint32_t out_cnt,
+  EverCrypt_Helpers_iovec *out,
+  uint8_t *tag
 )
 {
-  #if EVERCRYPT_TARGETCONFIG_X64
-  if (s == NULL)
-  {
-    return EverCrypt_Error_InvalidKey;
-  }
   if (iv_len == (uint32_t)0U)
   {
     return EverCrypt_Error_InvalidIVLength;
   }
   EverCrypt_AEAD_state_s scrut = *s;
-  uint8_t *ek = scrut.ek;
-  uint8_t *scratch_b = ek + (uint32_t)304U;
-  uint8_t *ek1 = ek;
-  uint8_t *keys_b = ek1;
-  uint8_t *hkeys_b = ek1 + (uint32_t)176U;
-  uint8_t tmp_iv[16U] = { 0U };
-  uint32_t len = iv_len / (uint32_t)16U;
-  uint32_t bytes_len = len * (uint32_t)16U;
-  uint8_t *iv_b = iv;
-  memcpy(tmp_iv, iv + bytes_len, iv_len % (uint32_t)16U * sizeof (iv[0U]));
-  uint64_t
-  uu____0 = compute_iv_stdcall(iv_b, (uint64_t)iv_len, (uint64_t)len, tmp_iv, tmp_iv, hkeys_b);
+  Spec_Cipher_Expansion_impl impl = scrut.impl;
+  EverCrypt_AEAD_stream st;
+  gcm_init(&st, impl, scrut.ek, iv, iv_len);
+  for (uint32_t i = (uint32_t)0U; i < ad_cnt; i++)
+  {
+    gcm_aad(&st, impl, ad[i].len, ad[i].base);
+  }
+  gcm_iov(&st, impl, enc, out_cnt, out, in_cnt, in);
+  gcm_finish(&st, impl, tag);
+  Lib_Memzero0_memzero(&st, sizeof (st));
+  return EverCrypt_Error_Success;
+}
+
+EverCrypt_Error_error_code
+EverCrypt_AEAD_encrypt_iov(
+  EverCrypt_AEAD_state_s *s,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint32_t ad_cnt,
+  EverCrypt_Helpers_iovec *ad,
+  uint32_t plain_cnt,
+  EverCrypt_Helpers_iovec *plain,
+  uint32_t cipher_cnt,
+  EverCrypt_Helpers_iovec *cipher,
+  uint8_t *tag
+)
+{
+  if (s == NULL)
+  {
+    return EverCrypt_Error_InvalidKey;
+  }
+  if (iov_length(plain_cnt, plain) != iov_length(cipher_cnt, cipher))
+  {
+    return EverCrypt_Error_DecodeError;
+  }
+  EverCrypt_AEAD_state_s scrut = *s;
+  Spec_Cipher_Expansion_impl i = scrut.impl;
+  uint8_t *ek = scrut.ek;
+  switch (i)
+  {
+    case Spec_Cipher_Expansion_Vale_AES128:
+      {
+        return
+          crypt_iov_aes_gcm(s,
+            true,
+            iv,
+            iv_len,
+            ad_cnt,
+            ad,
+            plain_cnt,
+            plain,
+            cipher_cnt,
+            cipher,
+            tag);
+      }
+    case Spec_Cipher_Expansion_Vale_AES256:
+    case Spec_Cipher_Expansion_Hacl_AES128:
+    case Spec_Cipher_Expansion_Hacl_AES256:
+    case Spec_Cipher_Expansion_Hacl_AES128_NI:
+    case Spec_Cipher_Expansion_Hacl_AES256_NI:
+      {
+        return
+          crypt_iov_aes_gcm(s,
+            true,
+            iv,
+            iv_len,
+            ad_cnt,
+            ad,
+            plain_cnt,
+            plain,
+            cipher_cnt,
+            cipher,
+            tag);
+      }
+    case Spec_Cipher_Expansion_Hacl_CHACHA20:
+      {
+        if (iv_len != (uint32_t)12U)
+        {
+          return EverCrypt_Error_InvalidIVLength;
+        }
+        EverCrypt_Chacha20Poly1305_aead_encrypt_iov(ek,
+          iv,
+          ad_cnt,
+          ad,
+          plain_cnt,
+          plain,
+          cipher_cnt,
+          cipher,
+          tag);
+        return EverCrypt_Error_Success;
+      }
+    case Spec_Cipher_Expansion_Hacl_XCHACHA20:
+      {
+        if (iv_len != (uint32_t)24U)
+        {
+          return EverCrypt_Error_InvalidIVLength;
+        }
+        uint8_t k1[32U] = { 0U };
+        uint8_t n1[12U] = { 0U };
+        EverCrypt_Chacha20Poly1305_xchacha20_derive(k1, n1, ek, iv);
+        EverCrypt_Chacha20Poly1305_aead_encrypt_iov(k1,
+          n1,
+          ad_cnt,
+          ad,
+          plain_cnt,
+          plain,
+          cipher_cnt,
+          cipher,
+          tag);
+        Lib_Memzero0_memzero(k1, (uint32_t)32U * sizeof (k1[0U]));
+        return EverCrypt_Error_Success;
+      }
+    case Spec_Cipher_Expansion_Hacl_AES256_SIV_NI:
+      {
+        /* The tag is computed over the whole plaintext before any of it is encrypted. */
+        return EverCrypt_Error_UnsupportedAlgorithm;
+      }
+    default:
+      {
+        KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
+        KRML_HOST_EXIT(253U);
+      }
+  }
+}
+
+static EverCrypt_Error_error_code
+decrypt_aes128_gcm(
+  EverCrypt_AEAD_state_s *s,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint8_t *ad,
+  uint32_t ad_len,
+  uint8_t *cipher,
+  uint32_t cipher_len,
+  uint8_t *tag,
+  uint8_t *dst
+)
+{
+  #if EVERCRYPT_TARGETCONFIG_X64
+  if (s == NULL)
+  {
+    return EverCrypt_Error_InvalidKey;
+  }
+  if (iv_len == (uint32_t)0U)
+  {
+    return EverCrypt_Error_InvalidIVLength;
+  }
+  EverCrypt_AEAD_state_s scrut = *s;
+  uint8_t *ek = scrut.ek;
+  uint8_t scratch_b[176U] = { 0U };
+  uint8_t *ek1 = ek;
+  uint8_t *keys_b = ek1;
+  uint8_t *hkeys_b = ek1 + (uint32_t)176U;
+  uint8_t tmp_iv[16U] = { 0U };
+  vale_iv(iv, iv_len, hkeys_b, tmp_iv);
   uint8_t *inout_b = scratch_b;
   uint8_t *abytes_b = scratch_b + (uint32_t)16U;
   uint8_t *scratch_b1 = scratch_b + (uint32_t)32U;
@@ -973,17 +1750,12 @@ decrypt_aes256_gcm(
   }
   EverCrypt_AEAD_state_s scrut = *s;
   uint8_t *ek = scrut.ek;
-  uint8_t *scratch_b = ek + (uint32_t)368U;
+  uint8_t scratch_b[176U] = { 0U };
   uint8_t *ek1 = ek;
   uint8_t *keys_b = ek1;
   uint8_t *hkeys_b = ek1 + (uint32_t)240U;
   uint8_t tmp_iv[16U] = { 0U };
-  uint32_t len = iv_len / (uint32_t)16U;
-  uint32_t bytes_len = len * (uint32_t)16U;
-  uint8_t *iv_b = iv;
-  memcpy(tmp_iv, iv + bytes_len, iv_len % (uint32_t)16U * sizeof (iv[0U]));
-  uint64_t
-  uu____0 = compute_iv_stdcall(iv_b, (uint64_t)iv_len, (uint64_t)len, tmp_iv, tmp_iv, hkeys_b);
+  vale_iv(iv, iv_len, hkeys_b, tmp_iv);
   uint8_t *inout_b = scratch_b;
   uint8_t *abytes_b = scratch_b + (uint32_t)16U;
   uint8_t *scratch_b1 = scratch_b + (uint32_t)32U;
@@ -1113,6 +1885,110 @@ decrypt_chacha20_poly1305(
   return EverCrypt_Error_AuthenticationFailure;
 }
 
+static EverCrypt_Error_error_code
+decrypt_xchacha20_poly1305(
+  EverCrypt_AEAD_state_s *s,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint8_t *ad,
+  uint32_t ad_len,
+  uint8_t *cipher,
+  uint32_t cipher_len,
+  uint8_t *tag,
+  uint8_t *dst
+)
+{
+  if (s == NULL)
+  {
+    return EverCrypt_Error_InvalidKey;
+  }
+  if (iv_len != (uint32_t)24U)
+  {
+    return EverCrypt_Error_InvalidIVLength;
+  }
+  EverCrypt_AEAD_state_s scrut = *s;
+  uint8_t *ek = scrut.ek;
+  uint32_t
+  r = EverCrypt_Chacha20Poly1305_xaead_decrypt(ek, iv, ad_len, ad, cipher_len, dst, cipher, tag);
+  if (r == (uint32_t)0U)
+  {
+    return EverCrypt_Error_Success;
+  }
+  return EverCrypt_Error_AuthenticationFailure;
+}
+
+static EverCrypt_Error_error_code
+decrypt_aes256_gcm_siv(
+  EverCrypt_AEAD_state_s *s,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint8_t *ad,
+  uint32_t ad_len,
+  uint8_t *cipher,
+  uint32_t cipher_len,
+  uint8_t *tag,
+  uint8_t *dst
+)
+{
+  if (s == NULL)
+  {
+    return EverCrypt_Error_InvalidKey;
+  }
+  if (iv_len != (uint32_t)12U)
+  {
+    return EverCrypt_Error_InvalidIVLength;
+  }
+  EverCrypt_AEAD_state_s scrut = *s;
+  uint8_t *ek = scrut.ek;
+  uint32_t r = Hacl_AES_GCM_NI_siv_decrypt(ek, iv, ad_len, ad, cipher_len, dst, cipher, tag);
+  if (r == (uint32_t)0U)
+  {
+    return EverCrypt_Error_Success;
+  }
+  return EverCrypt_Error_AuthenticationFailure;
+}
+
+/* Decrypts into dst before checking the tag, and wipes dst if it does not match. */
+static EverCrypt_Error_error_code
+decrypt_aes_gcm_engine(
+  EverCrypt_AEAD_state_s *s,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint8_t *ad,
+  uint32_t ad_len,
+  uint8_t *cipher,
+  uint32_t cipher_len,
+  uint8_t *tag,
+  uint8_t *dst
+)
+{
+  if (iv_len == (uint32_t)0U)
+  {
+    return EverCrypt_Error_InvalidIVLength;
+  }
+  EverCrypt_AEAD_state_s scrut = *s;
+  Spec_Cipher_Expansion_impl impl = scrut.impl;
+  uint8_t computed_tag[16U] = { 0U };
+  EverCrypt_AEAD_stream st;
+  gcm_init(&st, impl, scrut.ek, iv, iv_len);
+  gcm_aad(&st, impl, ad_len, ad);
+  gcm_crypt(&st, impl, false, cipher_len, dst, cipher);
+  gcm_finish(&st, impl, computed_tag);
+  Lib_Memzero0_memzero(&st, sizeof (st));
+  uint8_t res = (uint8_t)255U;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+  {
+    uint8_t uu____0 = FStar_UInt8_eq_mask(computed_tag[i], tag[i]);
+    res = uu____0 & res;
+  }
+  if (res == (uint8_t)255U)
+  {
+    return EverCrypt_Error_Success;
+  }
+  Lib_Memzero0_memzero(dst, cipher_len);
+  return EverCrypt_Error_AuthenticationFailure;
+}
+
 EverCrypt_Error_error_code
 EverCrypt_AEAD_decrypt(
   EverCrypt_AEAD_state_s *s,
@@ -1142,10 +2018,25 @@ EverCrypt_AEAD_decrypt(
       {
         return decrypt_aes256_gcm(s, iv, iv_len, ad, ad_len, cipher, cipher_len, tag, dst);
       }
+    case Spec_Cipher_Expansion_Hacl_AES128:
+    case Spec_Cipher_Expansion_Hacl_AES256:
+    case Spec_Cipher_Expansion_Hacl_AES128_NI:
+    case Spec_Cipher_Expansion_Hacl_AES256_NI:
+      {
+        return decrypt_aes_gcm_engine(s, iv, iv_len, ad, ad_len, cipher, cipher_len, tag, dst);
+      }
     case Spec_Cipher_Expansion_Hacl_CHACHA20:
       {
         return decrypt_chacha20_poly1305(s, iv, iv_len, ad, ad_len, cipher, cipher_len, tag, dst);
       }
+    case Spec_Cipher_Expansion_Hacl_XCHACHA20:
+      {
+        return decrypt_xchacha20_poly1305(s, iv, iv_len, ad, ad_len, cipher, cipher_len, tag, dst);
+      }
+    case Spec_Cipher_Expansion_Hacl_AES256_SIV_NI:
+      {
+        return decrypt_aes256_gcm_siv(s, iv, iv_len, ad, ad_len, cipher, cipher_len, tag, dst);
+      }
     default:
       {
         KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
@@ -1172,8 +2063,9 @@ EverCrypt_AEAD_decrypt_expand_aes128_gcm(
   bool has_sse = EverCrypt_AutoConfig2_has_sse();
   bool has_movbe = EverCrypt_AutoConfig2_has_movbe();
   bool has_aesni = EverCrypt_AutoConfig2_has_aesni();
+  bool vale = EverCrypt_AutoConfig2_wants_vale();
   #if EVERCRYPT_TARGETCONFIG_X64
-  if (has_aesni && has_pclmulqdq && has_avx && has_sse && has_movbe)
+  if (has_aesni && has_pclmulqdq && has_avx && has_sse && has_movbe && vale)
   {
     uint8_t ek[480U] = { 0U };
     uint8_t *keys_b0 = ek;
@@ -1199,12 +2091,7 @@ EverCrypt_AEAD_decrypt_expand_aes128_gcm(
       uint8_t *keys_b = ek1;
       uint8_t *hkeys_b = ek1 + (uint32_t)176U;
       uint8_t tmp_iv[16U] = { 0U };
-      uint32_t len = iv_len / (uint32_t)16U;
-      uint32_t bytes_len = len * (uint32_t)16U;
-      uint8_t *iv_b = iv;
-      memcpy(tmp_iv, iv + bytes_len, iv_len % (uint32_t)16U * sizeof (iv[0U]));
-      uint64_t
-      uu____0 = compute_iv_stdcall(iv_b, (uint64_t)iv_len, (uint64_t)len, tmp_iv, tmp_iv, hkeys_b);
+      vale_iv(iv, iv_len, hkeys_b, tmp_iv);
       uint8_t *inout_b = scratch_b;
       uint8_t *abytes_b = scratch_b + (uint32_t)16U;
       uint8_t *scratch_b1 = scratch_b + (uint32_t)32U;
@@ -1301,7 +2188,19 @@ EverCrypt_AEAD_decrypt_expand_aes128_gcm(
     }
   }
   #endif
-  return EverCrypt_Error_UnsupportedAlgorithm;
+  #if EVERCRYPT_TARGETCONFIG_X64 || EVERCRYPT_TARGETCONFIG_X86
+  if (has_aesni && has_pclmulqdq && has_sse)
+  {
+    uint8_t ek[304U] = { 0U };
+    Hacl_AES_GCM_NI_key_expansion((uint32_t)10U, k, ek);
+    EverCrypt_AEAD_state_s p = { .impl = Spec_Cipher_Expansion_Hacl_AES128_NI, .ek = ek };
+    return decrypt_aes_gcm_engine(&p, iv, iv_len, ad, ad_len, cipher, cipher_len, tag, dst);
+  }
+  #endif
+  uint8_t ek[176U] = { 0U };
+  Hacl_AES_GCM_CT_key_expansion((uint32_t)10U, k, ek);
+  EverCrypt_AEAD_state_s p = { .impl = Spec_Cipher_Expansion_Hacl_AES128, .ek = ek };
+  return decrypt_aes_gcm_engine(&p, iv, iv_len, ad, ad_len, cipher, cipher_len, tag, dst);
 }
 
 EverCrypt_Error_error_code
@@ -1322,8 +2221,9 @@ EverCrypt_AEAD_decrypt_expand_aes256_gcm(
   bool has_sse = EverCrypt_AutoConfig2_has_sse();
   bool has_movbe = EverCrypt_AutoConfig2_has_movbe();
   bool has_aesni = EverCrypt_AutoConfig2_has_aesni();
+  bool vale = EverCrypt_AutoConfig2_wants_vale();
   #if EVERCRYPT_TARGETCONFIG_X64
-  if (has_aesni && has_pclmulqdq && has_avx && has_sse && has_movbe)
+  if (has_aesni && has_pclmulqdq && has_avx && has_sse && has_movbe && vale)
   {
     uint8_t ek[544U] = { 0U };
     uint8_t *keys_b0 = ek;
@@ -1349,12 +2249,7 @@ EverCrypt_AEAD_decrypt_expand_aes256_gcm(
       uint8_t *keys_b = ek1;
       uint8_t *hkeys_b = ek1 + (uint32_t)240U;
       uint8_t tmp_iv[16U] = { 0U };
-      uint32_t len = iv_len / (uint32_t)16U;
-      uint32_t bytes_len = len * (uint32_t)16U;
-      uint8_t *iv_b = iv;
-      memcpy(tmp_iv, iv + bytes_len, iv_len % (uint32_t)16U * sizeof (iv[0U]));
-      uint64_t
-      uu____0 = compute_iv_stdcall(iv_b, (uint64_t)iv_len, (uint64_t)len, tmp_iv, tmp_iv, hkeys_b);
+      vale_iv(iv, iv_len, hkeys_b, tmp_iv);
       uint8_t *inout_b = scratch_b;
       uint8_t *abytes_b = scratch_b + (uint32_t)16U;
       uint8_t *scratch_b1 = scratch_b + (uint32_t)32U;
@@ -1451,7 +2346,19 @@ EverCrypt_AEAD_decrypt_expand_aes256_gcm(
     }
   }
   #endif
-  return EverCrypt_Error_UnsupportedAlgorithm;
+  #if EVERCRYPT_TARGETCONFIG_X64 || EVERCRYPT_TARGETCONFIG_X86
+  if (has_aesni && has_pclmulqdq && has_sse)
+  {
+    uint8_t ek[368U] = { 0U };
+    Hacl_AES_GCM_NI_key_expansion((uint32_t)14U, k, ek);
+    EverCrypt_AEAD_state_s p = { .impl = Spec_Cipher_Expansion_Hacl_AES256_NI, .ek = ek };
+    return decrypt_aes_gcm_engine(&p, iv, iv_len, ad, ad_len, cipher, cipher_len, tag, dst);
+  }
+  #endif
+  uint8_t ek[240U] = { 0U };
+  Hacl_AES_GCM_CT_key_expansion((uint32_t)14U, k, ek);
+  EverCrypt_AEAD_state_s p = { .impl = Spec_Cipher_Expansion_Hacl_AES256, .ek = ek };
+  return decrypt_aes_gcm_engine(&p, iv, iv_len, ad, ad_len, cipher, cipher_len, tag, dst);
 }
 
 EverCrypt_Error_error_code
@@ -1476,6 +2383,59 @@ EverCrypt_AEAD_decrypt_expand_chacha20_poly1305(
   return r;
 }
 
+EverCrypt_Error_error_code
+EverCrypt_AEAD_decrypt_expand_xchacha20_poly1305(
+  uint8_t *k,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint8_t *ad,
+  uint32_t ad_len,
+  uint8_t *cipher,
+  uint32_t cipher_len,
+  uint8_t *tag,
+  uint8_t *dst
+)
+{
+  uint8_t ek[32U] = { 0U };
+  EverCrypt_AEAD_state_s p = { .impl = Spec_Cipher_Expansion_Hacl_XCHACHA20, .ek = ek };
+  memcpy(ek, k, (uint32_t)32U * sizeof (k[0U]));
+  EverCrypt_AEAD_state_s *s = &p;
+  EverCrypt_Error_error_code
+  r = decrypt_xchacha20_poly1305(s, iv, iv_len, ad, ad_len, cipher, cipher_len, tag, dst);
+  return r;
+}
+
+EverCrypt_Error_error_code
+EverCrypt_AEAD_decrypt_expand_aes256_gcm_siv(
+  uint8_t *k,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint8_t *ad,
+  uint32_t ad_len,
+  uint8_t *cipher,
+  uint32_t cipher_len,
+  uint8_t *tag,
+  uint8_t *dst
+)
+{
+  bool has_aesni = EverCrypt_AutoConfig2_has_aesni();
+  bool has_pclmulqdq = EverCrypt_AutoConfig2_has_pclmulqdq();
+  bool has_sse = EverCrypt_AutoConfig2_has_sse();
+  #if EVERCRYPT_TARGETCONFIG_X64 || EVERCRYPT_TARGETCONFIG_X86
+  if (has_aesni && has_pclmulqdq && has_sse)
+  {
+    uint8_t ek[240U] = { 0U };
+    Hacl_AES_GCM_NI_siv_key_expansion(k, ek);
+    EverCrypt_AEAD_state_s p = { .impl = Spec_Cipher_Expansion_Hacl_AES256_SIV_NI, .ek = ek };
+    EverCrypt_AEAD_state_s *s = &p;
+    EverCrypt_Error_error_code
+    r = decrypt_aes256_gcm_siv(s, iv, iv_len, ad, ad_len, cipher, cipher_len, tag, dst);
+    return r;
+  }
+  #endif
+  return EverCrypt_Error_UnsupportedAlgorithm;
+}
+
 EverCrypt_Error_error_code
 EverCrypt_AEAD_decrypt_expand(
   Spec_Agile_AEAD_alg a,
@@ -1531,12 +2491,700 @@ EverCrypt_AEAD_decrypt_expand(
             tag,
             dst);
       }
-    default:
+    case Spec_Agile_AEAD_XCHACHA20_POLY1305:
       {
-        KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
-        KRML_HOST_EXIT(253U);
-      }
-  }
+        return
+          EverCrypt_AEAD_decrypt_expand_xchacha20_poly1305(k,
+            iv,
+            iv_len,
+            ad,
+            ad_len,
+            cipher,
+            cipher_len,
+            tag,
+            dst);
+      }
+    case Spec_Agile_AEAD_AES256_GCM_SIV:
+      {
+        return
+          EverCrypt_AEAD_decrypt_expand_aes256_gcm_siv(k,
+            iv,
+            iv_len,
+            ad,
+            ad_len,
+            cipher,
+            cipher_len,
+            tag,
+            dst);
+      }
+    default:
+      {
+        KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
+        KRML_HOST_EXIT(253U);
+      }
+  }
+}
+
+EverCrypt_Error_error_code
+EverCrypt_AEAD_decrypt_iov(
+  EverCrypt_AEAD_state_s *s,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint32_t ad_cnt,
+  EverCrypt_Helpers_iovec *ad,
+  uint32_t cipher_cnt,
+  EverCrypt_Helpers_iovec *cipher,
+  uint8_t *tag,
+  uint32_t dst_cnt,
+  EverCrypt_Helpers_iovec *dst
+)
+{
+  if (s == NULL)
+  {
+    return EverCrypt_Error_InvalidKey;
+  }
+  if (iov_length(cipher_cnt, cipher) != iov_length(dst_cnt, dst))
+  {
+    return EverCrypt_Error_DecodeError;
+  }
+  EverCrypt_AEAD_state_s scrut = *s;
+  Spec_Cipher_Expansion_impl i = scrut.impl;
+  uint8_t *ek = scrut.ek;
+  if (i == Spec_Cipher_Expansion_Hacl_CHACHA20)
+  {
+    if (iv_len != (uint32_t)12U)
+    {
+      return EverCrypt_Error_InvalidIVLength;
+    }
+    uint32_t
+    r =
+      EverCrypt_Chacha20Poly1305_aead_decrypt_iov(ek,
+        iv,
+        ad_cnt,
+        ad,
+        dst_cnt,
+        dst,
+        cipher_cnt,
+        cipher,
+        tag);
+    if (r == (uint32_t)0U)
+    {
+      return EverCrypt_Error_Success;
+    }
+    return EverCrypt_Error_AuthenticationFailure;
+  }
+  if (i == Spec_Cipher_Expansion_Hacl_XCHACHA20)
+  {
+    if (iv_len != (uint32_t)24U)
+    {
+      return EverCrypt_Error_InvalidIVLength;
+    }
+    uint8_t k1[32U] = { 0U };
+    uint8_t n1[12U] = { 0U };
+    EverCrypt_Chacha20Poly1305_xchacha20_derive(k1, n1, ek, iv);
+    uint32_t
+    r =
+      EverCrypt_Chacha20Poly1305_aead_decrypt_iov(k1,
+        n1,
+        ad_cnt,
+        ad,
+        dst_cnt,
+        dst,
+        cipher_cnt,
+        cipher,
+        tag);
+    Lib_Memzero0_memzero(k1, (uint32_t)32U * sizeof (k1[0U]));
+    if (r == (uint32_t)0U)
+    {
+      return EverCrypt_Error_Success;
+    }
+    return EverCrypt_Error_AuthenticationFailure;
+  }
+  if (i == Spec_Cipher_Expansion_Hacl_AES256_SIV_NI)
+  {
+    return EverCrypt_Error_UnsupportedAlgorithm;
+  }
+  uint8_t computed_tag[16U] = { 0U };
+  EverCrypt_Error_error_code
+  r =
+    crypt_iov_aes_gcm(s,
+      false,
+      iv,
+      iv_len,
+      ad_cnt,
+      ad,
+      cipher_cnt,
+      cipher,
+      dst_cnt,
+      dst,
+      computed_tag);
+  if (r != EverCrypt_Error_Success)
+  {
+    return r;
+  }
+  uint8_t res = (uint8_t)255U;
+  for (uint32_t i0 = (uint32_t)0U; i0 < (uint32_t)16U; i0++)
+  {
+    uint8_t uu____0 = FStar_UInt8_eq_mask(computed_tag[i0], tag[i0]);
+    res = uu____0 & res;
+  }
+  if (res == (uint8_t)255U)
+  {
+    return EverCrypt_Error_Success;
+  }
+  for (uint32_t i0 = (uint32_t)0U; i0 < dst_cnt; i0++)
+  {
+    Lib_Memzero0_memzero(dst[i0].base, dst[i0].len);
+  }
+  return EverCrypt_Error_AuthenticationFailure;
+}
+
+/* The batch API gathers the AES-GCM packets under Hacl_AES_GCM_NI expanded keys, by number of
+   rounds, and hands them over to the batch kernel eight at a time. Packets under Vale expanded
+   keys are left to the Vale kernels, which are faster one at a time than the batch kernel is
+   on many. */
+typedef struct gcm_batch_s
+{
+  uint32_t nr;
+  uint32_t n;
+  uint32_t idx[8U];
+  uint8_t *rk[8U];
+  uint8_t *hk[8U];
+  uint8_t *iv[8U];
+  uint32_t ad_len[8U];
+  uint8_t *ad[8U];
+  uint32_t len[8U];
+  uint8_t *out[8U];
+  uint8_t *in[8U];
+  uint8_t *tag[8U];
+}
+gcm_batch;
+
+static bool gcm_batch_eligible(Spec_Cipher_Expansion_impl i, uint32_t iv_len)
+{
+  bool ni = i == Spec_Cipher_Expansion_Hacl_AES128_NI || i == Spec_Cipher_Expansion_Hacl_AES256_NI;
+  return ni && iv_len == (uint32_t)12U;
+}
+
+static void gcm_batch_flush(gcm_batch *b, bool enc, EverCrypt_Error_error_code *res)
+{
+  if (b->n == (uint32_t)0U)
+  {
+    return;
+  }
+  if (enc)
+  {
+    Hacl_AES_GCM_NI_encrypt_batch(b->n,
+      b->nr,
+      b->rk,
+      b->hk,
+      b->iv,
+      b->ad_len,
+      b->ad,
+      b->len,
+      b->out,
+      b->in,
+      b->tag);
+    for (uint32_t j = (uint32_t)0U; j < b->n; j++)
+    {
+      res[b->idx[j]] = EverCrypt_Error_Success;
+    }
+  }
+  else
+  {
+    uint32_t r[8U] = { 0U };
+    uint32_t
+    uu____0 =
+      Hacl_AES_GCM_NI_decrypt_batch(b->n,
+        b->nr,
+        b->rk,
+        b->hk,
+        b->iv,
+        b->ad_len,
+        b->ad,
+        b->len,
+        b->out,
+        b->in,
+        b->tag,
+        r);
+    for (uint32_t j = (uint32_t)0U; j < b->n; j++)
+    {
+      if (r[j] == (uint32_t)0U)
+      {
+        res[b->idx[j]] = EverCrypt_Error_Success;
+      }
+      else
+      {
+        res[b->idx[j]] = EverCrypt_Error_AuthenticationFailure;
+      }
+    }
+  }
+  b->n = (uint32_t)0U;
+}
+
+static void
+gcm_batch_push(
+  gcm_batch *b,
+  bool enc,
+  EverCrypt_Error_error_code *res,
+  uint32_t idx,
+  EverCrypt_AEAD_state_s *s,
+  uint8_t *iv,
+  uint32_t ad_len,
+  uint8_t *ad,
+  uint32_t len,
+  uint8_t *out,
+  uint8_t *in,
+  uint8_t *tag
+)
+{
+  uint8_t *ek = s->ek;
+  uint32_t n = b->n;
+  b->idx[n] = idx;
+  b->rk[n] = ek;
+  b->hk[n] = ek + (uint32_t)16U * (b->nr + (uint32_t)1U);
+  b->iv[n] = iv;
+  b->ad_len[n] = ad_len;
+  b->ad[n] = ad;
+  b->len[n] = len;
+  b->out[n] = out;
+  b->in[n] = in;
+  b->tag[n] = tag;
+  b->n = n + (uint32_t)1U;
+  if (b->n == (uint32_t)8U)
+  {
+    gcm_batch_flush(b, enc, res);
+  }
+}
+
+static EverCrypt_Error_error_code
+crypt_batch(
+  bool enc,
+  uint32_t num,
+  EverCrypt_AEAD_state_s **s,
+  uint8_t **iv,
+  uint32_t iv_len,
+  uint8_t **ad,
+  uint32_t *ad_len,
+  uint8_t **in,
+  uint32_t *len,
+  uint8_t **out,
+  uint8_t **tag,
+  EverCrypt_Error_error_code *res
+)
+{
+  gcm_batch b128;
+  gcm_batch b256;
+  b128.nr = (uint32_t)10U;
+  b128.n = (uint32_t)0U;
+  b256.nr = (uint32_t)14U;
+  b256.n = (uint32_t)0U;
+  for (uint32_t j = (uint32_t)0U; j < num; j++)
+  {
+    if (s[j] != NULL && gcm_batch_eligible(s[j]->impl, iv_len))
+    {
+      gcm_batch *b = &b128;
+      if (gcm_rounds(s[j]->impl) == (uint32_t)14U)
+      {
+        b = &b256;
+      }
+      gcm_batch_push(b,
+        enc,
+        res,
+        j,
+        s[j],
+        iv[j],
+        ad_len[j],
+        ad[j],
+        len[j],
+        out[j],
+        in[j],
+        tag[j]);
+    }
+    else if (enc)
+    {
+      res[j] =
+        EverCrypt_AEAD_encrypt(s[j],
+          iv[j],
+          iv_len,
+          ad[j],
+          ad_len[j],
+          in[j],
+          len[j],
+          out[j],
+          tag[j]);
+    }
+    else
+    {
+      res[j] =
+        EverCrypt_AEAD_decrypt(s[j],
+          iv[j],
+          iv_len,
+          ad[j],
+          ad_len[j],
+          in[j],
+          len[j],
+          tag[j],
+          out[j]);
+    }
+  }
+  gcm_batch_flush(&b128, enc, res);
+  gcm_batch_flush(&b256, enc, res);
+  for (uint32_t j = (uint32_t)0U; j < num; j++)
+  {
+    if (res[j] != EverCrypt_Error_Success)
+    {
+      return res[j];
+    }
+  }
+  return EverCrypt_Error_Success;
+}
+
+EverCrypt_Error_error_code
+EverCrypt_AEAD_encrypt_batch(
+  uint32_t num,
+  EverCrypt_AEAD_state_s **s,
+  uint8_t **iv,
+  uint32_t iv_len,
+  uint8_t **ad,
+  uint32_t *ad_len,
+  uint8_t **plain,
+  uint32_t *plain_len,
+  uint8_t **cipher,
+  uint8_t **tag,
+  EverCrypt_Error_error_code *res
+)
+{
+  return crypt_batch(true, num, s, iv, iv_len, ad, ad_len, plain, plain_len, cipher, tag, res);
+}
+
+EverCrypt_Error_error_code
+EverCrypt_AEAD_decrypt_batch(
+  uint32_t num,
+  EverCrypt_AEAD_state_s **s,
+  uint8_t **iv,
+  uint32_t iv_len,
+  uint8_t **ad,
+  uint32_t *ad_len,
+  uint8_t **cipher,
+  uint32_t *cipher_len,
+  uint8_t **tag,
+  uint8_t **dst,
+  EverCrypt_Error_error_code *res
+)
+{
+  return crypt_batch(false, num, s, iv, iv_len, ad, ad_len, cipher, cipher_len, dst, tag, res);
+}
+
+/* The incremental API runs on the same streaming engines as the _iov variants: the Vale
+   AES-GCM kernels are one-shot, so AES-GCM goes through gcm_init and friends. */
+static EverCrypt_Error_error_code
+stream_init(
+  EverCrypt_AEAD_stream *st,
+  bool enc,
+  EverCrypt_AEAD_state_s *s,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint8_t *ad,
+  uint32_t ad_len
+)
+{
+  if (s == NULL)
+  {
+    return EverCrypt_Error_InvalidKey;
+  }
+  EverCrypt_AEAD_state_s scrut = *s;
+  Spec_Cipher_Expansion_impl i = scrut.impl;
+  uint8_t *ek = scrut.ek;
+  switch (i)
+  {
+    case Spec_Cipher_Expansion_Vale_AES128:
+    case Spec_Cipher_Expansion_Vale_AES256:
+    case Spec_Cipher_Expansion_Hacl_AES128:
+    case Spec_Cipher_Expansion_Hacl_AES256:
+    case Spec_Cipher_Expansion_Hacl_AES128_NI:
+    case Spec_Cipher_Expansion_Hacl_AES256_NI:
+      {
+        if (iv_len == (uint32_t)0U)
+        {
+          return EverCrypt_Error_InvalidIVLength;
+        }
+        gcm_init(st, i, ek, iv, iv_len);
+        gcm_aad(st, i, ad_len, ad);
+        break;
+      }
+    case Spec_Cipher_Expansion_Hacl_CHACHA20:
+      {
+        if (iv_len != (uint32_t)12U)
+        {
+          return EverCrypt_Error_InvalidIVLength;
+        }
+        EverCrypt_Chacha20Poly1305_stream_init(&st->u.chacha, ek, iv);
+        EverCrypt_Chacha20Poly1305_stream_aad(&st->u.chacha, ad_len, ad);
+        break;
+      }
+    case Spec_Cipher_Expansion_Hacl_XCHACHA20:
+      {
+        if (iv_len != (uint32_t)24U)
+        {
+          return EverCrypt_Error_InvalidIVLength;
+        }
+        uint8_t k1[32U] = { 0U };
+        uint8_t n1[12U] = { 0U };
+        EverCrypt_Chacha20Poly1305_xchacha20_derive(k1, n1, ek, iv);
+        EverCrypt_Chacha20Poly1305_stream_init(&st->u.chacha, k1, n1);
+        EverCrypt_Chacha20Poly1305_stream_aad(&st->u.chacha, ad_len, ad);
+        Lib_Memzero0_memzero(k1, (uint32_t)32U * sizeof (k1[0U]));
+        break;
+      }
+    case Spec_Cipher_Expansion_Hacl_AES256_SIV_NI:
+      {
+        return EverCrypt_Error_UnsupportedAlgorithm;
+      }
+    default:
+      {
+        KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
+        KRML_HOST_EXIT(253U);
+      }
+  }
+  st->key = s;
+  st->active = true;
+  st->enc = enc;
+  return EverCrypt_Error_Success;
+}
+
+static EverCrypt_Error_error_code
+stream_update(EverCrypt_AEAD_stream *st, bool enc, uint8_t *in, uint32_t len, uint8_t *out)
+{
+  if (!st->active || st->enc != enc)
+  {
+    return EverCrypt_Error_DecodeError;
+  }
+  EverCrypt_AEAD_state_s scrut = *st->key;
+  if
+  (
+    scrut.impl
+    == Spec_Cipher_Expansion_Hacl_CHACHA20
+    || scrut.impl == Spec_Cipher_Expansion_Hacl_XCHACHA20
+  )
+  {
+    /* The block counter is 32 bits and block 0 keys Poly1305. */
+    if (st->u.chacha.text_len + (uint64_t)len > (uint64_t)0x3FFFFFFFC0U)
+    {
+      return EverCrypt_Error_MaximumLengthExceeded;
+    }
+    if (enc)
+    {
+      EverCrypt_Chacha20Poly1305_stream_encrypt(&st->u.chacha, len, out, in);
+    }
+    else
+    {
+      EverCrypt_Chacha20Poly1305_stream_decrypt(&st->u.chacha, len, out, in);
+    }
+    return EverCrypt_Error_Success;
+  }
+  /* NIST SP 800-38D caps the plaintext at 2^39 - 256 bits. */
+  if (gcm_text_len(st, scrut.impl) + (uint64_t)len > (uint64_t)0xFFFFFFFE0U)
+  {
+    return EverCrypt_Error_MaximumLengthExceeded;
+  }
+  gcm_crypt(st, scrut.impl, enc, len, out, in);
+  return EverCrypt_Error_Success;
+}
+
+static EverCrypt_Error_error_code
+stream_finish(EverCrypt_AEAD_stream *st, bool enc, uint8_t *tag)
+{
+  if (!st->active || st->enc != enc)
+  {
+    return EverCrypt_Error_DecodeError;
+  }
+  EverCrypt_AEAD_state_s scrut = *st->key;
+  if
+  (
+    scrut.impl
+    == Spec_Cipher_Expansion_Hacl_CHACHA20
+    || scrut.impl == Spec_Cipher_Expansion_Hacl_XCHACHA20
+  )
+  {
+    EverCrypt_Chacha20Poly1305_stream_finish(&st->u.chacha, tag);
+  }
+  else
+  {
+    gcm_finish(st, scrut.impl, tag);
+  }
+  Lib_Memzero0_memzero(st, sizeof (st[0U]));
+  return EverCrypt_Error_Success;
+}
+
+EverCrypt_Error_error_code
+EverCrypt_AEAD_encrypt_init(
+  EverCrypt_AEAD_stream *st,
+  EverCrypt_AEAD_state_s *s,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint8_t *ad,
+  uint32_t ad_len
+)
+{
+  return stream_init(st, true, s, iv, iv_len, ad, ad_len);
+}
+
+EverCrypt_Error_error_code
+EverCrypt_AEAD_encrypt_update(
+  EverCrypt_AEAD_stream *st,
+  uint8_t *plain,
+  uint32_t len,
+  uint8_t *cipher
+)
+{
+  return stream_update(st, true, plain, len, cipher);
+}
+
+EverCrypt_Error_error_code EverCrypt_AEAD_encrypt_finish(EverCrypt_AEAD_stream *st, uint8_t *tag)
+{
+  return stream_finish(st, true, tag);
+}
+
+EverCrypt_Error_error_code
+EverCrypt_AEAD_decrypt_init(
+  EverCrypt_AEAD_stream *st,
+  EverCrypt_AEAD_state_s *s,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint8_t *ad,
+  uint32_t ad_len
+)
+{
+  return stream_init(st, false, s, iv, iv_len, ad, ad_len);
+}
+
+EverCrypt_Error_error_code
+EverCrypt_AEAD_decrypt_update(
+  EverCrypt_AEAD_stream *st,
+  uint8_t *cipher,
+  uint32_t len,
+  uint8_t *dst
+)
+{
+  return stream_update(st, false, cipher, len, dst);
+}
+
+EverCrypt_Error_error_code EverCrypt_AEAD_decrypt_finish(EverCrypt_AEAD_stream *st, uint8_t *tag)
+{
+  uint8_t computed_tag[16U] = { 0U };
+  EverCrypt_Error_error_code r = stream_finish(st, false, computed_tag);
+  if (r != EverCrypt_Error_Success)
+  {
+    return r;
+  }
+  uint8_t res = (uint8_t)255U;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+  {
+    uint8_t uu____0 = FStar_UInt8_eq_mask(computed_tag[i], tag[i]);
+    res = uu____0 & res;
+  }
+  if (res == (uint8_t)255U)
+  {
+    return EverCrypt_Error_Success;
+  }
+  return EverCrypt_Error_AuthenticationFailure;
+}
+
+/* The nonce of record seq. The encrypt and decrypt functions derive the GCM counter block of
+   such a 12-byte nonce directly, without hashing it. */
+static void seq_nonce(uint8_t *nonce, uint8_t *static_iv, uint64_t seq)
+{
+  uint8_t sb[8U] = { 0U };
+  store64_be(sb, seq);
+  memcpy(nonce, static_iv, (uint32_t)4U * sizeof (static_iv[0U]));
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    nonce[(uint32_t)4U + i] = static_iv[(uint32_t)4U + i] ^ sb[i];
+  }
+}
+
+EverCrypt_Error_error_code
+EverCrypt_AEAD_seq_init(
+  EverCrypt_AEAD_seq *ctx,
+  EverCrypt_AEAD_state_s *s,
+  uint8_t *static_iv,
+  uint64_t seq
+)
+{
+  if (s == NULL)
+  {
+    return EverCrypt_Error_InvalidKey;
+  }
+  if (s->impl == Spec_Cipher_Expansion_Hacl_XCHACHA20)
+  {
+    return EverCrypt_Error_InvalidIVLength;
+  }
+  ctx->key = s;
+  memcpy(ctx->static_iv, static_iv, (uint32_t)12U * sizeof (static_iv[0U]));
+  ctx->seq = seq;
+  return EverCrypt_Error_Success;
+}
+
+EverCrypt_Error_error_code
+EverCrypt_AEAD_seal_next(
+  EverCrypt_AEAD_seq *ctx,
+  uint8_t *ad,
+  uint32_t ad_len,
+  uint8_t *plain,
+  uint32_t plain_len,
+  uint8_t *cipher,
+  uint8_t *tag
+)
+{
+  if (ctx->seq == (uint64_t)0xFFFFFFFFFFFFFFFFU)
+  {
+    return EverCrypt_Error_MaximumLengthExceeded;
+  }
+  uint8_t nonce[12U] = { 0U };
+  seq_nonce(nonce, ctx->static_iv, ctx->seq);
+  EverCrypt_Error_error_code
+  r =
+    EverCrypt_AEAD_encrypt(ctx->key,
+      nonce,
+      (uint32_t)12U,
+      ad,
+      ad_len,
+      plain,
+      plain_len,
+      cipher,
+      tag);
+  if (r == EverCrypt_Error_Success)
+  {
+    ctx->seq = ctx->seq + (uint64_t)1U;
+  }
+  return r;
+}
+
+EverCrypt_Error_error_code
+EverCrypt_AEAD_open_at(
+  EverCrypt_AEAD_seq *ctx,
+  uint64_t seq,
+  uint8_t *ad,
+  uint32_t ad_len,
+  uint8_t *cipher,
+  uint32_t cipher_len,
+  uint8_t *tag,
+  uint8_t *dst
+)
+{
+  uint8_t nonce[12U] = { 0U };
+  seq_nonce(nonce, ctx->static_iv, seq);
+  return
+    EverCrypt_AEAD_decrypt(ctx->key,
+      nonce,
+      (uint32_t)12U,
+      ad,
+      ad_len,
+      cipher,
+      cipher_len,
+      tag,
+      dst);
 }
 
 void EverCrypt_AEAD_free(EverCrypt_AEAD_state_s *s)
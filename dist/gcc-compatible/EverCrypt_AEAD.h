@@ -37,6 +37,9 @@
 #include "EverCrypt_AutoConfig2.h"
 #include "EverCrypt_Error.h"
 #include "Hacl_Spec.h"
+#include "Hacl_AES_GCM_NI.h"
+#include "Hacl_AES_GCM_CT.h"
+#include "EverCrypt_Helpers.h"
 
 
 typedef struct EverCrypt_AEAD_state_s_s EverCrypt_AEAD_state_s;
@@ -51,9 +54,33 @@ uint8_t
 
 Spec_Agile_AEAD_alg EverCrypt_AEAD_alg_of_state(EverCrypt_AEAD_state_s *s);
 
+/* Spec_Agile_AEAD_XCHACHA20_POLY1305 takes the same 32-byte key as ChaCha20-Poly1305 and a
+   24-byte iv, which may be drawn at random for each message.
+
+   Spec_Agile_AEAD_AES256_GCM_SIV (RFC 8452) takes a 32-byte key and a 12-byte iv. Repeating an
+   iv only reveals whether the same message was encrypted twice with the same additional data.
+   It requires AES-NI and PCLMULQDQ, and is one-shot: the _iov and incremental entry points
+   return EverCrypt_Error_UnsupportedAlgorithm for it. */
 EverCrypt_Error_error_code
 EverCrypt_AEAD_create_in(Spec_Agile_AEAD_alg a, EverCrypt_AEAD_state_s **dst, uint8_t *k);
 
+/* Size in bytes of the storage EverCrypt_AEAD_init_in_place needs for algorithm a. */
+uint32_t EverCrypt_AEAD_size(Spec_Agile_AEAD_alg a);
+
+/* Like EverCrypt_AEAD_create_in, but builds the state inside mem, which must hold
+   EverCrypt_AEAD_size(a) bytes and be 16-byte aligned. Nothing is allocated: the state
+   lives as long as mem does and must not be passed to EverCrypt_AEAD_free. */
+EverCrypt_Error_error_code
+EverCrypt_AEAD_init_in_place(
+  Spec_Agile_AEAD_alg a,
+  void *mem,
+  EverCrypt_AEAD_state_s **dst,
+  uint8_t *k
+);
+
+/* Encrypts the plain_len bytes of plain into cipher and writes the 16-byte tag to tag.
+   cipher may be plain itself, to encrypt in place, e.g. within a packet buffer; buffers that
+   overlap only partially are not supported. The same holds for the _expand variants. */
 EverCrypt_Error_error_code
 EverCrypt_AEAD_encrypt(
   EverCrypt_AEAD_state_s *s,
@@ -106,6 +133,32 @@ EverCrypt_AEAD_encrypt_expand_chacha20_poly1305(
   uint8_t *tag
 );
 
+EverCrypt_Error_error_code
+EverCrypt_AEAD_encrypt_expand_xchacha20_poly1305(
+  uint8_t *k,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint8_t *ad,
+  uint32_t ad_len,
+  uint8_t *plain,
+  uint32_t plain_len,
+  uint8_t *cipher,
+  uint8_t *tag
+);
+
+EverCrypt_Error_error_code
+EverCrypt_AEAD_encrypt_expand_aes256_gcm_siv(
+  uint8_t *k,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint8_t *ad,
+  uint32_t ad_len,
+  uint8_t *plain,
+  uint32_t plain_len,
+  uint8_t *cipher,
+  uint8_t *tag
+);
+
 EverCrypt_Error_error_code
 EverCrypt_AEAD_encrypt_expand(
   Spec_Agile_AEAD_alg a,
@@ -120,6 +173,29 @@ EverCrypt_AEAD_encrypt_expand(
   uint8_t *tag
 );
 
+/* Like EverCrypt_AEAD_encrypt, but the additional data, the plaintext and the ciphertext
+   are lists of segments, so that scattered packets need not be copied into one buffer.
+   Segment boundaries need not line up between plain and cipher; their total lengths must be
+   equal, or EverCrypt_Error_DecodeError is returned. */
+EverCrypt_Error_error_code
+EverCrypt_AEAD_encrypt_iov(
+  EverCrypt_AEAD_state_s *s,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint32_t ad_cnt,
+  EverCrypt_Helpers_iovec *ad,
+  uint32_t plain_cnt,
+  EverCrypt_Helpers_iovec *plain,
+  uint32_t cipher_cnt,
+  EverCrypt_Helpers_iovec *cipher,
+  uint8_t *tag
+);
+
+/* Decrypts the cipher_len bytes of cipher into dst, provided tag authenticates them together
+   with ad. dst may be cipher itself, to decrypt in place; buffers that overlap only partially
+   are not supported. When EverCrypt_Error_AuthenticationFailure is returned, the contents of
+   dst are unspecified: in particular, decrypting in place does not preserve the ciphertext.
+   The same holds for the _expand variants. */
 EverCrypt_Error_error_code
 EverCrypt_AEAD_decrypt(
   EverCrypt_AEAD_state_s *s,
@@ -172,6 +248,32 @@ EverCrypt_AEAD_decrypt_expand_chacha20_poly1305(
   uint8_t *dst
 );
 
+EverCrypt_Error_error_code
+EverCrypt_AEAD_decrypt_expand_xchacha20_poly1305(
+  uint8_t *k,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint8_t *ad,
+  uint32_t ad_len,
+  uint8_t *cipher,
+  uint32_t cipher_len,
+  uint8_t *tag,
+  uint8_t *dst
+);
+
+EverCrypt_Error_error_code
+EverCrypt_AEAD_decrypt_expand_aes256_gcm_siv(
+  uint8_t *k,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint8_t *ad,
+  uint32_t ad_len,
+  uint8_t *cipher,
+  uint32_t cipher_len,
+  uint8_t *tag,
+  uint8_t *dst
+);
+
 EverCrypt_Error_error_code
 EverCrypt_AEAD_decrypt_expand(
   Spec_Agile_AEAD_alg a,
@@ -186,6 +288,184 @@ EverCrypt_AEAD_decrypt_expand(
   uint8_t *dst
 );
 
+/* Like EverCrypt_AEAD_decrypt, over lists of segments. The ciphertext is decrypted in the
+   same pass that authenticates it: if the tag does not match, every byte of dst is zeroed
+   before EverCrypt_Error_AuthenticationFailure is returned. */
+EverCrypt_Error_error_code
+EverCrypt_AEAD_decrypt_iov(
+  EverCrypt_AEAD_state_s *s,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint32_t ad_cnt,
+  EverCrypt_Helpers_iovec *ad,
+  uint32_t cipher_cnt,
+  EverCrypt_Helpers_iovec *cipher,
+  uint8_t *tag,
+  uint32_t dst_cnt,
+  EverCrypt_Helpers_iovec *dst
+);
+
+/* Encrypts num independent packets, each under its own key s[i] and IV iv[i], into cipher[i]
+   and tag[i]. When AES-GCM runs on the AES-NI and PCLMULQDQ intrinsics rather than on Vale,
+   packets with 12-byte IVs go through a batch kernel that interleaves the blocks of several
+   packets, which keeps the AES units busy on short packets; other packets are encrypted one
+   by one. Sets res[i] to the result of packet i, and
+   returns EverCrypt_Error_Success or the first error among them. */
+EverCrypt_Error_error_code
+EverCrypt_AEAD_encrypt_batch(
+  uint32_t num,
+  EverCrypt_AEAD_state_s **s,
+  uint8_t **iv,
+  uint32_t iv_len,
+  uint8_t **ad,
+  uint32_t *ad_len,
+  uint8_t **plain,
+  uint32_t *plain_len,
+  uint8_t **cipher,
+  uint8_t **tag,
+  EverCrypt_Error_error_code *res
+);
+
+/* The batch counterpart of EverCrypt_AEAD_decrypt. Packets that fail to authenticate through
+   the batch kernel have their dst[i] zeroed. */
+EverCrypt_Error_error_code
+EverCrypt_AEAD_decrypt_batch(
+  uint32_t num,
+  EverCrypt_AEAD_state_s **s,
+  uint8_t **iv,
+  uint32_t iv_len,
+  uint8_t **ad,
+  uint32_t *ad_len,
+  uint8_t **cipher,
+  uint32_t *cipher_len,
+  uint8_t **tag,
+  uint8_t **dst,
+  EverCrypt_Error_error_code *res
+);
+
+/* Incremental encryption and decryption, for messages too large to be held in memory or
+   passed in a single call. A message is processed as EverCrypt_AEAD_encrypt_init (or
+   decrypt_init), any number of update calls of arbitrary lengths, then finish. The context
+   is caller-allocated; it borrows the key object, which must outlive it, and may be reused
+   for another message once finish has returned.
+
+   The total length of a message is 64-bit, up to the limit of the algorithm: 2^36 - 32 bytes
+   for AES-GCM and 2^38 - 64 bytes for ChaCha20-Poly1305. An update that would exceed it
+   returns EverCrypt_Error_MaximumLengthExceeded and leaves the context unchanged. An update or
+   finish that does not match the init call (or that follows finish) returns
+   EverCrypt_Error_DecodeError. */
+typedef struct EverCrypt_AEAD_stream_s
+{
+  EverCrypt_AEAD_state_s *key;
+  bool active;
+  bool enc;
+  union {
+    Hacl_AES_GCM_NI_state gcm;
+    Hacl_AES_GCM_CT_state gcm_ct;
+    EverCrypt_Chacha20Poly1305_stream chacha;
+  }
+  u;
+}
+EverCrypt_AEAD_stream;
+
+/* Starts encrypting a message under key s. All of the additional data is passed here. */
+EverCrypt_Error_error_code
+EverCrypt_AEAD_encrypt_init(
+  EverCrypt_AEAD_stream *st,
+  EverCrypt_AEAD_state_s *s,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint8_t *ad,
+  uint32_t ad_len
+);
+
+/* Encrypts the next len bytes of the message. cipher may alias plain exactly. */
+EverCrypt_Error_error_code
+EverCrypt_AEAD_encrypt_update(
+  EverCrypt_AEAD_stream *st,
+  uint8_t *plain,
+  uint32_t len,
+  uint8_t *cipher
+);
+
+/* Writes the 16-byte tag and wipes the context. */
+EverCrypt_Error_error_code EverCrypt_AEAD_encrypt_finish(EverCrypt_AEAD_stream *st, uint8_t *tag);
+
+EverCrypt_Error_error_code
+EverCrypt_AEAD_decrypt_init(
+  EverCrypt_AEAD_stream *st,
+  EverCrypt_AEAD_state_s *s,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint8_t *ad,
+  uint32_t ad_len
+);
+
+/* Decrypts the next len bytes of the message. dst may alias cipher exactly. The plaintext is
+   released before it is authenticated: it must not be acted upon until
+   EverCrypt_AEAD_decrypt_finish has returned EverCrypt_Error_Success. */
+EverCrypt_Error_error_code
+EverCrypt_AEAD_decrypt_update(
+  EverCrypt_AEAD_stream *st,
+  uint8_t *cipher,
+  uint32_t len,
+  uint8_t *dst
+);
+
+/* Checks the 16-byte tag against the whole message, in constant time, and wipes the context.
+   Returns EverCrypt_Error_AuthenticationFailure if it does not match. */
+EverCrypt_Error_error_code EverCrypt_AEAD_decrypt_finish(EverCrypt_AEAD_stream *st, uint8_t *tag);
+
+/* Per-record nonces, as in TLS 1.3 (RFC 8446, 5.3) and QUIC: the nonce of record seq is a
+   static 12-byte IV XOR-ed with seq, encoded big-endian and left-padded to 12 bytes. The
+   context is caller-allocated; it borrows the key object, which must outlive it, and holds the
+   sequence number of the next record to be sealed. All algorithms but XChaCha20-Poly1305,
+   which takes 24-byte nonces, are supported. */
+typedef struct EverCrypt_AEAD_seq_s
+{
+  EverCrypt_AEAD_state_s *key;
+  uint8_t static_iv[12U];
+  uint64_t seq;
+}
+EverCrypt_AEAD_seq;
+
+/* Starts a sequence at record seq, usually 0. */
+EverCrypt_Error_error_code
+EverCrypt_AEAD_seq_init(
+  EverCrypt_AEAD_seq *ctx,
+  EverCrypt_AEAD_state_s *s,
+  uint8_t *static_iv,
+  uint64_t seq
+);
+
+/* Encrypts the next record as EverCrypt_AEAD_encrypt would, then moves on to the one after.
+   Sequence numbers do not wrap around: once 2^64 - 1 is reached, it is not used and
+   EverCrypt_Error_MaximumLengthExceeded is returned instead. */
+EverCrypt_Error_error_code
+EverCrypt_AEAD_seal_next(
+  EverCrypt_AEAD_seq *ctx,
+  uint8_t *ad,
+  uint32_t ad_len,
+  uint8_t *plain,
+  uint32_t plain_len,
+  uint8_t *cipher,
+  uint8_t *tag
+);
+
+/* Decrypts record seq as EverCrypt_AEAD_decrypt would. Records may be opened in any order;
+   the context is not modified, and rejecting replayed records is up to the caller. */
+EverCrypt_Error_error_code
+EverCrypt_AEAD_open_at(
+  EverCrypt_AEAD_seq *ctx,
+  uint64_t seq,
+  uint8_t *ad,
+  uint32_t ad_len,
+  uint8_t *cipher,
+  uint32_t cipher_len,
+  uint8_t *tag,
+  uint8_t *dst
+);
+
 void EverCrypt_AEAD_free(EverCrypt_AEAD_state_s *s);
 
 #define __EverCrypt_AEAD_H_DEFINED
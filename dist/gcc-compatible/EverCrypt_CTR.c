@@ -31,6 +31,8 @@ typedef struct EverCrypt_CTR_state_s_s
   uint32_t iv_len;
   uint8_t *xkey;
   uint32_t ctr;
+  uint8_t ks[64U];
+  uint32_t ks_len;
 }
 EverCrypt_CTR_state_s;
 
@@ -238,6 +240,164 @@ EverCrypt_CTR_create_in(
   }
 }
 
+/* Caller-provided storage holds the state record first, then the expanded key at the next
+   multiple of 16 bytes, then 16 bytes for the IV. */
+static uint32_t xkey_offset()
+{
+  uint32_t len = (uint32_t)sizeof (EverCrypt_CTR_state_s);
+  return (len + (uint32_t)15U) / (uint32_t)16U * (uint32_t)16U;
+}
+
+static uint32_t xkey_len(Spec_Agile_Cipher_cipher_alg a)
+{
+  switch (a)
+  {
+    case Spec_Agile_Cipher_AES128:
+      {
+        return (uint32_t)304U;
+      }
+    case Spec_Agile_Cipher_AES256:
+      {
+        return (uint32_t)368U;
+      }
+    case Spec_Agile_Cipher_CHACHA20:
+      {
+        return (uint32_t)32U;
+      }
+    default:
+      {
+        return (uint32_t)0U;
+      }
+  }
+}
+
+uint32_t EverCrypt_CTR_size(Spec_Agile_Cipher_cipher_alg a)
+{
+  uint32_t len = xkey_len(a);
+  if (len == (uint32_t)0U)
+  {
+    return (uint32_t)0U;
+  }
+  return xkey_offset() + len + (uint32_t)16U;
+}
+
+EverCrypt_Error_error_code
+EverCrypt_CTR_init_in_place(
+  Spec_Agile_Cipher_cipher_alg a,
+  void *mem,
+  EverCrypt_CTR_state_s **dst,
+  uint8_t *k,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint32_t c
+)
+{
+  uint8_t *ek = (uint8_t *)mem + xkey_offset();
+  uint8_t *iv_ = ek + xkey_len(a);
+  EverCrypt_CTR_state_s *p = (EverCrypt_CTR_state_s *)mem;
+  if (iv_len > (uint32_t)16U)
+  {
+    return EverCrypt_Error_InvalidIVLength;
+  }
+  memset(iv_, 0U, (uint32_t)16U * sizeof (iv_[0U]));
+  switch (a)
+  {
+    case Spec_Agile_Cipher_AES128:
+      {
+        bool has_aesni = EverCrypt_AutoConfig2_has_aesni();
+        bool has_pclmulqdq = EverCrypt_AutoConfig2_has_pclmulqdq();
+        bool has_avx = EverCrypt_AutoConfig2_has_avx();
+        bool has_sse = EverCrypt_AutoConfig2_has_sse();
+        if (iv_len < (uint32_t)12U)
+        {
+          return EverCrypt_Error_InvalidIVLength;
+        }
+        #if EVERCRYPT_TARGETCONFIG_X64
+        if (has_aesni && has_pclmulqdq && has_avx && has_sse)
+        {
+          uint8_t *keys_b = ek;
+          uint8_t *hkeys_b = ek + (uint32_t)176U;
+          uint64_t scrut = aes128_key_expansion(k, keys_b);
+          uint64_t scrut0 = aes128_keyhash_init(keys_b, hkeys_b);
+          memcpy(iv_, iv, iv_len * sizeof (iv[0U]));
+          p[0U]
+          =
+            (
+              (EverCrypt_CTR_state_s){
+                .i = vale_impl_of_alg(Spec_Cipher_Expansion_cipher_alg_of_impl(Spec_Cipher_Expansion_Vale_AES128)),
+                .iv = iv_,
+                .iv_len = iv_len,
+                .xkey = ek,
+                .ctr = c
+              }
+            );
+          *dst = p;
+          return EverCrypt_Error_Success;
+        }
+        #endif
+        return EverCrypt_Error_UnsupportedAlgorithm;
+      }
+    case Spec_Agile_Cipher_AES256:
+      {
+        bool has_aesni = EverCrypt_AutoConfig2_has_aesni();
+        bool has_pclmulqdq = EverCrypt_AutoConfig2_has_pclmulqdq();
+        bool has_avx = EverCrypt_AutoConfig2_has_avx();
+        bool has_sse = EverCrypt_AutoConfig2_has_sse();
+        if (iv_len < (uint32_t)12U)
+        {
+          return EverCrypt_Error_InvalidIVLength;
+        }
+        #if EVERCRYPT_TARGETCONFIG_X64
+        if (has_aesni && has_pclmulqdq && has_avx && has_sse)
+        {
+          uint8_t *keys_b = ek;
+          uint8_t *hkeys_b = ek + (uint32_t)240U;
+          uint64_t scrut = aes256_key_expansion(k, keys_b);
+          uint64_t scrut0 = aes256_keyhash_init(keys_b, hkeys_b);
+          memcpy(iv_, iv, iv_len * sizeof (iv[0U]));
+          p[0U]
+          =
+            (
+              (EverCrypt_CTR_state_s){
+                .i = vale_impl_of_alg(Spec_Cipher_Expansion_cipher_alg_of_impl(Spec_Cipher_Expansion_Vale_AES256)),
+                .iv = iv_,
+                .iv_len = iv_len,
+                .xkey = ek,
+                .ctr = c
+              }
+            );
+          *dst = p;
+          return EverCrypt_Error_Success;
+        }
+        #endif
+        return EverCrypt_Error_UnsupportedAlgorithm;
+      }
+    case Spec_Agile_Cipher_CHACHA20:
+      {
+        memcpy(ek, k, (uint32_t)32U * sizeof (k[0U]));
+        memcpy(iv_, iv, iv_len * sizeof (iv[0U]));
+        p[0U]
+        =
+          (
+            (EverCrypt_CTR_state_s){
+              .i = Spec_Cipher_Expansion_Hacl_CHACHA20,
+              .iv = iv_,
+              .iv_len = (uint32_t)12U,
+              .xkey = ek,
+              .ctr = c
+            }
+          );
+        *dst = p;
+        return EverCrypt_Error_Success;
+      }
+    default:
+      {
+        KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
+        KRML_HOST_EXIT(253U);
+      }
+  }
+}
+
 void
 EverCrypt_CTR_init(
   EverCrypt_CTR_state_s *p,
@@ -402,6 +562,7 @@ void EverCrypt_CTR_update_block(EverCrypt_CTR_state_s *p, uint8_t *dst, uint8_t
         uint32_t ctx[16U] = { 0U };
         Hacl_Impl_Chacha20_chacha20_init(ctx, ek, iv, (uint32_t)0U);
         Hacl_Impl_Chacha20_chacha20_encrypt_block(ctx, dst, c0, src);
+        p->ks_len = (uint32_t)0U;
         break;
       }
     default:
@@ -412,6 +573,163 @@ void EverCrypt_CTR_update_block(EverCrypt_CTR_state_s *p, uint8_t *dst, uint8_t
   }
 }
 
+#if EVERCRYPT_TARGETCONFIG_X64
+/* Counter block c, laid out the way Vale's gctr expects it. Returns the low 32-bit word of
+   the counter, the only one gctr increments. */
+static uint32_t aes_ctr_block(EverCrypt_CTR_state_s *p, uint32_t c, uint8_t *ctr_block)
+{
+  uint8_t b[16U] = { 0U };
+  memcpy(b, p->iv, p->iv_len * sizeof (p->iv[0U]));
+  FStar_UInt128_uint128
+  x = FStar_UInt128_add_mod(load128_be(b), FStar_UInt128_uint64_to_uint128((uint64_t)c));
+  store128_le(ctr_block, x);
+  return (uint32_t)FStar_UInt128_uint128_to_uint64(x);
+}
+
+static void
+aes_gctr(
+  Spec_Cipher_Expansion_impl i,
+  uint8_t *ek,
+  uint8_t *ctr_block,
+  uint32_t n,
+  uint8_t *dst,
+  uint8_t *src
+)
+{
+  uint8_t inout_b[16U] = { 0U };
+  if (i == Spec_Cipher_Expansion_Vale_AES128)
+  {
+    uint64_t
+    scrut =
+      gctr128_bytes(src,
+        (uint64_t)n * (uint64_t)16U,
+        dst,
+        inout_b,
+        ek,
+        ctr_block,
+        (uint64_t)n);
+  }
+  else
+  {
+    uint64_t
+    scrut =
+      gctr256_bytes(src,
+        (uint64_t)n * (uint64_t)16U,
+        dst,
+        inout_b,
+        ek,
+        ctr_block,
+        (uint64_t)n);
+  }
+}
+
+/* n full blocks from counter p->ctr on, as one pipelined gctr call per run of blocks that
+   does not carry out of the low 32-bit word of the counter block. */
+static void aes_update_blocks(EverCrypt_CTR_state_s *p, uint32_t n, uint8_t *dst, uint8_t *src)
+{
+  uint32_t done = (uint32_t)0U;
+  while (done < n)
+  {
+    uint8_t ctr_block[16U] = { 0U };
+    uint32_t lo = aes_ctr_block(p, p->ctr, ctr_block);
+    uint32_t room = (uint32_t)0U - lo;
+    uint32_t m = n - done;
+    if (room != (uint32_t)0U && room < m)
+    {
+      m = room;
+    }
+    aes_gctr(p->i,
+      p->xkey,
+      ctr_block,
+      m,
+      dst + done * (uint32_t)16U,
+      src + done * (uint32_t)16U);
+    p->ctr = p->ctr + m;
+    done = done + m;
+  }
+}
+#endif
+
+void
+EverCrypt_CTR_update(EverCrypt_CTR_state_s *p, uint8_t *dst, uint8_t *src, uint32_t len)
+{
+  Spec_Cipher_Expansion_impl i = p->i;
+  uint32_t bs;
+  if (i == Spec_Cipher_Expansion_Hacl_CHACHA20)
+  {
+    bs = (uint32_t)64U;
+  }
+  else
+  {
+    bs = (uint32_t)16U;
+  }
+  uint32_t n0 = p->ks_len;
+  if (len < n0)
+  {
+    n0 = len;
+  }
+  uint8_t *ks0 = p->ks + bs - p->ks_len;
+  for (uint32_t j = (uint32_t)0U; j < n0; j++)
+  {
+    dst[j] = src[j] ^ ks0[j];
+  }
+  p->ks_len = p->ks_len - n0;
+  uint8_t *dst1 = dst + n0;
+  uint8_t *src1 = src + n0;
+  uint32_t len1 = len - n0;
+  uint32_t nb = len1 / bs;
+  uint32_t rem = len1 % bs;
+  uint8_t *dst2 = dst1 + nb * bs;
+  uint8_t *src2 = src1 + nb * bs;
+  switch (i)
+  {
+    case Spec_Cipher_Expansion_Vale_AES128:
+    case Spec_Cipher_Expansion_Vale_AES256:
+      {
+        #if EVERCRYPT_TARGETCONFIG_X64
+        aes_update_blocks(p, nb, dst1, src1);
+        if (rem > (uint32_t)0U)
+        {
+          uint8_t ctr_block[16U] = { 0U };
+          aes_ctr_block(p, p->ctr, ctr_block);
+          memset(p->ks, 0U, (uint32_t)16U * sizeof (p->ks[0U]));
+          aes_gctr(i, p->xkey, ctr_block, (uint32_t)1U, p->ks, p->ks);
+          p->ctr = p->ctr + (uint32_t)1U;
+        }
+        #endif
+        break;
+      }
+    case Spec_Cipher_Expansion_Hacl_CHACHA20:
+      {
+        if (nb > (uint32_t)0U)
+        {
+          EverCrypt_Cipher_chacha20(nb * (uint32_t)64U, dst1, src1, p->xkey, p->iv, p->ctr);
+          p->ctr = p->ctr + nb;
+        }
+        if (rem > (uint32_t)0U)
+        {
+          memset(p->ks, 0U, (uint32_t)64U * sizeof (p->ks[0U]));
+          EverCrypt_Cipher_chacha20((uint32_t)64U, p->ks, p->ks, p->xkey, p->iv, p->ctr);
+          p->ctr = p->ctr + (uint32_t)1U;
+        }
+        break;
+      }
+    default:
+      {
+        KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
+        KRML_HOST_EXIT(253U);
+      }
+  }
+  if (rem > (uint32_t)0U)
+  {
+    for (uint32_t j = (uint32_t)0U; j < rem; j++)
+    {
+      dst2[j] = src2[j] ^ p->ks[j];
+    }
+    p->ks_len = bs - rem;
+  }
+}
+
 void EverCrypt_CTR_free(EverCrypt_CTR_state_s *p)
 {
   EverCrypt_CTR_state_s scrut = *p;
@@ -32,6 +32,7 @@
 #define __EverCrypt_CTR_H
 
 #include "Hacl_Chacha20.h"
+#include "EverCrypt_Cipher.h"
 #include "Hacl_Kremlib.h"
 #include "Vale.h"
 #include "EverCrypt_AutoConfig2.h"
@@ -92,6 +93,24 @@ EverCrypt_CTR_create_in(
   uint32_t c
 );
 
+/* Size in bytes of the storage EverCrypt_CTR_init_in_place needs for algorithm a, or 0 if a
+   is not supported. */
+uint32_t EverCrypt_CTR_size(Spec_Agile_Cipher_cipher_alg a);
+
+/* Like EverCrypt_CTR_create_in, but builds the state inside mem, which must hold
+   EverCrypt_CTR_size(a) bytes and be 16-byte aligned. Nothing is allocated: the state
+   lives as long as mem does and must not be passed to EverCrypt_CTR_free. */
+EverCrypt_Error_error_code
+EverCrypt_CTR_init_in_place(
+  Spec_Agile_Cipher_cipher_alg a,
+  void *mem,
+  EverCrypt_CTR_state_s **dst,
+  uint8_t *k,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint32_t c
+);
+
 void
 EverCrypt_CTR_init(
   EverCrypt_CTR_state_s *p,
@@ -103,6 +122,15 @@ EverCrypt_CTR_init(
 
 void EverCrypt_CTR_update_block(EverCrypt_CTR_state_s *p, uint8_t *dst, uint8_t *src);
 
+/* Encrypts (or decrypts) len bytes of src into dst, for any len. Full blocks go through the
+   multi-block Vale GCTR or vectorized ChaCha20 kernels; the keystream left over from a final
+   partial block is kept in the state and used first by the next call, so splitting a message
+   across calls does not change the output. The block counter advances by one per keystream
+   block generated, including for ChaCha20. dst may be src itself. EverCrypt_CTR_update_block
+   drops any such left-over keystream. */
+void
+EverCrypt_CTR_update(EverCrypt_CTR_state_s *p, uint8_t *dst, uint8_t *src, uint32_t len);
+
 void EverCrypt_CTR_free(EverCrypt_CTR_state_s *p);
 
 #define __EverCrypt_CTR_H_DEFINED
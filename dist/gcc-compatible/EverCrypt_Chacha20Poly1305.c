@@ -84,3 +84,493 @@ EverCrypt_Chacha20Poly1305_aead_decrypt(
   return Hacl_Chacha20Poly1305_32_aead_decrypt(k, n, aadlen, aad, mlen, m, cipher, tag);
 }
 
+void
+EverCrypt_Chacha20Poly1305_xchacha20_derive(uint8_t *k1, uint8_t *n1, uint8_t *k, uint8_t *n)
+{
+  Hacl_Chacha20_hchacha20(k1, k, n);
+  memset(n1, 0U, (uint32_t)4U * sizeof (n1[0U]));
+  memcpy(n1 + (uint32_t)4U, n + (uint32_t)16U, (uint32_t)8U * sizeof (n[0U]));
+}
+
+void
+EverCrypt_Chacha20Poly1305_xaead_encrypt(
+  uint8_t *k,
+  uint8_t *n,
+  uint32_t aadlen,
+  uint8_t *aad,
+  uint32_t mlen,
+  uint8_t *m,
+  uint8_t *cipher,
+  uint8_t *tag
+)
+{
+  uint8_t k1[32U] = { 0U };
+  uint8_t n1[12U] = { 0U };
+  EverCrypt_Chacha20Poly1305_xchacha20_derive(k1, n1, k, n);
+  EverCrypt_Chacha20Poly1305_aead_encrypt(k1, n1, aadlen, aad, mlen, m, cipher, tag);
+  Lib_Memzero0_memzero(k1, (uint32_t)32U * sizeof (k1[0U]));
+}
+
+uint32_t
+EverCrypt_Chacha20Poly1305_xaead_decrypt(
+  uint8_t *k,
+  uint8_t *n,
+  uint32_t aadlen,
+  uint8_t *aad,
+  uint32_t mlen,
+  uint8_t *m,
+  uint8_t *cipher,
+  uint8_t *tag
+)
+{
+  uint8_t k1[32U] = { 0U };
+  uint8_t n1[12U] = { 0U };
+  EverCrypt_Chacha20Poly1305_xchacha20_derive(k1, n1, k, n);
+  uint32_t r = EverCrypt_Chacha20Poly1305_aead_decrypt(k1, n1, aadlen, aad, mlen, m, cipher, tag);
+  Lib_Memzero0_memzero(k1, (uint32_t)32U * sizeof (k1[0U]));
+  return r;
+}
+
+void
+EverCrypt_Chacha20Poly1305_aead_encrypt_batch(
+  uint32_t num,
+  uint8_t **k,
+  uint8_t **n,
+  uint32_t *aadlen,
+  uint8_t **aad,
+  uint32_t *mlen,
+  uint8_t **m,
+  uint8_t **cipher,
+  uint8_t **tag
+)
+{
+  bool avx2 = EverCrypt_AutoConfig2_has_avx2();
+  #if EVERCRYPT_TARGETCONFIG_X64
+  if (avx2 && num > (uint32_t)1U)
+  {
+    Hacl_Chacha20Poly1305_256_aead_encrypt_batch(num, k, n, aadlen, aad, mlen, m, cipher, tag);
+    return;
+  }
+  #endif
+  for (uint32_t i = (uint32_t)0U; i < num; i++)
+  {
+    EverCrypt_Chacha20Poly1305_aead_encrypt(k[i],
+      n[i],
+      aadlen[i],
+      aad[i],
+      mlen[i],
+      m[i],
+      cipher[i],
+      tag[i]);
+  }
+}
+
+uint32_t
+EverCrypt_Chacha20Poly1305_aead_decrypt_batch(
+  uint32_t num,
+  uint8_t **k,
+  uint8_t **n,
+  uint32_t *aadlen,
+  uint8_t **aad,
+  uint32_t *mlen,
+  uint8_t **m,
+  uint8_t **cipher,
+  uint8_t **tag,
+  uint32_t *res
+)
+{
+  bool avx2 = EverCrypt_AutoConfig2_has_avx2();
+  #if EVERCRYPT_TARGETCONFIG_X64
+  if (avx2 && num > (uint32_t)1U)
+  {
+    return
+      Hacl_Chacha20Poly1305_256_aead_decrypt_batch(num,
+        k,
+        n,
+        aadlen,
+        aad,
+        mlen,
+        m,
+        cipher,
+        tag,
+        res);
+  }
+  #endif
+  uint32_t failed = (uint32_t)0U;
+  for (uint32_t i = (uint32_t)0U; i < num; i++)
+  {
+    res[i] =
+      EverCrypt_Chacha20Poly1305_aead_decrypt(k[i],
+        n[i],
+        aadlen[i],
+        aad[i],
+        mlen[i],
+        m[i],
+        cipher[i],
+        tag[i]);
+    failed = failed + res[i];
+  }
+  return failed;
+}
+
+static void
+stream_chacha20(
+  EverCrypt_Chacha20Poly1305_stream *st,
+  uint32_t len,
+  uint8_t *out,
+  uint8_t *text,
+  uint32_t ctr
+)
+{
+  #if EVERCRYPT_TARGETCONFIG_X64
+  if (st->avx2)
+  {
+    Hacl_Chacha20_Vec256_chacha20_encrypt_256(len, out, text, st->k, st->n, ctr);
+    return;
+  }
+  #endif
+  #if EVERCRYPT_TARGETCONFIG_X64
+  if (st->avx)
+  {
+    Hacl_Chacha20_Vec128_chacha20_encrypt_128(len, out, text, st->k, st->n, ctr);
+    return;
+  }
+  #endif
+  Hacl_Chacha20_chacha20_encrypt(len, out, text, st->k, st->n, ctr);
+}
+
+/* len is a multiple of 16. */
+static void stream_poly1305(EverCrypt_Chacha20Poly1305_stream *st, uint32_t len, uint8_t *text)
+{
+  #if EVERCRYPT_TARGETCONFIG_X64
+  if (st->avx2)
+  {
+    Hacl_Poly1305_256_poly1305_update(st->ctx.ctx256, len, text);
+    return;
+  }
+  #endif
+  #if EVERCRYPT_TARGETCONFIG_X64
+  if (st->avx)
+  {
+    Hacl_Poly1305_128_poly1305_update(st->ctx.ctx128, len, text);
+    return;
+  }
+  #endif
+  Hacl_Poly1305_32_poly1305_update(st->ctx.ctx32, len, text);
+}
+
+void
+EverCrypt_Chacha20Poly1305_stream_init(
+  EverCrypt_Chacha20Poly1305_stream *st,
+  uint8_t *k,
+  uint8_t *n
+)
+{
+  memcpy(st->k, k, (uint32_t)32U * sizeof (k[0U]));
+  memcpy(st->n, n, (uint32_t)12U * sizeof (n[0U]));
+  st->avx2 = EverCrypt_AutoConfig2_has_avx2();
+  st->avx = EverCrypt_AutoConfig2_has_avx();
+  st->ad_len = (uint64_t)0U;
+  st->text_len = (uint64_t)0U;
+  uint8_t block[64U] = { 0U };
+  Hacl_Chacha20_chacha20_encrypt((uint32_t)64U, block, block, st->k, st->n, (uint32_t)0U);
+  memcpy(st->poly_key, block, (uint32_t)32U * sizeof (block[0U]));
+  #if EVERCRYPT_TARGETCONFIG_X64
+  if (st->avx2)
+  {
+    Hacl_Poly1305_256_poly1305_init(st->ctx.ctx256, st->poly_key);
+    return;
+  }
+  #endif
+  #if EVERCRYPT_TARGETCONFIG_X64
+  if (st->avx)
+  {
+    Hacl_Poly1305_128_poly1305_init(st->ctx.ctx128, st->poly_key);
+    return;
+  }
+  #endif
+  Hacl_Poly1305_32_poly1305_init(st->ctx.ctx32, st->poly_key);
+}
+
+/* Absorbs len bytes into Poly1305, pos bytes into the current (AAD or text) field. */
+static void
+stream_absorb(EverCrypt_Chacha20Poly1305_stream *st, uint64_t pos, uint32_t len, uint8_t *text)
+{
+  uint32_t off = (uint32_t)(pos % (uint64_t)16U);
+  uint32_t i = (uint32_t)0U;
+  if (off != (uint32_t)0U)
+  {
+    i = (uint32_t)16U - off;
+    if (len < i)
+    {
+      i = len;
+    }
+    memcpy(st->buf + off, text, i * sizeof (text[0U]));
+    if (off + i == (uint32_t)16U)
+    {
+      stream_poly1305(st, (uint32_t)16U, st->buf);
+    }
+  }
+  uint32_t full = (len - i) / (uint32_t)16U * (uint32_t)16U;
+  if (full > (uint32_t)0U)
+  {
+    stream_poly1305(st, full, text + i);
+  }
+  i = i + full;
+  memcpy(st->buf, text + i, (len - i) * sizeof (text[0U]));
+}
+
+/* Pads the current field with zeroes to a multiple of 16 bytes. */
+static void stream_pad(EverCrypt_Chacha20Poly1305_stream *st, uint64_t pos)
+{
+  uint32_t off = (uint32_t)(pos % (uint64_t)16U);
+  if (off != (uint32_t)0U)
+  {
+    memset(st->buf + off, 0U, ((uint32_t)16U - off) * sizeof (st->buf[0U]));
+    stream_poly1305(st, (uint32_t)16U, st->buf);
+  }
+}
+
+void
+EverCrypt_Chacha20Poly1305_stream_aad(
+  EverCrypt_Chacha20Poly1305_stream *st,
+  uint32_t len,
+  uint8_t *aad
+)
+{
+  stream_absorb(st, st->ad_len, len, aad);
+  st->ad_len = st->ad_len + (uint64_t)len;
+}
+
+/* The text keystream starts at block 1; block 0 is the Poly1305 key. */
+static void
+stream_xor(EverCrypt_Chacha20Poly1305_stream *st, uint32_t len, uint8_t *out, uint8_t *text)
+{
+  uint64_t pos = st->text_len;
+  uint32_t off = (uint32_t)(pos % (uint64_t)64U);
+  uint32_t i = (uint32_t)0U;
+  if (off != (uint32_t)0U)
+  {
+    i = (uint32_t)64U - off;
+    if (len < i)
+    {
+      i = len;
+    }
+    for (uint32_t j = (uint32_t)0U; j < i; j++)
+    {
+      out[j] = text[j] ^ st->ks[off + j];
+    }
+  }
+  uint32_t ctr = (uint32_t)((pos + (uint64_t)i) / (uint64_t)64U) + (uint32_t)1U;
+  uint32_t full = (len - i) / (uint32_t)64U * (uint32_t)64U;
+  if (full > (uint32_t)0U)
+  {
+    stream_chacha20(st, full, out + i, text + i, ctr);
+  }
+  i = i + full;
+  if (i < len)
+  {
+    memset(st->ks, 0U, (uint32_t)64U * sizeof (st->ks[0U]));
+    Hacl_Chacha20_chacha20_encrypt((uint32_t)64U,
+      st->ks,
+      st->ks,
+      st->k,
+      st->n,
+      ctr + full / (uint32_t)64U);
+    for (uint32_t j = (uint32_t)0U; j < len - i; j++)
+    {
+      out[i + j] = text[i + j] ^ st->ks[j];
+    }
+  }
+}
+
+void
+EverCrypt_Chacha20Poly1305_stream_encrypt(
+  EverCrypt_Chacha20Poly1305_stream *st,
+  uint32_t len,
+  uint8_t *out,
+  uint8_t *text
+)
+{
+  if (len == (uint32_t)0U)
+  {
+    return;
+  }
+  if (st->text_len == (uint64_t)0U)
+  {
+    stream_pad(st, st->ad_len);
+  }
+  stream_xor(st, len, out, text);
+  stream_absorb(st, st->text_len, len, out);
+  st->text_len = st->text_len + (uint64_t)len;
+}
+
+/* The ciphertext is authenticated before it is decrypted, so that out may alias cipher. */
+void
+EverCrypt_Chacha20Poly1305_stream_decrypt(
+  EverCrypt_Chacha20Poly1305_stream *st,
+  uint32_t len,
+  uint8_t *out,
+  uint8_t *cipher
+)
+{
+  if (len == (uint32_t)0U)
+  {
+    return;
+  }
+  if (st->text_len == (uint64_t)0U)
+  {
+    stream_pad(st, st->ad_len);
+  }
+  stream_absorb(st, st->text_len, len, cipher);
+  stream_xor(st, len, out, cipher);
+  st->text_len = st->text_len + (uint64_t)len;
+}
+
+void EverCrypt_Chacha20Poly1305_stream_finish(EverCrypt_Chacha20Poly1305_stream *st, uint8_t *tag)
+{
+  if (st->text_len == (uint64_t)0U)
+  {
+    stream_pad(st, st->ad_len);
+  }
+  else
+  {
+    stream_pad(st, st->text_len);
+  }
+  uint8_t block[16U] = { 0U };
+  store64_le(block, st->ad_len);
+  store64_le(block + (uint32_t)8U, st->text_len);
+  stream_poly1305(st, (uint32_t)16U, block);
+  #if EVERCRYPT_TARGETCONFIG_X64
+  if (st->avx2)
+  {
+    Hacl_Poly1305_256_poly1305_finish(tag, st->poly_key, st->ctx.ctx256);
+    return;
+  }
+  #endif
+  #if EVERCRYPT_TARGETCONFIG_X64
+  if (st->avx)
+  {
+    Hacl_Poly1305_128_poly1305_finish(tag, st->poly_key, st->ctx.ctx128);
+    return;
+  }
+  #endif
+  Hacl_Poly1305_32_poly1305_finish(tag, st->poly_key, st->ctx.ctx32);
+}
+
+/* Runs the bytes of in through st, in chunks that fit both the current input and output
+   segments. Stops as soon as either list is exhausted. */
+static void
+stream_iov(
+  EverCrypt_Chacha20Poly1305_stream *st,
+  bool enc,
+  uint32_t out_cnt,
+  EverCrypt_Helpers_iovec *out,
+  uint32_t in_cnt,
+  EverCrypt_Helpers_iovec *in
+)
+{
+  uint32_t i = (uint32_t)0U;
+  uint32_t j = (uint32_t)0U;
+  uint32_t in_off = (uint32_t)0U;
+  uint32_t out_off = (uint32_t)0U;
+  while (i < in_cnt && j < out_cnt)
+  {
+    uint32_t len = in[i].len - in_off;
+    if (out[j].len - out_off < len)
+    {
+      len = out[j].len - out_off;
+    }
+    if (enc)
+    {
+      EverCrypt_Chacha20Poly1305_stream_encrypt(st,
+        len,
+        out[j].base + out_off,
+        in[i].base + in_off);
+    }
+    else
+    {
+      EverCrypt_Chacha20Poly1305_stream_decrypt(st,
+        len,
+        out[j].base + out_off,
+        in[i].base + in_off);
+    }
+    in_off = in_off + len;
+    out_off = out_off + len;
+    if (in_off == in[i].len)
+    {
+      i++;
+      in_off = (uint32_t)0U;
+    }
+    if (out_off == out[j].len)
+    {
+      j++;
+      out_off = (uint32_t)0U;
+    }
+  }
+}
+
+void
+EverCrypt_Chacha20Poly1305_aead_encrypt_iov(
+  uint8_t *k,
+  uint8_t *n,
+  uint32_t aad_cnt,
+  EverCrypt_Helpers_iovec *aad,
+  uint32_t m_cnt,
+  EverCrypt_Helpers_iovec *m,
+  uint32_t cipher_cnt,
+  EverCrypt_Helpers_iovec *cipher,
+  uint8_t *tag
+)
+{
+  EverCrypt_Chacha20Poly1305_stream st;
+  EverCrypt_Chacha20Poly1305_stream_init(&st, k, n);
+  for (uint32_t i = (uint32_t)0U; i < aad_cnt; i++)
+  {
+    EverCrypt_Chacha20Poly1305_stream_aad(&st, aad[i].len, aad[i].base);
+  }
+  stream_iov(&st, true, cipher_cnt, cipher, m_cnt, m);
+  EverCrypt_Chacha20Poly1305_stream_finish(&st, tag);
+  Lib_Memzero0_memzero(&st, sizeof (st));
+}
+
+uint32_t
+EverCrypt_Chacha20Poly1305_aead_decrypt_iov(
+  uint8_t *k,
+  uint8_t *n,
+  uint32_t aad_cnt,
+  EverCrypt_Helpers_iovec *aad,
+  uint32_t m_cnt,
+  EverCrypt_Helpers_iovec *m,
+  uint32_t cipher_cnt,
+  EverCrypt_Helpers_iovec *cipher,
+  uint8_t *tag
+)
+{
+  EverCrypt_Chacha20Poly1305_stream st;
+  EverCrypt_Chacha20Poly1305_stream_init(&st, k, n);
+  for (uint32_t i = (uint32_t)0U; i < aad_cnt; i++)
+  {
+    EverCrypt_Chacha20Poly1305_stream_aad(&st, aad[i].len, aad[i].base);
+  }
+  stream_iov(&st, false, m_cnt, m, cipher_cnt, cipher);
+  uint8_t computed_tag[16U] = { 0U };
+  EverCrypt_Chacha20Poly1305_stream_finish(&st, computed_tag);
+  Lib_Memzero0_memzero(&st, sizeof (st));
+  uint8_t res = (uint8_t)255U;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+  {
+    uint8_t uu____0 = FStar_UInt8_eq_mask(computed_tag[i], tag[i]);
+    res = uu____0 & res;
+  }
+  if (res == (uint8_t)255U)
+  {
+    return (uint32_t)0U;
+  }
+  for (uint32_t i = (uint32_t)0U; i < m_cnt; i++)
+  {
+    Lib_Memzero0_memzero(m[i].base, m[i].len);
+  }
+  return (uint32_t)1U;
+}
+
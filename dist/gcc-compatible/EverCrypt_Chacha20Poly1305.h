@@ -32,11 +32,16 @@
 #define __EverCrypt_Chacha20Poly1305_H
 
 #include "EverCrypt_AutoConfig2.h"
+#include "EverCrypt_Helpers.h"
+#include "Lib_Memzero0.h"
+#include "Hacl_Chacha20.h"
 #include "Hacl_Chacha20Poly1305_128.h"
 #include "Hacl_Chacha20Poly1305_32.h"
 #include "Hacl_Chacha20Poly1305_256.h"
 
 
+/* Dispatches to the widest Hacl_Chacha20Poly1305 implementation the CPU supports. As
+   there, cipher may be m itself, and m is not written when decryption fails. */
 void
 EverCrypt_Chacha20Poly1305_aead_encrypt(
   uint8_t *k,
@@ -61,5 +66,165 @@ EverCrypt_Chacha20Poly1305_aead_decrypt(
   uint8_t *tag
 );
 
+/* XChaCha20-Poly1305 (draft-irtf-cfrg-xchacha) takes a 24-byte nonce n, long enough to be
+   drawn at random. Writes the subkey HChaCha20(k, n[0..16]) to k1 (32 bytes) and the nonce
+   0^4 || n[16..24] to n1 (12 bytes), under which ChaCha20-Poly1305 then runs. */
+void
+EverCrypt_Chacha20Poly1305_xchacha20_derive(uint8_t *k1, uint8_t *n1, uint8_t *k, uint8_t *n);
+
+/* Like EverCrypt_Chacha20Poly1305_aead_encrypt and _decrypt, with a 24-byte nonce. */
+void
+EverCrypt_Chacha20Poly1305_xaead_encrypt(
+  uint8_t *k,
+  uint8_t *n,
+  uint32_t aadlen,
+  uint8_t *aad,
+  uint32_t mlen,
+  uint8_t *m,
+  uint8_t *cipher,
+  uint8_t *tag
+);
+
+uint32_t
+EverCrypt_Chacha20Poly1305_xaead_decrypt(
+  uint8_t *k,
+  uint8_t *n,
+  uint32_t aadlen,
+  uint8_t *aad,
+  uint32_t mlen,
+  uint8_t *m,
+  uint8_t *cipher,
+  uint8_t *tag
+);
+
+/* Seals (or opens) num independent packets, each under its own key k[i] and nonce n[i], as
+   the corresponding calls to EverCrypt_Chacha20Poly1305_aead_encrypt (or _decrypt) would.
+   With AVX2, 8 packets go through the ChaCha20 and Poly1305 kernels at once, one per vector
+   lane, which pays off for short packets; lanes idle once their packet is done, so batches
+   of similar lengths work best. Decryption sets res[i] to 0 or 1 for each packet, writes m[i]
+   only on success, and returns the number of packets that failed. */
+void
+EverCrypt_Chacha20Poly1305_aead_encrypt_batch(
+  uint32_t num,
+  uint8_t **k,
+  uint8_t **n,
+  uint32_t *aadlen,
+  uint8_t **aad,
+  uint32_t *mlen,
+  uint8_t **m,
+  uint8_t **cipher,
+  uint8_t **tag
+);
+
+uint32_t
+EverCrypt_Chacha20Poly1305_aead_decrypt_batch(
+  uint32_t num,
+  uint8_t **k,
+  uint8_t **n,
+  uint32_t *aadlen,
+  uint8_t **aad,
+  uint32_t *mlen,
+  uint8_t **m,
+  uint8_t **cipher,
+  uint8_t **tag,
+  uint32_t *res
+);
+
+/* Like EverCrypt_Chacha20Poly1305_aead_encrypt, but the additional data, the message and
+   the ciphertext are lists of segments. Segment boundaries need not line up between m and
+   cipher, whose total lengths must be equal. */
+void
+EverCrypt_Chacha20Poly1305_aead_encrypt_iov(
+  uint8_t *k,
+  uint8_t *n,
+  uint32_t aad_cnt,
+  EverCrypt_Helpers_iovec *aad,
+  uint32_t m_cnt,
+  EverCrypt_Helpers_iovec *m,
+  uint32_t cipher_cnt,
+  EverCrypt_Helpers_iovec *cipher,
+  uint8_t *tag
+);
+
+/* Like EverCrypt_Chacha20Poly1305_aead_decrypt, over lists of segments. The message is
+   decrypted in the same pass that authenticates it; if the tag does not match, 1 is
+   returned and every byte of m is zeroed. */
+uint32_t
+EverCrypt_Chacha20Poly1305_aead_decrypt_iov(
+  uint8_t *k,
+  uint8_t *n,
+  uint32_t aad_cnt,
+  EverCrypt_Helpers_iovec *aad,
+  uint32_t m_cnt,
+  EverCrypt_Helpers_iovec *m,
+  uint32_t cipher_cnt,
+  EverCrypt_Helpers_iovec *cipher,
+  uint8_t *tag
+);
+
+/* Incremental ChaCha20-Poly1305, for messages that are not all in memory at once: init,
+   any number of aad calls, any number of encrypt (or decrypt) calls, then finish. Every call
+   accepts arbitrary lengths; the keystream of a partial ChaCha20 block and the bytes of a
+   partial Poly1305 block are carried over in the state. At most 2^38 - 64 bytes of text may
+   be processed under one nonce, which the caller must enforce. */
+typedef struct EverCrypt_Chacha20Poly1305_stream_s
+{
+  uint8_t k[32U];
+  uint8_t n[12U];
+  bool avx2;
+  bool avx;
+  uint8_t poly_key[32U];
+  uint8_t ks[64U];
+  uint8_t buf[16U];
+  uint64_t ad_len;
+  uint64_t text_len;
+  union {
+    uint64_t ctx32[25U];
+    #if EVERCRYPT_TARGETCONFIG_X64
+    Lib_IntVector_Intrinsics_vec128 ctx128[25U];
+    Lib_IntVector_Intrinsics_vec256 ctx256[25U];
+    #endif
+  }
+  ctx;
+}
+EverCrypt_Chacha20Poly1305_stream;
+
+/* k (32 bytes) and n (12 bytes) are copied into the state. */
+void
+EverCrypt_Chacha20Poly1305_stream_init(
+  EverCrypt_Chacha20Poly1305_stream *st,
+  uint8_t *k,
+  uint8_t *n
+);
+
+void
+EverCrypt_Chacha20Poly1305_stream_aad(
+  EverCrypt_Chacha20Poly1305_stream *st,
+  uint32_t len,
+  uint8_t *aad
+);
+
+/* out may alias text exactly. */
+void
+EverCrypt_Chacha20Poly1305_stream_encrypt(
+  EverCrypt_Chacha20Poly1305_stream *st,
+  uint32_t len,
+  uint8_t *out,
+  uint8_t *text
+);
+
+/* out may alias cipher exactly. The plaintext is released before the tag is checked: it must
+   not be used until the tag computed by EverCrypt_Chacha20Poly1305_stream_finish matches. */
+void
+EverCrypt_Chacha20Poly1305_stream_decrypt(
+  EverCrypt_Chacha20Poly1305_stream *st,
+  uint32_t len,
+  uint8_t *out,
+  uint8_t *cipher
+);
+
+/* Writes the 16-byte tag. The state must be initialized again before reuse. */
+void EverCrypt_Chacha20Poly1305_stream_finish(EverCrypt_Chacha20Poly1305_stream *st, uint8_t *tag);
+
 #define __EverCrypt_Chacha20Poly1305_H_DEFINED
 #endif
@@ -34,8 +34,53 @@ EverCrypt_Cipher_chacha20(
   uint32_t ctr
 )
 {
+  bool avx2 = EverCrypt_AutoConfig2_has_avx2();
+  bool avx = EverCrypt_AutoConfig2_has_avx();
+  #if EVERCRYPT_TARGETCONFIG_X64
+  if (avx2 && len > (uint32_t)256U)
+  {
+    Hacl_Chacha20_Vec256_chacha20_encrypt_256(len, dst, src, key, iv, ctr);
+    return;
+  }
+  #endif
+  #if EVERCRYPT_TARGETCONFIG_X64
+  if (avx && len > (uint32_t)64U)
+  {
+    Hacl_Chacha20_Vec128_chacha20_encrypt_128(len, dst, src, key, iv, ctr);
+    return;
+  }
+  #endif
   uint32_t ctx[16U] = { 0U };
   Hacl_Impl_Chacha20_chacha20_init(ctx, key, iv, ctr);
   Hacl_Impl_Chacha20_chacha20_update(ctx, len, dst, src);
 }
 
+void
+EverCrypt_Cipher_chacha20_hp_masks(uint32_t n, uint8_t *masks, uint8_t *key, uint8_t *samples)
+{
+  bool avx2 = EverCrypt_AutoConfig2_has_avx2();
+  bool avx = EverCrypt_AutoConfig2_has_avx();
+  #if EVERCRYPT_TARGETCONFIG_X64
+  if (avx2 && n > (uint32_t)4U)
+  {
+    Hacl_Chacha20_Vec256_chacha20_hp_masks_256(n, masks, key, samples);
+    return;
+  }
+  #endif
+  #if EVERCRYPT_TARGETCONFIG_X64
+  if (avx && n > (uint32_t)1U)
+  {
+    Hacl_Chacha20_Vec128_chacha20_hp_masks_128(n, masks, key, samples);
+    return;
+  }
+  #endif
+  for (uint32_t i = (uint32_t)0U; i < n; i++)
+  {
+    uint8_t *sample = samples + i * (uint32_t)16U;
+    uint8_t zero[5U] = { 0U };
+    uint32_t ctx[16U] = { 0U };
+    Hacl_Impl_Chacha20_chacha20_init(ctx, key, sample + (uint32_t)4U, load32_le(sample));
+    Hacl_Impl_Chacha20_chacha20_update(ctx, (uint32_t)5U, masks + i * (uint32_t)5U, zero);
+  }
+}
+
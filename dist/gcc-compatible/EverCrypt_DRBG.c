@@ -272,6 +272,97 @@ EverCrypt_DRBG_state_s *EverCrypt_DRBG_create(Spec_Hash_Definitions_hash_alg a)
   return buf;
 }
 
+/* Caller-provided storage holds the state record first, then the reseed counter at the next
+   multiple of 16 bytes, then k and v. */
+static uint32_t ctr_offset()
+{
+  uint32_t len = (uint32_t)sizeof (EverCrypt_DRBG_state_s);
+  return (len + (uint32_t)15U) / (uint32_t)16U * (uint32_t)16U;
+}
+
+static uint32_t kv_len(Spec_Hash_Definitions_hash_alg a)
+{
+  switch (a)
+  {
+    case Spec_Hash_Definitions_SHA1:
+      {
+        return (uint32_t)20U;
+      }
+    case Spec_Hash_Definitions_SHA2_256:
+      {
+        return (uint32_t)32U;
+      }
+    case Spec_Hash_Definitions_SHA2_384:
+      {
+        return (uint32_t)48U;
+      }
+    case Spec_Hash_Definitions_SHA2_512:
+      {
+        return (uint32_t)64U;
+      }
+    default:
+      {
+        return (uint32_t)0U;
+      }
+  }
+}
+
+uint32_t EverCrypt_DRBG_size(Spec_Hash_Definitions_hash_alg a)
+{
+  uint32_t len = kv_len(a);
+  if (len == (uint32_t)0U)
+  {
+    return (uint32_t)0U;
+  }
+  return ctr_offset() + (uint32_t)sizeof (uint32_t) + (uint32_t)2U * len;
+}
+
+EverCrypt_DRBG_state_s *EverCrypt_DRBG_init_in_place(Spec_Hash_Definitions_hash_alg a, void *mem)
+{
+  uint32_t *ctr = (uint32_t *)((uint8_t *)mem + ctr_offset());
+  uint8_t *k = (uint8_t *)(ctr + (uint32_t)1U);
+  uint8_t *v = k + kv_len(a);
+  memset(k, 0U, kv_len(a) * sizeof (k[0U]));
+  memset(v, 0U, kv_len(a) * sizeof (v[0U]));
+  ctr[0U] = (uint32_t)1U;
+  Hacl_HMAC_DRBG_state s = { .k = k, .v = v, .reseed_counter = ctr };
+  EverCrypt_DRBG_state_s st;
+  switch (a)
+  {
+    case Spec_Hash_Definitions_SHA1:
+      {
+        st = ((EverCrypt_DRBG_state_s){ .tag = EverCrypt_DRBG_SHA1_s, { .case_SHA1_s = s } });
+        break;
+      }
+    case Spec_Hash_Definitions_SHA2_256:
+      {
+        st =
+          ((EverCrypt_DRBG_state_s){ .tag = EverCrypt_DRBG_SHA2_256_s, { .case_SHA2_256_s = s } });
+        break;
+      }
+    case Spec_Hash_Definitions_SHA2_384:
+      {
+        st =
+          ((EverCrypt_DRBG_state_s){ .tag = EverCrypt_DRBG_SHA2_384_s, { .case_SHA2_384_s = s } });
+        break;
+      }
+    case Spec_Hash_Definitions_SHA2_512:
+      {
+        st =
+          ((EverCrypt_DRBG_state_s){ .tag = EverCrypt_DRBG_SHA2_512_s, { .case_SHA2_512_s = s } });
+        break;
+      }
+    default:
+      {
+        KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
+        KRML_HOST_EXIT(253U);
+      }
+  }
+  EverCrypt_DRBG_state_s *buf = (EverCrypt_DRBG_state_s *)mem;
+  buf[0U] = st;
+  return buf;
+}
+
 bool
 EverCrypt_DRBG_instantiate_sha1(
   EverCrypt_DRBG_state_s *st,
@@ -2118,3 +2209,44 @@ void EverCrypt_DRBG_uninstantiate(EverCrypt_DRBG_state_s *st)
   KRML_HOST_EXIT(255U);
 }
 
+void EverCrypt_DRBG_uninstantiate_in_place(EverCrypt_DRBG_state_s *st)
+{
+  EverCrypt_DRBG_state_s st_s = *st;
+  Hacl_HMAC_DRBG_state s;
+  uint32_t len;
+  if (st_s.tag == EverCrypt_DRBG_SHA1_s)
+  {
+    s = st_s.case_SHA1_s;
+    len = (uint32_t)20U;
+  }
+  else if (st_s.tag == EverCrypt_DRBG_SHA2_256_s)
+  {
+    s = st_s.case_SHA2_256_s;
+    len = (uint32_t)32U;
+  }
+  else if (st_s.tag == EverCrypt_DRBG_SHA2_384_s)
+  {
+    s = st_s.case_SHA2_384_s;
+    len = (uint32_t)48U;
+  }
+  else if (st_s.tag == EverCrypt_DRBG_SHA2_512_s)
+  {
+    s = st_s.case_SHA2_512_s;
+    len = (uint32_t)64U;
+  }
+  else
+  {
+    KRML_HOST_EPRINTF("KreMLin abort at %s:%d\n%s\n",
+      __FILE__,
+      __LINE__,
+      "unreachable (pattern matches are exhaustive in F*)");
+    KRML_HOST_EXIT(255U);
+  }
+  uint8_t *k = s.k;
+  uint8_t *v = s.v;
+  uint32_t *ctr = s.reseed_counter;
+  Lib_Memzero_clear_words_u8(len, k);
+  Lib_Memzero_clear_words_u8(len, v);
+  ctr[0U] = (uint32_t)0U;
+}
+
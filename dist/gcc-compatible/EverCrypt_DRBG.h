@@ -111,6 +111,16 @@ EverCrypt_DRBG___proj__SHA2_512_s__item___0(
 
 EverCrypt_DRBG_state_s *EverCrypt_DRBG_create(Spec_Hash_Definitions_hash_alg a);
 
+/* Size in bytes of the storage EverCrypt_DRBG_init_in_place needs for algorithm a, or 0 if
+   a is not supported. */
+uint32_t EverCrypt_DRBG_size(Spec_Hash_Definitions_hash_alg a);
+
+/* Like EverCrypt_DRBG_create, but builds the state inside mem, which must hold
+   EverCrypt_DRBG_size(a) bytes and be 16-byte aligned. Nothing is allocated: the state
+   lives as long as mem does and must be released with EverCrypt_DRBG_uninstantiate_in_place
+   rather than EverCrypt_DRBG_uninstantiate. */
+EverCrypt_DRBG_state_s *EverCrypt_DRBG_init_in_place(Spec_Hash_Definitions_hash_alg a, void *mem);
+
 bool
 EverCrypt_DRBG_instantiate_sha1(
   EverCrypt_DRBG_state_s *st,
@@ -236,5 +246,9 @@ EverCrypt_DRBG_generate(
 
 void EverCrypt_DRBG_uninstantiate(EverCrypt_DRBG_state_s *st);
 
+/* Clears the secret state of a DRBG built with EverCrypt_DRBG_init_in_place, without
+   freeing it. */
+void EverCrypt_DRBG_uninstantiate_in_place(EverCrypt_DRBG_state_s *st);
+
 #define __EverCrypt_DRBG_H_DEFINED
 #endif
@@ -40,6 +40,7 @@
 #define EverCrypt_Error_AuthenticationFailure 3
 #define EverCrypt_Error_InvalidIVLength 4
 #define EverCrypt_Error_DecodeError 5
+#define EverCrypt_Error_MaximumLengthExceeded 6
 
 typedef uint8_t EverCrypt_Error_error_code;
 
@@ -55,5 +56,7 @@ bool EverCrypt_Error_uu___is_InvalidIVLength(EverCrypt_Error_error_code projecte
 
 bool EverCrypt_Error_uu___is_DecodeError(EverCrypt_Error_error_code projectee);
 
+bool EverCrypt_Error_uu___is_MaximumLengthExceeded(EverCrypt_Error_error_code projectee);
+
 #define __EverCrypt_Error_H_DEFINED
 #endif
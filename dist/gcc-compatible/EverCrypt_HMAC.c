@@ -373,3 +373,168 @@ EverCrypt_HMAC_compute(
   }
 }
 
+/* The key block XORed with ipad and with opad, for a block size of l bytes. */
+static void
+key_pads(
+  Spec_Hash_Definitions_hash_alg a,
+  uint32_t l,
+  uint8_t *key,
+  uint32_t keylen,
+  uint8_t *ipad,
+  uint8_t *opad
+)
+{
+  memset(ipad, 0U, l * sizeof (ipad[0U]));
+  if (keylen <= l)
+  {
+    memcpy(ipad, key, keylen * sizeof (key[0U]));
+  }
+  else
+  {
+    EverCrypt_Hash_hash(a, ipad, key, keylen);
+  }
+  for (uint32_t i = (uint32_t)0U; i < l; i++)
+  {
+    uint8_t ki = ipad[i];
+    ipad[i] = ki ^ (uint8_t)0x36U;
+    opad[i] = ki ^ (uint8_t)0x5cU;
+  }
+}
+
+void
+EverCrypt_HMAC_init_ctx(
+  EverCrypt_HMAC_ctx *ctx,
+  Spec_Hash_Definitions_hash_alg a,
+  uint8_t *key,
+  uint32_t keylen
+)
+{
+  uint8_t ipad[128U];
+  uint8_t opad[128U];
+  ctx->alg = a;
+  switch (a)
+  {
+    case Spec_Hash_Definitions_SHA1:
+      {
+        uint32_t *s = ctx->midstates.case_32;
+        key_pads(a, (uint32_t)64U, key, keylen, ipad, opad);
+        Hacl_Hash_Core_SHA1_legacy_init(s);
+        Hacl_Hash_SHA1_legacy_update_multi(s, ipad, (uint32_t)1U);
+        Hacl_Hash_Core_SHA1_legacy_init(s + (uint32_t)8U);
+        Hacl_Hash_SHA1_legacy_update_multi(s + (uint32_t)8U, opad, (uint32_t)1U);
+        break;
+      }
+    case Spec_Hash_Definitions_SHA2_256:
+      {
+        uint32_t *s = ctx->midstates.case_32;
+        key_pads(a, (uint32_t)64U, key, keylen, ipad, opad);
+        Hacl_Hash_Core_SHA2_init_256(s);
+        EverCrypt_Hash_update_multi_256(s, ipad, (uint32_t)1U);
+        Hacl_Hash_Core_SHA2_init_256(s + (uint32_t)8U);
+        EverCrypt_Hash_update_multi_256(s + (uint32_t)8U, opad, (uint32_t)1U);
+        break;
+      }
+    case Spec_Hash_Definitions_SHA2_384:
+      {
+        uint64_t *s = ctx->midstates.case_64;
+        key_pads(a, (uint32_t)128U, key, keylen, ipad, opad);
+        Hacl_Hash_Core_SHA2_init_384(s);
+        Hacl_Hash_SHA2_update_multi_384(s, ipad, (uint32_t)1U);
+        Hacl_Hash_Core_SHA2_init_384(s + (uint32_t)8U);
+        Hacl_Hash_SHA2_update_multi_384(s + (uint32_t)8U, opad, (uint32_t)1U);
+        break;
+      }
+    case Spec_Hash_Definitions_SHA2_512:
+      {
+        uint64_t *s = ctx->midstates.case_64;
+        key_pads(a, (uint32_t)128U, key, keylen, ipad, opad);
+        Hacl_Hash_Core_SHA2_init_512(s);
+        Hacl_Hash_SHA2_update_multi_512(s, ipad, (uint32_t)1U);
+        Hacl_Hash_Core_SHA2_init_512(s + (uint32_t)8U);
+        Hacl_Hash_SHA2_update_multi_512(s + (uint32_t)8U, opad, (uint32_t)1U);
+        break;
+      }
+    default:
+      {
+        KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
+        KRML_HOST_EXIT(253U);
+      }
+  }
+  Lib_Memzero0_memzero(ipad, (uint32_t)128U * sizeof (ipad[0U]));
+  Lib_Memzero0_memzero(opad, (uint32_t)128U * sizeof (opad[0U]));
+}
+
+void
+EverCrypt_HMAC_compute_with_ctx(
+  EverCrypt_HMAC_ctx *ctx,
+  uint8_t *mac,
+  uint8_t *data,
+  uint32_t datalen
+)
+{
+  uint8_t hash1[64U];
+  switch (ctx->alg)
+  {
+    case Spec_Hash_Definitions_SHA1:
+      {
+        uint32_t s[5U];
+        memcpy(s, ctx->midstates.case_32, (uint32_t)5U * sizeof (s[0U]));
+        Hacl_Hash_SHA1_legacy_update_last(s, (uint64_t)(uint32_t)64U, data, datalen);
+        Hacl_Hash_Core_SHA1_legacy_finish(s, hash1);
+        memcpy(s, ctx->midstates.case_32 + (uint32_t)8U, (uint32_t)5U * sizeof (s[0U]));
+        Hacl_Hash_SHA1_legacy_update_last(s, (uint64_t)(uint32_t)64U, hash1, (uint32_t)20U);
+        Hacl_Hash_Core_SHA1_legacy_finish(s, mac);
+        break;
+      }
+    case Spec_Hash_Definitions_SHA2_256:
+      {
+        uint32_t s[8U];
+        memcpy(s, ctx->midstates.case_32, (uint32_t)8U * sizeof (s[0U]));
+        EverCrypt_Hash_update_last_256(s, (uint64_t)(uint32_t)64U, data, datalen);
+        Hacl_Hash_Core_SHA2_finish_256(s, hash1);
+        memcpy(s, ctx->midstates.case_32 + (uint32_t)8U, (uint32_t)8U * sizeof (s[0U]));
+        EverCrypt_Hash_update_last_256(s, (uint64_t)(uint32_t)64U, hash1, (uint32_t)32U);
+        Hacl_Hash_Core_SHA2_finish_256(s, mac);
+        break;
+      }
+    case Spec_Hash_Definitions_SHA2_384:
+      {
+        uint64_t s[8U];
+        memcpy(s, ctx->midstates.case_64, (uint32_t)8U * sizeof (s[0U]));
+        Hacl_Hash_SHA2_update_last_384(s,
+          FStar_UInt128_uint64_to_uint128((uint64_t)(uint32_t)128U),
+          data,
+          datalen);
+        Hacl_Hash_Core_SHA2_finish_384(s, hash1);
+        memcpy(s, ctx->midstates.case_64 + (uint32_t)8U, (uint32_t)8U * sizeof (s[0U]));
+        Hacl_Hash_SHA2_update_last_384(s,
+          FStar_UInt128_uint64_to_uint128((uint64_t)(uint32_t)128U),
+          hash1,
+          (uint32_t)48U);
+        Hacl_Hash_Core_SHA2_finish_384(s, mac);
+        break;
+      }
+    case Spec_Hash_Definitions_SHA2_512:
+      {
+        uint64_t s[8U];
+        memcpy(s, ctx->midstates.case_64, (uint32_t)8U * sizeof (s[0U]));
+        Hacl_Hash_SHA2_update_last_512(s,
+          FStar_UInt128_uint64_to_uint128((uint64_t)(uint32_t)128U),
+          data,
+          datalen);
+        Hacl_Hash_Core_SHA2_finish_512(s, hash1);
+        memcpy(s, ctx->midstates.case_64 + (uint32_t)8U, (uint32_t)8U * sizeof (s[0U]));
+        Hacl_Hash_SHA2_update_last_512(s,
+          FStar_UInt128_uint64_to_uint128((uint64_t)(uint32_t)128U),
+          hash1,
+          (uint32_t)64U);
+        Hacl_Hash_Core_SHA2_finish_512(s, mac);
+        break;
+      }
+    default:
+      {
+        KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
+        KRML_HOST_EXIT(253U);
+      }
+  }
+}
@@ -35,6 +35,7 @@
 #include "Hacl_Hash.h"
 #include "Hacl_Spec.h"
 #include "EverCrypt_Hash.h"
+#include "Lib_Memzero0.h"
 
 
 void
@@ -87,5 +88,38 @@ EverCrypt_HMAC_compute(
   uint32_t datalen
 );
 
+/* HMAC under a fixed key. EverCrypt_HMAC_init_ctx compresses the key block XORed with ipad
+   and with opad once, and keeps both midstates, so that each EverCrypt_HMAC_compute_with_ctx
+   only compresses the blocks of the message and then one block for the outer hash. The
+   context holds key-equivalent material: the caller is responsible for erasing it. */
+typedef struct EverCrypt_HMAC_ctx_s
+{
+  Spec_Hash_Definitions_hash_alg alg;
+  union {
+    uint32_t case_32[16U];
+    uint64_t case_64[16U];
+  }
+  midstates;
+}
+EverCrypt_HMAC_ctx;
+
+/* a must satisfy EverCrypt_HMAC_is_supported_alg. */
+void
+EverCrypt_HMAC_init_ctx(
+  EverCrypt_HMAC_ctx *ctx,
+  Spec_Hash_Definitions_hash_alg a,
+  uint8_t *key,
+  uint32_t keylen
+);
+
+/* Same result as EverCrypt_HMAC_compute with the algorithm and key of ctx. */
+void
+EverCrypt_HMAC_compute_with_ctx(
+  EverCrypt_HMAC_ctx *ctx,
+  uint8_t *mac,
+  uint8_t *data,
+  uint32_t datalen
+);
+
 #define __EverCrypt_HMAC_H_DEFINED
 #endif
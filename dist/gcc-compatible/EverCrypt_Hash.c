@@ -336,6 +336,112 @@ EverCrypt_Hash_state_s *EverCrypt_Hash_create(Spec_Hash_Definitions_hash_alg a)
   return EverCrypt_Hash_create_in(a);
 }
 
+/* Caller-provided storage holds the state record first, then the hash state at the next
+   multiple of 16 bytes. */
+static uint32_t hash_state_offset()
+{
+  uint32_t len = (uint32_t)sizeof (EverCrypt_Hash_state_s);
+  return (len + (uint32_t)15U) / (uint32_t)16U * (uint32_t)16U;
+}
+
+uint32_t EverCrypt_Hash_size(Spec_Hash_Definitions_hash_alg a)
+{
+  switch (a)
+  {
+    case Spec_Hash_Definitions_MD5:
+      {
+        return hash_state_offset() + (uint32_t)4U * (uint32_t)sizeof (uint32_t);
+      }
+    case Spec_Hash_Definitions_SHA1:
+      {
+        return hash_state_offset() + (uint32_t)5U * (uint32_t)sizeof (uint32_t);
+      }
+    case Spec_Hash_Definitions_SHA2_224:
+      {
+        return hash_state_offset() + (uint32_t)8U * (uint32_t)sizeof (uint32_t);
+      }
+    case Spec_Hash_Definitions_SHA2_256:
+      {
+        return hash_state_offset() + (uint32_t)8U * (uint32_t)sizeof (uint32_t);
+      }
+    case Spec_Hash_Definitions_SHA2_384:
+      {
+        return hash_state_offset() + (uint32_t)8U * (uint32_t)sizeof (uint64_t);
+      }
+    case Spec_Hash_Definitions_SHA2_512:
+      {
+        return hash_state_offset() + (uint32_t)8U * (uint32_t)sizeof (uint64_t);
+      }
+    default:
+      {
+        return (uint32_t)0U;
+      }
+  }
+}
+
+EverCrypt_Hash_state_s *EverCrypt_Hash_init_in_place(Spec_Hash_Definitions_hash_alg a, void *mem)
+{
+  uint8_t *p = (uint8_t *)mem + hash_state_offset();
+  EverCrypt_Hash_state_s s;
+  switch (a)
+  {
+    case Spec_Hash_Definitions_MD5:
+      {
+        uint32_t *buf = (uint32_t *)p;
+        memset(buf, 0U, (uint32_t)4U * sizeof (buf[0U]));
+        s = ((EverCrypt_Hash_state_s){ .tag = EverCrypt_Hash_MD5_s, { .case_MD5_s = buf } });
+        break;
+      }
+    case Spec_Hash_Definitions_SHA1:
+      {
+        uint32_t *buf = (uint32_t *)p;
+        memset(buf, 0U, (uint32_t)5U * sizeof (buf[0U]));
+        s = ((EverCrypt_Hash_state_s){ .tag = EverCrypt_Hash_SHA1_s, { .case_SHA1_s = buf } });
+        break;
+      }
+    case Spec_Hash_Definitions_SHA2_224:
+      {
+        uint32_t *buf = (uint32_t *)p;
+        memset(buf, 0U, (uint32_t)8U * sizeof (buf[0U]));
+        s =
+          ((EverCrypt_Hash_state_s){ .tag = EverCrypt_Hash_SHA2_224_s, { .case_SHA2_224_s = buf } });
+        break;
+      }
+    case Spec_Hash_Definitions_SHA2_256:
+      {
+        uint32_t *buf = (uint32_t *)p;
+        memset(buf, 0U, (uint32_t)8U * sizeof (buf[0U]));
+        s =
+          ((EverCrypt_Hash_state_s){ .tag = EverCrypt_Hash_SHA2_256_s, { .case_SHA2_256_s = buf } });
+        break;
+      }
+    case Spec_Hash_Definitions_SHA2_384:
+      {
+        uint64_t *buf = (uint64_t *)p;
+        memset(buf, 0U, (uint32_t)8U * sizeof (buf[0U]));
+        s =
+          ((EverCrypt_Hash_state_s){ .tag = EverCrypt_Hash_SHA2_384_s, { .case_SHA2_384_s = buf } });
+        break;
+      }
+    case Spec_Hash_Definitions_SHA2_512:
+      {
+        uint64_t *buf = (uint64_t *)p;
+        memset(buf, 0U, (uint32_t)8U * sizeof (buf[0U]));
+        s =
+          ((EverCrypt_Hash_state_s){ .tag = EverCrypt_Hash_SHA2_512_s, { .case_SHA2_512_s = buf } });
+        break;
+      }
+    default:
+      {
+        KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
+        KRML_HOST_EXIT(253U);
+      }
+  }
+  EverCrypt_Hash_state_s *buf = (EverCrypt_Hash_state_s *)mem;
+  buf[0U] = s;
+  return buf;
+}
+
 void EverCrypt_Hash_init(EverCrypt_Hash_state_s *s)
 {
   EverCrypt_Hash_state_s scrut = *s;
@@ -950,6 +1056,40 @@ Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____
   return p;
 }
 
+/* Caller-provided storage holds the streaming state record, then the block state at the next
+   multiple of 16 bytes, then the buffer for one block of input. */
+static uint32_t block_state_offset()
+{
+  uint32_t len = (uint32_t)sizeof (Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____);
+  return (len + (uint32_t)15U) / (uint32_t)16U * (uint32_t)16U;
+}
+
+uint32_t EverCrypt_Hash_Incremental_size(Spec_Hash_Definitions_hash_alg a)
+{
+  uint32_t len = EverCrypt_Hash_size(a);
+  if (len == (uint32_t)0U)
+  {
+    return (uint32_t)0U;
+  }
+  return block_state_offset() + len + Hacl_Hash_Definitions_block_len(a);
+}
+
+Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____
+*EverCrypt_Hash_Incremental_init_in_place(Spec_Hash_Definitions_hash_alg a, void *mem)
+{
+  uint8_t *block_state_mem = (uint8_t *)mem + block_state_offset();
+  uint8_t *buf = block_state_mem + EverCrypt_Hash_size(a);
+  memset(buf, 0U, Hacl_Hash_Definitions_block_len(a) * sizeof (buf[0U]));
+  EverCrypt_Hash_state_s *block_state = EverCrypt_Hash_init_in_place(a, block_state_mem);
+  Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____
+  s = { .block_state = block_state, .buf = buf, .total_len = (uint64_t)0U };
+  Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____
+  *p = (Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____ *)mem;
+  p[0U] = s;
+  EverCrypt_Hash_init(block_state);
+  return p;
+}
+
 void
 EverCrypt_Hash_Incremental_init(Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____ *s)
 {
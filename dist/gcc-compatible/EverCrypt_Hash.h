@@ -150,6 +150,15 @@ EverCrypt_Hash_state_s *EverCrypt_Hash_create_in(Spec_Hash_Definitions_hash_alg
 
 EverCrypt_Hash_state_s *EverCrypt_Hash_create(Spec_Hash_Definitions_hash_alg a);
 
+/* Size in bytes of the storage EverCrypt_Hash_init_in_place needs for algorithm a, or 0 if
+   a is not supported. */
+uint32_t EverCrypt_Hash_size(Spec_Hash_Definitions_hash_alg a);
+
+/* Like EverCrypt_Hash_create_in, but builds the state inside mem, which must hold
+   EverCrypt_Hash_size(a) bytes and be 16-byte aligned. Nothing is allocated: the state
+   lives as long as mem does and must not be passed to EverCrypt_Hash_free. */
+EverCrypt_Hash_state_s *EverCrypt_Hash_init_in_place(Spec_Hash_Definitions_hash_alg a, void *mem);
+
 void EverCrypt_Hash_init(EverCrypt_Hash_state_s *s);
 
 void EverCrypt_Hash_update_multi_256(uint32_t *s, uint8_t *blocks, uint32_t n);
@@ -192,6 +201,17 @@ Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____;
 Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____
 *EverCrypt_Hash_Incremental_create_in(Spec_Hash_Definitions_hash_alg a);
 
+/* Size in bytes of the storage EverCrypt_Hash_Incremental_init_in_place needs for
+   algorithm a, or 0 if a is not supported. */
+uint32_t EverCrypt_Hash_Incremental_size(Spec_Hash_Definitions_hash_alg a);
+
+/* Like EverCrypt_Hash_Incremental_create_in, but builds the state inside mem, which must
+   hold EverCrypt_Hash_Incremental_size(a) bytes and be 16-byte aligned. Nothing is
+   allocated: the state lives as long as mem does and must not be passed to
+   EverCrypt_Hash_Incremental_free. */
+Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____
+*EverCrypt_Hash_Incremental_init_in_place(Spec_Hash_Definitions_hash_alg a, void *mem);
+
 void
 EverCrypt_Hash_Incremental_init(Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____ *s);
 
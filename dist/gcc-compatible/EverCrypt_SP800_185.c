@@ -0,0 +1,95 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "EverCrypt_SP800_185.h"
+
+bool
+EverCrypt_SP800_185_parallelhash128(
+  uint32_t blockByteLen,
+  uint32_t inputByteLen,
+  uint8_t *input,
+  uint32_t customByteLen,
+  uint8_t *custom,
+  uint32_t outputByteLen,
+  uint8_t *output
+)
+{
+  bool avx2 = EverCrypt_AutoConfig2_has_avx2();
+  #if EVERCRYPT_TARGETCONFIG_X64
+  if (avx2)
+  {
+    return
+      Hacl_SP800_185_parallelhash128_vec256(blockByteLen,
+        inputByteLen,
+        input,
+        customByteLen,
+        custom,
+        outputByteLen,
+        output);
+  }
+  #endif
+  return
+    Hacl_SP800_185_parallelhash128(blockByteLen,
+      inputByteLen,
+      input,
+      customByteLen,
+      custom,
+      outputByteLen,
+      output);
+}
+
+bool
+EverCrypt_SP800_185_parallelhash256(
+  uint32_t blockByteLen,
+  uint32_t inputByteLen,
+  uint8_t *input,
+  uint32_t customByteLen,
+  uint8_t *custom,
+  uint32_t outputByteLen,
+  uint8_t *output
+)
+{
+  bool avx2 = EverCrypt_AutoConfig2_has_avx2();
+  #if EVERCRYPT_TARGETCONFIG_X64
+  if (avx2)
+  {
+    return
+      Hacl_SP800_185_parallelhash256_vec256(blockByteLen,
+        inputByteLen,
+        input,
+        customByteLen,
+        custom,
+        outputByteLen,
+        output);
+  }
+  #endif
+  return
+    Hacl_SP800_185_parallelhash256(blockByteLen,
+      inputByteLen,
+      input,
+      customByteLen,
+      custom,
+      outputByteLen,
+      output);
+}
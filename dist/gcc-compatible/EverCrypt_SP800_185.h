@@ -0,0 +1,63 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "evercrypt_targetconfig.h"
+#include "libintvector.h"
+#include "kremlin/internal/types.h"
+#include "kremlin/lowstar_endianness.h"
+#include <string.h>
+#include "kremlin/internal/target.h"
+
+#ifndef __EverCrypt_SP800_185_H
+#define __EverCrypt_SP800_185_H
+
+#include "EverCrypt_AutoConfig2.h"
+#include "Hacl_SP800_185.h"
+
+/* Dispatch to the Hacl_SP800_185_parallelhash functions, vectorized with AVX2
+   when available. Return false, leaving output untouched, if blockByteLen (the
+   block size B) is 0, and true otherwise. */
+bool
+EverCrypt_SP800_185_parallelhash128(
+  uint32_t blockByteLen,
+  uint32_t inputByteLen,
+  uint8_t *input,
+  uint32_t customByteLen,
+  uint8_t *custom,
+  uint32_t outputByteLen,
+  uint8_t *output
+);
+
+bool
+EverCrypt_SP800_185_parallelhash256(
+  uint32_t blockByteLen,
+  uint32_t inputByteLen,
+  uint8_t *input,
+  uint32_t customByteLen,
+  uint8_t *custom,
+  uint32_t outputByteLen,
+  uint8_t *output
+);
+
+#define __EverCrypt_SP800_185_H_DEFINED
+#endif
@@ -39,5 +39,13 @@ extern void Hacl_AES128_aes128_key_expansion(uint8_t *key, uint8_t *expanded_key
 extern void
 Hacl_AES128_aes128_encrypt_block(uint16_t *cipher, uint16_t *plain, uint8_t *expanded_key);
 
+extern void
+Hacl_AES128_aes128_encrypt_blocks(
+  uint32_t nblocks,
+  uint16_t *cipher,
+  uint16_t *plain,
+  uint8_t *expanded_key
+);
+
 #define __Hacl_AES128_H_DEFINED
 #endif
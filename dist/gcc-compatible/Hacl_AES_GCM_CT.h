@@ -0,0 +1,88 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "evercrypt_targetconfig.h"
+#include "libintvector.h"
+#include "kremlin/internal/types.h"
+#include "kremlin/lowstar_endianness.h"
+#include <string.h>
+#include "kremlin/internal/target.h"
+
+#ifndef __Hacl_AES_GCM_CT_H
+#define __Hacl_AES_GCM_CT_H
+
+#include "Hacl_Kremlib.h"
+#include "Lib_Memzero0.h"
+
+
+/* Portable streaming AES-GCM, for machines without AES-NI and PCLMULQDQ. AES is bitsliced,
+   four blocks at a time, and GHASH uses integer multiplications with masked-out carries: there
+   are no table lookups or branches on secret data, so both run in constant time on any CPU
+   with a constant-time 64-bit multiplier.
+
+   The interface mirrors Hacl_AES_GCM_NI, except for the key schedule, which is the one written
+   by Hacl_AES_GCM_CT_key_expansion. It is the same size as the standard AES key schedule,
+   16 * (nr + 1) bytes, but its layout is specific to this implementation. It is not copied and
+   must outlive the state. */
+typedef struct Hacl_AES_GCM_CT_state_s
+{
+  uint8_t *round_keys;
+  uint32_t nr;
+  uint8_t hkey[16U];
+  uint8_t j0[16U];
+  uint8_t ek0[16U];
+  uint8_t acc[16U];
+  uint8_t ks[16U];
+  uint8_t buf[16U];
+  uint64_t ad_len;
+  uint64_t text_len;
+}
+Hacl_AES_GCM_CT_state;
+
+/* Expands the 16-byte (nr = 10) or 32-byte (nr = 14) key into 16 * (nr + 1) bytes of
+   round_keys. */
+void Hacl_AES_GCM_CT_key_expansion(uint32_t nr, uint8_t *key, uint8_t *round_keys);
+
+/* nr is the number of rounds: 10 for AES-128, 14 for AES-256. iv_len must be non-zero. */
+void
+Hacl_AES_GCM_CT_init(
+  Hacl_AES_GCM_CT_state *st,
+  uint32_t nr,
+  uint8_t *round_keys,
+  uint8_t *iv,
+  uint32_t iv_len
+);
+
+void Hacl_AES_GCM_CT_aad(Hacl_AES_GCM_CT_state *st, uint32_t len, uint8_t *ad);
+
+void
+Hacl_AES_GCM_CT_encrypt(Hacl_AES_GCM_CT_state *st, uint32_t len, uint8_t *out, uint8_t *text);
+
+void
+Hacl_AES_GCM_CT_decrypt(Hacl_AES_GCM_CT_state *st, uint32_t len, uint8_t *out, uint8_t *cipher);
+
+/* Writes the 16-byte tag. The state must be initialized again before reuse. */
+void Hacl_AES_GCM_CT_finish(Hacl_AES_GCM_CT_state *st, uint8_t *tag);
+
+#define __Hacl_AES_GCM_CT_H_DEFINED
+#endif
@@ -0,0 +1,1548 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "Hacl_AES_GCM_NI.h"
+
+#if EVERCRYPT_TARGETCONFIG_X64 || EVERCRYPT_TARGETCONFIG_X86
+
+/* GHASH operands are kept byte-reversed (as loaded by vec128_load_be), so that the
+   carry-less products are computed on whole 64-bit lanes. The 256-bit products of several
+   blocks are summed before a single reduction. */
+
+static inline void
+clmul_wide(
+  Lib_IntVector_Intrinsics_vec128 a,
+  Lib_IntVector_Intrinsics_vec128 b,
+  Lib_IntVector_Intrinsics_vec128 *lo,
+  Lib_IntVector_Intrinsics_vec128 *mid,
+  Lib_IntVector_Intrinsics_vec128 *hi
+)
+{
+  lo[0U] =
+    Lib_IntVector_Intrinsics_vec128_xor(lo[0U],
+      Lib_IntVector_Intrinsics_ni_clmul(a, b, 0x00));
+  mid[0U] =
+    Lib_IntVector_Intrinsics_vec128_xor(mid[0U],
+      Lib_IntVector_Intrinsics_vec128_xor(Lib_IntVector_Intrinsics_ni_clmul(a, b, 0x01),
+        Lib_IntVector_Intrinsics_ni_clmul(a, b, 0x10)));
+  hi[0U] =
+    Lib_IntVector_Intrinsics_vec128_xor(hi[0U],
+      Lib_IntVector_Intrinsics_ni_clmul(a, b, 0x11));
+}
+
+static inline Lib_IntVector_Intrinsics_vec128
+reduce(
+  Lib_IntVector_Intrinsics_vec128 lo,
+  Lib_IntVector_Intrinsics_vec128 mid,
+  Lib_IntVector_Intrinsics_vec128 hi
+)
+{
+  Lib_IntVector_Intrinsics_vec128
+  l = Lib_IntVector_Intrinsics_vec128_xor(lo, Lib_IntVector_Intrinsics_vec128_shift_left(mid, 64));
+  Lib_IntVector_Intrinsics_vec128
+  h = Lib_IntVector_Intrinsics_vec128_xor(hi, Lib_IntVector_Intrinsics_vec128_shift_right(mid, 64));
+  /* The operands are bit-reflected: shift the product left by one. */
+  Lib_IntVector_Intrinsics_vec128 lc = Lib_IntVector_Intrinsics_vec128_shift_right32(l, 31);
+  Lib_IntVector_Intrinsics_vec128 hc = Lib_IntVector_Intrinsics_vec128_shift_right32(h, 31);
+  Lib_IntVector_Intrinsics_vec128 c = Lib_IntVector_Intrinsics_vec128_shift_right(lc, 96);
+  l =
+    Lib_IntVector_Intrinsics_vec128_or(Lib_IntVector_Intrinsics_vec128_shift_left32(l, 1),
+      Lib_IntVector_Intrinsics_vec128_shift_left(lc, 32));
+  h =
+    Lib_IntVector_Intrinsics_vec128_or(Lib_IntVector_Intrinsics_vec128_shift_left32(h, 1),
+      Lib_IntVector_Intrinsics_vec128_shift_left(hc, 32));
+  h = Lib_IntVector_Intrinsics_vec128_or(h, c);
+  /* Reduce modulo x^128 + x^7 + x^2 + x + 1. */
+  Lib_IntVector_Intrinsics_vec128
+  a =
+    Lib_IntVector_Intrinsics_vec128_xor(Lib_IntVector_Intrinsics_vec128_shift_left32(l, 31),
+      Lib_IntVector_Intrinsics_vec128_xor(Lib_IntVector_Intrinsics_vec128_shift_left32(l, 30),
+        Lib_IntVector_Intrinsics_vec128_shift_left32(l, 25)));
+  Lib_IntVector_Intrinsics_vec128 b = Lib_IntVector_Intrinsics_vec128_shift_right(a, 32);
+  l = Lib_IntVector_Intrinsics_vec128_xor(l, Lib_IntVector_Intrinsics_vec128_shift_left(a, 96));
+  Lib_IntVector_Intrinsics_vec128
+  d =
+    Lib_IntVector_Intrinsics_vec128_xor(Lib_IntVector_Intrinsics_vec128_shift_right32(l, 1),
+      Lib_IntVector_Intrinsics_vec128_xor(Lib_IntVector_Intrinsics_vec128_shift_right32(l, 2),
+        Lib_IntVector_Intrinsics_vec128_shift_right32(l, 7)));
+  d = Lib_IntVector_Intrinsics_vec128_xor(d, b);
+  l = Lib_IntVector_Intrinsics_vec128_xor(l, d);
+  return Lib_IntVector_Intrinsics_vec128_xor(h, l);
+}
+
+static inline Lib_IntVector_Intrinsics_vec128
+gf128_mul(Lib_IntVector_Intrinsics_vec128 a, Lib_IntVector_Intrinsics_vec128 b)
+{
+  Lib_IntVector_Intrinsics_vec128 lo = Lib_IntVector_Intrinsics_vec128_zero;
+  Lib_IntVector_Intrinsics_vec128 mid = Lib_IntVector_Intrinsics_vec128_zero;
+  Lib_IntVector_Intrinsics_vec128 hi = Lib_IntVector_Intrinsics_vec128_zero;
+  clmul_wide(a, b, &lo, &mid, &hi);
+  return reduce(lo, mid, hi);
+}
+
+/* acc = (acc + x[0]) * H^n + x[1] * H^(n - 1) + ... + x[n - 1] * H, for 1 <= n <= 8
+   consecutive blocks. */
+static inline Lib_IntVector_Intrinsics_vec128
+ghash_n(
+  Lib_IntVector_Intrinsics_vec128 *h,
+  Lib_IntVector_Intrinsics_vec128 acc,
+  uint32_t n,
+  Lib_IntVector_Intrinsics_vec128 *x
+)
+{
+  Lib_IntVector_Intrinsics_vec128 lo = Lib_IntVector_Intrinsics_vec128_zero;
+  Lib_IntVector_Intrinsics_vec128 mid = Lib_IntVector_Intrinsics_vec128_zero;
+  Lib_IntVector_Intrinsics_vec128 hi = Lib_IntVector_Intrinsics_vec128_zero;
+  clmul_wide(Lib_IntVector_Intrinsics_vec128_xor(acc, x[0U]), h[n - (uint32_t)1U], &lo, &mid, &hi);
+  for (uint32_t j = (uint32_t)1U; j < n; j++)
+  {
+    clmul_wide(x[j], h[n - (uint32_t)1U - j], &lo, &mid, &hi);
+  }
+  return reduce(lo, mid, hi);
+}
+
+/* The number of blocks to process next, out of n available: batches of 8 (when hn is, and
+   H^5 .. H^8 are available), 4, or single blocks. Fixed batch sizes let the batches be fully
+   unrolled. */
+static inline uint32_t batch(uint32_t hn, uint32_t n)
+{
+  if (n >= hn)
+  {
+    return hn;
+  }
+  if (n >= (uint32_t)4U)
+  {
+    return (uint32_t)4U;
+  }
+  return (uint32_t)1U;
+}
+
+static inline Lib_IntVector_Intrinsics_vec128
+ghash_load_n(
+  Lib_IntVector_Intrinsics_vec128 *h,
+  Lib_IntVector_Intrinsics_vec128 acc,
+  uint32_t n,
+  uint8_t *data
+)
+{
+  Lib_IntVector_Intrinsics_vec128 x[8U];
+  for (uint32_t j = (uint32_t)0U; j < n; j++)
+  {
+    x[j] = Lib_IntVector_Intrinsics_vec128_load_be(data + (uint32_t)16U * j);
+  }
+  return ghash_n(h, acc, n, x);
+}
+
+/* Absorbs blocks of data, up to hn at a time; len is a multiple of 16. */
+static inline Lib_IntVector_Intrinsics_vec128
+ghash_blocks(
+  Lib_IntVector_Intrinsics_vec128 *h,
+  uint32_t hn,
+  Lib_IntVector_Intrinsics_vec128 acc,
+  uint32_t len,
+  uint8_t *data
+)
+{
+  uint32_t i = (uint32_t)0U;
+  while (i < len)
+  {
+    uint32_t n = batch(hn, (len - i) / (uint32_t)16U);
+    if (n == (uint32_t)8U)
+    {
+      acc = ghash_load_n(h, acc, (uint32_t)8U, data + i);
+    }
+    else if (n == (uint32_t)4U)
+    {
+      acc = ghash_load_n(h, acc, (uint32_t)4U, data + i);
+    }
+    else
+    {
+      acc = ghash_load_n(h, acc, (uint32_t)1U, data + i);
+    }
+    i = i + (uint32_t)16U * n;
+  }
+  return acc;
+}
+
+/* Absorbs the first len bytes of buf, zero-padded to a block. */
+static inline Lib_IntVector_Intrinsics_vec128
+ghash_padded(
+  Lib_IntVector_Intrinsics_vec128 *h,
+  Lib_IntVector_Intrinsics_vec128 acc,
+  uint32_t len,
+  uint8_t *buf
+)
+{
+  uint8_t block[16U] = { 0U };
+  memcpy(block, buf, len * sizeof (buf[0U]));
+  Lib_IntVector_Intrinsics_vec128 x = Lib_IntVector_Intrinsics_vec128_load_be(block);
+  return gf128_mul(Lib_IntVector_Intrinsics_vec128_xor(acc, x), h[0U]);
+}
+
+static inline void load_round_keys(Hacl_AES_GCM_NI_state *st, Lib_IntVector_Intrinsics_vec128 *k)
+{
+  for (uint32_t i = (uint32_t)0U; i <= st->nr; i++)
+  {
+    k[i] = Lib_IntVector_Intrinsics_vec128_load_le(st->round_keys + (uint32_t)16U * i);
+  }
+}
+
+/* Loads the powers of H computed so far. H^5 .. H^8 are only computed once an input is long
+   enough to use them. Returns the number of powers, which bounds the aggregation. */
+static inline uint32_t
+load_hkeys(Hacl_AES_GCM_NI_state *st, Lib_IntVector_Intrinsics_vec128 *h, uint32_t len)
+{
+  for (uint32_t i = (uint32_t)0U; i < st->hkeys_len; i++)
+  {
+    h[i] = Lib_IntVector_Intrinsics_vec128_load_le(st->hkeys + (uint32_t)16U * i);
+  }
+  if (st->hkeys_len < (uint32_t)8U && len >= (uint32_t)128U)
+  {
+    for (uint32_t i = st->hkeys_len; i < (uint32_t)8U; i++)
+    {
+      h[i] = gf128_mul(h[i - (uint32_t)1U], h[0U]);
+      Lib_IntVector_Intrinsics_vec128_store_le(st->hkeys + (uint32_t)16U * i, h[i]);
+    }
+    st->hkeys_len = (uint32_t)8U;
+  }
+  return st->hkeys_len;
+}
+
+static inline Lib_IntVector_Intrinsics_vec128
+aes_enc(Lib_IntVector_Intrinsics_vec128 *k, uint32_t nr, Lib_IntVector_Intrinsics_vec128 b)
+{
+  b = Lib_IntVector_Intrinsics_vec128_xor(b, k[0U]);
+  for (uint32_t r = (uint32_t)1U; r < nr; r++)
+  {
+    b = Lib_IntVector_Intrinsics_ni_aes_enc(b, k[r]);
+  }
+  return Lib_IntVector_Intrinsics_ni_aes_enc_last(b, k[nr]);
+}
+
+/* The counter block for 32-bit counter c: the last word of J0 is replaced, big-endian. */
+static inline Lib_IntVector_Intrinsics_vec128
+counter_block(Lib_IntVector_Intrinsics_vec128 j0, uint32_t c)
+{
+  return Lib_IntVector_Intrinsics_vec128_insert32(j0, htobe32(c), 3);
+}
+
+/* Absorbs any pending partial block of additional data, once the text starts. */
+static inline Lib_IntVector_Intrinsics_vec128
+flush_aad(
+  Hacl_AES_GCM_NI_state *st,
+  Lib_IntVector_Intrinsics_vec128 *h,
+  Lib_IntVector_Intrinsics_vec128 acc
+)
+{
+  uint32_t off = (uint32_t)(st->ad_len % (uint64_t)16U);
+  if (off != (uint32_t)0U)
+  {
+    return ghash_padded(h, acc, off, st->buf);
+  }
+  return acc;
+}
+
+/* One step of the key schedule: each word of k is xored with all the previous ones, then with
+   the broadcast word t. */
+static inline Lib_IntVector_Intrinsics_vec128
+key_step(Lib_IntVector_Intrinsics_vec128 k, Lib_IntVector_Intrinsics_vec128 t)
+{
+  k = Lib_IntVector_Intrinsics_vec128_xor(k, Lib_IntVector_Intrinsics_vec128_shift_left(k, 32));
+  k = Lib_IntVector_Intrinsics_vec128_xor(k, Lib_IntVector_Intrinsics_vec128_shift_left(k, 32));
+  k = Lib_IntVector_Intrinsics_vec128_xor(k, Lib_IntVector_Intrinsics_vec128_shift_left(k, 32));
+  return Lib_IntVector_Intrinsics_vec128_xor(k, t);
+}
+
+/* aeskeygenassist takes the round constant as an immediate, hence a macro. Word w of the
+   result is broadcast. */
+#define KEY_ASSIST(k, rcon, w) \
+  (Lib_IntVector_Intrinsics_vec128_shuffle32(Lib_IntVector_Intrinsics_ni_aes_keygen_assist(k, \
+        rcon), \
+      w, \
+      w, \
+      w, \
+      w))
+
+static void key_expansion128(uint8_t *key, Lib_IntVector_Intrinsics_vec128 *k)
+{
+  k[0U] = Lib_IntVector_Intrinsics_vec128_load_le(key);
+  k[1U] = key_step(k[0U], KEY_ASSIST(k[0U], 0x01, 3));
+  k[2U] = key_step(k[1U], KEY_ASSIST(k[1U], 0x02, 3));
+  k[3U] = key_step(k[2U], KEY_ASSIST(k[2U], 0x04, 3));
+  k[4U] = key_step(k[3U], KEY_ASSIST(k[3U], 0x08, 3));
+  k[5U] = key_step(k[4U], KEY_ASSIST(k[4U], 0x10, 3));
+  k[6U] = key_step(k[5U], KEY_ASSIST(k[5U], 0x20, 3));
+  k[7U] = key_step(k[6U], KEY_ASSIST(k[6U], 0x40, 3));
+  k[8U] = key_step(k[7U], KEY_ASSIST(k[7U], 0x80, 3));
+  k[9U] = key_step(k[8U], KEY_ASSIST(k[8U], 0x1b, 3));
+  k[10U] = key_step(k[9U], KEY_ASSIST(k[9U], 0x36, 3));
+}
+
+static void key_expansion256(uint8_t *key, Lib_IntVector_Intrinsics_vec128 *k)
+{
+  k[0U] = Lib_IntVector_Intrinsics_vec128_load_le(key);
+  k[1U] = Lib_IntVector_Intrinsics_vec128_load_le(key + (uint32_t)16U);
+  k[2U] = key_step(k[0U], KEY_ASSIST(k[1U], 0x01, 3));
+  k[3U] = key_step(k[1U], KEY_ASSIST(k[2U], 0x00, 2));
+  k[4U] = key_step(k[2U], KEY_ASSIST(k[3U], 0x02, 3));
+  k[5U] = key_step(k[3U], KEY_ASSIST(k[4U], 0x00, 2));
+  k[6U] = key_step(k[4U], KEY_ASSIST(k[5U], 0x04, 3));
+  k[7U] = key_step(k[5U], KEY_ASSIST(k[6U], 0x00, 2));
+  k[8U] = key_step(k[6U], KEY_ASSIST(k[7U], 0x08, 3));
+  k[9U] = key_step(k[7U], KEY_ASSIST(k[8U], 0x00, 2));
+  k[10U] = key_step(k[8U], KEY_ASSIST(k[9U], 0x10, 3));
+  k[11U] = key_step(k[9U], KEY_ASSIST(k[10U], 0x00, 2));
+  k[12U] = key_step(k[10U], KEY_ASSIST(k[11U], 0x20, 3));
+  k[13U] = key_step(k[11U], KEY_ASSIST(k[12U], 0x00, 2));
+  k[14U] = key_step(k[12U], KEY_ASSIST(k[13U], 0x40, 3));
+}
+
+/* XORs the keystream blocks b into in, writing out, and absorbs the n resulting ciphertext
+   blocks. For decryption, the input blocks are read before the output blocks are written, so
+   that out may alias in. */
+static inline Lib_IntVector_Intrinsics_vec128
+absorb_n(
+  Lib_IntVector_Intrinsics_vec128 *h,
+  bool enc,
+  uint32_t n,
+  Lib_IntVector_Intrinsics_vec128 *b,
+  uint8_t *out,
+  uint8_t *in,
+  Lib_IntVector_Intrinsics_vec128 acc
+)
+{
+  Lib_IntVector_Intrinsics_vec128 g[8U];
+  if (!enc)
+  {
+    for (uint32_t j = (uint32_t)0U; j < n; j++)
+    {
+      g[j] = Lib_IntVector_Intrinsics_vec128_load_be(in + (uint32_t)16U * j);
+    }
+  }
+  for (uint32_t j = (uint32_t)0U; j < n; j++)
+  {
+    Lib_IntVector_Intrinsics_vec128
+    x = Lib_IntVector_Intrinsics_vec128_load_le(in + (uint32_t)16U * j);
+    Lib_IntVector_Intrinsics_vec128_store_le(out + (uint32_t)16U * j,
+      Lib_IntVector_Intrinsics_vec128_xor(x, b[j]));
+  }
+  if (enc)
+  {
+    for (uint32_t j = (uint32_t)0U; j < n; j++)
+    {
+      g[j] = Lib_IntVector_Intrinsics_vec128_load_be(out + (uint32_t)16U * j);
+    }
+  }
+  return ghash_n(h, acc, n, g);
+}
+
+/* CTR and GHASH over n whole blocks, from counter c. */
+static inline Lib_IntVector_Intrinsics_vec128
+crypt_n(
+  Lib_IntVector_Intrinsics_vec128 *k,
+  uint32_t nr,
+  Lib_IntVector_Intrinsics_vec128 *h,
+  Lib_IntVector_Intrinsics_vec128 j0,
+  uint32_t c,
+  bool enc,
+  uint32_t n,
+  uint8_t *out,
+  uint8_t *in,
+  Lib_IntVector_Intrinsics_vec128 acc
+)
+{
+  Lib_IntVector_Intrinsics_vec128 b[8U];
+  for (uint32_t j = (uint32_t)0U; j < n; j++)
+  {
+    b[j] = Lib_IntVector_Intrinsics_vec128_xor(counter_block(j0, c + j), k[0U]);
+  }
+  for (uint32_t r = (uint32_t)1U; r < nr; r++)
+  {
+    for (uint32_t j = (uint32_t)0U; j < n; j++)
+    {
+      b[j] = Lib_IntVector_Intrinsics_ni_aes_enc(b[j], k[r]);
+    }
+  }
+  for (uint32_t j = (uint32_t)0U; j < n; j++)
+  {
+    b[j] = Lib_IntVector_Intrinsics_ni_aes_enc_last(b[j], k[nr]);
+  }
+  return absorb_n(h, enc, n, b, out, in, acc);
+}
+
+/* Bulk CTR and GHASH over the ciphertext. */
+static void
+crypt(Hacl_AES_GCM_NI_state *st, bool enc, uint32_t len, uint8_t *out, uint8_t *in)
+{
+  if (len == (uint32_t)0U)
+  {
+    return;
+  }
+  Lib_IntVector_Intrinsics_vec128 k[15U];
+  Lib_IntVector_Intrinsics_vec128 h[8U];
+  load_round_keys(st, k);
+  uint32_t hn = load_hkeys(st, h, len);
+  uint32_t nr = st->nr;
+  Lib_IntVector_Intrinsics_vec128 acc = Lib_IntVector_Intrinsics_vec128_load_le(st->acc);
+  if (st->text_len == (uint64_t)0U)
+  {
+    acc = flush_aad(st, h, acc);
+  }
+  Lib_IntVector_Intrinsics_vec128 j0 = Lib_IntVector_Intrinsics_vec128_load_le(st->j0);
+  uint32_t c0 = load32_be(st->j0 + (uint32_t)12U) + (uint32_t)1U;
+  uint32_t off = (uint32_t)(st->text_len % (uint64_t)16U);
+  uint32_t i = (uint32_t)0U;
+  if (off != (uint32_t)0U)
+  {
+    /* Finish the partial block left over by the previous call. */
+    uint32_t n = (uint32_t)16U - off;
+    if (len < n)
+    {
+      n = len;
+    }
+    for (uint32_t j = (uint32_t)0U; j < n; j++)
+    {
+      uint8_t x = in[j];
+      uint8_t y = x ^ st->ks[off + j];
+      out[j] = y;
+      st->buf[off + j] = enc ? y : x;
+    }
+    i = n;
+    if (off + n == (uint32_t)16U)
+    {
+      acc = ghash_padded(h, acc, (uint32_t)16U, st->buf);
+    }
+  }
+  /* From here on, block i of the call is block c - c0 of the message. */
+  uint32_t c = c0 + (uint32_t)((st->text_len + (uint64_t)i) / (uint64_t)16U);
+  while (i + (uint32_t)16U <= len)
+  {
+    uint32_t n = batch(hn, (len - i) / (uint32_t)16U);
+    if (n == (uint32_t)8U)
+    {
+      acc = crypt_n(k, nr, h, j0, c, enc, (uint32_t)8U, out + i, in + i, acc);
+    }
+    else if (n == (uint32_t)4U)
+    {
+      acc = crypt_n(k, nr, h, j0, c, enc, (uint32_t)4U, out + i, in + i, acc);
+    }
+    else
+    {
+      acc = crypt_n(k, nr, h, j0, c, enc, (uint32_t)1U, out + i, in + i, acc);
+    }
+    c = c + n;
+    i = i + (uint32_t)16U * n;
+  }
+  if (i < len)
+  {
+    /* Start a partial block, and keep its keystream for the next call. */
+    Lib_IntVector_Intrinsics_vec128 b = aes_enc(k, nr, counter_block(j0, c));
+    Lib_IntVector_Intrinsics_vec128_store_le(st->ks, b);
+    for (uint32_t j = (uint32_t)0U; j < len - i; j++)
+    {
+      uint8_t x = in[i + j];
+      uint8_t y = x ^ st->ks[j];
+      out[i + j] = y;
+      st->buf[j] = enc ? y : x;
+    }
+  }
+  st->text_len = st->text_len + (uint64_t)len;
+  Lib_IntVector_Intrinsics_vec128_store_le(st->acc, acc);
+}
+
+/* H = E(0), as loaded for GHASH. */
+static inline Lib_IntVector_Intrinsics_vec128
+hash_key(Lib_IntVector_Intrinsics_vec128 *k, uint32_t nr)
+{
+  uint8_t hb[16U] = { 0U };
+  Lib_IntVector_Intrinsics_vec128_store_le(hb,
+    aes_enc(k, nr, Lib_IntVector_Intrinsics_vec128_zero));
+  return Lib_IntVector_Intrinsics_vec128_load_be(hb);
+}
+
+/* Starts a message under iv, once the keys are in place. */
+static void
+init_iv(
+  Hacl_AES_GCM_NI_state *st,
+  Lib_IntVector_Intrinsics_vec128 *h,
+  uint8_t *iv,
+  uint32_t iv_len
+)
+{
+  st->ad_len = (uint64_t)0U;
+  st->text_len = (uint64_t)0U;
+  if (iv_len == (uint32_t)12U)
+  {
+    memcpy(st->j0, iv, (uint32_t)12U * sizeof (iv[0U]));
+    store32_be(st->j0 + (uint32_t)12U, (uint32_t)1U);
+  }
+  else
+  {
+    /* J0 = GHASH(iv || 0^s || 0^64 || [len(iv)]_64) */
+    uint32_t full = iv_len / (uint32_t)16U * (uint32_t)16U;
+    Lib_IntVector_Intrinsics_vec128
+    acc = ghash_blocks(h, (uint32_t)4U, Lib_IntVector_Intrinsics_vec128_zero, full, iv);
+    if (full < iv_len)
+    {
+      acc = ghash_padded(h, acc, iv_len - full, iv + full);
+    }
+    Lib_IntVector_Intrinsics_vec128
+    lb = Lib_IntVector_Intrinsics_vec128_load64s((uint64_t)iv_len * (uint64_t)8U, (uint64_t)0U);
+    acc = gf128_mul(Lib_IntVector_Intrinsics_vec128_xor(acc, lb), h[0U]);
+    Lib_IntVector_Intrinsics_vec128_store_be(st->j0, acc);
+  }
+  Lib_IntVector_Intrinsics_vec128_store_le(st->acc, Lib_IntVector_Intrinsics_vec128_zero);
+}
+
+/* The Vale table stores H^n multiplied by x, reduced modulo x^128 + x^7 + x^2 + x + 1 (the
+   constant 0xC2..01 in this bit order), in the same byte layout as hkeys: dividing by x gives
+   H^n back. */
+static inline void vale_hkey(uint8_t *dst, uint8_t *src)
+{
+  uint64_t lo = load64_le(src);
+  uint64_t hi = load64_le(src + (uint32_t)8U);
+  uint64_t m = (uint64_t)0U - (lo & (uint64_t)1U);
+  lo = lo ^ (m & (uint64_t)1U);
+  hi = hi ^ (m & (uint64_t)0xC200000000000000U);
+  store64_le(dst, lo >> (uint32_t)1U | hi << (uint32_t)63U);
+  store64_le(dst + (uint32_t)8U, hi >> (uint32_t)1U | m << (uint32_t)63U);
+}
+
+
+/* AES-256-GCM-SIV (RFC 8452). POLYVAL is GHASH over byte-reversed blocks, with the key
+   multiplied by x (RFC 8452, appendix A). Loading its blocks little-endian undoes the reversal,
+   so the GHASH kernels above are reused as is. */
+
+/* The 16-byte POLYVAL key, as a GHASH operand: mulX_GHASH(ByteReverse(H)). */
+static inline Lib_IntVector_Intrinsics_vec128 polyval_key(uint8_t *hb)
+{
+  uint64_t lo = load64_le(hb);
+  uint64_t hi = load64_le(hb + (uint32_t)8U);
+  uint64_t m = (uint64_t)0U - (lo & (uint64_t)1U);
+  uint64_t lo1 = lo >> (uint32_t)1U | hi << (uint32_t)63U;
+  uint64_t hi1 = hi >> (uint32_t)1U ^ (m & (uint64_t)0xe100000000000000U);
+  return Lib_IntVector_Intrinsics_vec128_load64s(lo1, hi1);
+}
+
+/* H^2 .. H^hn, with hn as large as a run of the given number of blocks can use. */
+static inline uint32_t polyval_powers(Lib_IntVector_Intrinsics_vec128 *h, uint32_t blocks)
+{
+  uint32_t hn = (uint32_t)1U;
+  if (blocks >= (uint32_t)8U)
+  {
+    hn = (uint32_t)8U;
+  }
+  else if (blocks >= (uint32_t)4U)
+  {
+    hn = (uint32_t)4U;
+  }
+  for (uint32_t i = (uint32_t)1U; i < hn; i++)
+  {
+    h[i] = gf128_mul(h[i - (uint32_t)1U], h[0U]);
+  }
+  return hn;
+}
+
+static inline Lib_IntVector_Intrinsics_vec128
+polyval_load_n(
+  Lib_IntVector_Intrinsics_vec128 *h,
+  Lib_IntVector_Intrinsics_vec128 acc,
+  uint32_t n,
+  uint8_t *data
+)
+{
+  Lib_IntVector_Intrinsics_vec128 x[8U];
+  for (uint32_t j = (uint32_t)0U; j < n; j++)
+  {
+    x[j] = Lib_IntVector_Intrinsics_vec128_load_le(data + (uint32_t)16U * j);
+  }
+  return ghash_n(h, acc, n, x);
+}
+
+/* Absorbs n whole blocks of data, with the fixed batch sizes of ghash_blocks. */
+static inline Lib_IntVector_Intrinsics_vec128
+polyval_batch(
+  Lib_IntVector_Intrinsics_vec128 *h,
+  Lib_IntVector_Intrinsics_vec128 acc,
+  uint32_t n,
+  uint8_t *data
+)
+{
+  if (n == (uint32_t)8U)
+  {
+    return polyval_load_n(h, acc, (uint32_t)8U, data);
+  }
+  if (n == (uint32_t)4U)
+  {
+    return polyval_load_n(h, acc, (uint32_t)4U, data);
+  }
+  return polyval_load_n(h, acc, (uint32_t)1U, data);
+}
+
+/* Absorbs the last len bytes of a field, 0 < len < 16, zero-padded. */
+static inline Lib_IntVector_Intrinsics_vec128
+polyval_last(
+  Lib_IntVector_Intrinsics_vec128 *h,
+  Lib_IntVector_Intrinsics_vec128 acc,
+  uint32_t len,
+  uint8_t *data
+)
+{
+  uint8_t block[16U] = { 0U };
+  memcpy(block, data, len * sizeof (data[0U]));
+  Lib_IntVector_Intrinsics_vec128 x = Lib_IntVector_Intrinsics_vec128_load_le(block);
+  return gf128_mul(Lib_IntVector_Intrinsics_vec128_xor(acc, x), h[0U]);
+}
+
+/* Absorbs the len bytes of data, zero-padded to a whole number of blocks. */
+static inline Lib_IntVector_Intrinsics_vec128
+polyval_field(
+  Lib_IntVector_Intrinsics_vec128 *h,
+  uint32_t hn,
+  Lib_IntVector_Intrinsics_vec128 acc,
+  uint32_t len,
+  uint8_t *data
+)
+{
+  uint32_t full = len / (uint32_t)16U * (uint32_t)16U;
+  uint32_t i = (uint32_t)0U;
+  while (i < full)
+  {
+    uint32_t n = batch(hn, (full - i) / (uint32_t)16U);
+    acc = polyval_batch(h, acc, n, data + i);
+    i = i + (uint32_t)16U * n;
+  }
+  if (full < len)
+  {
+    acc = polyval_last(h, acc, len - full, data + full);
+  }
+  return acc;
+}
+
+/* Derives the per-nonce keys from the master round keys k: the message authentication key, as
+   the POLYVAL key h[0], and the round keys ek of the message encryption key. */
+static void
+siv_derive_keys(
+  Lib_IntVector_Intrinsics_vec128 *k,
+  uint8_t *n,
+  Lib_IntVector_Intrinsics_vec128 *h,
+  Lib_IntVector_Intrinsics_vec128 *ek
+)
+{
+  uint8_t nb[16U] = { 0U };
+  memcpy(nb + (uint32_t)4U, n, (uint32_t)12U * sizeof (n[0U]));
+  Lib_IntVector_Intrinsics_vec128 base = Lib_IntVector_Intrinsics_vec128_load_le(nb);
+  Lib_IntVector_Intrinsics_vec128 b[6U];
+  for (uint32_t j = (uint32_t)0U; j < (uint32_t)6U; j++)
+  {
+    b[j] =
+      Lib_IntVector_Intrinsics_vec128_xor(Lib_IntVector_Intrinsics_vec128_insert32(base, j, 0),
+        k[0U]);
+  }
+  for (uint32_t r = (uint32_t)1U; r < (uint32_t)14U; r++)
+  {
+    for (uint32_t j = (uint32_t)0U; j < (uint32_t)6U; j++)
+    {
+      b[j] = Lib_IntVector_Intrinsics_ni_aes_enc(b[j], k[r]);
+    }
+  }
+  for (uint32_t j = (uint32_t)0U; j < (uint32_t)6U; j++)
+  {
+    b[j] = Lib_IntVector_Intrinsics_ni_aes_enc_last(b[j], k[14U]);
+  }
+  /* Each key is made of the first 8 bytes of consecutive blocks. */
+  uint8_t keys[48U] = { 0U };
+  for (uint32_t j = (uint32_t)0U; j < (uint32_t)3U; j++)
+  {
+    Lib_IntVector_Intrinsics_vec128_store_le(keys + (uint32_t)16U * j,
+      Lib_IntVector_Intrinsics_vec128_interleave_low64(b[(uint32_t)2U * j],
+        b[(uint32_t)2U * j + (uint32_t)1U]));
+  }
+  h[0U] = polyval_key(keys);
+  key_expansion256(keys + (uint32_t)16U, ek);
+  Lib_Memzero0_memzero(keys, (uint32_t)48U * sizeof (keys[0U]));
+}
+
+/* POLYVAL over the padded additional data, the padded text and the length block, in acc once
+   the fields before the length block have been absorbed. Returns the tag. */
+static inline Lib_IntVector_Intrinsics_vec128
+siv_tag(
+  Lib_IntVector_Intrinsics_vec128 *ek,
+  Lib_IntVector_Intrinsics_vec128 *h,
+  Lib_IntVector_Intrinsics_vec128 acc,
+  uint8_t *n,
+  uint32_t ad_len,
+  uint32_t len
+)
+{
+  Lib_IntVector_Intrinsics_vec128
+  lb =
+    Lib_IntVector_Intrinsics_vec128_load64s((uint64_t)ad_len * (uint64_t)8U,
+      (uint64_t)len * (uint64_t)8U);
+  acc = gf128_mul(Lib_IntVector_Intrinsics_vec128_xor(acc, lb), h[0U]);
+  uint8_t s[16U] = { 0U };
+  Lib_IntVector_Intrinsics_vec128_store_le(s, acc);
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)12U; i++)
+  {
+    s[i] = s[i] ^ n[i];
+  }
+  s[15U] = s[15U] & (uint8_t)0x7fU;
+  return aes_enc(ek, (uint32_t)14U, Lib_IntVector_Intrinsics_vec128_load_le(s));
+}
+
+/* CTR over n whole blocks from counter c. The counter is the first word of the counter block,
+   little-endian, and wraps around. */
+static inline void
+siv_ctr_n(
+  Lib_IntVector_Intrinsics_vec128 *ek,
+  Lib_IntVector_Intrinsics_vec128 cb,
+  uint32_t c,
+  uint32_t n,
+  uint8_t *out,
+  uint8_t *in
+)
+{
+  Lib_IntVector_Intrinsics_vec128 b[8U];
+  for (uint32_t j = (uint32_t)0U; j < n; j++)
+  {
+    b[j] =
+      Lib_IntVector_Intrinsics_vec128_xor(Lib_IntVector_Intrinsics_vec128_insert32(cb, c + j, 0),
+        ek[0U]);
+  }
+  for (uint32_t r = (uint32_t)1U; r < (uint32_t)14U; r++)
+  {
+    for (uint32_t j = (uint32_t)0U; j < n; j++)
+    {
+      b[j] = Lib_IntVector_Intrinsics_ni_aes_enc(b[j], ek[r]);
+    }
+  }
+  for (uint32_t j = (uint32_t)0U; j < n; j++)
+  {
+    b[j] = Lib_IntVector_Intrinsics_ni_aes_enc_last(b[j], ek[14U]);
+  }
+  for (uint32_t j = (uint32_t)0U; j < n; j++)
+  {
+    Lib_IntVector_Intrinsics_vec128
+    x = Lib_IntVector_Intrinsics_vec128_load_le(in + (uint32_t)16U * j);
+    Lib_IntVector_Intrinsics_vec128_store_le(out + (uint32_t)16U * j,
+      Lib_IntVector_Intrinsics_vec128_xor(x, b[j]));
+  }
+}
+
+/* CTR from the tag. When decrypting (dec), the plaintext is absorbed into acc as it is
+   written, while it is still in cache; the updated acc is returned. */
+static Lib_IntVector_Intrinsics_vec128
+siv_crypt(
+  Lib_IntVector_Intrinsics_vec128 *ek,
+  Lib_IntVector_Intrinsics_vec128 *h,
+  uint32_t hn,
+  Lib_IntVector_Intrinsics_vec128 tag,
+  bool dec,
+  uint32_t len,
+  uint8_t *out,
+  uint8_t *in,
+  Lib_IntVector_Intrinsics_vec128 acc
+)
+{
+  uint8_t cbb[16U] = { 0U };
+  Lib_IntVector_Intrinsics_vec128_store_le(cbb, tag);
+  cbb[15U] = cbb[15U] | (uint8_t)0x80U;
+  Lib_IntVector_Intrinsics_vec128 cb = Lib_IntVector_Intrinsics_vec128_load_le(cbb);
+  uint32_t c = load32_le(cbb);
+  uint32_t i = (uint32_t)0U;
+  while (i + (uint32_t)16U <= len)
+  {
+    uint32_t n = batch(hn, (len - i) / (uint32_t)16U);
+    if (n == (uint32_t)8U)
+    {
+      siv_ctr_n(ek, cb, c, (uint32_t)8U, out + i, in + i);
+    }
+    else if (n == (uint32_t)4U)
+    {
+      siv_ctr_n(ek, cb, c, (uint32_t)4U, out + i, in + i);
+    }
+    else
+    {
+      siv_ctr_n(ek, cb, c, (uint32_t)1U, out + i, in + i);
+    }
+    if (dec)
+    {
+      acc = polyval_batch(h, acc, n, out + i);
+    }
+    c = c + n;
+    i = i + (uint32_t)16U * n;
+  }
+  if (i < len)
+  {
+    uint8_t ks[16U] = { 0U };
+    Lib_IntVector_Intrinsics_vec128_store_le(ks,
+      aes_enc(ek, (uint32_t)14U, Lib_IntVector_Intrinsics_vec128_insert32(cb, c, 0)));
+    for (uint32_t j = (uint32_t)0U; j < len - i; j++)
+    {
+      out[i + j] = in[i + j] ^ ks[j];
+    }
+    if (dec)
+    {
+      acc = polyval_last(h, acc, len - i, out + i);
+    }
+  }
+  return acc;
+}
+
+/* Batched AES-GCM, for many short packets, each under its own keys and with a 12-byte IV. In
+   a group of up to eight packets, the 4-block chunks of all packets are taken in turn and
+   encrypted two at a time, so that eight blocks are in flight even when no single packet has
+   enough of them; the two chunks may belong to different packets, under different keys. The
+   last blocks of the packets, together with the tag masks E(J0), go through the same kernel,
+   two packets at a time. */
+
+/* Encrypts ba[0 .. n - 1] under ka and bb[0 .. n - 1] under kb, in lockstep. */
+static inline void
+aes_x2(
+  Lib_IntVector_Intrinsics_vec128 *ka,
+  Lib_IntVector_Intrinsics_vec128 *kb,
+  uint32_t nr,
+  uint32_t n,
+  Lib_IntVector_Intrinsics_vec128 *ba,
+  Lib_IntVector_Intrinsics_vec128 *bb
+)
+{
+  for (uint32_t j = (uint32_t)0U; j < n; j++)
+  {
+    ba[j] = Lib_IntVector_Intrinsics_vec128_xor(ba[j], ka[0U]);
+    bb[j] = Lib_IntVector_Intrinsics_vec128_xor(bb[j], kb[0U]);
+  }
+  for (uint32_t r = (uint32_t)1U; r < nr; r++)
+  {
+    for (uint32_t j = (uint32_t)0U; j < n; j++)
+    {
+      ba[j] = Lib_IntVector_Intrinsics_ni_aes_enc(ba[j], ka[r]);
+      bb[j] = Lib_IntVector_Intrinsics_ni_aes_enc(bb[j], kb[r]);
+    }
+  }
+  for (uint32_t j = (uint32_t)0U; j < n; j++)
+  {
+    ba[j] = Lib_IntVector_Intrinsics_ni_aes_enc_last(ba[j], ka[nr]);
+    bb[j] = Lib_IntVector_Intrinsics_ni_aes_enc_last(bb[j], kb[nr]);
+  }
+}
+
+/* The five blocks at the end of a packet whose first c blocks are done: J0, then the
+   counter blocks of the (at most three) remaining whole blocks and of a partial block. */
+static inline void
+tail_blocks(Lib_IntVector_Intrinsics_vec128 j0, uint32_t c, Lib_IntVector_Intrinsics_vec128 *b)
+{
+  b[0U] = j0;
+  for (uint32_t j = (uint32_t)0U; j < (uint32_t)4U; j++)
+  {
+    b[j + (uint32_t)1U] = counter_block(j0, (uint32_t)2U + c + j);
+  }
+}
+
+/* The number of tail_blocks a packet of len bytes needs, out of five. */
+static inline uint32_t tail_len(uint32_t len)
+{
+  uint32_t n = len / (uint32_t)16U % (uint32_t)4U + (uint32_t)1U;
+  if (len % (uint32_t)16U != (uint32_t)0U)
+  {
+    return n + (uint32_t)1U;
+  }
+  return n;
+}
+
+/* Finishes a packet of len bytes, from block c on, given its tail_blocks encrypted as b. */
+static inline void
+finish_packet(
+  Lib_IntVector_Intrinsics_vec128 *h,
+  bool enc,
+  uint32_t ad_len,
+  uint32_t len,
+  uint32_t c,
+  uint8_t *out,
+  uint8_t *in,
+  Lib_IntVector_Intrinsics_vec128 *b,
+  Lib_IntVector_Intrinsics_vec128 acc,
+  uint8_t *tag
+)
+{
+  uint32_t n = len / (uint32_t)16U - c;
+  uint32_t i = (uint32_t)16U * c;
+  uint32_t rem = len % (uint32_t)16U;
+  if (n > (uint32_t)0U)
+  {
+    acc = absorb_n(h, enc, n, b + (uint32_t)1U, out + i, in + i, acc);
+  }
+  if (rem != (uint32_t)0U)
+  {
+    uint8_t ks[16U] = { 0U };
+    uint8_t buf[16U] = { 0U };
+    uint32_t i1 = i + (uint32_t)16U * n;
+    Lib_IntVector_Intrinsics_vec128_store_le(ks, b[n + (uint32_t)1U]);
+    for (uint32_t j = (uint32_t)0U; j < rem; j++)
+    {
+      uint8_t x = in[i1 + j];
+      uint8_t y = x ^ ks[j];
+      out[i1 + j] = y;
+      buf[j] = enc ? y : x;
+    }
+    acc = ghash_padded(h, acc, rem, buf);
+  }
+  Lib_IntVector_Intrinsics_vec128
+  lb =
+    Lib_IntVector_Intrinsics_vec128_load64s((uint64_t)len * (uint64_t)8U,
+      (uint64_t)ad_len * (uint64_t)8U);
+  acc = gf128_mul(Lib_IntVector_Intrinsics_vec128_xor(acc, lb), h[0U]);
+  uint8_t s[16U] = { 0U };
+  Lib_IntVector_Intrinsics_vec128_store_be(s, acc);
+  Lib_IntVector_Intrinsics_vec128_store_le(tag,
+    Lib_IntVector_Intrinsics_vec128_xor(b[0U], Lib_IntVector_Intrinsics_vec128_load_le(s)));
+}
+
+/* Encrypts (or decrypts) g <= 8 packets and writes their tags, 16 bytes each, to tags. */
+static void
+crypt_group(
+  uint32_t g,
+  uint32_t nr,
+  bool enc,
+  uint8_t **round_keys,
+  uint8_t **hkeys,
+  uint8_t **iv,
+  uint32_t *ad_len,
+  uint8_t **ad,
+  uint32_t *len,
+  uint8_t **out,
+  uint8_t **in,
+  uint8_t *tags
+)
+{
+  Lib_IntVector_Intrinsics_vec128 k[8U][15U];
+  Lib_IntVector_Intrinsics_vec128 h[8U][4U];
+  Lib_IntVector_Intrinsics_vec128 j0[8U];
+  Lib_IntVector_Intrinsics_vec128 acc[8U];
+  uint32_t nc[8U] = { 0U };
+  uint32_t max_nc = (uint32_t)0U;
+  for (uint32_t p = (uint32_t)0U; p < g; p++)
+  {
+    for (uint32_t r = (uint32_t)0U; r <= nr; r++)
+    {
+      k[p][r] = Lib_IntVector_Intrinsics_vec128_load_le(round_keys[p] + (uint32_t)16U * r);
+    }
+    for (uint32_t j = (uint32_t)0U; j < (uint32_t)4U; j++)
+    {
+      h[p][j] = Lib_IntVector_Intrinsics_vec128_load_le(hkeys[p] + (uint32_t)16U * j);
+    }
+    uint8_t jb[16U] = { 0U };
+    memcpy(jb, iv[p], (uint32_t)12U * sizeof (iv[p][0U]));
+    store32_be(jb + (uint32_t)12U, (uint32_t)1U);
+    j0[p] = Lib_IntVector_Intrinsics_vec128_load_le(jb);
+    uint32_t full = ad_len[p] / (uint32_t)16U * (uint32_t)16U;
+    acc[p] =
+      ghash_blocks(h[p],
+        (uint32_t)4U,
+        Lib_IntVector_Intrinsics_vec128_zero,
+        full,
+        ad[p]);
+    if (ad_len[p] != full)
+    {
+      acc[p] = ghash_padded(h[p], acc[p], ad_len[p] - full, ad[p] + full);
+    }
+    nc[p] = len[p] / (uint32_t)64U;
+    if (nc[p] > max_nc)
+    {
+      max_nc = nc[p];
+    }
+  }
+  /* Chunk i of every packet, in turn, paired up with the previous one if that is pending. */
+  bool pending = false;
+  uint32_t pa = (uint32_t)0U;
+  uint32_t ia = (uint32_t)0U;
+  for (uint32_t i = (uint32_t)0U; i < max_nc; i++)
+  {
+    for (uint32_t p = (uint32_t)0U; p < g; p++)
+    {
+      if (i < nc[p])
+      {
+        if (!pending)
+        {
+          pa = p;
+          ia = i;
+          pending = true;
+        }
+        else
+        {
+          Lib_IntVector_Intrinsics_vec128 ba[4U];
+          Lib_IntVector_Intrinsics_vec128 bb[4U];
+          for (uint32_t j = (uint32_t)0U; j < (uint32_t)4U; j++)
+          {
+            ba[j] = counter_block(j0[pa], (uint32_t)2U + (uint32_t)4U * ia + j);
+            bb[j] = counter_block(j0[p], (uint32_t)2U + (uint32_t)4U * i + j);
+          }
+          aes_x2(k[pa], k[p], nr, (uint32_t)4U, ba, bb);
+          acc[pa] =
+            absorb_n(h[pa],
+              enc,
+              (uint32_t)4U,
+              ba,
+              out[pa] + (uint32_t)64U * ia,
+              in[pa] + (uint32_t)64U * ia,
+              acc[pa]);
+          acc[p] =
+            absorb_n(h[p],
+              enc,
+              (uint32_t)4U,
+              bb,
+              out[p] + (uint32_t)64U * i,
+              in[p] + (uint32_t)64U * i,
+              acc[p]);
+          pending = false;
+        }
+      }
+    }
+  }
+  if (pending)
+  {
+    acc[pa] =
+      crypt_n(k[pa],
+        nr,
+        h[pa],
+        j0[pa],
+        (uint32_t)2U + (uint32_t)4U * ia,
+        enc,
+        (uint32_t)4U,
+        out[pa] + (uint32_t)64U * ia,
+        in[pa] + (uint32_t)64U * ia,
+        acc[pa]);
+  }
+  for (uint32_t p = (uint32_t)0U; p < g; p = p + (uint32_t)2U)
+  {
+    /* An odd packet out is paired with itself. */
+    uint32_t q = p + (uint32_t)1U;
+    if (q == g)
+    {
+      q = p;
+    }
+    Lib_IntVector_Intrinsics_vec128 bp[5U];
+    Lib_IntVector_Intrinsics_vec128 bq[5U];
+    tail_blocks(j0[p], (uint32_t)4U * nc[p], bp);
+    tail_blocks(j0[q], (uint32_t)4U * nc[q], bq);
+    /* Most tails are J0 and at most one more block. */
+    if (tail_len(len[p]) <= (uint32_t)2U && tail_len(len[q]) <= (uint32_t)2U)
+    {
+      aes_x2(k[p], k[q], nr, (uint32_t)2U, bp, bq);
+    }
+    else
+    {
+      aes_x2(k[p], k[q], nr, (uint32_t)5U, bp, bq);
+    }
+    finish_packet(h[p],
+      enc,
+      ad_len[p],
+      len[p],
+      (uint32_t)4U * nc[p],
+      out[p],
+      in[p],
+      bp,
+      acc[p],
+      tags + (uint32_t)16U * p);
+    if (q != p)
+    {
+      finish_packet(h[q],
+        enc,
+        ad_len[q],
+        len[q],
+        (uint32_t)4U * nc[q],
+        out[q],
+        in[q],
+        bq,
+        acc[q],
+        tags + (uint32_t)16U * q);
+    }
+  }
+}
+
+#endif
+
+void Hacl_AES_GCM_NI_key_expansion(uint32_t nr, uint8_t *key, uint8_t *ek)
+{
+  #if EVERCRYPT_TARGETCONFIG_X64 || EVERCRYPT_TARGETCONFIG_X86
+  Lib_IntVector_Intrinsics_vec128 k[15U];
+  if (nr == (uint32_t)14U)
+  {
+    key_expansion256(key, k);
+  }
+  else
+  {
+    key_expansion128(key, k);
+  }
+  for (uint32_t i = (uint32_t)0U; i <= nr; i++)
+  {
+    Lib_IntVector_Intrinsics_vec128_store_le(ek + (uint32_t)16U * i, k[i]);
+  }
+  uint8_t *hkeys = ek + (uint32_t)16U * (nr + (uint32_t)1U);
+  Lib_IntVector_Intrinsics_vec128 h = hash_key(k, nr);
+  Lib_IntVector_Intrinsics_vec128 hi = h;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec128_store_le(hkeys + (uint32_t)16U * i, hi);
+    hi = gf128_mul(hi, h);
+  }
+  #else
+  KRML_HOST_EPRINTF("KreMLin abort at %s:%d\n%s\n",
+    __FILE__,
+    __LINE__,
+    "statically unreachable");
+  KRML_HOST_EXIT(255U);
+  #endif
+}
+
+void
+Hacl_AES_GCM_NI_init(
+  Hacl_AES_GCM_NI_state *st,
+  uint32_t nr,
+  uint8_t *round_keys,
+  uint8_t *iv,
+  uint32_t iv_len
+)
+{
+  #if EVERCRYPT_TARGETCONFIG_X64 || EVERCRYPT_TARGETCONFIG_X86
+  st->round_keys = round_keys;
+  st->nr = nr;
+  Lib_IntVector_Intrinsics_vec128 k[15U];
+  load_round_keys(st, k);
+  /* H, then H^2 .. H^4 for the aggregated GHASH; the other powers are computed on demand. */
+  Lib_IntVector_Intrinsics_vec128 h[8U];
+  h[0U] = hash_key(k, nr);
+  for (uint32_t i = (uint32_t)1U; i < (uint32_t)4U; i++)
+  {
+    h[i] = gf128_mul(h[i - (uint32_t)1U], h[0U]);
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec128_store_le(st->hkeys + (uint32_t)16U * i, h[i]);
+  }
+  st->hkeys_len = (uint32_t)4U;
+  init_iv(st, h, iv, iv_len);
+  #else
+  KRML_HOST_EPRINTF("KreMLin abort at %s:%d\n%s\n",
+    __FILE__,
+    __LINE__,
+    "statically unreachable");
+  KRML_HOST_EXIT(255U);
+  #endif
+}
+
+void
+Hacl_AES_GCM_NI_init_expanded(
+  Hacl_AES_GCM_NI_state *st,
+  uint32_t nr,
+  uint8_t *ek,
+  uint8_t *iv,
+  uint32_t iv_len
+)
+{
+  #if EVERCRYPT_TARGETCONFIG_X64 || EVERCRYPT_TARGETCONFIG_X86
+  st->round_keys = ek;
+  st->nr = nr;
+  memcpy(st->hkeys, ek + (uint32_t)16U * (nr + (uint32_t)1U), (uint32_t)128U * sizeof (ek[0U]));
+  st->hkeys_len = (uint32_t)8U;
+  Lib_IntVector_Intrinsics_vec128 h[8U];
+  load_hkeys(st, h, (uint32_t)0U);
+  init_iv(st, h, iv, iv_len);
+  #else
+  KRML_HOST_EPRINTF("KreMLin abort at %s:%d\n%s\n",
+    __FILE__,
+    __LINE__,
+    "statically unreachable");
+  KRML_HOST_EXIT(255U);
+  #endif
+}
+
+void
+Hacl_AES_GCM_NI_init_vale(
+  Hacl_AES_GCM_NI_state *st,
+  uint32_t nr,
+  uint8_t *ek,
+  uint8_t *iv,
+  uint32_t iv_len
+)
+{
+  #if EVERCRYPT_TARGETCONFIG_X64 || EVERCRYPT_TARGETCONFIG_X86
+  st->round_keys = ek;
+  st->nr = nr;
+  /* H, H^2, H^3 and H^4 are entries 0, 1, 3 and 4 of the table after the round keys; H^5 ..
+     H^8 are computed on demand, as after init. */
+  uint8_t *vale = ek + (uint32_t)16U * (nr + (uint32_t)1U);
+  vale_hkey(st->hkeys, vale);
+  vale_hkey(st->hkeys + (uint32_t)16U, vale + (uint32_t)16U);
+  vale_hkey(st->hkeys + (uint32_t)32U, vale + (uint32_t)48U);
+  vale_hkey(st->hkeys + (uint32_t)48U, vale + (uint32_t)64U);
+  st->hkeys_len = (uint32_t)4U;
+  Lib_IntVector_Intrinsics_vec128 h[8U];
+  load_hkeys(st, h, (uint32_t)0U);
+  init_iv(st, h, iv, iv_len);
+  #else
+  KRML_HOST_EPRINTF("KreMLin abort at %s:%d\n%s\n",
+    __FILE__,
+    __LINE__,
+    "statically unreachable");
+  KRML_HOST_EXIT(255U);
+  #endif
+}
+
+void Hacl_AES_GCM_NI_aad(Hacl_AES_GCM_NI_state *st, uint32_t len, uint8_t *ad)
+{
+  #if EVERCRYPT_TARGETCONFIG_X64 || EVERCRYPT_TARGETCONFIG_X86
+  Lib_IntVector_Intrinsics_vec128 h[8U];
+  uint32_t hn = load_hkeys(st, h, len);
+  Lib_IntVector_Intrinsics_vec128 acc = Lib_IntVector_Intrinsics_vec128_load_le(st->acc);
+  uint32_t off = (uint32_t)(st->ad_len % (uint64_t)16U);
+  uint32_t i = (uint32_t)0U;
+  if (off != (uint32_t)0U)
+  {
+    i = (uint32_t)16U - off;
+    if (len < i)
+    {
+      i = len;
+    }
+    memcpy(st->buf + off, ad, i * sizeof (ad[0U]));
+    if (off + i == (uint32_t)16U)
+    {
+      acc = ghash_padded(h, acc, (uint32_t)16U, st->buf);
+    }
+  }
+  uint32_t full = (len - i) / (uint32_t)16U * (uint32_t)16U;
+  acc = ghash_blocks(h, hn, acc, full, ad + i);
+  i = i + full;
+  memcpy(st->buf, ad + i, (len - i) * sizeof (ad[0U]));
+  st->ad_len = st->ad_len + (uint64_t)len;
+  Lib_IntVector_Intrinsics_vec128_store_le(st->acc, acc);
+  #else
+  KRML_HOST_EPRINTF("KreMLin abort at %s:%d\n%s\n",
+    __FILE__,
+    __LINE__,
+    "statically unreachable");
+  KRML_HOST_EXIT(255U);
+  #endif
+}
+
+void
+Hacl_AES_GCM_NI_encrypt(Hacl_AES_GCM_NI_state *st, uint32_t len, uint8_t *out, uint8_t *text)
+{
+  #if EVERCRYPT_TARGETCONFIG_X64 || EVERCRYPT_TARGETCONFIG_X86
+  crypt(st, true, len, out, text);
+  #else
+  KRML_HOST_EPRINTF("KreMLin abort at %s:%d\n%s\n",
+    __FILE__,
+    __LINE__,
+    "statically unreachable");
+  KRML_HOST_EXIT(255U);
+  #endif
+}
+
+void
+Hacl_AES_GCM_NI_decrypt(Hacl_AES_GCM_NI_state *st, uint32_t len, uint8_t *out, uint8_t *cipher)
+{
+  #if EVERCRYPT_TARGETCONFIG_X64 || EVERCRYPT_TARGETCONFIG_X86
+  crypt(st, false, len, out, cipher);
+  #else
+  KRML_HOST_EPRINTF("KreMLin abort at %s:%d\n%s\n",
+    __FILE__,
+    __LINE__,
+    "statically unreachable");
+  KRML_HOST_EXIT(255U);
+  #endif
+}
+
+void Hacl_AES_GCM_NI_finish(Hacl_AES_GCM_NI_state *st, uint8_t *tag)
+{
+  #if EVERCRYPT_TARGETCONFIG_X64 || EVERCRYPT_TARGETCONFIG_X86
+  Lib_IntVector_Intrinsics_vec128 k[15U];
+  Lib_IntVector_Intrinsics_vec128 h[8U];
+  load_round_keys(st, k);
+  load_hkeys(st, h, (uint32_t)0U);
+  Lib_IntVector_Intrinsics_vec128 acc = Lib_IntVector_Intrinsics_vec128_load_le(st->acc);
+  uint32_t off = (uint32_t)(st->text_len % (uint64_t)16U);
+  if (st->text_len == (uint64_t)0U)
+  {
+    acc = flush_aad(st, h, acc);
+  }
+  else if (off != (uint32_t)0U)
+  {
+    acc = ghash_padded(h, acc, off, st->buf);
+  }
+  Lib_IntVector_Intrinsics_vec128
+  lb =
+    Lib_IntVector_Intrinsics_vec128_load64s(st->text_len * (uint64_t)8U,
+      st->ad_len * (uint64_t)8U);
+  acc = gf128_mul(Lib_IntVector_Intrinsics_vec128_xor(acc, lb), h[0U]);
+  uint8_t s[16U] = { 0U };
+  Lib_IntVector_Intrinsics_vec128_store_be(s, acc);
+  Lib_IntVector_Intrinsics_vec128
+  t = aes_enc(k, st->nr, Lib_IntVector_Intrinsics_vec128_load_le(st->j0));
+  Lib_IntVector_Intrinsics_vec128_store_le(tag,
+    Lib_IntVector_Intrinsics_vec128_xor(t, Lib_IntVector_Intrinsics_vec128_load_le(s)));
+  #else
+  KRML_HOST_EPRINTF("KreMLin abort at %s:%d\n%s\n",
+    __FILE__,
+    __LINE__,
+    "statically unreachable");
+  KRML_HOST_EXIT(255U);
+  #endif
+}
+
+
+void Hacl_AES_GCM_NI_siv_key_expansion(uint8_t *key, uint8_t *round_keys)
+{
+  #if EVERCRYPT_TARGETCONFIG_X64 || EVERCRYPT_TARGETCONFIG_X86
+  Lib_IntVector_Intrinsics_vec128 k[15U];
+  key_expansion256(key, k);
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)15U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec128_store_le(round_keys + (uint32_t)16U * i, k[i]);
+  }
+  #else
+  KRML_HOST_EPRINTF("KreMLin abort at %s:%d\n%s\n",
+    __FILE__,
+    __LINE__,
+    "statically unreachable");
+  KRML_HOST_EXIT(255U);
+  #endif
+}
+
+void
+Hacl_AES_GCM_NI_siv_encrypt(
+  uint8_t *round_keys,
+  uint8_t *n,
+  uint32_t ad_len,
+  uint8_t *ad,
+  uint32_t len,
+  uint8_t *out,
+  uint8_t *text,
+  uint8_t *tag
+)
+{
+  #if EVERCRYPT_TARGETCONFIG_X64 || EVERCRYPT_TARGETCONFIG_X86
+  Lib_IntVector_Intrinsics_vec128 k[15U];
+  Lib_IntVector_Intrinsics_vec128 ek[15U];
+  Lib_IntVector_Intrinsics_vec128 h[8U];
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)15U; i++)
+  {
+    k[i] = Lib_IntVector_Intrinsics_vec128_load_le(round_keys + (uint32_t)16U * i);
+  }
+  siv_derive_keys(k, n, h, ek);
+  uint32_t blocks = ad_len / (uint32_t)16U;
+  if (len / (uint32_t)16U > blocks)
+  {
+    blocks = len / (uint32_t)16U;
+  }
+  uint32_t hn = polyval_powers(h, blocks);
+  Lib_IntVector_Intrinsics_vec128 acc = Lib_IntVector_Intrinsics_vec128_zero;
+  acc = polyval_field(h, hn, acc, ad_len, ad);
+  acc = polyval_field(h, hn, acc, len, text);
+  Lib_IntVector_Intrinsics_vec128 t = siv_tag(ek, h, acc, n, ad_len, len);
+  siv_crypt(ek, h, hn, t, false, len, out, text, acc);
+  Lib_IntVector_Intrinsics_vec128_store_le(tag, t);
+  Lib_Memzero0_memzero(ek, (uint32_t)15U * sizeof (ek[0U]));
+  #else
+  KRML_HOST_EPRINTF("KreMLin abort at %s:%d\n%s\n",
+    __FILE__,
+    __LINE__,
+    "statically unreachable");
+  KRML_HOST_EXIT(255U);
+  #endif
+}
+
+uint32_t
+Hacl_AES_GCM_NI_siv_decrypt(
+  uint8_t *round_keys,
+  uint8_t *n,
+  uint32_t ad_len,
+  uint8_t *ad,
+  uint32_t len,
+  uint8_t *out,
+  uint8_t *cipher,
+  uint8_t *tag
+)
+{
+  #if EVERCRYPT_TARGETCONFIG_X64 || EVERCRYPT_TARGETCONFIG_X86
+  Lib_IntVector_Intrinsics_vec128 k[15U];
+  Lib_IntVector_Intrinsics_vec128 ek[15U];
+  Lib_IntVector_Intrinsics_vec128 h[8U];
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)15U; i++)
+  {
+    k[i] = Lib_IntVector_Intrinsics_vec128_load_le(round_keys + (uint32_t)16U * i);
+  }
+  siv_derive_keys(k, n, h, ek);
+  uint32_t blocks = ad_len / (uint32_t)16U;
+  if (len / (uint32_t)16U > blocks)
+  {
+    blocks = len / (uint32_t)16U;
+  }
+  uint32_t hn = polyval_powers(h, blocks);
+  Lib_IntVector_Intrinsics_vec128 acc = Lib_IntVector_Intrinsics_vec128_zero;
+  acc = polyval_field(h, hn, acc, ad_len, ad);
+  /* The tag is the initial counter block: decrypt, then recompute it over the plaintext. */
+  Lib_IntVector_Intrinsics_vec128 t = Lib_IntVector_Intrinsics_vec128_load_le(tag);
+  acc = siv_crypt(ek, h, hn, t, true, len, out, cipher, acc);
+  uint8_t computed[16U] = { 0U };
+  Lib_IntVector_Intrinsics_vec128_store_le(computed, siv_tag(ek, h, acc, n, ad_len, len));
+  Lib_Memzero0_memzero(ek, (uint32_t)15U * sizeof (ek[0U]));
+  uint8_t res = (uint8_t)255U;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+  {
+    uint8_t uu____0 = FStar_UInt8_eq_mask(computed[i], tag[i]);
+    res = uu____0 & res;
+  }
+  if (res == (uint8_t)255U)
+  {
+    return (uint32_t)0U;
+  }
+  Lib_Memzero0_memzero(out, len * sizeof (out[0U]));
+  return (uint32_t)1U;
+  #else
+  KRML_HOST_EPRINTF("KreMLin abort at %s:%d\n%s\n",
+    __FILE__,
+    __LINE__,
+    "statically unreachable");
+  KRML_HOST_EXIT(255U);
+  #endif
+}
+
+void
+Hacl_AES_GCM_NI_encrypt_batch(
+  uint32_t num,
+  uint32_t nr,
+  uint8_t **round_keys,
+  uint8_t **hkeys,
+  uint8_t **iv,
+  uint32_t *ad_len,
+  uint8_t **ad,
+  uint32_t *len,
+  uint8_t **out,
+  uint8_t **text,
+  uint8_t **tag
+)
+{
+  #if EVERCRYPT_TARGETCONFIG_X64 || EVERCRYPT_TARGETCONFIG_X86
+  for (uint32_t i = (uint32_t)0U; i < num; i = i + (uint32_t)8U)
+  {
+    uint32_t g = num - i;
+    if (g > (uint32_t)8U)
+    {
+      g = (uint32_t)8U;
+    }
+    uint8_t tags[128U] = { 0U };
+    crypt_group(g,
+      nr,
+      true,
+      round_keys + i,
+      hkeys + i,
+      iv + i,
+      ad_len + i,
+      ad + i,
+      len + i,
+      out + i,
+      text + i,
+      tags);
+    for (uint32_t p = (uint32_t)0U; p < g; p++)
+    {
+      memcpy(tag[i + p], tags + (uint32_t)16U * p, (uint32_t)16U * sizeof (tags[0U]));
+    }
+  }
+  #else
+  KRML_HOST_EPRINTF("KreMLin abort at %s:%d\n%s\n",
+    __FILE__,
+    __LINE__,
+    "statically unreachable");
+  KRML_HOST_EXIT(255U);
+  #endif
+}
+
+uint32_t
+Hacl_AES_GCM_NI_decrypt_batch(
+  uint32_t num,
+  uint32_t nr,
+  uint8_t **round_keys,
+  uint8_t **hkeys,
+  uint8_t **iv,
+  uint32_t *ad_len,
+  uint8_t **ad,
+  uint32_t *len,
+  uint8_t **out,
+  uint8_t **cipher,
+  uint8_t **tag,
+  uint32_t *res
+)
+{
+  #if EVERCRYPT_TARGETCONFIG_X64 || EVERCRYPT_TARGETCONFIG_X86
+  uint32_t failed = (uint32_t)0U;
+  for (uint32_t i = (uint32_t)0U; i < num; i = i + (uint32_t)8U)
+  {
+    uint32_t g = num - i;
+    if (g > (uint32_t)8U)
+    {
+      g = (uint32_t)8U;
+    }
+    uint8_t tags[128U] = { 0U };
+    crypt_group(g,
+      nr,
+      false,
+      round_keys + i,
+      hkeys + i,
+      iv + i,
+      ad_len + i,
+      ad + i,
+      len + i,
+      out + i,
+      cipher + i,
+      tags);
+    for (uint32_t p = (uint32_t)0U; p < g; p++)
+    {
+      uint8_t r = (uint8_t)255U;
+      for (uint32_t j = (uint32_t)0U; j < (uint32_t)16U; j++)
+      {
+        uint8_t uu____0 = FStar_UInt8_eq_mask(tags[(uint32_t)16U * p + j], tag[i + p][j]);
+        r = uu____0 & r;
+      }
+      if (r == (uint8_t)255U)
+      {
+        res[i + p] = (uint32_t)0U;
+      }
+      else
+      {
+        Lib_Memzero0_memzero(out[i + p], len[i + p] * sizeof (out[i + p][0U]));
+        res[i + p] = (uint32_t)1U;
+        failed = failed + (uint32_t)1U;
+      }
+    }
+  }
+  return failed;
+  #else
+  KRML_HOST_EPRINTF("KreMLin abort at %s:%d\n%s\n",
+    __FILE__,
+    __LINE__,
+    "statically unreachable");
+  KRML_HOST_EXIT(255U);
+  #endif
+}
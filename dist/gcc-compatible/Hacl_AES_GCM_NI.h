@@ -0,0 +1,183 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "evercrypt_targetconfig.h"
+#include "libintvector.h"
+#include "kremlin/internal/types.h"
+#include "kremlin/lowstar_endianness.h"
+#include <string.h>
+#include "kremlin/internal/target.h"
+
+#ifndef __Hacl_AES_GCM_NI_H
+#define __Hacl_AES_GCM_NI_H
+
+#include "Hacl_Kremlib.h"
+#include "Lib_Memzero0.h"
+
+
+/* Streaming AES-GCM with AES-NI and PCLMULQDQ, for x64 and x86. The round keys are the
+   standard AES key schedule (11 or 15 round keys), as laid out at the start of the Vale
+   expanded keys or written by Hacl_AES_GCM_NI_key_expansion. They are not copied and must
+   outlive the state. Up to eight blocks are processed at a time, with an aggregated GHASH over
+   H .. H^8 (hkeys_len of which have been computed).
+
+   A message is processed as: init, any number of aad calls, any number of encrypt (or
+   decrypt) calls, then finish. Every call accepts arbitrary lengths; partial blocks are
+   carried over in the state. Output may alias input exactly. */
+typedef struct Hacl_AES_GCM_NI_state_s
+{
+  uint8_t *round_keys;
+  uint32_t nr;
+  uint8_t hkeys[128U];
+  uint32_t hkeys_len;
+  uint8_t j0[16U];
+  uint8_t acc[16U];
+  uint8_t ks[16U];
+  uint8_t buf[16U];
+  uint64_t ad_len;
+  uint64_t text_len;
+}
+Hacl_AES_GCM_NI_state;
+
+/* nr is the number of rounds: 10 for AES-128, 14 for AES-256. Writes the 16 * (nr + 1) bytes
+   of round keys for the 16- or 32-byte key, followed by the 128 bytes of H .. H^8: 304 or 368
+   bytes in total, the size of the Vale expanded keys. */
+void Hacl_AES_GCM_NI_key_expansion(uint32_t nr, uint8_t *key, uint8_t *ek);
+
+/* iv_len must be non-zero. */
+void
+Hacl_AES_GCM_NI_init(
+  Hacl_AES_GCM_NI_state *st,
+  uint32_t nr,
+  uint8_t *round_keys,
+  uint8_t *iv,
+  uint32_t iv_len
+);
+
+/* As init, with keys from Hacl_AES_GCM_NI_key_expansion, which saves computing the powers of
+   H. */
+void
+Hacl_AES_GCM_NI_init_expanded(
+  Hacl_AES_GCM_NI_state *st,
+  uint32_t nr,
+  uint8_t *ek,
+  uint8_t *iv,
+  uint32_t iv_len
+);
+
+/* As init, with the Vale expanded keys of EverCrypt_AEAD (the round keys, then the Vale table
+   of powers of H), whose table saves computing H .. H^4. */
+void
+Hacl_AES_GCM_NI_init_vale(
+  Hacl_AES_GCM_NI_state *st,
+  uint32_t nr,
+  uint8_t *ek,
+  uint8_t *iv,
+  uint32_t iv_len
+);
+
+void Hacl_AES_GCM_NI_aad(Hacl_AES_GCM_NI_state *st, uint32_t len, uint8_t *ad);
+
+void
+Hacl_AES_GCM_NI_encrypt(Hacl_AES_GCM_NI_state *st, uint32_t len, uint8_t *out, uint8_t *text);
+
+void
+Hacl_AES_GCM_NI_decrypt(Hacl_AES_GCM_NI_state *st, uint32_t len, uint8_t *out, uint8_t *cipher);
+
+/* Writes the 16-byte tag. The state must be initialized again before reuse. */
+void Hacl_AES_GCM_NI_finish(Hacl_AES_GCM_NI_state *st, uint8_t *tag);
+
+/* AES-256-GCM-SIV (RFC 8452), on the same kernels: POLYVAL runs through the aggregated GHASH
+   and CTR processes up to eight blocks at a time. Encryption makes two passes over the text,
+   POLYVAL then CTR; decryption makes one. Writes the 240 bytes of round keys of the 32-byte
+   key-generating key. */
+void Hacl_AES_GCM_NI_siv_key_expansion(uint8_t *key, uint8_t *round_keys);
+
+/* n is the 12-byte nonce. out may alias text exactly. */
+void
+Hacl_AES_GCM_NI_siv_encrypt(
+  uint8_t *round_keys,
+  uint8_t *n,
+  uint32_t ad_len,
+  uint8_t *ad,
+  uint32_t len,
+  uint8_t *out,
+  uint8_t *text,
+  uint8_t *tag
+);
+
+/* Returns 0 if the tag matches, and 1 otherwise, with out zeroed. out may alias cipher
+   exactly. */
+uint32_t
+Hacl_AES_GCM_NI_siv_decrypt(
+  uint8_t *round_keys,
+  uint8_t *n,
+  uint32_t ad_len,
+  uint8_t *ad,
+  uint32_t len,
+  uint8_t *out,
+  uint8_t *cipher,
+  uint8_t *tag
+);
+
+/* Batched AES-GCM for many short packets, each with its own keys and a 12-byte IV. Groups of
+   eight packets are processed together, with the blocks of two packets at a time in flight,
+   so that the AES pipeline stays full even when no packet is long enough to fill it on its
+   own. nr is 10 or 14 for every packet; round_keys[i] points to the round keys of packet i
+   and hkeys[i] to H, H^2, H^3, H^4, as written after them by Hacl_AES_GCM_NI_key_expansion.
+   out[i] may alias text[i] exactly. */
+void
+Hacl_AES_GCM_NI_encrypt_batch(
+  uint32_t num,
+  uint32_t nr,
+  uint8_t **round_keys,
+  uint8_t **hkeys,
+  uint8_t **iv,
+  uint32_t *ad_len,
+  uint8_t **ad,
+  uint32_t *len,
+  uint8_t **out,
+  uint8_t **text,
+  uint8_t **tag
+);
+
+/* Sets res[i] to 0 if the tag of packet i matches, and to 1 otherwise, with out[i] zeroed.
+   Returns the number of packets that failed. */
+uint32_t
+Hacl_AES_GCM_NI_decrypt_batch(
+  uint32_t num,
+  uint32_t nr,
+  uint8_t **round_keys,
+  uint8_t **hkeys,
+  uint8_t **iv,
+  uint32_t *ad_len,
+  uint8_t **ad,
+  uint32_t *len,
+  uint8_t **out,
+  uint8_t **cipher,
+  uint8_t **tag,
+  uint32_t *res
+);
+
+#define __Hacl_AES_GCM_NI_H_DEFINED
+#endif
@@ -234,3 +234,18 @@ Hacl_Chacha20_chacha20_decrypt(
   Hacl_Impl_Chacha20_chacha20_update(ctx, len, out, cipher);
 }
 
+/* HChaCha20 (draft-irtf-cfrg-xchacha): the ChaCha20 rounds over the 32-byte key and the
+   16-byte input n, which takes the place of the counter and the nonce, without the final
+   addition. The 32-byte output is made of words 0..3 and 12..15 of the state. */
+void Hacl_Chacha20_hchacha20(uint8_t *out, uint8_t *key, uint8_t *n)
+{
+  uint32_t ctx[16U] = { 0U };
+  Hacl_Impl_Chacha20_chacha20_init(ctx, key, n + (uint32_t)4U, load32_le(n));
+  rounds(ctx);
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    store32_le(out + i * (uint32_t)4U, ctx[i]);
+    store32_le(out + (uint32_t)16U + i * (uint32_t)4U, ctx[(uint32_t)12U + i]);
+  }
+}
+
@@ -69,5 +69,9 @@ Hacl_Chacha20_chacha20_decrypt(
   uint32_t ctr
 );
 
+/* Derives the 32-byte XChaCha20 subkey from key (32 bytes) and the first 16 bytes n of the
+   24-byte nonce. */
+void Hacl_Chacha20_hchacha20(uint8_t *out, uint8_t *key, uint8_t *n);
+
 #define __Hacl_Chacha20_H_DEFINED
 #endif
@@ -24,6 +24,234 @@
 
 #include "Hacl_Chacha20Poly1305_256.h"
 
+static inline void
+poly1305_update4_256(Lib_IntVector_Intrinsics_vec256 *ctx, uint32_t nb, uint8_t *text)
+{
+  Lib_IntVector_Intrinsics_vec256 *pre0 = ctx + (uint32_t)5U;
+  Lib_IntVector_Intrinsics_vec256 *acc0 = ctx;
+  for (uint32_t i = (uint32_t)0U; i < nb; i++)
+  {
+    uint8_t *block = text + i * (uint32_t)64U;
+    Lib_IntVector_Intrinsics_vec256 e[5U];
+    for (uint32_t _i = 0U; _i < (uint32_t)5U; ++_i)
+      e[_i] = Lib_IntVector_Intrinsics_vec256_zero;
+    Lib_IntVector_Intrinsics_vec256 lo = Lib_IntVector_Intrinsics_vec256_load_le(block);
+    Lib_IntVector_Intrinsics_vec256
+    hi = Lib_IntVector_Intrinsics_vec256_load_le(block + (uint32_t)32U);
+    Lib_IntVector_Intrinsics_vec256
+    mask260 = Lib_IntVector_Intrinsics_vec256_load64((uint64_t)0x3ffffffU);
+    Lib_IntVector_Intrinsics_vec256
+    m0 = Lib_IntVector_Intrinsics_vec256_interleave_low128(lo, hi);
+    Lib_IntVector_Intrinsics_vec256
+    m1 = Lib_IntVector_Intrinsics_vec256_interleave_high128(lo, hi);
+    Lib_IntVector_Intrinsics_vec256
+    m2 = Lib_IntVector_Intrinsics_vec256_shift_right(m0, (uint32_t)48U);
+    Lib_IntVector_Intrinsics_vec256
+    m3 = Lib_IntVector_Intrinsics_vec256_shift_right(m1, (uint32_t)48U);
+    Lib_IntVector_Intrinsics_vec256
+    m4 = Lib_IntVector_Intrinsics_vec256_interleave_high64(m0, m1);
+    Lib_IntVector_Intrinsics_vec256
+    t010 = Lib_IntVector_Intrinsics_vec256_interleave_low64(m0, m1);
+    Lib_IntVector_Intrinsics_vec256
+    t30 = Lib_IntVector_Intrinsics_vec256_interleave_low64(m2, m3);
+    Lib_IntVector_Intrinsics_vec256
+    t20 = Lib_IntVector_Intrinsics_vec256_shift_right64(t30, (uint32_t)4U);
+    Lib_IntVector_Intrinsics_vec256 o20 = Lib_IntVector_Intrinsics_vec256_and(t20, mask260);
+    Lib_IntVector_Intrinsics_vec256
+    t10 = Lib_IntVector_Intrinsics_vec256_shift_right64(t010, (uint32_t)26U);
+    Lib_IntVector_Intrinsics_vec256 o10 = Lib_IntVector_Intrinsics_vec256_and(t10, mask260);
+    Lib_IntVector_Intrinsics_vec256 o5 = Lib_IntVector_Intrinsics_vec256_and(t010, mask260);
+    Lib_IntVector_Intrinsics_vec256
+    t31 = Lib_IntVector_Intrinsics_vec256_shift_right64(t30, (uint32_t)30U);
+    Lib_IntVector_Intrinsics_vec256 o30 = Lib_IntVector_Intrinsics_vec256_and(t31, mask260);
+    Lib_IntVector_Intrinsics_vec256
+    o40 = Lib_IntVector_Intrinsics_vec256_shift_right64(m4, (uint32_t)40U);
+    Lib_IntVector_Intrinsics_vec256 o00 = o5;
+    Lib_IntVector_Intrinsics_vec256 o11 = o10;
+    Lib_IntVector_Intrinsics_vec256 o21 = o20;
+    Lib_IntVector_Intrinsics_vec256 o31 = o30;
+    Lib_IntVector_Intrinsics_vec256 o41 = o40;
+    e[0U] = o00;
+    e[1U] = o11;
+    e[2U] = o21;
+    e[3U] = o31;
+    e[4U] = o41;
+    uint64_t b = (uint64_t)0x1000000U;
+    Lib_IntVector_Intrinsics_vec256 mask = Lib_IntVector_Intrinsics_vec256_load64(b);
+    Lib_IntVector_Intrinsics_vec256 f4 = e[4U];
+    e[4U] = Lib_IntVector_Intrinsics_vec256_or(f4, mask);
+    Lib_IntVector_Intrinsics_vec256 *rn = pre0 + (uint32_t)10U;
+    Lib_IntVector_Intrinsics_vec256 *rn5 = pre0 + (uint32_t)15U;
+    Lib_IntVector_Intrinsics_vec256 r0 = rn[0U];
+    Lib_IntVector_Intrinsics_vec256 r1 = rn[1U];
+    Lib_IntVector_Intrinsics_vec256 r2 = rn[2U];
+    Lib_IntVector_Intrinsics_vec256 r3 = rn[3U];
+    Lib_IntVector_Intrinsics_vec256 r4 = rn[4U];
+    Lib_IntVector_Intrinsics_vec256 r51 = rn5[1U];
+    Lib_IntVector_Intrinsics_vec256 r52 = rn5[2U];
+    Lib_IntVector_Intrinsics_vec256 r53 = rn5[3U];
+    Lib_IntVector_Intrinsics_vec256 r54 = rn5[4U];
+    Lib_IntVector_Intrinsics_vec256 f10 = acc0[0U];
+    Lib_IntVector_Intrinsics_vec256 f110 = acc0[1U];
+    Lib_IntVector_Intrinsics_vec256 f120 = acc0[2U];
+    Lib_IntVector_Intrinsics_vec256 f130 = acc0[3U];
+    Lib_IntVector_Intrinsics_vec256 f140 = acc0[4U];
+    Lib_IntVector_Intrinsics_vec256 a0 = Lib_IntVector_Intrinsics_vec256_mul64(r0, f10);
+    Lib_IntVector_Intrinsics_vec256 a1 = Lib_IntVector_Intrinsics_vec256_mul64(r1, f10);
+    Lib_IntVector_Intrinsics_vec256 a2 = Lib_IntVector_Intrinsics_vec256_mul64(r2, f10);
+    Lib_IntVector_Intrinsics_vec256 a3 = Lib_IntVector_Intrinsics_vec256_mul64(r3, f10);
+    Lib_IntVector_Intrinsics_vec256 a4 = Lib_IntVector_Intrinsics_vec256_mul64(r4, f10);
+    Lib_IntVector_Intrinsics_vec256
+    a01 =
+      Lib_IntVector_Intrinsics_vec256_add64(a0,
+        Lib_IntVector_Intrinsics_vec256_mul64(r54, f110));
+    Lib_IntVector_Intrinsics_vec256
+    a11 =
+      Lib_IntVector_Intrinsics_vec256_add64(a1,
+        Lib_IntVector_Intrinsics_vec256_mul64(r0, f110));
+    Lib_IntVector_Intrinsics_vec256
+    a21 =
+      Lib_IntVector_Intrinsics_vec256_add64(a2,
+        Lib_IntVector_Intrinsics_vec256_mul64(r1, f110));
+    Lib_IntVector_Intrinsics_vec256
+    a31 =
+      Lib_IntVector_Intrinsics_vec256_add64(a3,
+        Lib_IntVector_Intrinsics_vec256_mul64(r2, f110));
+    Lib_IntVector_Intrinsics_vec256
+    a41 =
+      Lib_IntVector_Intrinsics_vec256_add64(a4,
+        Lib_IntVector_Intrinsics_vec256_mul64(r3, f110));
+    Lib_IntVector_Intrinsics_vec256
+    a02 =
+      Lib_IntVector_Intrinsics_vec256_add64(a01,
+        Lib_IntVector_Intrinsics_vec256_mul64(r53, f120));
+    Lib_IntVector_Intrinsics_vec256
+    a12 =
+      Lib_IntVector_Intrinsics_vec256_add64(a11,
+        Lib_IntVector_Intrinsics_vec256_mul64(r54, f120));
+    Lib_IntVector_Intrinsics_vec256
+    a22 =
+      Lib_IntVector_Intrinsics_vec256_add64(a21,
+        Lib_IntVector_Intrinsics_vec256_mul64(r0, f120));
+    Lib_IntVector_Intrinsics_vec256
+    a32 =
+      Lib_IntVector_Intrinsics_vec256_add64(a31,
+        Lib_IntVector_Intrinsics_vec256_mul64(r1, f120));
+    Lib_IntVector_Intrinsics_vec256
+    a42 =
+      Lib_IntVector_Intrinsics_vec256_add64(a41,
+        Lib_IntVector_Intrinsics_vec256_mul64(r2, f120));
+    Lib_IntVector_Intrinsics_vec256
+    a03 =
+      Lib_IntVector_Intrinsics_vec256_add64(a02,
+        Lib_IntVector_Intrinsics_vec256_mul64(r52, f130));
+    Lib_IntVector_Intrinsics_vec256
+    a13 =
+      Lib_IntVector_Intrinsics_vec256_add64(a12,
+        Lib_IntVector_Intrinsics_vec256_mul64(r53, f130));
+    Lib_IntVector_Intrinsics_vec256
+    a23 =
+      Lib_IntVector_Intrinsics_vec256_add64(a22,
+        Lib_IntVector_Intrinsics_vec256_mul64(r54, f130));
+    Lib_IntVector_Intrinsics_vec256
+    a33 =
+      Lib_IntVector_Intrinsics_vec256_add64(a32,
+        Lib_IntVector_Intrinsics_vec256_mul64(r0, f130));
+    Lib_IntVector_Intrinsics_vec256
+    a43 =
+      Lib_IntVector_Intrinsics_vec256_add64(a42,
+        Lib_IntVector_Intrinsics_vec256_mul64(r1, f130));
+    Lib_IntVector_Intrinsics_vec256
+    a04 =
+      Lib_IntVector_Intrinsics_vec256_add64(a03,
+        Lib_IntVector_Intrinsics_vec256_mul64(r51, f140));
+    Lib_IntVector_Intrinsics_vec256
+    a14 =
+      Lib_IntVector_Intrinsics_vec256_add64(a13,
+        Lib_IntVector_Intrinsics_vec256_mul64(r52, f140));
+    Lib_IntVector_Intrinsics_vec256
+    a24 =
+      Lib_IntVector_Intrinsics_vec256_add64(a23,
+        Lib_IntVector_Intrinsics_vec256_mul64(r53, f140));
+    Lib_IntVector_Intrinsics_vec256
+    a34 =
+      Lib_IntVector_Intrinsics_vec256_add64(a33,
+        Lib_IntVector_Intrinsics_vec256_mul64(r54, f140));
+    Lib_IntVector_Intrinsics_vec256
+    a44 =
+      Lib_IntVector_Intrinsics_vec256_add64(a43,
+        Lib_IntVector_Intrinsics_vec256_mul64(r0, f140));
+    Lib_IntVector_Intrinsics_vec256 t01 = a04;
+    Lib_IntVector_Intrinsics_vec256 t1 = a14;
+    Lib_IntVector_Intrinsics_vec256 t2 = a24;
+    Lib_IntVector_Intrinsics_vec256 t3 = a34;
+    Lib_IntVector_Intrinsics_vec256 t4 = a44;
+    Lib_IntVector_Intrinsics_vec256
+    mask26 = Lib_IntVector_Intrinsics_vec256_load64((uint64_t)0x3ffffffU);
+    Lib_IntVector_Intrinsics_vec256
+    z0 = Lib_IntVector_Intrinsics_vec256_shift_right64(t01, (uint32_t)26U);
+    Lib_IntVector_Intrinsics_vec256
+    z1 = Lib_IntVector_Intrinsics_vec256_shift_right64(t3, (uint32_t)26U);
+    Lib_IntVector_Intrinsics_vec256 x0 = Lib_IntVector_Intrinsics_vec256_and(t01, mask26);
+    Lib_IntVector_Intrinsics_vec256 x3 = Lib_IntVector_Intrinsics_vec256_and(t3, mask26);
+    Lib_IntVector_Intrinsics_vec256 x1 = Lib_IntVector_Intrinsics_vec256_add64(t1, z0);
+    Lib_IntVector_Intrinsics_vec256 x4 = Lib_IntVector_Intrinsics_vec256_add64(t4, z1);
+    Lib_IntVector_Intrinsics_vec256
+    z01 = Lib_IntVector_Intrinsics_vec256_shift_right64(x1, (uint32_t)26U);
+    Lib_IntVector_Intrinsics_vec256
+    z11 = Lib_IntVector_Intrinsics_vec256_shift_right64(x4, (uint32_t)26U);
+    Lib_IntVector_Intrinsics_vec256
+    t = Lib_IntVector_Intrinsics_vec256_shift_left64(z11, (uint32_t)2U);
+    Lib_IntVector_Intrinsics_vec256 z12 = Lib_IntVector_Intrinsics_vec256_add64(z11, t);
+    Lib_IntVector_Intrinsics_vec256 x11 = Lib_IntVector_Intrinsics_vec256_and(x1, mask26);
+    Lib_IntVector_Intrinsics_vec256 x41 = Lib_IntVector_Intrinsics_vec256_and(x4, mask26);
+    Lib_IntVector_Intrinsics_vec256 x2 = Lib_IntVector_Intrinsics_vec256_add64(t2, z01);
+    Lib_IntVector_Intrinsics_vec256 x01 = Lib_IntVector_Intrinsics_vec256_add64(x0, z12);
+    Lib_IntVector_Intrinsics_vec256
+    z02 = Lib_IntVector_Intrinsics_vec256_shift_right64(x2, (uint32_t)26U);
+    Lib_IntVector_Intrinsics_vec256
+    z13 = Lib_IntVector_Intrinsics_vec256_shift_right64(x01, (uint32_t)26U);
+    Lib_IntVector_Intrinsics_vec256 x21 = Lib_IntVector_Intrinsics_vec256_and(x2, mask26);
+    Lib_IntVector_Intrinsics_vec256 x02 = Lib_IntVector_Intrinsics_vec256_and(x01, mask26);
+    Lib_IntVector_Intrinsics_vec256 x31 = Lib_IntVector_Intrinsics_vec256_add64(x3, z02);
+    Lib_IntVector_Intrinsics_vec256 x12 = Lib_IntVector_Intrinsics_vec256_add64(x11, z13);
+    Lib_IntVector_Intrinsics_vec256
+    z03 = Lib_IntVector_Intrinsics_vec256_shift_right64(x31, (uint32_t)26U);
+    Lib_IntVector_Intrinsics_vec256 x32 = Lib_IntVector_Intrinsics_vec256_and(x31, mask26);
+    Lib_IntVector_Intrinsics_vec256 x42 = Lib_IntVector_Intrinsics_vec256_add64(x41, z03);
+    Lib_IntVector_Intrinsics_vec256 o01 = x02;
+    Lib_IntVector_Intrinsics_vec256 o12 = x12;
+    Lib_IntVector_Intrinsics_vec256 o22 = x21;
+    Lib_IntVector_Intrinsics_vec256 o32 = x32;
+    Lib_IntVector_Intrinsics_vec256 o42 = x42;
+    acc0[0U] = o01;
+    acc0[1U] = o12;
+    acc0[2U] = o22;
+    acc0[3U] = o32;
+    acc0[4U] = o42;
+    Lib_IntVector_Intrinsics_vec256 f100 = acc0[0U];
+    Lib_IntVector_Intrinsics_vec256 f11 = acc0[1U];
+    Lib_IntVector_Intrinsics_vec256 f12 = acc0[2U];
+    Lib_IntVector_Intrinsics_vec256 f13 = acc0[3U];
+    Lib_IntVector_Intrinsics_vec256 f14 = acc0[4U];
+    Lib_IntVector_Intrinsics_vec256 f20 = e[0U];
+    Lib_IntVector_Intrinsics_vec256 f21 = e[1U];
+    Lib_IntVector_Intrinsics_vec256 f22 = e[2U];
+    Lib_IntVector_Intrinsics_vec256 f23 = e[3U];
+    Lib_IntVector_Intrinsics_vec256 f24 = e[4U];
+    Lib_IntVector_Intrinsics_vec256 o0 = Lib_IntVector_Intrinsics_vec256_add64(f100, f20);
+    Lib_IntVector_Intrinsics_vec256 o1 = Lib_IntVector_Intrinsics_vec256_add64(f11, f21);
+    Lib_IntVector_Intrinsics_vec256 o2 = Lib_IntVector_Intrinsics_vec256_add64(f12, f22);
+    Lib_IntVector_Intrinsics_vec256 o3 = Lib_IntVector_Intrinsics_vec256_add64(f13, f23);
+    Lib_IntVector_Intrinsics_vec256 o4 = Lib_IntVector_Intrinsics_vec256_add64(f14, f24);
+    acc0[0U] = o0;
+    acc0[1U] = o1;
+    acc0[2U] = o2;
+    acc0[3U] = o3;
+    acc0[4U] = o4;
+  }
+}
+
 static inline void
 poly1305_padded_256(Lib_IntVector_Intrinsics_vec256 *ctx, uint32_t len, uint8_t *text)
 {
@@ -44,227 +272,7 @@ poly1305_padded_256(Lib_IntVector_Intrinsics_vec256 *ctx, uint32_t len, uint8_t
     uint32_t len1 = len0 - bs;
     uint8_t *text1 = t00 + bs;
     uint32_t nb = len1 / bs;
-    for (uint32_t i = (uint32_t)0U; i < nb; i++)
-    {
-      uint8_t *block = text1 + i * bs;
-      Lib_IntVector_Intrinsics_vec256 e[5U];
-      for (uint32_t _i = 0U; _i < (uint32_t)5U; ++_i)
-        e[_i] = Lib_IntVector_Intrinsics_vec256_zero;
-      Lib_IntVector_Intrinsics_vec256 lo = Lib_IntVector_Intrinsics_vec256_load_le(block);
-      Lib_IntVector_Intrinsics_vec256
-      hi = Lib_IntVector_Intrinsics_vec256_load_le(block + (uint32_t)32U);
-      Lib_IntVector_Intrinsics_vec256
-      mask260 = Lib_IntVector_Intrinsics_vec256_load64((uint64_t)0x3ffffffU);
-      Lib_IntVector_Intrinsics_vec256
-      m0 = Lib_IntVector_Intrinsics_vec256_interleave_low128(lo, hi);
-      Lib_IntVector_Intrinsics_vec256
-      m1 = Lib_IntVector_Intrinsics_vec256_interleave_high128(lo, hi);
-      Lib_IntVector_Intrinsics_vec256
-      m2 = Lib_IntVector_Intrinsics_vec256_shift_right(m0, (uint32_t)48U);
-      Lib_IntVector_Intrinsics_vec256
-      m3 = Lib_IntVector_Intrinsics_vec256_shift_right(m1, (uint32_t)48U);
-      Lib_IntVector_Intrinsics_vec256
-      m4 = Lib_IntVector_Intrinsics_vec256_interleave_high64(m0, m1);
-      Lib_IntVector_Intrinsics_vec256
-      t010 = Lib_IntVector_Intrinsics_vec256_interleave_low64(m0, m1);
-      Lib_IntVector_Intrinsics_vec256
-      t30 = Lib_IntVector_Intrinsics_vec256_interleave_low64(m2, m3);
-      Lib_IntVector_Intrinsics_vec256
-      t20 = Lib_IntVector_Intrinsics_vec256_shift_right64(t30, (uint32_t)4U);
-      Lib_IntVector_Intrinsics_vec256 o20 = Lib_IntVector_Intrinsics_vec256_and(t20, mask260);
-      Lib_IntVector_Intrinsics_vec256
-      t10 = Lib_IntVector_Intrinsics_vec256_shift_right64(t010, (uint32_t)26U);
-      Lib_IntVector_Intrinsics_vec256 o10 = Lib_IntVector_Intrinsics_vec256_and(t10, mask260);
-      Lib_IntVector_Intrinsics_vec256 o5 = Lib_IntVector_Intrinsics_vec256_and(t010, mask260);
-      Lib_IntVector_Intrinsics_vec256
-      t31 = Lib_IntVector_Intrinsics_vec256_shift_right64(t30, (uint32_t)30U);
-      Lib_IntVector_Intrinsics_vec256 o30 = Lib_IntVector_Intrinsics_vec256_and(t31, mask260);
-      Lib_IntVector_Intrinsics_vec256
-      o40 = Lib_IntVector_Intrinsics_vec256_shift_right64(m4, (uint32_t)40U);
-      Lib_IntVector_Intrinsics_vec256 o00 = o5;
-      Lib_IntVector_Intrinsics_vec256 o11 = o10;
-      Lib_IntVector_Intrinsics_vec256 o21 = o20;
-      Lib_IntVector_Intrinsics_vec256 o31 = o30;
-      Lib_IntVector_Intrinsics_vec256 o41 = o40;
-      e[0U] = o00;
-      e[1U] = o11;
-      e[2U] = o21;
-      e[3U] = o31;
-      e[4U] = o41;
-      uint64_t b = (uint64_t)0x1000000U;
-      Lib_IntVector_Intrinsics_vec256 mask = Lib_IntVector_Intrinsics_vec256_load64(b);
-      Lib_IntVector_Intrinsics_vec256 f4 = e[4U];
-      e[4U] = Lib_IntVector_Intrinsics_vec256_or(f4, mask);
-      Lib_IntVector_Intrinsics_vec256 *rn = pre0 + (uint32_t)10U;
-      Lib_IntVector_Intrinsics_vec256 *rn5 = pre0 + (uint32_t)15U;
-      Lib_IntVector_Intrinsics_vec256 r0 = rn[0U];
-      Lib_IntVector_Intrinsics_vec256 r1 = rn[1U];
-      Lib_IntVector_Intrinsics_vec256 r2 = rn[2U];
-      Lib_IntVector_Intrinsics_vec256 r3 = rn[3U];
-      Lib_IntVector_Intrinsics_vec256 r4 = rn[4U];
-      Lib_IntVector_Intrinsics_vec256 r51 = rn5[1U];
-      Lib_IntVector_Intrinsics_vec256 r52 = rn5[2U];
-      Lib_IntVector_Intrinsics_vec256 r53 = rn5[3U];
-      Lib_IntVector_Intrinsics_vec256 r54 = rn5[4U];
-      Lib_IntVector_Intrinsics_vec256 f10 = acc0[0U];
-      Lib_IntVector_Intrinsics_vec256 f110 = acc0[1U];
-      Lib_IntVector_Intrinsics_vec256 f120 = acc0[2U];
-      Lib_IntVector_Intrinsics_vec256 f130 = acc0[3U];
-      Lib_IntVector_Intrinsics_vec256 f140 = acc0[4U];
-      Lib_IntVector_Intrinsics_vec256 a0 = Lib_IntVector_Intrinsics_vec256_mul64(r0, f10);
-      Lib_IntVector_Intrinsics_vec256 a1 = Lib_IntVector_Intrinsics_vec256_mul64(r1, f10);
-      Lib_IntVector_Intrinsics_vec256 a2 = Lib_IntVector_Intrinsics_vec256_mul64(r2, f10);
-      Lib_IntVector_Intrinsics_vec256 a3 = Lib_IntVector_Intrinsics_vec256_mul64(r3, f10);
-      Lib_IntVector_Intrinsics_vec256 a4 = Lib_IntVector_Intrinsics_vec256_mul64(r4, f10);
-      Lib_IntVector_Intrinsics_vec256
-      a01 =
-        Lib_IntVector_Intrinsics_vec256_add64(a0,
-          Lib_IntVector_Intrinsics_vec256_mul64(r54, f110));
-      Lib_IntVector_Intrinsics_vec256
-      a11 =
-        Lib_IntVector_Intrinsics_vec256_add64(a1,
-          Lib_IntVector_Intrinsics_vec256_mul64(r0, f110));
-      Lib_IntVector_Intrinsics_vec256
-      a21 =
-        Lib_IntVector_Intrinsics_vec256_add64(a2,
-          Lib_IntVector_Intrinsics_vec256_mul64(r1, f110));
-      Lib_IntVector_Intrinsics_vec256
-      a31 =
-        Lib_IntVector_Intrinsics_vec256_add64(a3,
-          Lib_IntVector_Intrinsics_vec256_mul64(r2, f110));
-      Lib_IntVector_Intrinsics_vec256
-      a41 =
-        Lib_IntVector_Intrinsics_vec256_add64(a4,
-          Lib_IntVector_Intrinsics_vec256_mul64(r3, f110));
-      Lib_IntVector_Intrinsics_vec256
-      a02 =
-        Lib_IntVector_Intrinsics_vec256_add64(a01,
-          Lib_IntVector_Intrinsics_vec256_mul64(r53, f120));
-      Lib_IntVector_Intrinsics_vec256
-      a12 =
-        Lib_IntVector_Intrinsics_vec256_add64(a11,
-          Lib_IntVector_Intrinsics_vec256_mul64(r54, f120));
-      Lib_IntVector_Intrinsics_vec256
-      a22 =
-        Lib_IntVector_Intrinsics_vec256_add64(a21,
-          Lib_IntVector_Intrinsics_vec256_mul64(r0, f120));
-      Lib_IntVector_Intrinsics_vec256
-      a32 =
-        Lib_IntVector_Intrinsics_vec256_add64(a31,
-          Lib_IntVector_Intrinsics_vec256_mul64(r1, f120));
-      Lib_IntVector_Intrinsics_vec256
-      a42 =
-        Lib_IntVector_Intrinsics_vec256_add64(a41,
-          Lib_IntVector_Intrinsics_vec256_mul64(r2, f120));
-      Lib_IntVector_Intrinsics_vec256
-      a03 =
-        Lib_IntVector_Intrinsics_vec256_add64(a02,
-          Lib_IntVector_Intrinsics_vec256_mul64(r52, f130));
-      Lib_IntVector_Intrinsics_vec256
-      a13 =
-        Lib_IntVector_Intrinsics_vec256_add64(a12,
-          Lib_IntVector_Intrinsics_vec256_mul64(r53, f130));
-      Lib_IntVector_Intrinsics_vec256
-      a23 =
-        Lib_IntVector_Intrinsics_vec256_add64(a22,
-          Lib_IntVector_Intrinsics_vec256_mul64(r54, f130));
-      Lib_IntVector_Intrinsics_vec256
-      a33 =
-        Lib_IntVector_Intrinsics_vec256_add64(a32,
-          Lib_IntVector_Intrinsics_vec256_mul64(r0, f130));
-      Lib_IntVector_Intrinsics_vec256
-      a43 =
-        Lib_IntVector_Intrinsics_vec256_add64(a42,
-          Lib_IntVector_Intrinsics_vec256_mul64(r1, f130));
-      Lib_IntVector_Intrinsics_vec256
-      a04 =
-        Lib_IntVector_Intrinsics_vec256_add64(a03,
-          Lib_IntVector_Intrinsics_vec256_mul64(r51, f140));
-      Lib_IntVector_Intrinsics_vec256
-      a14 =
-        Lib_IntVector_Intrinsics_vec256_add64(a13,
-          Lib_IntVector_Intrinsics_vec256_mul64(r52, f140));
-      Lib_IntVector_Intrinsics_vec256
-      a24 =
-        Lib_IntVector_Intrinsics_vec256_add64(a23,
-          Lib_IntVector_Intrinsics_vec256_mul64(r53, f140));
-      Lib_IntVector_Intrinsics_vec256
-      a34 =
-        Lib_IntVector_Intrinsics_vec256_add64(a33,
-          Lib_IntVector_Intrinsics_vec256_mul64(r54, f140));
-      Lib_IntVector_Intrinsics_vec256
-      a44 =
-        Lib_IntVector_Intrinsics_vec256_add64(a43,
-          Lib_IntVector_Intrinsics_vec256_mul64(r0, f140));
-      Lib_IntVector_Intrinsics_vec256 t01 = a04;
-      Lib_IntVector_Intrinsics_vec256 t1 = a14;
-      Lib_IntVector_Intrinsics_vec256 t2 = a24;
-      Lib_IntVector_Intrinsics_vec256 t3 = a34;
-      Lib_IntVector_Intrinsics_vec256 t4 = a44;
-      Lib_IntVector_Intrinsics_vec256
-      mask26 = Lib_IntVector_Intrinsics_vec256_load64((uint64_t)0x3ffffffU);
-      Lib_IntVector_Intrinsics_vec256
-      z0 = Lib_IntVector_Intrinsics_vec256_shift_right64(t01, (uint32_t)26U);
-      Lib_IntVector_Intrinsics_vec256
-      z1 = Lib_IntVector_Intrinsics_vec256_shift_right64(t3, (uint32_t)26U);
-      Lib_IntVector_Intrinsics_vec256 x0 = Lib_IntVector_Intrinsics_vec256_and(t01, mask26);
-      Lib_IntVector_Intrinsics_vec256 x3 = Lib_IntVector_Intrinsics_vec256_and(t3, mask26);
-      Lib_IntVector_Intrinsics_vec256 x1 = Lib_IntVector_Intrinsics_vec256_add64(t1, z0);
-      Lib_IntVector_Intrinsics_vec256 x4 = Lib_IntVector_Intrinsics_vec256_add64(t4, z1);
-      Lib_IntVector_Intrinsics_vec256
-      z01 = Lib_IntVector_Intrinsics_vec256_shift_right64(x1, (uint32_t)26U);
-      Lib_IntVector_Intrinsics_vec256
-      z11 = Lib_IntVector_Intrinsics_vec256_shift_right64(x4, (uint32_t)26U);
-      Lib_IntVector_Intrinsics_vec256
-      t = Lib_IntVector_Intrinsics_vec256_shift_left64(z11, (uint32_t)2U);
-      Lib_IntVector_Intrinsics_vec256 z12 = Lib_IntVector_Intrinsics_vec256_add64(z11, t);
-      Lib_IntVector_Intrinsics_vec256 x11 = Lib_IntVector_Intrinsics_vec256_and(x1, mask26);
-      Lib_IntVector_Intrinsics_vec256 x41 = Lib_IntVector_Intrinsics_vec256_and(x4, mask26);
-      Lib_IntVector_Intrinsics_vec256 x2 = Lib_IntVector_Intrinsics_vec256_add64(t2, z01);
-      Lib_IntVector_Intrinsics_vec256 x01 = Lib_IntVector_Intrinsics_vec256_add64(x0, z12);
-      Lib_IntVector_Intrinsics_vec256
-      z02 = Lib_IntVector_Intrinsics_vec256_shift_right64(x2, (uint32_t)26U);
-      Lib_IntVector_Intrinsics_vec256
-      z13 = Lib_IntVector_Intrinsics_vec256_shift_right64(x01, (uint32_t)26U);
-      Lib_IntVector_Intrinsics_vec256 x21 = Lib_IntVector_Intrinsics_vec256_and(x2, mask26);
-      Lib_IntVector_Intrinsics_vec256 x02 = Lib_IntVector_Intrinsics_vec256_and(x01, mask26);
-      Lib_IntVector_Intrinsics_vec256 x31 = Lib_IntVector_Intrinsics_vec256_add64(x3, z02);
-      Lib_IntVector_Intrinsics_vec256 x12 = Lib_IntVector_Intrinsics_vec256_add64(x11, z13);
-      Lib_IntVector_Intrinsics_vec256
-      z03 = Lib_IntVector_Intrinsics_vec256_shift_right64(x31, (uint32_t)26U);
-      Lib_IntVector_Intrinsics_vec256 x32 = Lib_IntVector_Intrinsics_vec256_and(x31, mask26);
-      Lib_IntVector_Intrinsics_vec256 x42 = Lib_IntVector_Intrinsics_vec256_add64(x41, z03);
-      Lib_IntVector_Intrinsics_vec256 o01 = x02;
-      Lib_IntVector_Intrinsics_vec256 o12 = x12;
-      Lib_IntVector_Intrinsics_vec256 o22 = x21;
-      Lib_IntVector_Intrinsics_vec256 o32 = x32;
-      Lib_IntVector_Intrinsics_vec256 o42 = x42;
-      acc0[0U] = o01;
-      acc0[1U] = o12;
-      acc0[2U] = o22;
-      acc0[3U] = o32;
-      acc0[4U] = o42;
-      Lib_IntVector_Intrinsics_vec256 f100 = acc0[0U];
-      Lib_IntVector_Intrinsics_vec256 f11 = acc0[1U];
-      Lib_IntVector_Intrinsics_vec256 f12 = acc0[2U];
-      Lib_IntVector_Intrinsics_vec256 f13 = acc0[3U];
-      Lib_IntVector_Intrinsics_vec256 f14 = acc0[4U];
-      Lib_IntVector_Intrinsics_vec256 f20 = e[0U];
-      Lib_IntVector_Intrinsics_vec256 f21 = e[1U];
-      Lib_IntVector_Intrinsics_vec256 f22 = e[2U];
-      Lib_IntVector_Intrinsics_vec256 f23 = e[3U];
-      Lib_IntVector_Intrinsics_vec256 f24 = e[4U];
-      Lib_IntVector_Intrinsics_vec256 o0 = Lib_IntVector_Intrinsics_vec256_add64(f100, f20);
-      Lib_IntVector_Intrinsics_vec256 o1 = Lib_IntVector_Intrinsics_vec256_add64(f11, f21);
-      Lib_IntVector_Intrinsics_vec256 o2 = Lib_IntVector_Intrinsics_vec256_add64(f12, f22);
-      Lib_IntVector_Intrinsics_vec256 o3 = Lib_IntVector_Intrinsics_vec256_add64(f13, f23);
-      Lib_IntVector_Intrinsics_vec256 o4 = Lib_IntVector_Intrinsics_vec256_add64(f14, f24);
-      acc0[0U] = o0;
-      acc0[1U] = o1;
-      acc0[2U] = o2;
-      acc0[3U] = o3;
-      acc0[4U] = o4;
-    }
+    poly1305_update4_256(ctx, nb, text1);
     Hacl_Impl_Poly1305_Field32xN_256_fmul_r4_normalize(acc0, pre0);
   }
   uint32_t len1 = n * (uint32_t)16U - len0;
@@ -907,22 +915,15 @@ poly1305_padded_256(Lib_IntVector_Intrinsics_vec256 *ctx, uint32_t len, uint8_t
 }
 
 static inline void
-poly1305_do_256(
+poly1305_finish_256(
+  Lib_IntVector_Intrinsics_vec256 *ctx,
   uint8_t *k,
   uint32_t aadlen,
-  uint8_t *aad,
   uint32_t mlen,
-  uint8_t *m,
   uint8_t *out
 )
 {
-  Lib_IntVector_Intrinsics_vec256 ctx[25U];
-  for (uint32_t _i = 0U; _i < (uint32_t)25U; ++_i)
-    ctx[_i] = Lib_IntVector_Intrinsics_vec256_zero;
   uint8_t block[16U] = { 0U };
-  Hacl_Poly1305_256_poly1305_init(ctx, k);
-  poly1305_padded_256(ctx, aadlen, aad);
-  poly1305_padded_256(ctx, mlen, m);
   store64_le(block, (uint64_t)aadlen);
   store64_le(block + (uint32_t)8U, (uint64_t)mlen);
   Lib_IntVector_Intrinsics_vec256 *pre = ctx + (uint32_t)5U;
@@ -1135,6 +1136,103 @@ poly1305_do_256(
   Hacl_Poly1305_256_poly1305_finish(out, k, ctx);
 }
 
+static inline void
+poly1305_do_256(
+  uint8_t *k,
+  uint32_t aadlen,
+  uint8_t *aad,
+  uint32_t mlen,
+  uint8_t *m,
+  uint8_t *out
+)
+{
+  Lib_IntVector_Intrinsics_vec256 ctx[25U];
+  for (uint32_t _i = 0U; _i < (uint32_t)25U; ++_i)
+    ctx[_i] = Lib_IntVector_Intrinsics_vec256_zero;
+  Hacl_Poly1305_256_poly1305_init(ctx, k);
+  poly1305_padded_256(ctx, aadlen, aad);
+  poly1305_padded_256(ctx, mlen, m);
+  poly1305_finish_256(ctx, k, aadlen, mlen, out);
+}
+
+/* Encrypts the len bytes, a multiple of 64, at offset off of m into cipher and absorbs the
+   resulting ciphertext into the 4-way Poly1305 accumulator while it is still in L1. */
+static inline void
+chacha20_poly1305_chunk_256(
+  Lib_IntVector_Intrinsics_vec256 *ctx,
+  uint8_t *k,
+  uint8_t *n,
+  uint32_t off,
+  uint32_t len,
+  uint8_t *m,
+  uint8_t *cipher
+)
+{
+  uint8_t *c = cipher + off;
+  Hacl_Chacha20_Vec256_chacha20_encrypt_256(len,
+    c,
+    m + off,
+    k,
+    n,
+    (uint32_t)1U + off / (uint32_t)64U);
+  if (off == (uint32_t)0U)
+  {
+    Hacl_Impl_Poly1305_Field32xN_256_load_acc4(ctx, c);
+    poly1305_update4_256(ctx, len / (uint32_t)64U - (uint32_t)1U, c + (uint32_t)64U);
+    return;
+  }
+  poly1305_update4_256(ctx, len / (uint32_t)64U, c);
+}
+
+/* Single-pass encryption for messages longer than one chunk: the message is encrypted and
+   MACed in 2KB chunks, so that the ciphertext is absorbed while it is still in L1 instead of
+   being read back from L2 or memory by a second pass. The accumulator stays in 4-way form
+   across chunks and is normalized once, after the last whole 64-byte block. */
+static inline void
+chacha20_poly1305_stitched_256(
+  uint8_t *k,
+  uint8_t *n,
+  uint32_t aadlen,
+  uint8_t *aad,
+  uint32_t mlen,
+  uint8_t *m,
+  uint8_t *cipher,
+  uint8_t *mac
+)
+{
+  Lib_IntVector_Intrinsics_vec256 ctx[25U];
+  for (uint32_t _i = 0U; _i < (uint32_t)25U; ++_i)
+    ctx[_i] = Lib_IntVector_Intrinsics_vec256_zero;
+  uint8_t tmp[64U] = { 0U };
+  Hacl_Chacha20_Vec256_chacha20_encrypt_256((uint32_t)64U, tmp, tmp, k, n, (uint32_t)0U);
+  uint8_t *key = tmp;
+  Hacl_Poly1305_256_poly1305_init(ctx, key);
+  poly1305_padded_256(ctx, aadlen, aad);
+  uint32_t len0 = mlen / (uint32_t)64U * (uint32_t)64U;
+  if (len0 > (uint32_t)0U)
+  {
+    uint32_t nb = len0 / (uint32_t)2048U;
+    uint32_t rem = len0 % (uint32_t)2048U;
+    for (uint32_t i = (uint32_t)0U; i < nb; i++)
+    {
+      chacha20_poly1305_chunk_256(ctx, k, n, i * (uint32_t)2048U, (uint32_t)2048U, m, cipher);
+    }
+    if (rem > (uint32_t)0U)
+    {
+      chacha20_poly1305_chunk_256(ctx, k, n, nb * (uint32_t)2048U, rem, m, cipher);
+    }
+    Hacl_Impl_Poly1305_Field32xN_256_fmul_r4_normalize(ctx, ctx + (uint32_t)5U);
+  }
+  Hacl_Chacha20_Vec256_chacha20_encrypt_256(mlen - len0,
+    cipher + len0,
+    m + len0,
+    k,
+    n,
+    (uint32_t)1U + len0 / (uint32_t)64U);
+  poly1305_padded_256(ctx, mlen - len0, cipher + len0);
+  poly1305_finish_256(ctx, key, aadlen, mlen, mac);
+}
+
 void
 Hacl_Chacha20Poly1305_256_aead_encrypt(
   uint8_t *k,
@@ -1147,6 +1245,11 @@ Hacl_Chacha20Poly1305_256_aead_encrypt(
   uint8_t *mac
 )
 {
+  if (mlen > (uint32_t)2048U)
+  {
+    chacha20_poly1305_stitched_256(k, n, aadlen, aad, mlen, m, cipher, mac);
+    return;
+  }
   Hacl_Chacha20_Vec256_chacha20_encrypt_256(mlen, cipher, m, k, n, (uint32_t)1U);
   uint8_t tmp[64U] = { 0U };
   Hacl_Chacha20_Vec256_chacha20_encrypt_256((uint32_t)64U, tmp, tmp, k, n, (uint32_t)0U);
@@ -1186,3 +1289,371 @@ Hacl_Chacha20Poly1305_256_aead_decrypt(
   return (uint32_t)1U;
 }
 
+
+/* Block t of the Poly1305 input of an AEAD packet: aad and the ciphertext, each zero-padded to
+   a multiple of 16 bytes, then their lengths. Partial and length blocks are built in tmp. */
+static inline uint8_t
+*poly1305_packet_block(
+  uint8_t *tmp,
+  uint32_t t,
+  uint32_t aadlen,
+  uint8_t *aad,
+  uint32_t len,
+  uint8_t *c
+)
+{
+  uint32_t na = (aadlen + (uint32_t)15U) / (uint32_t)16U;
+  uint32_t nc = (len + (uint32_t)15U) / (uint32_t)16U;
+  uint8_t *src;
+  uint32_t rem;
+  if (t < na)
+  {
+    src = aad + t * (uint32_t)16U;
+    rem = aadlen - t * (uint32_t)16U;
+  }
+  else if (t < na + nc)
+  {
+    src = c + (t - na) * (uint32_t)16U;
+    rem = len - (t - na) * (uint32_t)16U;
+  }
+  else
+  {
+    store64_le(tmp, (uint64_t)aadlen);
+    store64_le(tmp + (uint32_t)8U, (uint64_t)len);
+    return tmp;
+  }
+  if (rem >= (uint32_t)16U)
+  {
+    return src;
+  }
+  memset(tmp, 0U, (uint32_t)16U * sizeof (tmp[0U]));
+  memcpy(tmp, src, rem * sizeof (src[0U]));
+  return tmp;
+}
+
+/* Computes the Poly1305 tags of up to 8 packets at once, one per 64-bit lane of two vectors.
+   Packet i uses the one-time key at keys + 32 i. Lanes whose packet has no block left keep
+   their accumulator. */
+static void
+poly1305_packets_256(
+  uint32_t num,
+  uint8_t *keys,
+  uint32_t *aadlen,
+  uint8_t **aad,
+  uint32_t *len,
+  uint8_t **c,
+  uint8_t **tag
+)
+{
+  Lib_IntVector_Intrinsics_vec256 acc[10U];
+  Lib_IntVector_Intrinsics_vec256 r[10U];
+  Lib_IntVector_Intrinsics_vec256 r5[10U];
+  uint64_t rl[40U] = { 0U };
+  uint32_t nb[8U] = { 0U };
+  uint32_t max_nb = (uint32_t)0U;
+  for (uint32_t i = (uint32_t)0U; i < num; i++)
+  {
+    uint8_t *key = keys + i * (uint32_t)32U;
+    uint64_t lo = load64_le(key) & (uint64_t)0x0ffffffc0fffffffU;
+    uint64_t hi = load64_le(key + (uint32_t)8U) & (uint64_t)0x0ffffffc0ffffffcU;
+    uint64_t *l = rl + i / (uint32_t)4U * (uint32_t)20U + i % (uint32_t)4U;
+    l[0U] = lo & (uint64_t)0x3ffffffU;
+    l[4U] = lo >> (uint32_t)26U & (uint64_t)0x3ffffffU;
+    l[8U] = lo >> (uint32_t)52U | (hi & (uint64_t)0x3fffU) << (uint32_t)12U;
+    l[12U] = hi >> (uint32_t)14U & (uint64_t)0x3ffffffU;
+    l[16U] = hi >> (uint32_t)40U;
+    nb[i] =
+      (aadlen[i] + (uint32_t)15U)
+      / (uint32_t)16U
+      + (len[i] + (uint32_t)15U) / (uint32_t)16U
+      + (uint32_t)1U;
+    if (nb[i] > max_nb)
+    {
+      max_nb = nb[i];
+    }
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)10U; i++)
+  {
+    uint64_t *l = rl + i * (uint32_t)4U;
+    acc[i] = Lib_IntVector_Intrinsics_vec256_zero;
+    r[i] = Lib_IntVector_Intrinsics_vec256_load64s(l[0U], l[1U], l[2U], l[3U]);
+    r5[i] = Lib_IntVector_Intrinsics_vec256_smul64(r[i], (uint64_t)5U);
+  }
+  uint8_t zero[16U] = { 0U };
+  Lib_IntVector_Intrinsics_vec256
+  mask26 = Lib_IntVector_Intrinsics_vec256_load64((uint64_t)0x3ffffffU);
+  for (uint32_t t = (uint32_t)0U; t < max_nb; t++)
+  {
+    uint8_t tmp[128U];
+    uint8_t *b[8U];
+    uint64_t live[8U];
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+    {
+      if (i < num && t < nb[i])
+      {
+        b[i] = poly1305_packet_block(tmp + i * (uint32_t)16U, t, aadlen[i], aad[i], len[i], c[i]);
+        live[i] = (uint64_t)0xffffffffffffffffU;
+      }
+      else
+      {
+        b[i] = zero;
+        live[i] = (uint64_t)0U;
+      }
+    }
+    for (uint32_t h = (uint32_t)0U; h < (uint32_t)2U; h++)
+    {
+      uint8_t **bh = b + h * (uint32_t)4U;
+      uint64_t *lh = live + h * (uint32_t)4U;
+      Lib_IntVector_Intrinsics_vec256 *a = acc + h * (uint32_t)5U;
+      Lib_IntVector_Intrinsics_vec256 *rh = r + h * (uint32_t)5U;
+      Lib_IntVector_Intrinsics_vec256 *r5h = r5 + h * (uint32_t)5U;
+      Lib_IntVector_Intrinsics_vec256
+      f0 =
+        Lib_IntVector_Intrinsics_vec256_load64s(load64_le(bh[0U]),
+          load64_le(bh[1U]),
+          load64_le(bh[2U]),
+          load64_le(bh[3U]));
+      Lib_IntVector_Intrinsics_vec256
+      f1 =
+        Lib_IntVector_Intrinsics_vec256_load64s(load64_le(bh[0U] + (uint32_t)8U),
+          load64_le(bh[1U] + (uint32_t)8U),
+          load64_le(bh[2U] + (uint32_t)8U),
+          load64_le(bh[3U] + (uint32_t)8U));
+      Lib_IntVector_Intrinsics_vec256 e[5U];
+      e[0U] = Lib_IntVector_Intrinsics_vec256_and(f0, mask26);
+      e[1U] =
+        Lib_IntVector_Intrinsics_vec256_and(Lib_IntVector_Intrinsics_vec256_shift_right64(f0,
+            (uint32_t)26U),
+          mask26);
+      e[2U] =
+        Lib_IntVector_Intrinsics_vec256_or(Lib_IntVector_Intrinsics_vec256_shift_right64(f0,
+            (uint32_t)52U),
+          Lib_IntVector_Intrinsics_vec256_shift_left64(Lib_IntVector_Intrinsics_vec256_and(f1,
+              Lib_IntVector_Intrinsics_vec256_load64((uint64_t)0x3fffU)),
+            (uint32_t)12U));
+      e[3U] =
+        Lib_IntVector_Intrinsics_vec256_and(Lib_IntVector_Intrinsics_vec256_shift_right64(f1,
+            (uint32_t)14U),
+          mask26);
+      e[4U] =
+        Lib_IntVector_Intrinsics_vec256_or(Lib_IntVector_Intrinsics_vec256_shift_right64(f1,
+            (uint32_t)40U),
+          Lib_IntVector_Intrinsics_vec256_load64((uint64_t)0x1000000U));
+      Lib_IntVector_Intrinsics_vec256 x[5U];
+      for (uint32_t j = (uint32_t)0U; j < (uint32_t)5U; j++)
+      {
+        x[j] = Lib_IntVector_Intrinsics_vec256_add64(a[j], e[j]);
+      }
+      /* t_j = sum of x_i r_(j - i), with r_(-k) taken as 5 r_(5 - k). */
+      Lib_IntVector_Intrinsics_vec256 t0[5U];
+      for (uint32_t j = (uint32_t)0U; j < (uint32_t)5U; j++)
+      {
+        Lib_IntVector_Intrinsics_vec256 s = Lib_IntVector_Intrinsics_vec256_mul64(rh[j], x[0U]);
+        for (uint32_t i = (uint32_t)1U; i < (uint32_t)5U; i++)
+        {
+          Lib_IntVector_Intrinsics_vec256 ri;
+          if (i <= j)
+          {
+            ri = rh[j - i];
+          }
+          else
+          {
+            ri = r5h[(uint32_t)5U + j - i];
+          }
+          s =
+            Lib_IntVector_Intrinsics_vec256_add64(s,
+              Lib_IntVector_Intrinsics_vec256_mul64(ri, x[i]));
+        }
+        t0[j] = s;
+      }
+      Lib_IntVector_Intrinsics_vec256
+      z0 = Lib_IntVector_Intrinsics_vec256_shift_right64(t0[0U], (uint32_t)26U);
+      Lib_IntVector_Intrinsics_vec256
+      z1 = Lib_IntVector_Intrinsics_vec256_shift_right64(t0[3U], (uint32_t)26U);
+      Lib_IntVector_Intrinsics_vec256 x0 = Lib_IntVector_Intrinsics_vec256_and(t0[0U], mask26);
+      Lib_IntVector_Intrinsics_vec256 x3 = Lib_IntVector_Intrinsics_vec256_and(t0[3U], mask26);
+      Lib_IntVector_Intrinsics_vec256 x1 = Lib_IntVector_Intrinsics_vec256_add64(t0[1U], z0);
+      Lib_IntVector_Intrinsics_vec256 x4 = Lib_IntVector_Intrinsics_vec256_add64(t0[4U], z1);
+      Lib_IntVector_Intrinsics_vec256
+      z01 = Lib_IntVector_Intrinsics_vec256_shift_right64(x1, (uint32_t)26U);
+      Lib_IntVector_Intrinsics_vec256
+      z11 = Lib_IntVector_Intrinsics_vec256_shift_right64(x4, (uint32_t)26U);
+      Lib_IntVector_Intrinsics_vec256
+      z12 =
+        Lib_IntVector_Intrinsics_vec256_add64(z11,
+          Lib_IntVector_Intrinsics_vec256_shift_left64(z11, (uint32_t)2U));
+      Lib_IntVector_Intrinsics_vec256 x11 = Lib_IntVector_Intrinsics_vec256_and(x1, mask26);
+      Lib_IntVector_Intrinsics_vec256 x41 = Lib_IntVector_Intrinsics_vec256_and(x4, mask26);
+      Lib_IntVector_Intrinsics_vec256 x2 = Lib_IntVector_Intrinsics_vec256_add64(t0[2U], z01);
+      Lib_IntVector_Intrinsics_vec256 x01 = Lib_IntVector_Intrinsics_vec256_add64(x0, z12);
+      Lib_IntVector_Intrinsics_vec256
+      z02 = Lib_IntVector_Intrinsics_vec256_shift_right64(x2, (uint32_t)26U);
+      Lib_IntVector_Intrinsics_vec256
+      z13 = Lib_IntVector_Intrinsics_vec256_shift_right64(x01, (uint32_t)26U);
+      Lib_IntVector_Intrinsics_vec256 x21 = Lib_IntVector_Intrinsics_vec256_and(x2, mask26);
+      Lib_IntVector_Intrinsics_vec256 x02 = Lib_IntVector_Intrinsics_vec256_and(x01, mask26);
+      Lib_IntVector_Intrinsics_vec256 x31 = Lib_IntVector_Intrinsics_vec256_add64(x3, z02);
+      Lib_IntVector_Intrinsics_vec256 x12 = Lib_IntVector_Intrinsics_vec256_add64(x11, z13);
+      Lib_IntVector_Intrinsics_vec256
+      z03 = Lib_IntVector_Intrinsics_vec256_shift_right64(x31, (uint32_t)26U);
+      Lib_IntVector_Intrinsics_vec256 x32 = Lib_IntVector_Intrinsics_vec256_and(x31, mask26);
+      Lib_IntVector_Intrinsics_vec256 x42 = Lib_IntVector_Intrinsics_vec256_add64(x41, z03);
+      Lib_IntVector_Intrinsics_vec256 o[5U] = { x02, x12, x21, x32, x42 };
+      Lib_IntVector_Intrinsics_vec256
+      m = Lib_IntVector_Intrinsics_vec256_load64s(lh[0U], lh[1U], lh[2U], lh[3U]);
+      Lib_IntVector_Intrinsics_vec256 nm = Lib_IntVector_Intrinsics_vec256_lognot(m);
+      for (uint32_t j = (uint32_t)0U; j < (uint32_t)5U; j++)
+      {
+        a[j] =
+          Lib_IntVector_Intrinsics_vec256_or(Lib_IntVector_Intrinsics_vec256_and(o[j], m),
+            Lib_IntVector_Intrinsics_vec256_and(a[j], nm));
+      }
+    }
+  }
+  uint8_t al[320U];
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)10U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec256_store_le(al + i * (uint32_t)32U, acc[i]);
+  }
+  for (uint32_t i = (uint32_t)0U; i < num; i++)
+  {
+    uint64_t ctx[25U] = { 0U };
+    uint8_t *a = al + i / (uint32_t)4U * (uint32_t)160U + i % (uint32_t)4U * (uint32_t)8U;
+    for (uint32_t j = (uint32_t)0U; j < (uint32_t)5U; j++)
+    {
+      ctx[j] = load64_le(a + j * (uint32_t)32U);
+    }
+    Hacl_Poly1305_32_poly1305_finish(tag[i], keys + i * (uint32_t)32U, ctx);
+  }
+}
+
+/* ChaCha20 over up to 8 packets at once. Lanes past num repeat packet 0 with nothing to
+   write. */
+static void
+chacha20_packets_256(
+  uint32_t num,
+  uint32_t *len,
+  uint8_t **out,
+  uint8_t **text,
+  uint8_t **k,
+  uint8_t **n,
+  uint32_t ctr
+)
+{
+  uint32_t l[8U] = { 0U };
+  uint8_t *o[8U];
+  uint8_t *t[8U];
+  uint8_t *kl[8U];
+  uint8_t *nl[8U];
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    uint32_t j = (uint32_t)0U;
+    if (i < num)
+    {
+      j = i;
+      l[i] = len[i];
+    }
+    o[i] = out[j];
+    t[i] = text[j];
+    kl[i] = k[j];
+    nl[i] = n[j];
+  }
+  Hacl_Chacha20_Vec256_chacha20_encrypt_multi_256(l, o, t, kl, nl, ctr);
+}
+
+/* Derives the Poly1305 one-time keys of up to 8 packets into keys, 32 bytes each. */
+static void poly1305_keys_256(uint32_t num, uint8_t *keys, uint8_t **k, uint8_t **n)
+{
+  uint32_t l[8U];
+  uint8_t *p[8U];
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    l[i] = (uint32_t)32U;
+    p[i] = keys + i * (uint32_t)32U;
+  }
+  chacha20_packets_256(num, l, p, p, k, n, (uint32_t)0U);
+}
+
+void
+Hacl_Chacha20Poly1305_256_aead_encrypt_batch(
+  uint32_t num,
+  uint8_t **k,
+  uint8_t **n,
+  uint32_t *aadlen,
+  uint8_t **aad,
+  uint32_t *mlen,
+  uint8_t **m,
+  uint8_t **cipher,
+  uint8_t **mac
+)
+{
+  for (uint32_t i = (uint32_t)0U; i < num; i = i + (uint32_t)8U)
+  {
+    uint32_t g = num - i;
+    if (g > (uint32_t)8U)
+    {
+      g = (uint32_t)8U;
+    }
+    uint8_t keys[256U] = { 0U };
+    poly1305_keys_256(g, keys, k + i, n + i);
+    chacha20_packets_256(g, mlen + i, cipher + i, m + i, k + i, n + i, (uint32_t)1U);
+    poly1305_packets_256(g, keys, aadlen + i, aad + i, mlen + i, cipher + i, mac + i);
+    Lib_Memzero0_memzero(keys, (uint32_t)256U * sizeof (keys[0U]));
+  }
+}
+
+uint32_t
+Hacl_Chacha20Poly1305_256_aead_decrypt_batch(
+  uint32_t num,
+  uint8_t **k,
+  uint8_t **n,
+  uint32_t *aadlen,
+  uint8_t **aad,
+  uint32_t *mlen,
+  uint8_t **m,
+  uint8_t **cipher,
+  uint8_t **mac,
+  uint32_t *res
+)
+{
+  uint32_t failed = (uint32_t)0U;
+  for (uint32_t i = (uint32_t)0U; i < num; i = i + (uint32_t)8U)
+  {
+    uint32_t g = num - i;
+    if (g > (uint32_t)8U)
+    {
+      g = (uint32_t)8U;
+    }
+    uint8_t keys[256U] = { 0U };
+    uint8_t computed[128U] = { 0U };
+    uint8_t *cm[8U];
+    uint32_t l[8U] = { 0U };
+    for (uint32_t j = (uint32_t)0U; j < (uint32_t)8U; j++)
+    {
+      cm[j] = computed + j * (uint32_t)16U;
+    }
+    poly1305_keys_256(g, keys, k + i, n + i);
+    poly1305_packets_256(g, keys, aadlen + i, aad + i, mlen + i, cipher + i, cm);
+    Lib_Memzero0_memzero(keys, (uint32_t)256U * sizeof (keys[0U]));
+    for (uint32_t j = (uint32_t)0U; j < g; j++)
+    {
+      uint8_t eq = (uint8_t)255U;
+      for (uint32_t b = (uint32_t)0U; b < (uint32_t)16U; b++)
+      {
+        eq = FStar_UInt8_eq_mask(cm[j][b], mac[i + j][b]) & eq;
+      }
+      if (eq == (uint8_t)255U)
+      {
+        res[i + j] = (uint32_t)0U;
+        l[j] = mlen[i + j];
+      }
+      else
+      {
+        res[i + j] = (uint32_t)1U;
+        failed = failed + (uint32_t)1U;
+      }
+    }
+    chacha20_packets_256(g, l, m + i, cipher + i, k + i, n + i, (uint32_t)1U);
+  }
+  return failed;
+}
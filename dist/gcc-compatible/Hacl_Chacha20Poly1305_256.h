@@ -34,8 +34,12 @@
 #include "Hacl_Kremlib.h"
 #include "Hacl_Chacha20_Vec256.h"
 #include "Hacl_Poly1305_256.h"
+#include "Hacl_Poly1305_32.h"
+#include "Lib_Memzero0.h"
 
 
+/* Encrypts the mlen bytes of m into cipher and writes the 16-byte tag to mac. cipher may
+   be m itself, to encrypt in place; buffers that overlap only partially are not supported. */
 void
 Hacl_Chacha20Poly1305_256_aead_encrypt(
   uint8_t *k,
@@ -48,6 +52,9 @@ Hacl_Chacha20Poly1305_256_aead_encrypt(
   uint8_t *mac
 );
 
+/* Checks mac against aad and the mlen bytes of cipher and, if it matches, decrypts cipher
+   into m and returns 0. Otherwise 1 is returned and m is not written. m may be cipher itself,
+   to decrypt in place. */
 uint32_t
 Hacl_Chacha20Poly1305_256_aead_decrypt(
   uint8_t *k,
@@ -60,5 +67,40 @@ Hacl_Chacha20Poly1305_256_aead_decrypt(
   uint8_t *mac
 );
 
+/* Seals num independent packets: packet i is encrypted as by
+   Hacl_Chacha20Poly1305_256_aead_encrypt(k[i], n[i], aadlen[i], aad[i], mlen[i], m[i],
+   cipher[i], mac[i]). Packets are processed 8 at a time, one per vector lane for ChaCha20 and
+   one per 64-bit lane for Poly1305, so packets of similar lengths should be batched together.
+   cipher[i] may be m[i] itself; distinct packets must not overlap. */
+void
+Hacl_Chacha20Poly1305_256_aead_encrypt_batch(
+  uint32_t num,
+  uint8_t **k,
+  uint8_t **n,
+  uint32_t *aadlen,
+  uint8_t **aad,
+  uint32_t *mlen,
+  uint8_t **m,
+  uint8_t **cipher,
+  uint8_t **mac
+);
+
+/* Opens num independent packets: res[i] is set to what
+   Hacl_Chacha20Poly1305_256_aead_decrypt would return for packet i, and m[i] is written
+   only when it is 0. Returns the number of packets that failed to authenticate. */
+uint32_t
+Hacl_Chacha20Poly1305_256_aead_decrypt_batch(
+  uint32_t num,
+  uint8_t **k,
+  uint8_t **n,
+  uint32_t *aadlen,
+  uint8_t **aad,
+  uint32_t *mlen,
+  uint8_t **m,
+  uint8_t **cipher,
+  uint8_t **mac,
+  uint32_t *res
+);
+
 #define __Hacl_Chacha20Poly1305_256_H_DEFINED
 #endif
@@ -36,6 +36,8 @@
 #include "Hacl_Poly1305_32.h"
 
 
+/* Encrypts the mlen bytes of m into cipher and writes the 16-byte tag to mac. cipher may
+   be m itself, to encrypt in place; buffers that overlap only partially are not supported. */
 void
 Hacl_Chacha20Poly1305_32_aead_encrypt(
   uint8_t *k,
@@ -48,6 +50,9 @@ Hacl_Chacha20Poly1305_32_aead_encrypt(
   uint8_t *mac
 );
 
+/* Checks mac against aad and the mlen bytes of cipher and, if it matches, decrypts cipher
+   into m and returns 0. Otherwise 1 is returned and m is not written. m may be cipher itself,
+   to decrypt in place. */
 uint32_t
 Hacl_Chacha20Poly1305_32_aead_decrypt(
   uint8_t *k,
@@ -759,3 +759,77 @@ Hacl_Chacha20_Vec128_chacha20_decrypt_128(
   }
 }
 
+static inline void
+chacha20_hp_masks_block_128(Lib_IntVector_Intrinsics_vec128 *ctx, uint8_t *masks, uint8_t *samples)
+{
+  Lib_IntVector_Intrinsics_vec128 k[16U];
+  for (uint32_t _i = 0U; _i < (uint32_t)16U; ++_i)
+    k[_i] = Lib_IntVector_Intrinsics_vec128_zero;
+  memcpy(k, ctx, (uint32_t)12U * sizeof (ctx[0U]));
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    uint8_t *s = samples + i * (uint32_t)4U;
+    k[(uint32_t)12U + i] =
+      Lib_IntVector_Intrinsics_vec128_load32s(load32_le(s + (uint32_t)0U),
+        load32_le(s + (uint32_t)16U),
+        load32_le(s + (uint32_t)32U),
+        load32_le(s + (uint32_t)48U));
+  }
+  double_round_128(k);
+  double_round_128(k);
+  double_round_128(k);
+  double_round_128(k);
+  double_round_128(k);
+  double_round_128(k);
+  double_round_128(k);
+  double_round_128(k);
+  double_round_128(k);
+  double_round_128(k);
+  Lib_IntVector_Intrinsics_vec128 w0 = Lib_IntVector_Intrinsics_vec128_add32(k[0U], ctx[0U]);
+  Lib_IntVector_Intrinsics_vec128 w1 = Lib_IntVector_Intrinsics_vec128_add32(k[1U], ctx[1U]);
+  uint8_t b0[16U] = { 0U };
+  uint8_t b1[16U] = { 0U };
+  Lib_IntVector_Intrinsics_vec128_store_le(b0, w0);
+  Lib_IntVector_Intrinsics_vec128_store_le(b1, w1);
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    uint8_t *m = masks + i * (uint32_t)5U;
+    memcpy(m, b0 + i * (uint32_t)4U, (uint32_t)4U * sizeof (b0[0U]));
+    m[4U] = b1[i * (uint32_t)4U];
+  }
+}
+
+void
+Hacl_Chacha20_Vec128_chacha20_hp_masks_128(
+  uint32_t n,
+  uint8_t *masks,
+  uint8_t *key,
+  uint8_t *samples
+)
+{
+  Lib_IntVector_Intrinsics_vec128 ctx[12U];
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    uint32_t x = Hacl_Impl_Chacha20_Vec_chacha20_constants[i];
+    ctx[i] = Lib_IntVector_Intrinsics_vec128_load32(x);
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    uint32_t x = load32_le(key + i * (uint32_t)4U);
+    ctx[(uint32_t)4U + i] = Lib_IntVector_Intrinsics_vec128_load32(x);
+  }
+  uint32_t nb = n / (uint32_t)4U;
+  uint32_t rem = n % (uint32_t)4U;
+  for (uint32_t i = (uint32_t)0U; i < nb; i++)
+  {
+    chacha20_hp_masks_block_128(ctx, masks + i * (uint32_t)20U, samples + i * (uint32_t)64U);
+  }
+  if (rem > (uint32_t)0U)
+  {
+    uint8_t s[64U] = { 0U };
+    uint8_t m[20U] = { 0U };
+    memcpy(s, samples + nb * (uint32_t)64U, rem * (uint32_t)16U * sizeof (samples[0U]));
+    chacha20_hp_masks_block_128(ctx, m, s);
+    memcpy(masks + nb * (uint32_t)20U, m, rem * (uint32_t)5U * sizeof (m[0U]));
+  }
+}
@@ -55,5 +55,16 @@ Hacl_Chacha20_Vec128_chacha20_decrypt_128(
   uint32_t ctr
 );
 
+/* Computes the ChaCha20 header-protection masks of n samples, 4 at a time: for each i, the
+   first 5 bytes of the key stream block whose counter and nonce are the first 4 and the last
+   12 bytes of the 16-byte sample at samples + 16 i are written to masks + 5 i. */
+void
+Hacl_Chacha20_Vec128_chacha20_hp_masks_128(
+  uint32_t n,
+  uint8_t *masks,
+  uint8_t *key,
+  uint8_t *samples
+);
+
 #define __Hacl_Chacha20_Vec128_H_DEFINED
 #endif
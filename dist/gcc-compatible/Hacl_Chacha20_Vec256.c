@@ -891,3 +891,243 @@ Hacl_Chacha20_Vec256_chacha20_decrypt_256(
   }
 }
 
+static inline void
+chacha20_hp_masks_block_256(Lib_IntVector_Intrinsics_vec256 *ctx, uint8_t *masks, uint8_t *samples)
+{
+  Lib_IntVector_Intrinsics_vec256 k[16U];
+  for (uint32_t _i = 0U; _i < (uint32_t)16U; ++_i)
+    k[_i] = Lib_IntVector_Intrinsics_vec256_zero;
+  memcpy(k, ctx, (uint32_t)12U * sizeof (ctx[0U]));
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    uint8_t *s = samples + i * (uint32_t)4U;
+    k[(uint32_t)12U + i] =
+      Lib_IntVector_Intrinsics_vec256_load32s(load32_le(s + (uint32_t)0U),
+        load32_le(s + (uint32_t)16U),
+        load32_le(s + (uint32_t)32U),
+        load32_le(s + (uint32_t)48U),
+        load32_le(s + (uint32_t)64U),
+        load32_le(s + (uint32_t)80U),
+        load32_le(s + (uint32_t)96U),
+        load32_le(s + (uint32_t)112U));
+  }
+  double_round_256(k);
+  double_round_256(k);
+  double_round_256(k);
+  double_round_256(k);
+  double_round_256(k);
+  double_round_256(k);
+  double_round_256(k);
+  double_round_256(k);
+  double_round_256(k);
+  double_round_256(k);
+  Lib_IntVector_Intrinsics_vec256 w0 = Lib_IntVector_Intrinsics_vec256_add32(k[0U], ctx[0U]);
+  Lib_IntVector_Intrinsics_vec256 w1 = Lib_IntVector_Intrinsics_vec256_add32(k[1U], ctx[1U]);
+  uint8_t b0[32U] = { 0U };
+  uint8_t b1[32U] = { 0U };
+  Lib_IntVector_Intrinsics_vec256_store_le(b0, w0);
+  Lib_IntVector_Intrinsics_vec256_store_le(b1, w1);
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    uint8_t *m = masks + i * (uint32_t)5U;
+    memcpy(m, b0 + i * (uint32_t)4U, (uint32_t)4U * sizeof (b0[0U]));
+    m[4U] = b1[i * (uint32_t)4U];
+  }
+}
+
+void
+Hacl_Chacha20_Vec256_chacha20_hp_masks_256(
+  uint32_t n,
+  uint8_t *masks,
+  uint8_t *key,
+  uint8_t *samples
+)
+{
+  Lib_IntVector_Intrinsics_vec256 ctx[12U];
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    uint32_t x = Hacl_Impl_Chacha20_Vec_chacha20_constants[i];
+    ctx[i] = Lib_IntVector_Intrinsics_vec256_load32(x);
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    uint32_t x = load32_le(key + i * (uint32_t)4U);
+    ctx[(uint32_t)4U + i] = Lib_IntVector_Intrinsics_vec256_load32(x);
+  }
+  uint32_t nb = n / (uint32_t)8U;
+  uint32_t rem = n % (uint32_t)8U;
+  for (uint32_t i = (uint32_t)0U; i < nb; i++)
+  {
+    chacha20_hp_masks_block_256(ctx, masks + i * (uint32_t)40U, samples + i * (uint32_t)128U);
+  }
+  if (rem > (uint32_t)0U)
+  {
+    uint8_t s[128U] = { 0U };
+    uint8_t m[40U] = { 0U };
+    memcpy(s, samples + nb * (uint32_t)128U, rem * (uint32_t)16U * sizeof (samples[0U]));
+    chacha20_hp_masks_block_256(ctx, m, s);
+    memcpy(masks + nb * (uint32_t)40U, m, rem * (uint32_t)5U * sizeof (m[0U]));
+  }
+}
+
+/* Turns the 16 state words of 8 lanes into the 8 key stream blocks they encode: afterwards
+   the block of lane i is k[2 i] followed by k[2 i + 1]. */
+static inline void transpose_256(Lib_IntVector_Intrinsics_vec256 *k)
+{
+  Lib_IntVector_Intrinsics_vec256 t[16U];
+  for (uint32_t h = (uint32_t)0U; h < (uint32_t)2U; h++)
+  {
+    Lib_IntVector_Intrinsics_vec256 *v = k + h * (uint32_t)8U;
+    Lib_IntVector_Intrinsics_vec256
+    v0_ = Lib_IntVector_Intrinsics_vec256_interleave_low32(v[0U], v[1U]);
+    Lib_IntVector_Intrinsics_vec256
+    v1_ = Lib_IntVector_Intrinsics_vec256_interleave_high32(v[0U], v[1U]);
+    Lib_IntVector_Intrinsics_vec256
+    v2_ = Lib_IntVector_Intrinsics_vec256_interleave_low32(v[2U], v[3U]);
+    Lib_IntVector_Intrinsics_vec256
+    v3_ = Lib_IntVector_Intrinsics_vec256_interleave_high32(v[2U], v[3U]);
+    Lib_IntVector_Intrinsics_vec256
+    v4_ = Lib_IntVector_Intrinsics_vec256_interleave_low32(v[4U], v[5U]);
+    Lib_IntVector_Intrinsics_vec256
+    v5_ = Lib_IntVector_Intrinsics_vec256_interleave_high32(v[4U], v[5U]);
+    Lib_IntVector_Intrinsics_vec256
+    v6_ = Lib_IntVector_Intrinsics_vec256_interleave_low32(v[6U], v[7U]);
+    Lib_IntVector_Intrinsics_vec256
+    v7_ = Lib_IntVector_Intrinsics_vec256_interleave_high32(v[6U], v[7U]);
+    Lib_IntVector_Intrinsics_vec256
+    v0__ = Lib_IntVector_Intrinsics_vec256_interleave_low64(v0_, v2_);
+    Lib_IntVector_Intrinsics_vec256
+    v1__ = Lib_IntVector_Intrinsics_vec256_interleave_high64(v0_, v2_);
+    Lib_IntVector_Intrinsics_vec256
+    v2__ = Lib_IntVector_Intrinsics_vec256_interleave_low64(v1_, v3_);
+    Lib_IntVector_Intrinsics_vec256
+    v3__ = Lib_IntVector_Intrinsics_vec256_interleave_high64(v1_, v3_);
+    Lib_IntVector_Intrinsics_vec256
+    v4__ = Lib_IntVector_Intrinsics_vec256_interleave_low64(v4_, v6_);
+    Lib_IntVector_Intrinsics_vec256
+    v5__ = Lib_IntVector_Intrinsics_vec256_interleave_high64(v4_, v6_);
+    Lib_IntVector_Intrinsics_vec256
+    v6__ = Lib_IntVector_Intrinsics_vec256_interleave_low64(v5_, v7_);
+    Lib_IntVector_Intrinsics_vec256
+    v7__ = Lib_IntVector_Intrinsics_vec256_interleave_high64(v5_, v7_);
+    Lib_IntVector_Intrinsics_vec256 *o = t + h * (uint32_t)8U;
+    o[0U] = Lib_IntVector_Intrinsics_vec256_interleave_low128(v0__, v4__);
+    o[4U] = Lib_IntVector_Intrinsics_vec256_interleave_high128(v0__, v4__);
+    o[1U] = Lib_IntVector_Intrinsics_vec256_interleave_low128(v1__, v5__);
+    o[5U] = Lib_IntVector_Intrinsics_vec256_interleave_high128(v1__, v5__);
+    o[2U] = Lib_IntVector_Intrinsics_vec256_interleave_low128(v2__, v6__);
+    o[6U] = Lib_IntVector_Intrinsics_vec256_interleave_high128(v2__, v6__);
+    o[3U] = Lib_IntVector_Intrinsics_vec256_interleave_low128(v3__, v7__);
+    o[7U] = Lib_IntVector_Intrinsics_vec256_interleave_high128(v3__, v7__);
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    k[(uint32_t)2U * i] = t[i];
+    k[(uint32_t)2U * i + (uint32_t)1U] = t[(uint32_t)8U + i];
+  }
+}
+
+void
+Hacl_Chacha20_Vec256_chacha20_encrypt_multi_256(
+  uint32_t *len,
+  uint8_t **out,
+  uint8_t **text,
+  uint8_t **key,
+  uint8_t **n,
+  uint32_t ctr
+)
+{
+  Lib_IntVector_Intrinsics_vec256 ctx[16U];
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    uint32_t x = Hacl_Impl_Chacha20_Vec_chacha20_constants[i];
+    ctx[i] = Lib_IntVector_Intrinsics_vec256_load32(x);
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    uint32_t o = i * (uint32_t)4U;
+    ctx[(uint32_t)4U + i] =
+      Lib_IntVector_Intrinsics_vec256_load32s(load32_le(key[0U] + o),
+        load32_le(key[1U] + o),
+        load32_le(key[2U] + o),
+        load32_le(key[3U] + o),
+        load32_le(key[4U] + o),
+        load32_le(key[5U] + o),
+        load32_le(key[6U] + o),
+        load32_le(key[7U] + o));
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)3U; i++)
+  {
+    uint32_t o = i * (uint32_t)4U;
+    ctx[(uint32_t)13U + i] =
+      Lib_IntVector_Intrinsics_vec256_load32s(load32_le(n[0U] + o),
+        load32_le(n[1U] + o),
+        load32_le(n[2U] + o),
+        load32_le(n[3U] + o),
+        load32_le(n[4U] + o),
+        load32_le(n[5U] + o),
+        load32_le(n[6U] + o),
+        load32_le(n[7U] + o));
+  }
+  uint32_t max_len = (uint32_t)0U;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    if (len[i] > max_len)
+    {
+      max_len = len[i];
+    }
+  }
+  uint32_t nb = (max_len + (uint32_t)63U) / (uint32_t)64U;
+  for (uint32_t b = (uint32_t)0U; b < nb; b++)
+  {
+    Lib_IntVector_Intrinsics_vec256 k[16U];
+    ctx[12U] = Lib_IntVector_Intrinsics_vec256_load32(ctr + b);
+    memcpy(k, ctx, (uint32_t)16U * sizeof (ctx[0U]));
+    double_round_256(k);
+    double_round_256(k);
+    double_round_256(k);
+    double_round_256(k);
+    double_round_256(k);
+    double_round_256(k);
+    double_round_256(k);
+    double_round_256(k);
+    double_round_256(k);
+    double_round_256(k);
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+    {
+      k[i] = Lib_IntVector_Intrinsics_vec256_add32(k[i], ctx[i]);
+    }
+    transpose_256(k);
+    uint32_t off = b * (uint32_t)64U;
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+    {
+      if (off < len[i])
+      {
+        uint32_t rem = len[i] - off;
+        uint8_t *o = out[i] + off;
+        uint8_t *t = text[i] + off;
+        if (rem >= (uint32_t)64U)
+        {
+          Lib_IntVector_Intrinsics_vec256 x0 = Lib_IntVector_Intrinsics_vec256_load_le(t);
+          Lib_IntVector_Intrinsics_vec256
+          x1 = Lib_IntVector_Intrinsics_vec256_load_le(t + (uint32_t)32U);
+          Lib_IntVector_Intrinsics_vec256_store_le(o,
+            Lib_IntVector_Intrinsics_vec256_xor(x0, k[(uint32_t)2U * i]));
+          Lib_IntVector_Intrinsics_vec256_store_le(o + (uint32_t)32U,
+            Lib_IntVector_Intrinsics_vec256_xor(x1, k[(uint32_t)2U * i + (uint32_t)1U]));
+        }
+        else
+        {
+          uint8_t ks[64U] = { 0U };
+          Lib_IntVector_Intrinsics_vec256_store_le(ks, k[(uint32_t)2U * i]);
+          Lib_IntVector_Intrinsics_vec256_store_le(ks + (uint32_t)32U,
+            k[(uint32_t)2U * i + (uint32_t)1U]);
+          for (uint32_t j = (uint32_t)0U; j < rem; j++)
+          {
+            o[j] = t[j] ^ ks[j];
+          }
+        }
+      }
+    }
+  }
+}
@@ -55,5 +55,30 @@ Hacl_Chacha20_Vec256_chacha20_decrypt_256(
   uint32_t ctr
 );
 
+/* Computes the ChaCha20 header-protection masks of n samples, 8 at a time: for each i, the
+   first 5 bytes of the key stream block whose counter and nonce are the first 4 and the last
+   12 bytes of the 16-byte sample at samples + 16 i are written to masks + 5 i. */
+void
+Hacl_Chacha20_Vec256_chacha20_hp_masks_256(
+  uint32_t n,
+  uint8_t *masks,
+  uint8_t *key,
+  uint8_t *samples
+);
+
+/* Encrypts 8 independent messages at once, one per vector lane: for each i < 8, the len[i]
+   bytes of text[i] are encrypted into out[i] under key[i] and nonce n[i], starting from block
+   counter ctr. All 8 key and nonce pointers must be valid; a lane with len[i] = 0 is computed
+   but nothing is written for it. out[i] may be text[i] itself. */
+void
+Hacl_Chacha20_Vec256_chacha20_encrypt_multi_256(
+  uint32_t *len,
+  uint8_t **out,
+  uint8_t **text,
+  uint8_t **key,
+  uint8_t **n,
+  uint32_t ctr
+);
+
 #define __Hacl_Chacha20_Vec256_H_DEFINED
 #endif
@@ -0,0 +1,77 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "evercrypt_targetconfig.h"
+#include "libintvector.h"
+#include "kremlin/internal/types.h"
+#include "kremlin/lowstar_endianness.h"
+#include <string.h>
+#include "kremlin/internal/target.h"
+
+#ifndef __Hacl_Frodo976_AES_H
+#define __Hacl_Frodo976_AES_H
+
+#include "Hacl_Kremlib.h"
+#include "Lib_RandomBuffer_System.h"
+#include "Hacl_SHA3.h"
+#include "Hacl_Lib.h"
+#include "EverCrypt_AutoConfig2.h"
+#include "Hacl_Frodo_KEM_Vec256.h"
+#include "Hacl_AES128.h"
+
+
+typedef struct Hacl_Frodo976_AES_prepared_pk_s_s Hacl_Frodo976_AES_prepared_pk_s;
+
+uint32_t Hacl_Frodo976_AES_crypto_kem_keypair(uint8_t *pk, uint8_t *sk);
+
+uint32_t Hacl_Frodo976_AES_crypto_kem_enc(uint8_t *ct, uint8_t *ss, uint8_t *pk);
+
+uint32_t Hacl_Frodo976_AES_crypto_kem_dec(uint8_t *ss, uint8_t *ct, uint8_t *sk);
+
+/* Expands the public matrix A of pk once, so that encapsulations to pk, and
+   decapsulations with the matching secret key, do not have to regenerate it.
+   The prepared key is heap-allocated and must be released with
+   Hacl_Frodo976_AES_free_prepared_pk. */
+Hacl_Frodo976_AES_prepared_pk_s *Hacl_Frodo976_AES_prepare_pk(uint8_t *pk);
+
+void Hacl_Frodo976_AES_free_prepared_pk(Hacl_Frodo976_AES_prepared_pk_s *p);
+
+uint32_t
+Hacl_Frodo976_AES_crypto_kem_enc_prepared(
+  uint8_t *ct,
+  uint8_t *ss,
+  Hacl_Frodo976_AES_prepared_pk_s *p
+);
+
+/* Falls back onto Hacl_Frodo976_AES_crypto_kem_dec when p was prepared for a
+   public key other than the one embedded in sk. */
+uint32_t
+Hacl_Frodo976_AES_crypto_kem_dec_prepared(
+  uint8_t *ss,
+  uint8_t *ct,
+  uint8_t *sk,
+  Hacl_Frodo976_AES_prepared_pk_s *p
+);
+
+#define __Hacl_Frodo976_AES_H_DEFINED
+#endif
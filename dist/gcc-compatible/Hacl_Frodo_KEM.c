@@ -125,29 +125,209 @@ static inline void matrix_from_lbytes(uint32_t n1, uint32_t n2, uint8_t *b, uint
 }
 
 static inline void
-frodo_gen_matrix_cshake(uint32_t n, uint32_t seed_len, uint8_t *seed, uint16_t *res)
+frodo_gen_matrix_cshake_4x(
+  uint32_t n,
+  uint32_t seed_len,
+  uint8_t *seed,
+  uint32_t i,
+  uint16_t *res
+)
 {
   KRML_CHECK_SIZE(sizeof (uint8_t), (uint32_t)2U * n);
   uint8_t r[(uint32_t)2U * n];
   memset(r, 0U, (uint32_t)2U * n * sizeof (r[0U]));
-  memset(res, 0U, n * n * sizeof (res[0U]));
-  for (uint32_t i = (uint32_t)0U; i < n; i++)
+  for (uint32_t i0 = (uint32_t)0U; i0 < (uint32_t)4U; i0++)
   {
-    uint32_t ctr = (uint32_t)256U + i;
+    uint32_t ctr = (uint32_t)256U + i + i0;
     uint64_t s[25U] = { 0U };
     s[0U] = (uint64_t)0x10010001a801U | (uint64_t)(uint16_t)ctr << (uint32_t)48U;
     Hacl_Impl_SHA3_state_permute(s);
     Hacl_Impl_SHA3_absorb(s, (uint32_t)168U, seed_len, seed, (uint8_t)0x04U);
     Hacl_Impl_SHA3_squeeze(s, (uint32_t)168U, (uint32_t)2U * n, r);
-    for (uint32_t i0 = (uint32_t)0U; i0 < n; i0++)
+    for (uint32_t i1 = (uint32_t)0U; i1 < n; i1++)
     {
-      uint8_t *resij = r + (uint32_t)2U * i0;
+      uint8_t *resij = r + (uint32_t)2U * i1;
       uint16_t u = load16_le(resij);
-      res[i * n + i0] = u;
+      res[i0 * n + i1] = u;
+    }
+  }
+}
+
+static inline void
+matrix_mul_add_as_plus_e_4x(
+  uint32_t n,
+  uint32_t nbar,
+  uint16_t *a,
+  uint16_t *s,
+  uint16_t *e,
+  uint16_t *b
+)
+{
+  for (uint32_t i0 = (uint32_t)0U; i0 < (uint32_t)4U; i0++)
+  {
+    uint16_t *a_row = a + i0 * n;
+    for (uint32_t k = (uint32_t)0U; k < nbar; k++)
+    {
+      uint16_t *s_row = s + k * n;
+      uint16_t res = e[i0 * nbar + k];
+      for (uint32_t i = (uint32_t)0U; i < n; i++)
+      {
+        res = res + a_row[i] * s_row[i];
+      }
+      b[i0 * nbar + k] = res;
     }
   }
 }
 
+static inline void
+matrix_mul_add_sa_4x(uint32_t n, uint32_t nbar, uint16_t *a, uint16_t *s, uint32_t j, uint16_t *b)
+{
+  uint16_t *a0 = a;
+  uint16_t *a1 = a + n;
+  uint16_t *a2 = a + (uint32_t)2U * n;
+  uint16_t *a3 = a + (uint32_t)3U * n;
+  for (uint32_t k = (uint32_t)0U; k < nbar; k++)
+  {
+    uint16_t s0 = s[k * n + j];
+    uint16_t s1 = s[k * n + j + (uint32_t)1U];
+    uint16_t s2 = s[k * n + j + (uint32_t)2U];
+    uint16_t s3 = s[k * n + j + (uint32_t)3U];
+    uint16_t *b_row = b + k * n;
+    for (uint32_t i = (uint32_t)0U; i < n; i++)
+    {
+      b_row[i] = b_row[i] + s0 * a0[i] + s1 * a1[i] + s2 * a2[i] + s3 * a3[i];
+    }
+  }
+}
+
+/* Computes b = A * s + e, where A is the n x n public matrix expanded from seed_a
+   and s is given transposed (nbar x n), as in matrix_mul_s. A is never
+   materialized: rows are generated four at a time and consumed immediately.
+   Uses the AVX2 kernels of Hacl_Frodo_KEM_Vec256 when available. */
+static inline void
+frodo_mul_add_as_plus_e(
+  uint32_t n,
+  uint32_t nbar,
+  uint32_t seed_len,
+  uint8_t *seed_a,
+  uint16_t *s,
+  uint16_t *e,
+  uint16_t *b
+)
+{
+  KRML_CHECK_SIZE(sizeof (uint16_t), (uint32_t)4U * n);
+  uint16_t a_rows[(uint32_t)4U * n];
+  memset(a_rows, 0U, (uint32_t)4U * n * sizeof (a_rows[0U]));
+  bool avx2 = EverCrypt_AutoConfig2_has_avx2();
+  #if EVERCRYPT_TARGETCONFIG_X64
+  if (avx2)
+  {
+    for (uint32_t i0 = (uint32_t)0U; i0 < n; i0 = i0 + (uint32_t)4U)
+    {
+      Hacl_Impl_Frodo_Vec256_gen_matrix_cshake_4x(n, seed_len, seed_a, i0, a_rows);
+      Hacl_Impl_Frodo_Vec256_mul_add_as_plus_e_4x(n,
+        nbar,
+        a_rows,
+        s,
+        e + i0 * nbar,
+        b + i0 * nbar);
+    }
+    return;
+  }
+  #endif
+  for (uint32_t i0 = (uint32_t)0U; i0 < n; i0 = i0 + (uint32_t)4U)
+  {
+    frodo_gen_matrix_cshake_4x(n, seed_len, seed_a, i0, a_rows);
+    matrix_mul_add_as_plus_e_4x(n, nbar, a_rows, s, e + i0 * nbar, b + i0 * nbar);
+  }
+}
+
+/* Computes b = s * A + e, where s is nbar x n and A is the n x n public matrix
+   expanded from seed_a. Each group of four rows of A is multiplied by the
+   matching four columns of s and accumulated into every row of b. */
+static inline void
+frodo_mul_add_sa_plus_e(
+  uint32_t n,
+  uint32_t nbar,
+  uint32_t seed_len,
+  uint8_t *seed_a,
+  uint16_t *s,
+  uint16_t *e,
+  uint16_t *b
+)
+{
+  KRML_CHECK_SIZE(sizeof (uint16_t), (uint32_t)4U * n);
+  uint16_t a_rows[(uint32_t)4U * n];
+  memset(a_rows, 0U, (uint32_t)4U * n * sizeof (a_rows[0U]));
+  memcpy(b, e, nbar * n * sizeof (e[0U]));
+  bool avx2 = EverCrypt_AutoConfig2_has_avx2();
+  #if EVERCRYPT_TARGETCONFIG_X64
+  if (avx2)
+  {
+    for (uint32_t i0 = (uint32_t)0U; i0 < n; i0 = i0 + (uint32_t)4U)
+    {
+      Hacl_Impl_Frodo_Vec256_gen_matrix_cshake_4x(n, seed_len, seed_a, i0, a_rows);
+      Hacl_Impl_Frodo_Vec256_mul_add_sa_4x(n, nbar, a_rows, s, i0, b);
+    }
+    return;
+  }
+  #endif
+  for (uint32_t i0 = (uint32_t)0U; i0 < n; i0 = i0 + (uint32_t)4U)
+  {
+    frodo_gen_matrix_cshake_4x(n, seed_len, seed_a, i0, a_rows);
+    matrix_mul_add_sa_4x(n, nbar, a_rows, s, i0, b);
+  }
+}
+
+/* Expands the whole n x n matrix A from seed_a, for callers that reuse it. */
+static inline void frodo_gen_matrix(uint32_t n, uint32_t seed_len, uint8_t *seed, uint16_t *res)
+{
+  bool avx2 = EverCrypt_AutoConfig2_has_avx2();
+  #if EVERCRYPT_TARGETCONFIG_X64
+  if (avx2)
+  {
+    for (uint32_t i0 = (uint32_t)0U; i0 < n; i0 = i0 + (uint32_t)4U)
+    {
+      Hacl_Impl_Frodo_Vec256_gen_matrix_cshake_4x(n, seed_len, seed, i0, res + i0 * n);
+    }
+    return;
+  }
+  #endif
+  for (uint32_t i0 = (uint32_t)0U; i0 < n; i0 = i0 + (uint32_t)4U)
+  {
+    frodo_gen_matrix_cshake_4x(n, seed_len, seed, i0, res + i0 * n);
+  }
+}
+
+/* Same as frodo_mul_add_sa_plus_e, with A already expanded into a_matrix. */
+static inline void
+matrix_mul_add_sa_plus_e(
+  uint32_t n,
+  uint32_t nbar,
+  uint16_t *a_matrix,
+  uint16_t *s,
+  uint16_t *e,
+  uint16_t *b
+)
+{
+  memcpy(b, e, nbar * n * sizeof (e[0U]));
+  bool avx2 = EverCrypt_AutoConfig2_has_avx2();
+  #if EVERCRYPT_TARGETCONFIG_X64
+  if (avx2)
+  {
+    for (uint32_t i0 = (uint32_t)0U; i0 < n; i0 = i0 + (uint32_t)4U)
+    {
+      Hacl_Impl_Frodo_Vec256_mul_add_sa_4x(n, nbar, a_matrix + i0 * n, s, i0, b);
+    }
+    return;
+  }
+  #endif
+  for (uint32_t i0 = (uint32_t)0U; i0 < n; i0 = i0 + (uint32_t)4U)
+  {
+    matrix_mul_add_sa_4x(n, nbar, a_matrix + i0 * n, s, i0, b);
+  }
+}
+
 static const
 uint16_t
 cdf_table[12U] =
@@ -193,6 +373,14 @@ frodo_sample_matrix(
   Hacl_Impl_SHA3_absorb(s, (uint32_t)168U, seed_len, seed, (uint8_t)0x04U);
   Hacl_Impl_SHA3_squeeze(s, (uint32_t)168U, (uint32_t)2U * n1 * n2, r);
   memset(res, 0U, n1 * n2 * sizeof (res[0U]));
+  bool avx2 = EverCrypt_AutoConfig2_has_avx2();
+  #if EVERCRYPT_TARGETCONFIG_X64
+  if (avx2 && n1 * n2 % (uint32_t)16U == (uint32_t)0U)
+  {
+    Hacl_Impl_Frodo_Vec256_sample(n1 * n2, (uint32_t)11U, cdf_table, r, res);
+    return;
+  }
+  #endif
   for (uint32_t i0 = (uint32_t)0U; i0 < n1; i0++)
   {
     for (uint32_t i = (uint32_t)0U; i < n2; i++)
@@ -206,6 +394,19 @@ frodo_sample_matrix(
 
 static inline void frodo_pack(uint32_t n1, uint32_t n2, uint32_t d, uint16_t *a, uint8_t *res)
 {
+  bool avx2 = EverCrypt_AutoConfig2_has_avx2();
+  #if EVERCRYPT_TARGETCONFIG_X64
+  if
+  (
+    avx2
+    && (d == (uint32_t)15U || d == (uint32_t)16U)
+    && n1 * n2 % (uint32_t)16U == (uint32_t)0U
+  )
+  {
+    Hacl_Impl_Frodo_Vec256_pack(n1 * n2, d, a, res);
+    return;
+  }
+  #endif
   uint32_t n = n1 * n2 / (uint32_t)8U;
   for (uint32_t i = (uint32_t)0U; i < n; i++)
   {
@@ -246,6 +447,19 @@ static inline void frodo_pack(uint32_t n1, uint32_t n2, uint32_t d, uint16_t *a,
 static inline void
 frodo_unpack(uint32_t n1, uint32_t n2, uint32_t d, uint8_t *b, uint16_t *res)
 {
+  bool avx2 = EverCrypt_AutoConfig2_has_avx2();
+  #if EVERCRYPT_TARGETCONFIG_X64
+  if
+  (
+    avx2
+    && (d == (uint32_t)15U || d == (uint32_t)16U)
+    && n1 * n2 % (uint32_t)16U == (uint32_t)0U
+  )
+  {
+    Hacl_Impl_Frodo_Vec256_unpack(n1 * n2, d, b, res);
+    return;
+  }
+  #endif
   uint32_t n = n1 * n2 / (uint32_t)8U;
   for (uint32_t i = (uint32_t)0U; i < n; i++)
   {
@@ -314,17 +528,20 @@ frodo_mul_add_as_plus_e_pack(uint8_t *seed_a, uint8_t *seed_e, uint8_t *b, uint8
     s_matrix);
   matrix_to_lbytes((uint32_t)64U, (uint32_t)8U, s_matrix, s);
   uint16_t b_matrix[512U] = { 0U };
-  uint16_t a_matrix[4096U] = { 0U };
   uint16_t e_matrix[512U] = { 0U };
-  frodo_gen_matrix_cshake((uint32_t)64U, (uint32_t)16U, seed_a, a_matrix);
   frodo_sample_matrix((uint32_t)64U,
     (uint32_t)8U,
     (uint32_t)16U,
     seed_e,
     (uint16_t)2U,
     e_matrix);
-  matrix_mul_s((uint32_t)64U, (uint32_t)64U, (uint32_t)8U, a_matrix, s_matrix, b_matrix);
-  matrix_add((uint32_t)64U, (uint32_t)8U, b_matrix, e_matrix);
+  frodo_mul_add_as_plus_e((uint32_t)64U,
+    (uint32_t)8U,
+    (uint32_t)16U,
+    seed_a,
+    s_matrix,
+    e_matrix,
+    b_matrix);
   Lib_Memzero_clear_words_u16((uint32_t)512U, e_matrix);
   frodo_pack((uint32_t)64U, (uint32_t)8U, (uint32_t)15U, b_matrix, b);
   Lib_Memzero_clear_words_u16((uint32_t)512U, s_matrix);
@@ -394,7 +611,8 @@ frodo_mul_add_sb_plus_e_plus_mu(
   matrix_add((uint32_t)8U, (uint32_t)8U, v_matrix, mu_encode);
 }
 
-static inline void crypto_kem_enc_ct(uint8_t *pk, uint8_t *g, uint8_t *coins, uint8_t *ct)
+static inline void
+crypto_kem_enc_ct(uint16_t *a_matrix, uint8_t *pk, uint8_t *g, uint8_t *coins, uint8_t *ct)
 {
   uint8_t *seed_a = pk;
   uint8_t *b = pk + (uint32_t)16U;
@@ -412,17 +630,32 @@ static inline void crypto_kem_enc_ct(uint8_t *pk, uint8_t *g, uint8_t *coins, ui
   uint32_t c12Len = c1Len + c2Len;
   uint8_t *c1 = ct;
   uint16_t bp_matrix[512U] = { 0U };
-  uint16_t a_matrix[4096U] = { 0U };
   uint16_t ep_matrix[512U] = { 0U };
-  frodo_gen_matrix_cshake((uint32_t)64U, (uint32_t)16U, seed_a, a_matrix);
   frodo_sample_matrix((uint32_t)8U,
     (uint32_t)64U,
     (uint32_t)16U,
     seed_e,
     (uint16_t)5U,
     ep_matrix);
-  matrix_mul((uint32_t)8U, (uint32_t)64U, (uint32_t)64U, sp_matrix, a_matrix, bp_matrix);
-  matrix_add((uint32_t)8U, (uint32_t)64U, bp_matrix, ep_matrix);
+  if (a_matrix == NULL)
+  {
+    frodo_mul_add_sa_plus_e((uint32_t)64U,
+      (uint32_t)8U,
+      (uint32_t)16U,
+      seed_a,
+      sp_matrix,
+      ep_matrix,
+      bp_matrix);
+  }
+  else
+  {
+    matrix_mul_add_sa_plus_e((uint32_t)64U,
+      (uint32_t)8U,
+      a_matrix,
+      sp_matrix,
+      ep_matrix,
+      bp_matrix);
+  }
   Lib_Memzero_clear_words_u16((uint32_t)512U, ep_matrix);
   frodo_pack((uint32_t)8U, (uint32_t)64U, (uint32_t)15U, bp_matrix, c1);
   uint8_t *c2 = ct + c1Len;
@@ -472,7 +705,7 @@ uint32_t Hacl_Frodo_KEM_crypto_kem_keypair(uint8_t *pk, uint8_t *sk)
   return (uint32_t)0U;
 }
 
-uint32_t Hacl_Frodo_KEM_crypto_kem_enc(uint8_t *ct, uint8_t *ss, uint8_t *pk)
+static uint32_t crypto_kem_enc_(uint16_t *a_matrix, uint8_t *ct, uint8_t *ss, uint8_t *pk)
 {
   uint8_t coins[16U] = { 0U };
   randombytes_(bytes_mu, coins);
@@ -489,13 +722,13 @@ uint32_t Hacl_Frodo_KEM_crypto_kem_enc(uint8_t *ct, uint8_t *ss, uint8_t *pk)
     pk_coins,
     (uint8_t)0x04U);
   Hacl_Impl_SHA3_squeeze(s, (uint32_t)168U, (uint32_t)48U, g);
-  crypto_kem_enc_ct(pk, g, coins, ct);
+  crypto_kem_enc_ct(a_matrix, pk, g, coins, ct);
   crypto_kem_enc_ss(g, ct, ss);
   Lib_Memzero_clear_words_u8((uint32_t)32U, g);
   return (uint32_t)0U;
 }
 
-uint32_t Hacl_Frodo_KEM_crypto_kem_dec(uint8_t *ss, uint8_t *ct, uint8_t *sk)
+static uint32_t crypto_kem_dec_(uint16_t *a_matrix, uint8_t *ss, uint8_t *ct, uint8_t *sk)
 {
   uint16_t bp_matrix[512U] = { 0U };
   uint16_t c_matrix[64U] = { 0U };
@@ -541,17 +774,32 @@ uint32_t Hacl_Frodo_KEM_crypto_kem_dec(uint8_t *ss, uint8_t *ct, uint8_t *sk)
     seed_ep,
     (uint16_t)4U,
     sp_matrix);
-  uint16_t a_matrix[4096U] = { 0U };
   uint16_t ep_matrix[512U] = { 0U };
-  frodo_gen_matrix_cshake((uint32_t)64U, (uint32_t)16U, seed_a, a_matrix);
   frodo_sample_matrix((uint32_t)8U,
     (uint32_t)64U,
     (uint32_t)16U,
     seed_ep,
     (uint16_t)5U,
     ep_matrix);
-  matrix_mul((uint32_t)8U, (uint32_t)64U, (uint32_t)64U, sp_matrix, a_matrix, bpp_matrix);
-  matrix_add((uint32_t)8U, (uint32_t)64U, bpp_matrix, ep_matrix);
+  if (a_matrix == NULL)
+  {
+    frodo_mul_add_sa_plus_e((uint32_t)64U,
+      (uint32_t)8U,
+      (uint32_t)16U,
+      seed_a,
+      sp_matrix,
+      ep_matrix,
+      bpp_matrix);
+  }
+  else
+  {
+    matrix_mul_add_sa_plus_e((uint32_t)64U,
+      (uint32_t)8U,
+      a_matrix,
+      sp_matrix,
+      ep_matrix,
+      bpp_matrix);
+  }
   Lib_Memzero_clear_words_u16((uint32_t)512U, ep_matrix);
   frodo_mul_add_sb_plus_e_plus_mu(b, seed_ep, mu_decode1, sp_matrix, cp_matrix);
   Lib_Memzero_clear_words_u16((uint32_t)512U, sp_matrix);
@@ -600,3 +848,66 @@ uint32_t Hacl_Frodo_KEM_crypto_kem_dec(uint8_t *ss, uint8_t *ct, uint8_t *sk)
   return (uint32_t)0U;
 }
 
+uint32_t Hacl_Frodo_KEM_crypto_kem_enc(uint8_t *ct, uint8_t *ss, uint8_t *pk)
+{
+  return crypto_kem_enc_(NULL, ct, ss, pk);
+}
+
+uint32_t Hacl_Frodo_KEM_crypto_kem_dec(uint8_t *ss, uint8_t *ct, uint8_t *sk)
+{
+  return crypto_kem_dec_(NULL, ss, ct, sk);
+}
+
+typedef struct Hacl_Frodo_KEM_prepared_pk_s_s
+{
+  uint8_t *pk;
+  uint16_t *a_matrix;
+}
+Hacl_Frodo_KEM_prepared_pk_s;
+
+Hacl_Frodo_KEM_prepared_pk_s *Hacl_Frodo_KEM_prepare_pk(uint8_t *pk)
+{
+  uint8_t *pk1 = KRML_HOST_CALLOC(crypto_publickeybytes, sizeof (uint8_t));
+  uint16_t *a_matrix = KRML_HOST_CALLOC((uint32_t)64U * (uint32_t)64U, sizeof (uint16_t));
+  memcpy(pk1, pk, crypto_publickeybytes * sizeof (pk[0U]));
+  frodo_gen_matrix((uint32_t)64U, (uint32_t)16U, pk1, a_matrix);
+  Hacl_Frodo_KEM_prepared_pk_s
+  *p = KRML_HOST_MALLOC(sizeof (Hacl_Frodo_KEM_prepared_pk_s));
+  p[0U] = ((Hacl_Frodo_KEM_prepared_pk_s){ .pk = pk1, .a_matrix = a_matrix });
+  return p;
+}
+
+void Hacl_Frodo_KEM_free_prepared_pk(Hacl_Frodo_KEM_prepared_pk_s *p)
+{
+  KRML_HOST_FREE(p->pk);
+  KRML_HOST_FREE(p->a_matrix);
+  KRML_HOST_FREE(p);
+}
+
+uint32_t
+Hacl_Frodo_KEM_crypto_kem_enc_prepared(
+  uint8_t *ct,
+  uint8_t *ss,
+  Hacl_Frodo_KEM_prepared_pk_s *p
+)
+{
+  return crypto_kem_enc_(p->a_matrix, ct, ss, p->pk);
+}
+
+uint32_t
+Hacl_Frodo_KEM_crypto_kem_dec_prepared(
+  uint8_t *ss,
+  uint8_t *ct,
+  uint8_t *sk,
+  Hacl_Frodo_KEM_prepared_pk_s *p
+)
+{
+  uint8_t *pk = sk + (uint32_t)16U;
+  if (memcmp(pk, p->pk, crypto_publickeybytes * sizeof (pk[0U])) != 0)
+  {
+    /* p was prepared for another key: A cannot be reused. */
+    return crypto_kem_dec_(NULL, ss, ct, sk);
+  }
+  return crypto_kem_dec_(p->a_matrix, ss, ct, sk);
+}
+
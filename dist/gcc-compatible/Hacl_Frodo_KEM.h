@@ -35,13 +35,42 @@
 #include "Lib_RandomBuffer_System.h"
 #include "Hacl_SHA3.h"
 #include "Hacl_Lib.h"
+#include "EverCrypt_AutoConfig2.h"
+#include "Hacl_Frodo_KEM_Vec256.h"
 
 
+typedef struct Hacl_Frodo_KEM_prepared_pk_s_s Hacl_Frodo_KEM_prepared_pk_s;
+
 uint32_t Hacl_Frodo_KEM_crypto_kem_keypair(uint8_t *pk, uint8_t *sk);
 
 uint32_t Hacl_Frodo_KEM_crypto_kem_enc(uint8_t *ct, uint8_t *ss, uint8_t *pk);
 
 uint32_t Hacl_Frodo_KEM_crypto_kem_dec(uint8_t *ss, uint8_t *ct, uint8_t *sk);
 
+/* Expands the public matrix A of pk once, so that encapsulations to pk, and
+   decapsulations with the matching secret key, do not have to regenerate it.
+   The prepared key is heap-allocated and must be released with
+   Hacl_Frodo_KEM_free_prepared_pk. */
+Hacl_Frodo_KEM_prepared_pk_s *Hacl_Frodo_KEM_prepare_pk(uint8_t *pk);
+
+void Hacl_Frodo_KEM_free_prepared_pk(Hacl_Frodo_KEM_prepared_pk_s *p);
+
+uint32_t
+Hacl_Frodo_KEM_crypto_kem_enc_prepared(
+  uint8_t *ct,
+  uint8_t *ss,
+  Hacl_Frodo_KEM_prepared_pk_s *p
+);
+
+/* Falls back onto Hacl_Frodo_KEM_crypto_kem_dec when p was prepared for a
+   public key other than the one embedded in sk. */
+uint32_t
+Hacl_Frodo_KEM_crypto_kem_dec_prepared(
+  uint8_t *ss,
+  uint8_t *ct,
+  uint8_t *sk,
+  Hacl_Frodo_KEM_prepared_pk_s *p
+);
+
 #define __Hacl_Frodo_KEM_H_DEFINED
 #endif
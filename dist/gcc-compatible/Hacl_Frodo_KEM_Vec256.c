@@ -0,0 +1,372 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+
+#include "Hacl_Frodo_KEM_Vec256.h"
+
+void
+Hacl_Impl_Frodo_Vec256_gen_matrix_cshake_4x(
+  uint32_t n,
+  uint32_t seed_len,
+  uint8_t *seed,
+  uint32_t i,
+  uint16_t *res
+)
+{
+  KRML_CHECK_SIZE(sizeof (uint8_t), (uint32_t)8U * n);
+  uint8_t r[(uint32_t)8U * n];
+  memset(r, 0U, (uint32_t)8U * n * sizeof (r[0U]));
+  uint8_t *r0 = r;
+  uint8_t *r1 = r + (uint32_t)2U * n;
+  uint8_t *r2 = r + (uint32_t)4U * n;
+  uint8_t *r3 = r + (uint32_t)6U * n;
+  Lib_IntVector_Intrinsics_vec256 s[25U];
+  for (uint32_t _i = 0U; _i < (uint32_t)25U; ++_i)
+    s[_i] = Lib_IntVector_Intrinsics_vec256_zero;
+  uint64_t ctr0 = (uint64_t)(uint16_t)((uint32_t)256U + i);
+  uint64_t ctr1 = (uint64_t)(uint16_t)((uint32_t)257U + i);
+  uint64_t ctr2 = (uint64_t)(uint16_t)((uint32_t)258U + i);
+  uint64_t ctr3 = (uint64_t)(uint16_t)((uint32_t)259U + i);
+  s[0U] =
+    Lib_IntVector_Intrinsics_vec256_load64s((uint64_t)0x10010001a801U | ctr0 << (uint32_t)48U,
+      (uint64_t)0x10010001a801U | ctr1 << (uint32_t)48U,
+      (uint64_t)0x10010001a801U | ctr2 << (uint32_t)48U,
+      (uint64_t)0x10010001a801U | ctr3 << (uint32_t)48U);
+  Hacl_Impl_SHA3_Vec256_state_permute4(s);
+  Hacl_Impl_SHA3_Vec256_absorb4(s,
+    (uint32_t)168U,
+    seed_len,
+    seed,
+    seed,
+    seed,
+    seed,
+    (uint8_t)0x04U);
+  Hacl_Impl_SHA3_Vec256_squeeze4(s, (uint32_t)168U, (uint32_t)2U * n, r0, r1, r2, r3);
+  for (uint32_t i0 = (uint32_t)0U; i0 < (uint32_t)4U * n; i0++)
+  {
+    uint8_t *resij = r + (uint32_t)2U * i0;
+    uint16_t u = load16_le(resij);
+    res[i0] = u;
+  }
+}
+
+static inline uint16_t hsum16(Lib_IntVector_Intrinsics_vec256 x)
+{
+  uint8_t b[32U] = { 0U };
+  Lib_IntVector_Intrinsics_vec256_store_le(b, x);
+  uint16_t res = (uint16_t)0U;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+  {
+    res = res + load16_le(b + (uint32_t)2U * i);
+  }
+  return res;
+}
+
+void
+Hacl_Impl_Frodo_Vec256_mul_add_as_plus_e_4x(
+  uint32_t n,
+  uint32_t nbar,
+  uint16_t *a,
+  uint16_t *s,
+  uint16_t *e,
+  uint16_t *b
+)
+{
+  uint16_t *a0 = a;
+  uint16_t *a1 = a + n;
+  uint16_t *a2 = a + (uint32_t)2U * n;
+  uint16_t *a3 = a + (uint32_t)3U * n;
+  for (uint32_t k = (uint32_t)0U; k < nbar; k++)
+  {
+    uint16_t *s_row = s + k * n;
+    Lib_IntVector_Intrinsics_vec256 acc0 = Lib_IntVector_Intrinsics_vec256_zero;
+    Lib_IntVector_Intrinsics_vec256 acc1 = Lib_IntVector_Intrinsics_vec256_zero;
+    Lib_IntVector_Intrinsics_vec256 acc2 = Lib_IntVector_Intrinsics_vec256_zero;
+    Lib_IntVector_Intrinsics_vec256 acc3 = Lib_IntVector_Intrinsics_vec256_zero;
+    for (uint32_t i = (uint32_t)0U; i < n; i = i + (uint32_t)16U)
+    {
+      Lib_IntVector_Intrinsics_vec256
+      sk = Lib_IntVector_Intrinsics_vec256_load_le((uint8_t *)(s_row + i));
+      Lib_IntVector_Intrinsics_vec256
+      x0 = Lib_IntVector_Intrinsics_vec256_load_le((uint8_t *)(a0 + i));
+      Lib_IntVector_Intrinsics_vec256
+      x1 = Lib_IntVector_Intrinsics_vec256_load_le((uint8_t *)(a1 + i));
+      Lib_IntVector_Intrinsics_vec256
+      x2 = Lib_IntVector_Intrinsics_vec256_load_le((uint8_t *)(a2 + i));
+      Lib_IntVector_Intrinsics_vec256
+      x3 = Lib_IntVector_Intrinsics_vec256_load_le((uint8_t *)(a3 + i));
+      Lib_IntVector_Intrinsics_vec256 p0 = Lib_IntVector_Intrinsics_vec256_mul16(x0, sk);
+      Lib_IntVector_Intrinsics_vec256 p1 = Lib_IntVector_Intrinsics_vec256_mul16(x1, sk);
+      Lib_IntVector_Intrinsics_vec256 p2 = Lib_IntVector_Intrinsics_vec256_mul16(x2, sk);
+      Lib_IntVector_Intrinsics_vec256 p3 = Lib_IntVector_Intrinsics_vec256_mul16(x3, sk);
+      acc0 = Lib_IntVector_Intrinsics_vec256_add16(acc0, p0);
+      acc1 = Lib_IntVector_Intrinsics_vec256_add16(acc1, p1);
+      acc2 = Lib_IntVector_Intrinsics_vec256_add16(acc2, p2);
+      acc3 = Lib_IntVector_Intrinsics_vec256_add16(acc3, p3);
+    }
+    b[k] = e[k] + hsum16(acc0);
+    b[nbar + k] = e[nbar + k] + hsum16(acc1);
+    b[(uint32_t)2U * nbar + k] = e[(uint32_t)2U * nbar + k] + hsum16(acc2);
+    b[(uint32_t)3U * nbar + k] = e[(uint32_t)3U * nbar + k] + hsum16(acc3);
+  }
+}
+
+void
+Hacl_Impl_Frodo_Vec256_mul_add_sa_4x(
+  uint32_t n,
+  uint32_t nbar,
+  uint16_t *a,
+  uint16_t *s,
+  uint32_t j,
+  uint16_t *b
+)
+{
+  uint16_t *a0 = a;
+  uint16_t *a1 = a + n;
+  uint16_t *a2 = a + (uint32_t)2U * n;
+  uint16_t *a3 = a + (uint32_t)3U * n;
+  for (uint32_t k = (uint32_t)0U; k < nbar; k++)
+  {
+    uint16_t s0 = s[k * n + j];
+    uint16_t s1 = s[k * n + j + (uint32_t)1U];
+    uint16_t s2 = s[k * n + j + (uint32_t)2U];
+    uint16_t s3 = s[k * n + j + (uint32_t)3U];
+    uint16_t *b_row = b + k * n;
+    for (uint32_t i = (uint32_t)0U; i < n; i = i + (uint32_t)16U)
+    {
+      Lib_IntVector_Intrinsics_vec256
+      x0 = Lib_IntVector_Intrinsics_vec256_load_le((uint8_t *)(a0 + i));
+      Lib_IntVector_Intrinsics_vec256
+      x1 = Lib_IntVector_Intrinsics_vec256_load_le((uint8_t *)(a1 + i));
+      Lib_IntVector_Intrinsics_vec256
+      x2 = Lib_IntVector_Intrinsics_vec256_load_le((uint8_t *)(a2 + i));
+      Lib_IntVector_Intrinsics_vec256
+      x3 = Lib_IntVector_Intrinsics_vec256_load_le((uint8_t *)(a3 + i));
+      Lib_IntVector_Intrinsics_vec256
+      acc = Lib_IntVector_Intrinsics_vec256_load_le((uint8_t *)(b_row + i));
+      Lib_IntVector_Intrinsics_vec256 p0 = Lib_IntVector_Intrinsics_vec256_smul16(x0, s0);
+      acc = Lib_IntVector_Intrinsics_vec256_add16(acc, p0);
+      Lib_IntVector_Intrinsics_vec256 p1 = Lib_IntVector_Intrinsics_vec256_smul16(x1, s1);
+      acc = Lib_IntVector_Intrinsics_vec256_add16(acc, p1);
+      Lib_IntVector_Intrinsics_vec256 p2 = Lib_IntVector_Intrinsics_vec256_smul16(x2, s2);
+      acc = Lib_IntVector_Intrinsics_vec256_add16(acc, p2);
+      Lib_IntVector_Intrinsics_vec256 p3 = Lib_IntVector_Intrinsics_vec256_smul16(x3, s3);
+      acc = Lib_IntVector_Intrinsics_vec256_add16(acc, p3);
+      Lib_IntVector_Intrinsics_vec256_store_le((uint8_t *)(b_row + i), acc);
+    }
+  }
+}
+
+void
+Hacl_Impl_Frodo_Vec256_sample(
+  uint32_t len,
+  uint32_t bound,
+  const uint16_t *cdf_table,
+  uint8_t *r,
+  uint16_t *res
+)
+{
+  Lib_IntVector_Intrinsics_vec256 one = Lib_IntVector_Intrinsics_vec256_load16((uint16_t)1U);
+  for (uint32_t i0 = (uint32_t)0U; i0 < len; i0 = i0 + (uint32_t)16U)
+  {
+    Lib_IntVector_Intrinsics_vec256
+    u = Lib_IntVector_Intrinsics_vec256_load_le(r + (uint32_t)2U * i0);
+    Lib_IntVector_Intrinsics_vec256
+    prnd = Lib_IntVector_Intrinsics_vec256_shift_right16(u, (uint32_t)1U);
+    Lib_IntVector_Intrinsics_vec256 sign = Lib_IntVector_Intrinsics_vec256_and(u, one);
+    Lib_IntVector_Intrinsics_vec256 sample = Lib_IntVector_Intrinsics_vec256_zero;
+    for (uint32_t i = (uint32_t)0U; i < bound; i++)
+    {
+      Lib_IntVector_Intrinsics_vec256 ti = Lib_IntVector_Intrinsics_vec256_load16(cdf_table[i]);
+      Lib_IntVector_Intrinsics_vec256 d = Lib_IntVector_Intrinsics_vec256_sub16(ti, prnd);
+      Lib_IntVector_Intrinsics_vec256
+      samplei = Lib_IntVector_Intrinsics_vec256_shift_right16(d, (uint32_t)15U);
+      sample = Lib_IntVector_Intrinsics_vec256_add16(sample, samplei);
+    }
+    Lib_IntVector_Intrinsics_vec256
+    neg_sign = Lib_IntVector_Intrinsics_vec256_sub16(Lib_IntVector_Intrinsics_vec256_zero, sign);
+    Lib_IntVector_Intrinsics_vec256 x = Lib_IntVector_Intrinsics_vec256_xor(neg_sign, sample);
+    Lib_IntVector_Intrinsics_vec256 y = Lib_IntVector_Intrinsics_vec256_add16(x, sign);
+    Lib_IntVector_Intrinsics_vec256_store_le((uint8_t *)(res + i0), y);
+  }
+}
+
+/* With d = 15, each 128-bit lane holds eight coefficients, which pack into 15
+   bytes. Adjacent coefficients are merged into 30-bit then 60-bit words; the
+   two 60-bit words of a lane are then laid out big-endian by byte shuffles. */
+
+static const
+uint8_t
+pack15_lo[32U] =
+  {
+    (uint8_t)7U, (uint8_t)6U, (uint8_t)5U, (uint8_t)4U, (uint8_t)3U, (uint8_t)2U, (uint8_t)1U,
+    (uint8_t)0U, (uint8_t)14U, (uint8_t)13U, (uint8_t)12U, (uint8_t)11U, (uint8_t)10U,
+    (uint8_t)9U, (uint8_t)8U, (uint8_t)0x80U, (uint8_t)7U, (uint8_t)6U, (uint8_t)5U,
+    (uint8_t)4U, (uint8_t)3U, (uint8_t)2U, (uint8_t)1U, (uint8_t)0U, (uint8_t)14U,
+    (uint8_t)13U, (uint8_t)12U, (uint8_t)11U, (uint8_t)10U, (uint8_t)9U, (uint8_t)8U,
+    (uint8_t)0x80U
+  };
+
+static const
+uint8_t
+pack15_hi[32U] =
+  {
+    (uint8_t)0x80U, (uint8_t)0x80U, (uint8_t)0x80U, (uint8_t)0x80U, (uint8_t)0x80U,
+    (uint8_t)0x80U, (uint8_t)0x80U, (uint8_t)15U, (uint8_t)0x80U, (uint8_t)0x80U,
+    (uint8_t)0x80U, (uint8_t)0x80U, (uint8_t)0x80U, (uint8_t)0x80U, (uint8_t)0x80U,
+    (uint8_t)0x80U, (uint8_t)0x80U, (uint8_t)0x80U, (uint8_t)0x80U, (uint8_t)0x80U,
+    (uint8_t)0x80U, (uint8_t)0x80U, (uint8_t)0x80U, (uint8_t)15U, (uint8_t)0x80U,
+    (uint8_t)0x80U, (uint8_t)0x80U, (uint8_t)0x80U, (uint8_t)0x80U, (uint8_t)0x80U,
+    (uint8_t)0x80U, (uint8_t)0x80U
+  };
+
+static const
+uint8_t
+unpack15[32U] =
+  {
+    (uint8_t)7U, (uint8_t)6U, (uint8_t)5U, (uint8_t)4U, (uint8_t)3U, (uint8_t)2U, (uint8_t)1U,
+    (uint8_t)0U, (uint8_t)14U, (uint8_t)13U, (uint8_t)12U, (uint8_t)11U, (uint8_t)10U,
+    (uint8_t)9U, (uint8_t)8U, (uint8_t)7U, (uint8_t)7U, (uint8_t)6U, (uint8_t)5U, (uint8_t)4U,
+    (uint8_t)3U, (uint8_t)2U, (uint8_t)1U, (uint8_t)0U, (uint8_t)14U, (uint8_t)13U,
+    (uint8_t)12U, (uint8_t)11U, (uint8_t)10U, (uint8_t)9U, (uint8_t)8U, (uint8_t)7U
+  };
+
+void Hacl_Impl_Frodo_Vec256_pack(uint32_t len, uint32_t d, uint16_t *a, uint8_t *res)
+{
+  if (d == (uint32_t)16U)
+  {
+    for (uint32_t i = (uint32_t)0U; i < len; i = i + (uint32_t)16U)
+    {
+      Lib_IntVector_Intrinsics_vec256
+      x = Lib_IntVector_Intrinsics_vec256_load_le((uint8_t *)(a + i));
+      Lib_IntVector_Intrinsics_vec256_store16_be(res + (uint32_t)2U * i, x);
+    }
+    return;
+  }
+  Lib_IntVector_Intrinsics_vec256
+  mask15 = Lib_IntVector_Intrinsics_vec256_load16((uint16_t)0x7fffU);
+  Lib_IntVector_Intrinsics_vec256
+  mask16 = Lib_IntVector_Intrinsics_vec256_load32((uint32_t)0xffffU);
+  Lib_IntVector_Intrinsics_vec256
+  mask32 = Lib_IntVector_Intrinsics_vec256_load64((uint64_t)0xffffffffU);
+  Lib_IntVector_Intrinsics_vec256
+  even = Lib_IntVector_Intrinsics_vec256_load64s((uint64_t)0xffffffffffffffffU,
+      (uint64_t)0U,
+      (uint64_t)0xffffffffffffffffU,
+      (uint64_t)0U);
+  Lib_IntVector_Intrinsics_vec256
+  lo = Lib_IntVector_Intrinsics_vec256_load_le((uint8_t *)pack15_lo);
+  Lib_IntVector_Intrinsics_vec256
+  hi = Lib_IntVector_Intrinsics_vec256_load_le((uint8_t *)pack15_hi);
+  for (uint32_t i = (uint32_t)0U; i < len; i = i + (uint32_t)16U)
+  {
+    Lib_IntVector_Intrinsics_vec256
+    x0 = Lib_IntVector_Intrinsics_vec256_load_le((uint8_t *)(a + i));
+    Lib_IntVector_Intrinsics_vec256 x = Lib_IntVector_Intrinsics_vec256_and(x0, mask15);
+    Lib_IntVector_Intrinsics_vec256 x_even = Lib_IntVector_Intrinsics_vec256_and(x, mask16);
+    Lib_IntVector_Intrinsics_vec256
+    y0 = Lib_IntVector_Intrinsics_vec256_shift_left32(x_even, (uint32_t)15U);
+    Lib_IntVector_Intrinsics_vec256
+    y1 = Lib_IntVector_Intrinsics_vec256_shift_right32(x, (uint32_t)16U);
+    Lib_IntVector_Intrinsics_vec256 y = Lib_IntVector_Intrinsics_vec256_or(y0, y1);
+    Lib_IntVector_Intrinsics_vec256 y_even = Lib_IntVector_Intrinsics_vec256_and(y, mask32);
+    Lib_IntVector_Intrinsics_vec256
+    z0 = Lib_IntVector_Intrinsics_vec256_shift_left64(y_even, (uint32_t)30U);
+    Lib_IntVector_Intrinsics_vec256
+    z1 = Lib_IntVector_Intrinsics_vec256_shift_right64(y, (uint32_t)32U);
+    Lib_IntVector_Intrinsics_vec256 z = Lib_IntVector_Intrinsics_vec256_or(z0, z1);
+    Lib_IntVector_Intrinsics_vec256
+    z4 = Lib_IntVector_Intrinsics_vec256_shift_left64(z, (uint32_t)4U);
+    Lib_IntVector_Intrinsics_vec256
+    w =
+      Lib_IntVector_Intrinsics_vec256_xor(z,
+        Lib_IntVector_Intrinsics_vec256_and(Lib_IntVector_Intrinsics_vec256_xor(z, z4), even));
+    Lib_IntVector_Intrinsics_vec256
+    r =
+      Lib_IntVector_Intrinsics_vec256_or(Lib_IntVector_Intrinsics_vec256_shuffle8(w, lo),
+        Lib_IntVector_Intrinsics_vec256_shuffle8(w, hi));
+    uint8_t tmp[32U] = { 0U };
+    Lib_IntVector_Intrinsics_vec256_store_le(tmp, r);
+    uint8_t *r0 = res + (uint32_t)15U * (i / (uint32_t)8U);
+    memcpy(r0, tmp, (uint32_t)15U * sizeof (tmp[0U]));
+    memcpy(r0 + (uint32_t)15U, tmp + (uint32_t)16U, (uint32_t)15U * sizeof (tmp[0U]));
+  }
+}
+
+void Hacl_Impl_Frodo_Vec256_unpack(uint32_t len, uint32_t d, uint8_t *b, uint16_t *res)
+{
+  if (d == (uint32_t)16U)
+  {
+    for (uint32_t i = (uint32_t)0U; i < len; i = i + (uint32_t)16U)
+    {
+      Lib_IntVector_Intrinsics_vec256
+      x = Lib_IntVector_Intrinsics_vec256_load16_be(b + (uint32_t)2U * i);
+      Lib_IntVector_Intrinsics_vec256_store_le((uint8_t *)(res + i), x);
+    }
+    return;
+  }
+  Lib_IntVector_Intrinsics_vec256
+  mask15 = Lib_IntVector_Intrinsics_vec256_load32((uint32_t)0x7fffU);
+  Lib_IntVector_Intrinsics_vec256
+  mask30 = Lib_IntVector_Intrinsics_vec256_load64((uint64_t)0x3fffffffU);
+  Lib_IntVector_Intrinsics_vec256
+  mask60 = Lib_IntVector_Intrinsics_vec256_load64((uint64_t)0xfffffffffffffffU);
+  Lib_IntVector_Intrinsics_vec256
+  even = Lib_IntVector_Intrinsics_vec256_load64s((uint64_t)0xffffffffffffffffU,
+      (uint64_t)0U,
+      (uint64_t)0xffffffffffffffffU,
+      (uint64_t)0U);
+  Lib_IntVector_Intrinsics_vec256 sh = Lib_IntVector_Intrinsics_vec256_load_le((uint8_t *)unpack15);
+  for (uint32_t i = (uint32_t)0U; i < len; i = i + (uint32_t)16U)
+  {
+    uint8_t *b0 = b + (uint32_t)15U * (i / (uint32_t)8U);
+    uint8_t tmp[32U] = { 0U };
+    memcpy(tmp, b0, (uint32_t)15U * sizeof (b0[0U]));
+    memcpy(tmp + (uint32_t)16U, b0 + (uint32_t)15U, (uint32_t)15U * sizeof (b0[0U]));
+    Lib_IntVector_Intrinsics_vec256 u = Lib_IntVector_Intrinsics_vec256_load_le(tmp);
+    Lib_IntVector_Intrinsics_vec256 w = Lib_IntVector_Intrinsics_vec256_shuffle8(u, sh);
+    Lib_IntVector_Intrinsics_vec256
+    w4 = Lib_IntVector_Intrinsics_vec256_shift_right64(w, (uint32_t)4U);
+    Lib_IntVector_Intrinsics_vec256
+    z0 =
+      Lib_IntVector_Intrinsics_vec256_xor(w,
+        Lib_IntVector_Intrinsics_vec256_and(Lib_IntVector_Intrinsics_vec256_xor(w, w4), even));
+    Lib_IntVector_Intrinsics_vec256 z = Lib_IntVector_Intrinsics_vec256_and(z0, mask60);
+    Lib_IntVector_Intrinsics_vec256
+    y0 = Lib_IntVector_Intrinsics_vec256_shift_right64(z, (uint32_t)30U);
+    Lib_IntVector_Intrinsics_vec256 z_odd = Lib_IntVector_Intrinsics_vec256_and(z, mask30);
+    Lib_IntVector_Intrinsics_vec256
+    y1 = Lib_IntVector_Intrinsics_vec256_shift_left64(z_odd, (uint32_t)32U);
+    Lib_IntVector_Intrinsics_vec256 y = Lib_IntVector_Intrinsics_vec256_or(y0, y1);
+    Lib_IntVector_Intrinsics_vec256
+    x0 = Lib_IntVector_Intrinsics_vec256_shift_right32(y, (uint32_t)15U);
+    Lib_IntVector_Intrinsics_vec256 y_odd = Lib_IntVector_Intrinsics_vec256_and(y, mask15);
+    Lib_IntVector_Intrinsics_vec256
+    x1 = Lib_IntVector_Intrinsics_vec256_shift_left32(y_odd, (uint32_t)16U);
+    Lib_IntVector_Intrinsics_vec256 x = Lib_IntVector_Intrinsics_vec256_or(x0, x1);
+    Lib_IntVector_Intrinsics_vec256_store_le((uint8_t *)(res + i), x);
+  }
+}
+
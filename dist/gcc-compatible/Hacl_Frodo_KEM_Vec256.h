@@ -0,0 +1,93 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "evercrypt_targetconfig.h"
+#include "libintvector.h"
+#include "kremlin/internal/types.h"
+#include "kremlin/lowstar_endianness.h"
+#include <string.h>
+#include "kremlin/internal/target.h"
+
+#ifndef __Hacl_Frodo_KEM_Vec256_H
+#define __Hacl_Frodo_KEM_Vec256_H
+
+#include "Hacl_SHA3_Vec256.h"
+#include "Hacl_Kremlib.h"
+
+
+/* AVX2 kernels for the FrodoKEM matrix products. The public matrix A is
+   processed four rows at a time; n must be a multiple of 16. */
+
+/* Generates rows i .. i + 3 of A with four interleaved cSHAKE128 instances. */
+void
+Hacl_Impl_Frodo_Vec256_gen_matrix_cshake_4x(
+  uint32_t n,
+  uint32_t seed_len,
+  uint8_t *seed,
+  uint32_t i,
+  uint16_t *res
+);
+
+/* Computes four rows of b = A * s + e from four rows of A, with s given
+   transposed (nbar x n). */
+void
+Hacl_Impl_Frodo_Vec256_mul_add_as_plus_e_4x(
+  uint32_t n,
+  uint32_t nbar,
+  uint16_t *a,
+  uint16_t *s,
+  uint16_t *e,
+  uint16_t *b
+);
+
+/* Accumulates into b (nbar x n) the contribution of rows j .. j + 3 of A to
+   the product s * A. */
+void
+Hacl_Impl_Frodo_Vec256_mul_add_sa_4x(
+  uint32_t n,
+  uint32_t nbar,
+  uint16_t *a,
+  uint16_t *s,
+  uint32_t j,
+  uint16_t *b
+);
+
+/* Turns the 2 * len bytes of r into len samples, by a constant-time scan of
+   the first bound entries of cdf_table over sixteen lanes. */
+void
+Hacl_Impl_Frodo_Vec256_sample(
+  uint32_t len,
+  uint32_t bound,
+  const uint16_t *cdf_table,
+  uint8_t *r,
+  uint16_t *res
+);
+
+/* Packs and unpacks len coefficients of d bits each, d being 15 or 16, as in
+   frodo_pack and frodo_unpack. len must be a multiple of 16. */
+void Hacl_Impl_Frodo_Vec256_pack(uint32_t len, uint32_t d, uint16_t *a, uint8_t *res);
+
+void Hacl_Impl_Frodo_Vec256_unpack(uint32_t len, uint32_t d, uint8_t *b, uint16_t *res);
+
+#define __Hacl_Frodo_KEM_Vec256_H_DEFINED
+#endif
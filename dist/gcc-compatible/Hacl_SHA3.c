@@ -65,61 +65,278 @@ inline uint64_t Hacl_Impl_SHA3_rotl(uint64_t a, uint32_t b)
 
 void Hacl_Impl_SHA3_state_permute(uint64_t *s)
 {
-  for (uint32_t i0 = (uint32_t)0U; i0 < (uint32_t)24U; i0++)
+  uint64_t a0 = s[0U];
+  uint64_t a1 = ~s[1U];
+  uint64_t a2 = ~s[2U];
+  uint64_t a3 = s[3U];
+  uint64_t a4 = s[4U];
+  uint64_t a5 = s[5U];
+  uint64_t a6 = s[6U];
+  uint64_t a7 = s[7U];
+  uint64_t a8 = ~s[8U];
+  uint64_t a9 = s[9U];
+  uint64_t a10 = s[10U];
+  uint64_t a11 = s[11U];
+  uint64_t a12 = ~s[12U];
+  uint64_t a13 = s[13U];
+  uint64_t a14 = s[14U];
+  uint64_t a15 = s[15U];
+  uint64_t a16 = s[16U];
+  uint64_t a17 = ~s[17U];
+  uint64_t a18 = s[18U];
+  uint64_t a19 = s[19U];
+  uint64_t a20 = ~s[20U];
+  uint64_t a21 = s[21U];
+  uint64_t a22 = s[22U];
+  uint64_t a23 = s[23U];
+  uint64_t a24 = s[24U];
+  uint64_t e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12;
+  uint64_t e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24;
+  uint64_t b0, b1, b2, b3, b4;
+  uint64_t d0, d1, d2, d3, d4;
+  uint64_t c0 = a0 ^ a5 ^ a10 ^ a15 ^ a20;
+  uint64_t c1 = a1 ^ a6 ^ a11 ^ a16 ^ a21;
+  uint64_t c2 = a2 ^ a7 ^ a12 ^ a17 ^ a22;
+  uint64_t c3 = a3 ^ a8 ^ a13 ^ a18 ^ a23;
+  uint64_t c4 = a4 ^ a9 ^ a14 ^ a19 ^ a24;
+  for (uint32_t i0 = (uint32_t)0U; i0 < (uint32_t)24U; i0 = i0 + (uint32_t)2U)
   {
-    uint64_t b[5U] = { 0U };
-    for (uint32_t i = (uint32_t)0U; i < (uint32_t)5U; i++)
-    {
-      b[i] =
-        s[i
-        + (uint32_t)0U]
-        ^
-          (s[i
-          + (uint32_t)5U]
-          ^ (s[i + (uint32_t)10U] ^ (s[i + (uint32_t)15U] ^ s[i + (uint32_t)20U])));
-    }
-    for (uint32_t i1 = (uint32_t)0U; i1 < (uint32_t)5U; i1++)
-    {
-      uint64_t uu____0 = b[(i1 + (uint32_t)4U) % (uint32_t)5U];
-      uint64_t
-      _D = uu____0 ^ Hacl_Impl_SHA3_rotl(b[(i1 + (uint32_t)1U) % (uint32_t)5U], (uint32_t)1U);
-      for (uint32_t i = (uint32_t)0U; i < (uint32_t)5U; i++)
-      {
-        s[i1 + (uint32_t)5U * i] = s[i1 + (uint32_t)5U * i] ^ _D;
-      }
-    }
-    Lib_Memzero0_memzero(b, (uint32_t)5U * sizeof (b[0U]));
-    uint64_t x = s[1U];
-    uint64_t b0 = x;
-    for (uint32_t i = (uint32_t)0U; i < (uint32_t)24U; i++)
-    {
-      uint32_t _Y = Hacl_Impl_SHA3_keccak_piln[i];
-      uint32_t r = Hacl_Impl_SHA3_keccak_rotc[i];
-      uint64_t temp = s[_Y];
-      s[_Y] = Hacl_Impl_SHA3_rotl(b0, r);
-      b0 = temp;
-    }
-    Lib_Memzero0_memzero(&b0, (uint32_t)1U * sizeof ((&b0)[0U]));
-    uint64_t b1[25U] = { 0U };
-    memcpy(b1, s, (uint32_t)25U * sizeof (s[0U]));
-    for (uint32_t i1 = (uint32_t)0U; i1 < (uint32_t)5U; i1++)
-    {
-      for (uint32_t i = (uint32_t)0U; i < (uint32_t)5U; i++)
-      {
-        s[i + (uint32_t)5U * i1] =
-          b1[i
-          + (uint32_t)5U * i1]
-          ^
-            (~b1[(i + (uint32_t)1U)
-            % (uint32_t)5U
-            + (uint32_t)5U * i1]
-            & b1[(i + (uint32_t)2U) % (uint32_t)5U + (uint32_t)5U * i1]);
-      }
-    }
-    Lib_Memzero0_memzero(b1, (uint32_t)25U * sizeof (b1[0U]));
-    uint64_t c = Hacl_Impl_SHA3_keccak_rndc[i0];
-    s[0U] = s[0U] ^ c;
+    d0 = c4 ^ Hacl_Impl_SHA3_rotl(c1, (uint32_t)1U);
+    d1 = c0 ^ Hacl_Impl_SHA3_rotl(c2, (uint32_t)1U);
+    d2 = c1 ^ Hacl_Impl_SHA3_rotl(c3, (uint32_t)1U);
+    d3 = c2 ^ Hacl_Impl_SHA3_rotl(c4, (uint32_t)1U);
+    d4 = c3 ^ Hacl_Impl_SHA3_rotl(c0, (uint32_t)1U);
+    a0 = a0 ^ d0;
+    b0 = a0;
+    a6 = a6 ^ d1;
+    b1 = Hacl_Impl_SHA3_rotl(a6, (uint32_t)44U);
+    a12 = a12 ^ d2;
+    b2 = Hacl_Impl_SHA3_rotl(a12, (uint32_t)43U);
+    a18 = a18 ^ d3;
+    b3 = Hacl_Impl_SHA3_rotl(a18, (uint32_t)21U);
+    a24 = a24 ^ d4;
+    b4 = Hacl_Impl_SHA3_rotl(a24, (uint32_t)14U);
+    e0 = b0 ^ (b1 | b2) ^ Hacl_Impl_SHA3_keccak_rndc[i0];
+    c0 = e0;
+    e1 = b1 ^ (~b2 | b3);
+    c1 = e1;
+    e2 = b2 ^ (b3 & b4);
+    c2 = e2;
+    e3 = b3 ^ (b4 | b0);
+    c3 = e3;
+    e4 = b4 ^ (b0 & b1);
+    c4 = e4;
+    a3 = a3 ^ d3;
+    b0 = Hacl_Impl_SHA3_rotl(a3, (uint32_t)28U);
+    a9 = a9 ^ d4;
+    b1 = Hacl_Impl_SHA3_rotl(a9, (uint32_t)20U);
+    a10 = a10 ^ d0;
+    b2 = Hacl_Impl_SHA3_rotl(a10, (uint32_t)3U);
+    a16 = a16 ^ d1;
+    b3 = Hacl_Impl_SHA3_rotl(a16, (uint32_t)45U);
+    a22 = a22 ^ d2;
+    b4 = Hacl_Impl_SHA3_rotl(a22, (uint32_t)61U);
+    e5 = b0 ^ (b1 | b2);
+    c0 = c0 ^ e5;
+    e6 = b1 ^ (b2 & b3);
+    c1 = c1 ^ e6;
+    e7 = b2 ^ (b3 | ~b4);
+    c2 = c2 ^ e7;
+    e8 = b3 ^ (b4 | b0);
+    c3 = c3 ^ e8;
+    e9 = b4 ^ (b0 & b1);
+    c4 = c4 ^ e9;
+    a1 = a1 ^ d1;
+    b0 = Hacl_Impl_SHA3_rotl(a1, (uint32_t)1U);
+    a7 = a7 ^ d2;
+    b1 = Hacl_Impl_SHA3_rotl(a7, (uint32_t)6U);
+    a13 = a13 ^ d3;
+    b2 = Hacl_Impl_SHA3_rotl(a13, (uint32_t)25U);
+    a19 = a19 ^ d4;
+    b3 = Hacl_Impl_SHA3_rotl(a19, (uint32_t)8U);
+    a20 = a20 ^ d0;
+    b4 = Hacl_Impl_SHA3_rotl(a20, (uint32_t)18U);
+    e10 = b0 ^ (b1 | b2);
+    c0 = c0 ^ e10;
+    e11 = b1 ^ (b2 & b3);
+    c1 = c1 ^ e11;
+    e12 = b2 ^ (~b3 & b4);
+    c2 = c2 ^ e12;
+    e13 = ~b3 ^ (b4 | b0);
+    c3 = c3 ^ e13;
+    e14 = b4 ^ (b0 & b1);
+    c4 = c4 ^ e14;
+    a4 = a4 ^ d4;
+    b0 = Hacl_Impl_SHA3_rotl(a4, (uint32_t)27U);
+    a5 = a5 ^ d0;
+    b1 = Hacl_Impl_SHA3_rotl(a5, (uint32_t)36U);
+    a11 = a11 ^ d1;
+    b2 = Hacl_Impl_SHA3_rotl(a11, (uint32_t)10U);
+    a17 = a17 ^ d2;
+    b3 = Hacl_Impl_SHA3_rotl(a17, (uint32_t)15U);
+    a23 = a23 ^ d3;
+    b4 = Hacl_Impl_SHA3_rotl(a23, (uint32_t)56U);
+    e15 = b0 ^ (b1 & b2);
+    c0 = c0 ^ e15;
+    e16 = b1 ^ (b2 | b3);
+    c1 = c1 ^ e16;
+    e17 = b2 ^ (~b3 | b4);
+    c2 = c2 ^ e17;
+    e18 = ~b3 ^ (b4 & b0);
+    c3 = c3 ^ e18;
+    e19 = b4 ^ (b0 | b1);
+    c4 = c4 ^ e19;
+    a2 = a2 ^ d2;
+    b0 = Hacl_Impl_SHA3_rotl(a2, (uint32_t)62U);
+    a8 = a8 ^ d3;
+    b1 = Hacl_Impl_SHA3_rotl(a8, (uint32_t)55U);
+    a14 = a14 ^ d4;
+    b2 = Hacl_Impl_SHA3_rotl(a14, (uint32_t)39U);
+    a15 = a15 ^ d0;
+    b3 = Hacl_Impl_SHA3_rotl(a15, (uint32_t)41U);
+    a21 = a21 ^ d1;
+    b4 = Hacl_Impl_SHA3_rotl(a21, (uint32_t)2U);
+    e20 = b0 ^ (~b1 & b2);
+    c0 = c0 ^ e20;
+    e21 = ~b1 ^ (b2 | b3);
+    c1 = c1 ^ e21;
+    e22 = b2 ^ (b3 & b4);
+    c2 = c2 ^ e22;
+    e23 = b3 ^ (b4 | b0);
+    c3 = c3 ^ e23;
+    e24 = b4 ^ (b0 & b1);
+    c4 = c4 ^ e24;
+    d0 = c4 ^ Hacl_Impl_SHA3_rotl(c1, (uint32_t)1U);
+    d1 = c0 ^ Hacl_Impl_SHA3_rotl(c2, (uint32_t)1U);
+    d2 = c1 ^ Hacl_Impl_SHA3_rotl(c3, (uint32_t)1U);
+    d3 = c2 ^ Hacl_Impl_SHA3_rotl(c4, (uint32_t)1U);
+    d4 = c3 ^ Hacl_Impl_SHA3_rotl(c0, (uint32_t)1U);
+    e0 = e0 ^ d0;
+    b0 = e0;
+    e6 = e6 ^ d1;
+    b1 = Hacl_Impl_SHA3_rotl(e6, (uint32_t)44U);
+    e12 = e12 ^ d2;
+    b2 = Hacl_Impl_SHA3_rotl(e12, (uint32_t)43U);
+    e18 = e18 ^ d3;
+    b3 = Hacl_Impl_SHA3_rotl(e18, (uint32_t)21U);
+    e24 = e24 ^ d4;
+    b4 = Hacl_Impl_SHA3_rotl(e24, (uint32_t)14U);
+    a0 = b0 ^ (b1 | b2) ^ Hacl_Impl_SHA3_keccak_rndc[i0 + (uint32_t)1U];
+    c0 = a0;
+    a1 = b1 ^ (~b2 | b3);
+    c1 = a1;
+    a2 = b2 ^ (b3 & b4);
+    c2 = a2;
+    a3 = b3 ^ (b4 | b0);
+    c3 = a3;
+    a4 = b4 ^ (b0 & b1);
+    c4 = a4;
+    e3 = e3 ^ d3;
+    b0 = Hacl_Impl_SHA3_rotl(e3, (uint32_t)28U);
+    e9 = e9 ^ d4;
+    b1 = Hacl_Impl_SHA3_rotl(e9, (uint32_t)20U);
+    e10 = e10 ^ d0;
+    b2 = Hacl_Impl_SHA3_rotl(e10, (uint32_t)3U);
+    e16 = e16 ^ d1;
+    b3 = Hacl_Impl_SHA3_rotl(e16, (uint32_t)45U);
+    e22 = e22 ^ d2;
+    b4 = Hacl_Impl_SHA3_rotl(e22, (uint32_t)61U);
+    a5 = b0 ^ (b1 | b2);
+    c0 = c0 ^ a5;
+    a6 = b1 ^ (b2 & b3);
+    c1 = c1 ^ a6;
+    a7 = b2 ^ (b3 | ~b4);
+    c2 = c2 ^ a7;
+    a8 = b3 ^ (b4 | b0);
+    c3 = c3 ^ a8;
+    a9 = b4 ^ (b0 & b1);
+    c4 = c4 ^ a9;
+    e1 = e1 ^ d1;
+    b0 = Hacl_Impl_SHA3_rotl(e1, (uint32_t)1U);
+    e7 = e7 ^ d2;
+    b1 = Hacl_Impl_SHA3_rotl(e7, (uint32_t)6U);
+    e13 = e13 ^ d3;
+    b2 = Hacl_Impl_SHA3_rotl(e13, (uint32_t)25U);
+    e19 = e19 ^ d4;
+    b3 = Hacl_Impl_SHA3_rotl(e19, (uint32_t)8U);
+    e20 = e20 ^ d0;
+    b4 = Hacl_Impl_SHA3_rotl(e20, (uint32_t)18U);
+    a10 = b0 ^ (b1 | b2);
+    c0 = c0 ^ a10;
+    a11 = b1 ^ (b2 & b3);
+    c1 = c1 ^ a11;
+    a12 = b2 ^ (~b3 & b4);
+    c2 = c2 ^ a12;
+    a13 = ~b3 ^ (b4 | b0);
+    c3 = c3 ^ a13;
+    a14 = b4 ^ (b0 & b1);
+    c4 = c4 ^ a14;
+    e4 = e4 ^ d4;
+    b0 = Hacl_Impl_SHA3_rotl(e4, (uint32_t)27U);
+    e5 = e5 ^ d0;
+    b1 = Hacl_Impl_SHA3_rotl(e5, (uint32_t)36U);
+    e11 = e11 ^ d1;
+    b2 = Hacl_Impl_SHA3_rotl(e11, (uint32_t)10U);
+    e17 = e17 ^ d2;
+    b3 = Hacl_Impl_SHA3_rotl(e17, (uint32_t)15U);
+    e23 = e23 ^ d3;
+    b4 = Hacl_Impl_SHA3_rotl(e23, (uint32_t)56U);
+    a15 = b0 ^ (b1 & b2);
+    c0 = c0 ^ a15;
+    a16 = b1 ^ (b2 | b3);
+    c1 = c1 ^ a16;
+    a17 = b2 ^ (~b3 | b4);
+    c2 = c2 ^ a17;
+    a18 = ~b3 ^ (b4 & b0);
+    c3 = c3 ^ a18;
+    a19 = b4 ^ (b0 | b1);
+    c4 = c4 ^ a19;
+    e2 = e2 ^ d2;
+    b0 = Hacl_Impl_SHA3_rotl(e2, (uint32_t)62U);
+    e8 = e8 ^ d3;
+    b1 = Hacl_Impl_SHA3_rotl(e8, (uint32_t)55U);
+    e14 = e14 ^ d4;
+    b2 = Hacl_Impl_SHA3_rotl(e14, (uint32_t)39U);
+    e15 = e15 ^ d0;
+    b3 = Hacl_Impl_SHA3_rotl(e15, (uint32_t)41U);
+    e21 = e21 ^ d1;
+    b4 = Hacl_Impl_SHA3_rotl(e21, (uint32_t)2U);
+    a20 = b0 ^ (~b1 & b2);
+    c0 = c0 ^ a20;
+    a21 = ~b1 ^ (b2 | b3);
+    c1 = c1 ^ a21;
+    a22 = b2 ^ (b3 & b4);
+    c2 = c2 ^ a22;
+    a23 = b3 ^ (b4 | b0);
+    c3 = c3 ^ a23;
+    a24 = b4 ^ (b0 & b1);
+    c4 = c4 ^ a24;
   }
+  s[0U] = a0;
+  s[1U] = ~a1;
+  s[2U] = ~a2;
+  s[3U] = a3;
+  s[4U] = a4;
+  s[5U] = a5;
+  s[6U] = a6;
+  s[7U] = a7;
+  s[8U] = ~a8;
+  s[9U] = a9;
+  s[10U] = a10;
+  s[11U] = a11;
+  s[12U] = ~a12;
+  s[13U] = a13;
+  s[14U] = a14;
+  s[15U] = a15;
+  s[16U] = a16;
+  s[17U] = ~a17;
+  s[18U] = a18;
+  s[19U] = a19;
+  s[20U] = ~a20;
+  s[21U] = a21;
+  s[22U] = a22;
+  s[23U] = a23;
+  s[24U] = a24;
 }
 
 void Hacl_Impl_SHA3_loadState(uint32_t rateInBytes, uint8_t *input, uint64_t *s)
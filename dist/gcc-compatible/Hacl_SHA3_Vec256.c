@@ -0,0 +1,614 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "Hacl_SHA3_Vec256.h"
+
+void Hacl_Impl_SHA3_Vec256_state_permute4(Lib_IntVector_Intrinsics_vec256 *s)
+{
+  Lib_IntVector_Intrinsics_vec256 a0 = s[0U];
+  Lib_IntVector_Intrinsics_vec256 a1 = Lib_IntVector_Intrinsics_vec256_lognot(s[1U]);
+  Lib_IntVector_Intrinsics_vec256 a2 = Lib_IntVector_Intrinsics_vec256_lognot(s[2U]);
+  Lib_IntVector_Intrinsics_vec256 a3 = s[3U];
+  Lib_IntVector_Intrinsics_vec256 a4 = s[4U];
+  Lib_IntVector_Intrinsics_vec256 a5 = s[5U];
+  Lib_IntVector_Intrinsics_vec256 a6 = s[6U];
+  Lib_IntVector_Intrinsics_vec256 a7 = s[7U];
+  Lib_IntVector_Intrinsics_vec256 a8 = Lib_IntVector_Intrinsics_vec256_lognot(s[8U]);
+  Lib_IntVector_Intrinsics_vec256 a9 = s[9U];
+  Lib_IntVector_Intrinsics_vec256 a10 = s[10U];
+  Lib_IntVector_Intrinsics_vec256 a11 = s[11U];
+  Lib_IntVector_Intrinsics_vec256 a12 = Lib_IntVector_Intrinsics_vec256_lognot(s[12U]);
+  Lib_IntVector_Intrinsics_vec256 a13 = s[13U];
+  Lib_IntVector_Intrinsics_vec256 a14 = s[14U];
+  Lib_IntVector_Intrinsics_vec256 a15 = s[15U];
+  Lib_IntVector_Intrinsics_vec256 a16 = s[16U];
+  Lib_IntVector_Intrinsics_vec256 a17 = Lib_IntVector_Intrinsics_vec256_lognot(s[17U]);
+  Lib_IntVector_Intrinsics_vec256 a18 = s[18U];
+  Lib_IntVector_Intrinsics_vec256 a19 = s[19U];
+  Lib_IntVector_Intrinsics_vec256 a20 = Lib_IntVector_Intrinsics_vec256_lognot(s[20U]);
+  Lib_IntVector_Intrinsics_vec256 a21 = s[21U];
+  Lib_IntVector_Intrinsics_vec256 a22 = s[22U];
+  Lib_IntVector_Intrinsics_vec256 a23 = s[23U];
+  Lib_IntVector_Intrinsics_vec256 a24 = s[24U];
+  Lib_IntVector_Intrinsics_vec256 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12;
+  Lib_IntVector_Intrinsics_vec256 e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24;
+  Lib_IntVector_Intrinsics_vec256 b0, b1, b2, b3, b4;
+  Lib_IntVector_Intrinsics_vec256 d0, d1, d2, d3, d4;
+  Lib_IntVector_Intrinsics_vec256 c0 = Lib_IntVector_Intrinsics_vec256_xor(a0, a5);
+  Lib_IntVector_Intrinsics_vec256 c1 = Lib_IntVector_Intrinsics_vec256_xor(a1, a6);
+  Lib_IntVector_Intrinsics_vec256 c2 = Lib_IntVector_Intrinsics_vec256_xor(a2, a7);
+  Lib_IntVector_Intrinsics_vec256 c3 = Lib_IntVector_Intrinsics_vec256_xor(a3, a8);
+  Lib_IntVector_Intrinsics_vec256 c4 = Lib_IntVector_Intrinsics_vec256_xor(a4, a9);
+  c0 = Lib_IntVector_Intrinsics_vec256_xor(c0, a10);
+  c0 = Lib_IntVector_Intrinsics_vec256_xor(c0, a15);
+  c0 = Lib_IntVector_Intrinsics_vec256_xor(c0, a20);
+  c1 = Lib_IntVector_Intrinsics_vec256_xor(c1, a11);
+  c1 = Lib_IntVector_Intrinsics_vec256_xor(c1, a16);
+  c1 = Lib_IntVector_Intrinsics_vec256_xor(c1, a21);
+  c2 = Lib_IntVector_Intrinsics_vec256_xor(c2, a12);
+  c2 = Lib_IntVector_Intrinsics_vec256_xor(c2, a17);
+  c2 = Lib_IntVector_Intrinsics_vec256_xor(c2, a22);
+  c3 = Lib_IntVector_Intrinsics_vec256_xor(c3, a13);
+  c3 = Lib_IntVector_Intrinsics_vec256_xor(c3, a18);
+  c3 = Lib_IntVector_Intrinsics_vec256_xor(c3, a23);
+  c4 = Lib_IntVector_Intrinsics_vec256_xor(c4, a14);
+  c4 = Lib_IntVector_Intrinsics_vec256_xor(c4, a19);
+  c4 = Lib_IntVector_Intrinsics_vec256_xor(c4, a24);
+  for (uint32_t i0 = (uint32_t)0U; i0 < (uint32_t)24U; i0 = i0 + (uint32_t)2U)
+  {
+    d0 = Lib_IntVector_Intrinsics_vec256_rotate_left64(c1, (uint32_t)1U);
+    d0 = Lib_IntVector_Intrinsics_vec256_xor(c4, d0);
+    d1 = Lib_IntVector_Intrinsics_vec256_rotate_left64(c2, (uint32_t)1U);
+    d1 = Lib_IntVector_Intrinsics_vec256_xor(c0, d1);
+    d2 = Lib_IntVector_Intrinsics_vec256_rotate_left64(c3, (uint32_t)1U);
+    d2 = Lib_IntVector_Intrinsics_vec256_xor(c1, d2);
+    d3 = Lib_IntVector_Intrinsics_vec256_rotate_left64(c4, (uint32_t)1U);
+    d3 = Lib_IntVector_Intrinsics_vec256_xor(c2, d3);
+    d4 = Lib_IntVector_Intrinsics_vec256_rotate_left64(c0, (uint32_t)1U);
+    d4 = Lib_IntVector_Intrinsics_vec256_xor(c3, d4);
+    a0 = Lib_IntVector_Intrinsics_vec256_xor(a0, d0);
+    b0 = a0;
+    a6 = Lib_IntVector_Intrinsics_vec256_xor(a6, d1);
+    b1 = Lib_IntVector_Intrinsics_vec256_rotate_left64(a6, (uint32_t)44U);
+    a12 = Lib_IntVector_Intrinsics_vec256_xor(a12, d2);
+    b2 = Lib_IntVector_Intrinsics_vec256_rotate_left64(a12, (uint32_t)43U);
+    a18 = Lib_IntVector_Intrinsics_vec256_xor(a18, d3);
+    b3 = Lib_IntVector_Intrinsics_vec256_rotate_left64(a18, (uint32_t)21U);
+    a24 = Lib_IntVector_Intrinsics_vec256_xor(a24, d4);
+    b4 = Lib_IntVector_Intrinsics_vec256_rotate_left64(a24, (uint32_t)14U);
+    e0 = Lib_IntVector_Intrinsics_vec256_or(b1, b2);
+    e0 = Lib_IntVector_Intrinsics_vec256_xor(b0, e0);
+    e0 = Lib_IntVector_Intrinsics_vec256_xor(e0, Lib_IntVector_Intrinsics_vec256_load64(Hacl_Impl_SHA3_keccak_rndc[i0]));
+    c0 = e0;
+    e1 = Lib_IntVector_Intrinsics_vec256_or(Lib_IntVector_Intrinsics_vec256_lognot(b2), b3);
+    e1 = Lib_IntVector_Intrinsics_vec256_xor(b1, e1);
+    c1 = e1;
+    e2 = Lib_IntVector_Intrinsics_vec256_and(b3, b4);
+    e2 = Lib_IntVector_Intrinsics_vec256_xor(b2, e2);
+    c2 = e2;
+    e3 = Lib_IntVector_Intrinsics_vec256_or(b4, b0);
+    e3 = Lib_IntVector_Intrinsics_vec256_xor(b3, e3);
+    c3 = e3;
+    e4 = Lib_IntVector_Intrinsics_vec256_and(b0, b1);
+    e4 = Lib_IntVector_Intrinsics_vec256_xor(b4, e4);
+    c4 = e4;
+    a3 = Lib_IntVector_Intrinsics_vec256_xor(a3, d3);
+    b0 = Lib_IntVector_Intrinsics_vec256_rotate_left64(a3, (uint32_t)28U);
+    a9 = Lib_IntVector_Intrinsics_vec256_xor(a9, d4);
+    b1 = Lib_IntVector_Intrinsics_vec256_rotate_left64(a9, (uint32_t)20U);
+    a10 = Lib_IntVector_Intrinsics_vec256_xor(a10, d0);
+    b2 = Lib_IntVector_Intrinsics_vec256_rotate_left64(a10, (uint32_t)3U);
+    a16 = Lib_IntVector_Intrinsics_vec256_xor(a16, d1);
+    b3 = Lib_IntVector_Intrinsics_vec256_rotate_left64(a16, (uint32_t)45U);
+    a22 = Lib_IntVector_Intrinsics_vec256_xor(a22, d2);
+    b4 = Lib_IntVector_Intrinsics_vec256_rotate_left64(a22, (uint32_t)61U);
+    e5 = Lib_IntVector_Intrinsics_vec256_or(b1, b2);
+    e5 = Lib_IntVector_Intrinsics_vec256_xor(b0, e5);
+    c0 = Lib_IntVector_Intrinsics_vec256_xor(c0, e5);
+    e6 = Lib_IntVector_Intrinsics_vec256_and(b2, b3);
+    e6 = Lib_IntVector_Intrinsics_vec256_xor(b1, e6);
+    c1 = Lib_IntVector_Intrinsics_vec256_xor(c1, e6);
+    e7 = Lib_IntVector_Intrinsics_vec256_or(b3, Lib_IntVector_Intrinsics_vec256_lognot(b4));
+    e7 = Lib_IntVector_Intrinsics_vec256_xor(b2, e7);
+    c2 = Lib_IntVector_Intrinsics_vec256_xor(c2, e7);
+    e8 = Lib_IntVector_Intrinsics_vec256_or(b4, b0);
+    e8 = Lib_IntVector_Intrinsics_vec256_xor(b3, e8);
+    c3 = Lib_IntVector_Intrinsics_vec256_xor(c3, e8);
+    e9 = Lib_IntVector_Intrinsics_vec256_and(b0, b1);
+    e9 = Lib_IntVector_Intrinsics_vec256_xor(b4, e9);
+    c4 = Lib_IntVector_Intrinsics_vec256_xor(c4, e9);
+    a1 = Lib_IntVector_Intrinsics_vec256_xor(a1, d1);
+    b0 = Lib_IntVector_Intrinsics_vec256_rotate_left64(a1, (uint32_t)1U);
+    a7 = Lib_IntVector_Intrinsics_vec256_xor(a7, d2);
+    b1 = Lib_IntVector_Intrinsics_vec256_rotate_left64(a7, (uint32_t)6U);
+    a13 = Lib_IntVector_Intrinsics_vec256_xor(a13, d3);
+    b2 = Lib_IntVector_Intrinsics_vec256_rotate_left64(a13, (uint32_t)25U);
+    a19 = Lib_IntVector_Intrinsics_vec256_xor(a19, d4);
+    b3 = Lib_IntVector_Intrinsics_vec256_rotate_left64(a19, (uint32_t)8U);
+    a20 = Lib_IntVector_Intrinsics_vec256_xor(a20, d0);
+    b4 = Lib_IntVector_Intrinsics_vec256_rotate_left64(a20, (uint32_t)18U);
+    e10 = Lib_IntVector_Intrinsics_vec256_or(b1, b2);
+    e10 = Lib_IntVector_Intrinsics_vec256_xor(b0, e10);
+    c0 = Lib_IntVector_Intrinsics_vec256_xor(c0, e10);
+    e11 = Lib_IntVector_Intrinsics_vec256_and(b2, b3);
+    e11 = Lib_IntVector_Intrinsics_vec256_xor(b1, e11);
+    c1 = Lib_IntVector_Intrinsics_vec256_xor(c1, e11);
+    e12 = Lib_IntVector_Intrinsics_vec256_and(Lib_IntVector_Intrinsics_vec256_lognot(b3), b4);
+    e12 = Lib_IntVector_Intrinsics_vec256_xor(b2, e12);
+    c2 = Lib_IntVector_Intrinsics_vec256_xor(c2, e12);
+    e13 = Lib_IntVector_Intrinsics_vec256_or(b4, b0);
+    e13 = Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_lognot(b3), e13);
+    c3 = Lib_IntVector_Intrinsics_vec256_xor(c3, e13);
+    e14 = Lib_IntVector_Intrinsics_vec256_and(b0, b1);
+    e14 = Lib_IntVector_Intrinsics_vec256_xor(b4, e14);
+    c4 = Lib_IntVector_Intrinsics_vec256_xor(c4, e14);
+    a4 = Lib_IntVector_Intrinsics_vec256_xor(a4, d4);
+    b0 = Lib_IntVector_Intrinsics_vec256_rotate_left64(a4, (uint32_t)27U);
+    a5 = Lib_IntVector_Intrinsics_vec256_xor(a5, d0);
+    b1 = Lib_IntVector_Intrinsics_vec256_rotate_left64(a5, (uint32_t)36U);
+    a11 = Lib_IntVector_Intrinsics_vec256_xor(a11, d1);
+    b2 = Lib_IntVector_Intrinsics_vec256_rotate_left64(a11, (uint32_t)10U);
+    a17 = Lib_IntVector_Intrinsics_vec256_xor(a17, d2);
+    b3 = Lib_IntVector_Intrinsics_vec256_rotate_left64(a17, (uint32_t)15U);
+    a23 = Lib_IntVector_Intrinsics_vec256_xor(a23, d3);
+    b4 = Lib_IntVector_Intrinsics_vec256_rotate_left64(a23, (uint32_t)56U);
+    e15 = Lib_IntVector_Intrinsics_vec256_and(b1, b2);
+    e15 = Lib_IntVector_Intrinsics_vec256_xor(b0, e15);
+    c0 = Lib_IntVector_Intrinsics_vec256_xor(c0, e15);
+    e16 = Lib_IntVector_Intrinsics_vec256_or(b2, b3);
+    e16 = Lib_IntVector_Intrinsics_vec256_xor(b1, e16);
+    c1 = Lib_IntVector_Intrinsics_vec256_xor(c1, e16);
+    e17 = Lib_IntVector_Intrinsics_vec256_or(Lib_IntVector_Intrinsics_vec256_lognot(b3), b4);
+    e17 = Lib_IntVector_Intrinsics_vec256_xor(b2, e17);
+    c2 = Lib_IntVector_Intrinsics_vec256_xor(c2, e17);
+    e18 = Lib_IntVector_Intrinsics_vec256_and(b4, b0);
+    e18 = Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_lognot(b3), e18);
+    c3 = Lib_IntVector_Intrinsics_vec256_xor(c3, e18);
+    e19 = Lib_IntVector_Intrinsics_vec256_or(b0, b1);
+    e19 = Lib_IntVector_Intrinsics_vec256_xor(b4, e19);
+    c4 = Lib_IntVector_Intrinsics_vec256_xor(c4, e19);
+    a2 = Lib_IntVector_Intrinsics_vec256_xor(a2, d2);
+    b0 = Lib_IntVector_Intrinsics_vec256_rotate_left64(a2, (uint32_t)62U);
+    a8 = Lib_IntVector_Intrinsics_vec256_xor(a8, d3);
+    b1 = Lib_IntVector_Intrinsics_vec256_rotate_left64(a8, (uint32_t)55U);
+    a14 = Lib_IntVector_Intrinsics_vec256_xor(a14, d4);
+    b2 = Lib_IntVector_Intrinsics_vec256_rotate_left64(a14, (uint32_t)39U);
+    a15 = Lib_IntVector_Intrinsics_vec256_xor(a15, d0);
+    b3 = Lib_IntVector_Intrinsics_vec256_rotate_left64(a15, (uint32_t)41U);
+    a21 = Lib_IntVector_Intrinsics_vec256_xor(a21, d1);
+    b4 = Lib_IntVector_Intrinsics_vec256_rotate_left64(a21, (uint32_t)2U);
+    e20 = Lib_IntVector_Intrinsics_vec256_and(Lib_IntVector_Intrinsics_vec256_lognot(b1), b2);
+    e20 = Lib_IntVector_Intrinsics_vec256_xor(b0, e20);
+    c0 = Lib_IntVector_Intrinsics_vec256_xor(c0, e20);
+    e21 = Lib_IntVector_Intrinsics_vec256_or(b2, b3);
+    e21 = Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_lognot(b1), e21);
+    c1 = Lib_IntVector_Intrinsics_vec256_xor(c1, e21);
+    e22 = Lib_IntVector_Intrinsics_vec256_and(b3, b4);
+    e22 = Lib_IntVector_Intrinsics_vec256_xor(b2, e22);
+    c2 = Lib_IntVector_Intrinsics_vec256_xor(c2, e22);
+    e23 = Lib_IntVector_Intrinsics_vec256_or(b4, b0);
+    e23 = Lib_IntVector_Intrinsics_vec256_xor(b3, e23);
+    c3 = Lib_IntVector_Intrinsics_vec256_xor(c3, e23);
+    e24 = Lib_IntVector_Intrinsics_vec256_and(b0, b1);
+    e24 = Lib_IntVector_Intrinsics_vec256_xor(b4, e24);
+    c4 = Lib_IntVector_Intrinsics_vec256_xor(c4, e24);
+    d0 = Lib_IntVector_Intrinsics_vec256_rotate_left64(c1, (uint32_t)1U);
+    d0 = Lib_IntVector_Intrinsics_vec256_xor(c4, d0);
+    d1 = Lib_IntVector_Intrinsics_vec256_rotate_left64(c2, (uint32_t)1U);
+    d1 = Lib_IntVector_Intrinsics_vec256_xor(c0, d1);
+    d2 = Lib_IntVector_Intrinsics_vec256_rotate_left64(c3, (uint32_t)1U);
+    d2 = Lib_IntVector_Intrinsics_vec256_xor(c1, d2);
+    d3 = Lib_IntVector_Intrinsics_vec256_rotate_left64(c4, (uint32_t)1U);
+    d3 = Lib_IntVector_Intrinsics_vec256_xor(c2, d3);
+    d4 = Lib_IntVector_Intrinsics_vec256_rotate_left64(c0, (uint32_t)1U);
+    d4 = Lib_IntVector_Intrinsics_vec256_xor(c3, d4);
+    e0 = Lib_IntVector_Intrinsics_vec256_xor(e0, d0);
+    b0 = e0;
+    e6 = Lib_IntVector_Intrinsics_vec256_xor(e6, d1);
+    b1 = Lib_IntVector_Intrinsics_vec256_rotate_left64(e6, (uint32_t)44U);
+    e12 = Lib_IntVector_Intrinsics_vec256_xor(e12, d2);
+    b2 = Lib_IntVector_Intrinsics_vec256_rotate_left64(e12, (uint32_t)43U);
+    e18 = Lib_IntVector_Intrinsics_vec256_xor(e18, d3);
+    b3 = Lib_IntVector_Intrinsics_vec256_rotate_left64(e18, (uint32_t)21U);
+    e24 = Lib_IntVector_Intrinsics_vec256_xor(e24, d4);
+    b4 = Lib_IntVector_Intrinsics_vec256_rotate_left64(e24, (uint32_t)14U);
+    a0 = Lib_IntVector_Intrinsics_vec256_or(b1, b2);
+    a0 = Lib_IntVector_Intrinsics_vec256_xor(b0, a0);
+    a0 = Lib_IntVector_Intrinsics_vec256_xor(a0, Lib_IntVector_Intrinsics_vec256_load64(Hacl_Impl_SHA3_keccak_rndc[i0 + (uint32_t)1U]));
+    c0 = a0;
+    a1 = Lib_IntVector_Intrinsics_vec256_or(Lib_IntVector_Intrinsics_vec256_lognot(b2), b3);
+    a1 = Lib_IntVector_Intrinsics_vec256_xor(b1, a1);
+    c1 = a1;
+    a2 = Lib_IntVector_Intrinsics_vec256_and(b3, b4);
+    a2 = Lib_IntVector_Intrinsics_vec256_xor(b2, a2);
+    c2 = a2;
+    a3 = Lib_IntVector_Intrinsics_vec256_or(b4, b0);
+    a3 = Lib_IntVector_Intrinsics_vec256_xor(b3, a3);
+    c3 = a3;
+    a4 = Lib_IntVector_Intrinsics_vec256_and(b0, b1);
+    a4 = Lib_IntVector_Intrinsics_vec256_xor(b4, a4);
+    c4 = a4;
+    e3 = Lib_IntVector_Intrinsics_vec256_xor(e3, d3);
+    b0 = Lib_IntVector_Intrinsics_vec256_rotate_left64(e3, (uint32_t)28U);
+    e9 = Lib_IntVector_Intrinsics_vec256_xor(e9, d4);
+    b1 = Lib_IntVector_Intrinsics_vec256_rotate_left64(e9, (uint32_t)20U);
+    e10 = Lib_IntVector_Intrinsics_vec256_xor(e10, d0);
+    b2 = Lib_IntVector_Intrinsics_vec256_rotate_left64(e10, (uint32_t)3U);
+    e16 = Lib_IntVector_Intrinsics_vec256_xor(e16, d1);
+    b3 = Lib_IntVector_Intrinsics_vec256_rotate_left64(e16, (uint32_t)45U);
+    e22 = Lib_IntVector_Intrinsics_vec256_xor(e22, d2);
+    b4 = Lib_IntVector_Intrinsics_vec256_rotate_left64(e22, (uint32_t)61U);
+    a5 = Lib_IntVector_Intrinsics_vec256_or(b1, b2);
+    a5 = Lib_IntVector_Intrinsics_vec256_xor(b0, a5);
+    c0 = Lib_IntVector_Intrinsics_vec256_xor(c0, a5);
+    a6 = Lib_IntVector_Intrinsics_vec256_and(b2, b3);
+    a6 = Lib_IntVector_Intrinsics_vec256_xor(b1, a6);
+    c1 = Lib_IntVector_Intrinsics_vec256_xor(c1, a6);
+    a7 = Lib_IntVector_Intrinsics_vec256_or(b3, Lib_IntVector_Intrinsics_vec256_lognot(b4));
+    a7 = Lib_IntVector_Intrinsics_vec256_xor(b2, a7);
+    c2 = Lib_IntVector_Intrinsics_vec256_xor(c2, a7);
+    a8 = Lib_IntVector_Intrinsics_vec256_or(b4, b0);
+    a8 = Lib_IntVector_Intrinsics_vec256_xor(b3, a8);
+    c3 = Lib_IntVector_Intrinsics_vec256_xor(c3, a8);
+    a9 = Lib_IntVector_Intrinsics_vec256_and(b0, b1);
+    a9 = Lib_IntVector_Intrinsics_vec256_xor(b4, a9);
+    c4 = Lib_IntVector_Intrinsics_vec256_xor(c4, a9);
+    e1 = Lib_IntVector_Intrinsics_vec256_xor(e1, d1);
+    b0 = Lib_IntVector_Intrinsics_vec256_rotate_left64(e1, (uint32_t)1U);
+    e7 = Lib_IntVector_Intrinsics_vec256_xor(e7, d2);
+    b1 = Lib_IntVector_Intrinsics_vec256_rotate_left64(e7, (uint32_t)6U);
+    e13 = Lib_IntVector_Intrinsics_vec256_xor(e13, d3);
+    b2 = Lib_IntVector_Intrinsics_vec256_rotate_left64(e13, (uint32_t)25U);
+    e19 = Lib_IntVector_Intrinsics_vec256_xor(e19, d4);
+    b3 = Lib_IntVector_Intrinsics_vec256_rotate_left64(e19, (uint32_t)8U);
+    e20 = Lib_IntVector_Intrinsics_vec256_xor(e20, d0);
+    b4 = Lib_IntVector_Intrinsics_vec256_rotate_left64(e20, (uint32_t)18U);
+    a10 = Lib_IntVector_Intrinsics_vec256_or(b1, b2);
+    a10 = Lib_IntVector_Intrinsics_vec256_xor(b0, a10);
+    c0 = Lib_IntVector_Intrinsics_vec256_xor(c0, a10);
+    a11 = Lib_IntVector_Intrinsics_vec256_and(b2, b3);
+    a11 = Lib_IntVector_Intrinsics_vec256_xor(b1, a11);
+    c1 = Lib_IntVector_Intrinsics_vec256_xor(c1, a11);
+    a12 = Lib_IntVector_Intrinsics_vec256_and(Lib_IntVector_Intrinsics_vec256_lognot(b3), b4);
+    a12 = Lib_IntVector_Intrinsics_vec256_xor(b2, a12);
+    c2 = Lib_IntVector_Intrinsics_vec256_xor(c2, a12);
+    a13 = Lib_IntVector_Intrinsics_vec256_or(b4, b0);
+    a13 = Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_lognot(b3), a13);
+    c3 = Lib_IntVector_Intrinsics_vec256_xor(c3, a13);
+    a14 = Lib_IntVector_Intrinsics_vec256_and(b0, b1);
+    a14 = Lib_IntVector_Intrinsics_vec256_xor(b4, a14);
+    c4 = Lib_IntVector_Intrinsics_vec256_xor(c4, a14);
+    e4 = Lib_IntVector_Intrinsics_vec256_xor(e4, d4);
+    b0 = Lib_IntVector_Intrinsics_vec256_rotate_left64(e4, (uint32_t)27U);
+    e5 = Lib_IntVector_Intrinsics_vec256_xor(e5, d0);
+    b1 = Lib_IntVector_Intrinsics_vec256_rotate_left64(e5, (uint32_t)36U);
+    e11 = Lib_IntVector_Intrinsics_vec256_xor(e11, d1);
+    b2 = Lib_IntVector_Intrinsics_vec256_rotate_left64(e11, (uint32_t)10U);
+    e17 = Lib_IntVector_Intrinsics_vec256_xor(e17, d2);
+    b3 = Lib_IntVector_Intrinsics_vec256_rotate_left64(e17, (uint32_t)15U);
+    e23 = Lib_IntVector_Intrinsics_vec256_xor(e23, d3);
+    b4 = Lib_IntVector_Intrinsics_vec256_rotate_left64(e23, (uint32_t)56U);
+    a15 = Lib_IntVector_Intrinsics_vec256_and(b1, b2);
+    a15 = Lib_IntVector_Intrinsics_vec256_xor(b0, a15);
+    c0 = Lib_IntVector_Intrinsics_vec256_xor(c0, a15);
+    a16 = Lib_IntVector_Intrinsics_vec256_or(b2, b3);
+    a16 = Lib_IntVector_Intrinsics_vec256_xor(b1, a16);
+    c1 = Lib_IntVector_Intrinsics_vec256_xor(c1, a16);
+    a17 = Lib_IntVector_Intrinsics_vec256_or(Lib_IntVector_Intrinsics_vec256_lognot(b3), b4);
+    a17 = Lib_IntVector_Intrinsics_vec256_xor(b2, a17);
+    c2 = Lib_IntVector_Intrinsics_vec256_xor(c2, a17);
+    a18 = Lib_IntVector_Intrinsics_vec256_and(b4, b0);
+    a18 = Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_lognot(b3), a18);
+    c3 = Lib_IntVector_Intrinsics_vec256_xor(c3, a18);
+    a19 = Lib_IntVector_Intrinsics_vec256_or(b0, b1);
+    a19 = Lib_IntVector_Intrinsics_vec256_xor(b4, a19);
+    c4 = Lib_IntVector_Intrinsics_vec256_xor(c4, a19);
+    e2 = Lib_IntVector_Intrinsics_vec256_xor(e2, d2);
+    b0 = Lib_IntVector_Intrinsics_vec256_rotate_left64(e2, (uint32_t)62U);
+    e8 = Lib_IntVector_Intrinsics_vec256_xor(e8, d3);
+    b1 = Lib_IntVector_Intrinsics_vec256_rotate_left64(e8, (uint32_t)55U);
+    e14 = Lib_IntVector_Intrinsics_vec256_xor(e14, d4);
+    b2 = Lib_IntVector_Intrinsics_vec256_rotate_left64(e14, (uint32_t)39U);
+    e15 = Lib_IntVector_Intrinsics_vec256_xor(e15, d0);
+    b3 = Lib_IntVector_Intrinsics_vec256_rotate_left64(e15, (uint32_t)41U);
+    e21 = Lib_IntVector_Intrinsics_vec256_xor(e21, d1);
+    b4 = Lib_IntVector_Intrinsics_vec256_rotate_left64(e21, (uint32_t)2U);
+    a20 = Lib_IntVector_Intrinsics_vec256_and(Lib_IntVector_Intrinsics_vec256_lognot(b1), b2);
+    a20 = Lib_IntVector_Intrinsics_vec256_xor(b0, a20);
+    c0 = Lib_IntVector_Intrinsics_vec256_xor(c0, a20);
+    a21 = Lib_IntVector_Intrinsics_vec256_or(b2, b3);
+    a21 = Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_lognot(b1), a21);
+    c1 = Lib_IntVector_Intrinsics_vec256_xor(c1, a21);
+    a22 = Lib_IntVector_Intrinsics_vec256_and(b3, b4);
+    a22 = Lib_IntVector_Intrinsics_vec256_xor(b2, a22);
+    c2 = Lib_IntVector_Intrinsics_vec256_xor(c2, a22);
+    a23 = Lib_IntVector_Intrinsics_vec256_or(b4, b0);
+    a23 = Lib_IntVector_Intrinsics_vec256_xor(b3, a23);
+    c3 = Lib_IntVector_Intrinsics_vec256_xor(c3, a23);
+    a24 = Lib_IntVector_Intrinsics_vec256_and(b0, b1);
+    a24 = Lib_IntVector_Intrinsics_vec256_xor(b4, a24);
+    c4 = Lib_IntVector_Intrinsics_vec256_xor(c4, a24);
+  }
+  s[0U] = a0;
+  s[1U] = Lib_IntVector_Intrinsics_vec256_lognot(a1);
+  s[2U] = Lib_IntVector_Intrinsics_vec256_lognot(a2);
+  s[3U] = a3;
+  s[4U] = a4;
+  s[5U] = a5;
+  s[6U] = a6;
+  s[7U] = a7;
+  s[8U] = Lib_IntVector_Intrinsics_vec256_lognot(a8);
+  s[9U] = a9;
+  s[10U] = a10;
+  s[11U] = a11;
+  s[12U] = Lib_IntVector_Intrinsics_vec256_lognot(a12);
+  s[13U] = a13;
+  s[14U] = a14;
+  s[15U] = a15;
+  s[16U] = a16;
+  s[17U] = Lib_IntVector_Intrinsics_vec256_lognot(a17);
+  s[18U] = a18;
+  s[19U] = a19;
+  s[20U] = Lib_IntVector_Intrinsics_vec256_lognot(a20);
+  s[21U] = a21;
+  s[22U] = a22;
+  s[23U] = a23;
+  s[24U] = a24;
+}
+
+void
+Hacl_Impl_SHA3_Vec256_loadState4(
+  uint32_t rateInBytes,
+  uint8_t *b0,
+  uint8_t *b1,
+  uint8_t *b2,
+  uint8_t *b3,
+  Lib_IntVector_Intrinsics_vec256 *s
+)
+{
+  uint8_t b[800U] = { 0U };
+  memcpy(b, b0, rateInBytes * sizeof (b0[0U]));
+  memcpy(b + (uint32_t)200U, b1, rateInBytes * sizeof (b1[0U]));
+  memcpy(b + (uint32_t)400U, b2, rateInBytes * sizeof (b2[0U]));
+  memcpy(b + (uint32_t)600U, b3, rateInBytes * sizeof (b3[0U]));
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)25U; i++)
+  {
+    uint64_t u0 = load64_le(b + i * (uint32_t)8U);
+    uint64_t u1 = load64_le(b + (uint32_t)200U + i * (uint32_t)8U);
+    uint64_t u2 = load64_le(b + (uint32_t)400U + i * (uint32_t)8U);
+    uint64_t u3 = load64_le(b + (uint32_t)600U + i * (uint32_t)8U);
+    Lib_IntVector_Intrinsics_vec256 x = Lib_IntVector_Intrinsics_vec256_load64s(u0, u1, u2, u3);
+    s[i] = Lib_IntVector_Intrinsics_vec256_xor(s[i], x);
+  }
+  Lib_Memzero0_memzero(b, (uint32_t)800U * sizeof (b[0U]));
+}
+
+void
+Hacl_Impl_SHA3_Vec256_storeState4(
+  uint32_t rateInBytes,
+  Lib_IntVector_Intrinsics_vec256 *s,
+  uint8_t *b0,
+  uint8_t *b1,
+  uint8_t *b2,
+  uint8_t *b3
+)
+{
+  uint8_t b[800U] = { 0U };
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)25U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec256 sj = s[i];
+    store64_le(b + i * (uint32_t)8U, (uint64_t)Lib_IntVector_Intrinsics_vec256_extract64(sj, 0));
+    store64_le(b + (uint32_t)200U + i * (uint32_t)8U,
+      (uint64_t)Lib_IntVector_Intrinsics_vec256_extract64(sj, 1));
+    store64_le(b + (uint32_t)400U + i * (uint32_t)8U,
+      (uint64_t)Lib_IntVector_Intrinsics_vec256_extract64(sj, 2));
+    store64_le(b + (uint32_t)600U + i * (uint32_t)8U,
+      (uint64_t)Lib_IntVector_Intrinsics_vec256_extract64(sj, 3));
+  }
+  memcpy(b0, b, rateInBytes * sizeof (b[0U]));
+  memcpy(b1, b + (uint32_t)200U, rateInBytes * sizeof (b[0U]));
+  memcpy(b2, b + (uint32_t)400U, rateInBytes * sizeof (b[0U]));
+  memcpy(b3, b + (uint32_t)600U, rateInBytes * sizeof (b[0U]));
+  Lib_Memzero0_memzero(b, (uint32_t)800U * sizeof (b[0U]));
+}
+
+void
+Hacl_Impl_SHA3_Vec256_absorb4(
+  Lib_IntVector_Intrinsics_vec256 *s,
+  uint32_t rateInBytes,
+  uint32_t inputByteLen,
+  uint8_t *input0,
+  uint8_t *input1,
+  uint8_t *input2,
+  uint8_t *input3,
+  uint8_t delimitedSuffix
+)
+{
+  uint32_t nb = inputByteLen / rateInBytes;
+  uint32_t rem = inputByteLen % rateInBytes;
+  for (uint32_t i = (uint32_t)0U; i < nb; i++)
+  {
+    uint32_t off = i * rateInBytes;
+    Hacl_Impl_SHA3_Vec256_loadState4(rateInBytes,
+      input0 + off,
+      input1 + off,
+      input2 + off,
+      input3 + off,
+      s);
+    Hacl_Impl_SHA3_Vec256_state_permute4(s);
+  }
+  uint32_t off = nb * rateInBytes;
+  uint8_t b[800U] = { 0U };
+  uint8_t *b0 = b;
+  uint8_t *b1 = b + (uint32_t)200U;
+  uint8_t *b2 = b + (uint32_t)400U;
+  uint8_t *b3 = b + (uint32_t)600U;
+  memcpy(b0, input0 + off, rem * sizeof (input0[0U]));
+  memcpy(b1, input1 + off, rem * sizeof (input1[0U]));
+  memcpy(b2, input2 + off, rem * sizeof (input2[0U]));
+  memcpy(b3, input3 + off, rem * sizeof (input3[0U]));
+  b0[rem] = delimitedSuffix;
+  b1[rem] = delimitedSuffix;
+  b2[rem] = delimitedSuffix;
+  b3[rem] = delimitedSuffix;
+  Hacl_Impl_SHA3_Vec256_loadState4(rateInBytes, b0, b1, b2, b3, s);
+  if (!((delimitedSuffix & (uint8_t)0x80U) == (uint8_t)0U) && rem == rateInBytes - (uint32_t)1U)
+  {
+    Hacl_Impl_SHA3_Vec256_state_permute4(s);
+  }
+  uint64_t last = (uint64_t)0x80U << (uint32_t)8U * ((rateInBytes - (uint32_t)1U) % (uint32_t)8U);
+  uint32_t i = (rateInBytes - (uint32_t)1U) / (uint32_t)8U;
+  s[i] = Lib_IntVector_Intrinsics_vec256_xor(s[i], Lib_IntVector_Intrinsics_vec256_load64(last));
+  Hacl_Impl_SHA3_Vec256_state_permute4(s);
+  Lib_Memzero0_memzero(b, (uint32_t)800U * sizeof (b[0U]));
+}
+
+void
+Hacl_Impl_SHA3_Vec256_squeeze4(
+  Lib_IntVector_Intrinsics_vec256 *s,
+  uint32_t rateInBytes,
+  uint32_t outputByteLen,
+  uint8_t *output0,
+  uint8_t *output1,
+  uint8_t *output2,
+  uint8_t *output3
+)
+{
+  uint32_t outBlocks = outputByteLen / rateInBytes;
+  uint32_t remOut = outputByteLen % rateInBytes;
+  for (uint32_t i = (uint32_t)0U; i < outBlocks; i++)
+  {
+    uint32_t off = i * rateInBytes;
+    Hacl_Impl_SHA3_Vec256_storeState4(rateInBytes,
+      s,
+      output0 + off,
+      output1 + off,
+      output2 + off,
+      output3 + off);
+    Hacl_Impl_SHA3_Vec256_state_permute4(s);
+  }
+  uint32_t off = outputByteLen - remOut;
+  Hacl_Impl_SHA3_Vec256_storeState4(remOut,
+    s,
+    output0 + off,
+    output1 + off,
+    output2 + off,
+    output3 + off);
+}
+
+void
+Hacl_Impl_SHA3_Vec256_keccak4(
+  uint32_t rate,
+  uint32_t capacity,
+  uint32_t inputByteLen,
+  uint8_t *input0,
+  uint8_t *input1,
+  uint8_t *input2,
+  uint8_t *input3,
+  uint8_t delimitedSuffix,
+  uint32_t outputByteLen,
+  uint8_t *output0,
+  uint8_t *output1,
+  uint8_t *output2,
+  uint8_t *output3
+)
+{
+  uint32_t rateInBytes = rate / (uint32_t)8U;
+  Lib_IntVector_Intrinsics_vec256 s[25U];
+  for (uint32_t _i = 0U; _i < (uint32_t)25U; ++_i)
+    s[_i] = Lib_IntVector_Intrinsics_vec256_zero;
+  Hacl_Impl_SHA3_Vec256_absorb4(s,
+    rateInBytes,
+    inputByteLen,
+    input0,
+    input1,
+    input2,
+    input3,
+    delimitedSuffix);
+  Hacl_Impl_SHA3_Vec256_squeeze4(s,
+    rateInBytes,
+    outputByteLen,
+    output0,
+    output1,
+    output2,
+    output3);
+}
+
+void
+Hacl_SHA3_Vec256_shake128_4(
+  uint32_t inputByteLen,
+  uint8_t *input0,
+  uint8_t *input1,
+  uint8_t *input2,
+  uint8_t *input3,
+  uint32_t outputByteLen,
+  uint8_t *output0,
+  uint8_t *output1,
+  uint8_t *output2,
+  uint8_t *output3
+)
+{
+  Hacl_Impl_SHA3_Vec256_keccak4((uint32_t)1344U,
+    (uint32_t)256U,
+    inputByteLen,
+    input0,
+    input1,
+    input2,
+    input3,
+    (uint8_t)0x1FU,
+    outputByteLen,
+    output0,
+    output1,
+    output2,
+    output3);
+}
+
+void
+Hacl_SHA3_Vec256_shake256_4(
+  uint32_t inputByteLen,
+  uint8_t *input0,
+  uint8_t *input1,
+  uint8_t *input2,
+  uint8_t *input3,
+  uint32_t outputByteLen,
+  uint8_t *output0,
+  uint8_t *output1,
+  uint8_t *output2,
+  uint8_t *output3
+)
+{
+  Hacl_Impl_SHA3_Vec256_keccak4((uint32_t)1088U,
+    (uint32_t)512U,
+    inputByteLen,
+    input0,
+    input1,
+    input2,
+    input3,
+    (uint8_t)0x1FU,
+    outputByteLen,
+    output0,
+    output1,
+    output2,
+    output3);
+}
@@ -0,0 +1,131 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "evercrypt_targetconfig.h"
+#include "libintvector.h"
+#include "kremlin/internal/types.h"
+#include "kremlin/lowstar_endianness.h"
+#include <string.h>
+#include "kremlin/internal/target.h"
+
+#ifndef __Hacl_SHA3_Vec256_H
+#define __Hacl_SHA3_Vec256_H
+
+#include "Hacl_SHA3.h"
+#include "Hacl_Kremlib.h"
+
+
+/* Four independent Keccak-f[1600] states, interleaved lane by lane: s[i] holds
+   lane i of each of the four states. Requires AVX2. */
+void Hacl_Impl_SHA3_Vec256_state_permute4(Lib_IntVector_Intrinsics_vec256 *s);
+
+void
+Hacl_Impl_SHA3_Vec256_loadState4(
+  uint32_t rateInBytes,
+  uint8_t *b0,
+  uint8_t *b1,
+  uint8_t *b2,
+  uint8_t *b3,
+  Lib_IntVector_Intrinsics_vec256 *s
+);
+
+void
+Hacl_Impl_SHA3_Vec256_storeState4(
+  uint32_t rateInBytes,
+  Lib_IntVector_Intrinsics_vec256 *s,
+  uint8_t *b0,
+  uint8_t *b1,
+  uint8_t *b2,
+  uint8_t *b3
+);
+
+void
+Hacl_Impl_SHA3_Vec256_absorb4(
+  Lib_IntVector_Intrinsics_vec256 *s,
+  uint32_t rateInBytes,
+  uint32_t inputByteLen,
+  uint8_t *input0,
+  uint8_t *input1,
+  uint8_t *input2,
+  uint8_t *input3,
+  uint8_t delimitedSuffix
+);
+
+void
+Hacl_Impl_SHA3_Vec256_squeeze4(
+  Lib_IntVector_Intrinsics_vec256 *s,
+  uint32_t rateInBytes,
+  uint32_t outputByteLen,
+  uint8_t *output0,
+  uint8_t *output1,
+  uint8_t *output2,
+  uint8_t *output3
+);
+
+void
+Hacl_Impl_SHA3_Vec256_keccak4(
+  uint32_t rate,
+  uint32_t capacity,
+  uint32_t inputByteLen,
+  uint8_t *input0,
+  uint8_t *input1,
+  uint8_t *input2,
+  uint8_t *input3,
+  uint8_t delimitedSuffix,
+  uint32_t outputByteLen,
+  uint8_t *output0,
+  uint8_t *output1,
+  uint8_t *output2,
+  uint8_t *output3
+);
+
+void
+Hacl_SHA3_Vec256_shake128_4(
+  uint32_t inputByteLen,
+  uint8_t *input0,
+  uint8_t *input1,
+  uint8_t *input2,
+  uint8_t *input3,
+  uint32_t outputByteLen,
+  uint8_t *output0,
+  uint8_t *output1,
+  uint8_t *output2,
+  uint8_t *output3
+);
+
+void
+Hacl_SHA3_Vec256_shake256_4(
+  uint32_t inputByteLen,
+  uint8_t *input0,
+  uint8_t *input1,
+  uint8_t *input2,
+  uint8_t *input3,
+  uint32_t outputByteLen,
+  uint8_t *output0,
+  uint8_t *output1,
+  uint8_t *output2,
+  uint8_t *output3
+);
+
+#define __Hacl_SHA3_Vec256_H_DEFINED
+#endif
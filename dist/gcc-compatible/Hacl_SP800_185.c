@@ -0,0 +1,490 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "Hacl_SP800_185.h"
+
+typedef struct cshake_state_s
+{
+  uint64_t st[25U];
+  uint8_t buf[168U];
+  uint32_t rateInBytes;
+  uint32_t len;
+}
+cshake_state;
+
+static uint32_t left_encode(uint8_t *dst, uint64_t x)
+{
+  uint32_t n = (uint32_t)1U;
+  while (n < (uint32_t)8U && x >> (uint32_t)8U * n != (uint64_t)0U)
+  {
+    n = n + (uint32_t)1U;
+  }
+  dst[0U] = (uint8_t)n;
+  for (uint32_t i = (uint32_t)0U; i < n; i++)
+  {
+    dst[(uint32_t)1U + i] = (uint8_t)(x >> (uint32_t)8U * (n - (uint32_t)1U - i));
+  }
+  return n + (uint32_t)1U;
+}
+
+static uint32_t right_encode(uint8_t *dst, uint64_t x)
+{
+  uint32_t n = left_encode(dst, x) - (uint32_t)1U;
+  memmove(dst, dst + (uint32_t)1U, n * sizeof (dst[0U]));
+  dst[n] = (uint8_t)n;
+  return n + (uint32_t)1U;
+}
+
+static void cshake_update(cshake_state *p, uint32_t len, uint8_t *data)
+{
+  uint32_t rateInBytes = p->rateInBytes;
+  if (p->len > (uint32_t)0U)
+  {
+    uint32_t diff = rateInBytes - p->len;
+    uint32_t n = len < diff ? len : diff;
+    memcpy(p->buf + p->len, data, n * sizeof (data[0U]));
+    p->len = p->len + n;
+    data = data + n;
+    len = len - n;
+    if (p->len < rateInBytes)
+    {
+      return;
+    }
+    Hacl_Impl_SHA3_loadState(rateInBytes, p->buf, p->st);
+    Hacl_Impl_SHA3_state_permute(p->st);
+    p->len = (uint32_t)0U;
+  }
+  uint32_t nb = len / rateInBytes;
+  for (uint32_t i = (uint32_t)0U; i < nb; i++)
+  {
+    Hacl_Impl_SHA3_loadState(rateInBytes, data + i * rateInBytes, p->st);
+    Hacl_Impl_SHA3_state_permute(p->st);
+  }
+  uint32_t rem = len % rateInBytes;
+  memcpy(p->buf, data + nb * rateInBytes, rem * sizeof (data[0U]));
+  p->len = rem;
+}
+
+static void cshake_update_encoded(cshake_state *p, bool right, uint64_t x)
+{
+  uint8_t b[9U] = { 0U };
+  uint32_t n;
+  if (right)
+  {
+    n = right_encode(b, x);
+  }
+  else
+  {
+    n = left_encode(b, x);
+  }
+  cshake_update(p, n, b);
+}
+
+static void cshake_update_string(cshake_state *p, uint32_t len, uint8_t *s)
+{
+  cshake_update_encoded(p, false, (uint64_t)len * (uint64_t)8U);
+  cshake_update(p, len, s);
+}
+
+/* Zero-pads the buffered input up to the next block boundary (bytepad). */
+static void cshake_pad(cshake_state *p)
+{
+  if (p->len > (uint32_t)0U)
+  {
+    memset(p->buf + p->len, 0U, (p->rateInBytes - p->len) * sizeof (p->buf[0U]));
+    Hacl_Impl_SHA3_loadState(p->rateInBytes, p->buf, p->st);
+    Hacl_Impl_SHA3_state_permute(p->st);
+    p->len = (uint32_t)0U;
+  }
+}
+
+/* Returns the domain-separation suffix to use in cshake_finish: SHAKE when N
+   and S are both empty, cSHAKE otherwise. */
+static uint8_t
+cshake_init(
+  cshake_state *p,
+  uint32_t rateInBytes,
+  uint32_t nameByteLen,
+  uint8_t *name,
+  uint32_t customByteLen,
+  uint8_t *custom
+)
+{
+  memset(p->st, 0U, (uint32_t)25U * sizeof (p->st[0U]));
+  p->rateInBytes = rateInBytes;
+  p->len = (uint32_t)0U;
+  if (nameByteLen == (uint32_t)0U && customByteLen == (uint32_t)0U)
+  {
+    return (uint8_t)0x1FU;
+  }
+  cshake_update_encoded(p, false, (uint64_t)rateInBytes);
+  cshake_update_string(p, nameByteLen, name);
+  cshake_update_string(p, customByteLen, custom);
+  cshake_pad(p);
+  return (uint8_t)0x04U;
+}
+
+static void
+cshake_finish(cshake_state *p, uint8_t delimitedSuffix, uint32_t outputByteLen, uint8_t *output)
+{
+  uint32_t rateInBytes = p->rateInBytes;
+  memset(p->buf + p->len, 0U, (rateInBytes - p->len) * sizeof (p->buf[0U]));
+  p->buf[p->len] = delimitedSuffix;
+  p->buf[rateInBytes - (uint32_t)1U] = p->buf[rateInBytes - (uint32_t)1U] | (uint8_t)0x80U;
+  Hacl_Impl_SHA3_loadState(rateInBytes, p->buf, p->st);
+  Hacl_Impl_SHA3_state_permute(p->st);
+  Hacl_Impl_SHA3_squeeze(p->st, rateInBytes, outputByteLen, output);
+  Lib_Memzero0_memzero(p->st, (uint32_t)25U * sizeof (p->st[0U]));
+  Lib_Memzero0_memzero(p->buf, (uint32_t)168U * sizeof (p->buf[0U]));
+}
+
+static void
+cshake(
+  uint32_t rateInBytes,
+  uint32_t inputByteLen,
+  uint8_t *input,
+  uint32_t nameByteLen,
+  uint8_t *name,
+  uint32_t customByteLen,
+  uint8_t *custom,
+  uint32_t outputByteLen,
+  uint8_t *output
+)
+{
+  cshake_state p;
+  uint8_t suffix = cshake_init(&p, rateInBytes, nameByteLen, name, customByteLen, custom);
+  cshake_update(&p, inputByteLen, input);
+  cshake_finish(&p, suffix, outputByteLen, output);
+}
+
+static uint8_t kmac_name[4U] = { (uint8_t)0x4BU, (uint8_t)0x4DU, (uint8_t)0x41U, (uint8_t)0x43U };
+
+static void
+kmac(
+  uint32_t rateInBytes,
+  uint32_t keyByteLen,
+  uint8_t *key,
+  uint32_t inputByteLen,
+  uint8_t *input,
+  uint32_t customByteLen,
+  uint8_t *custom,
+  uint32_t outputByteLen,
+  uint8_t *output
+)
+{
+  cshake_state p;
+  uint8_t
+  suffix = cshake_init(&p, rateInBytes, (uint32_t)4U, kmac_name, customByteLen, custom);
+  cshake_update_encoded(&p, false, (uint64_t)rateInBytes);
+  cshake_update_string(&p, keyByteLen, key);
+  cshake_pad(&p);
+  cshake_update(&p, inputByteLen, input);
+  cshake_update_encoded(&p, true, (uint64_t)outputByteLen * (uint64_t)8U);
+  cshake_finish(&p, suffix, outputByteLen, output);
+}
+
+static uint8_t
+parallelhash_name[12U] =
+  {
+    (uint8_t)0x50U, (uint8_t)0x61U, (uint8_t)0x72U, (uint8_t)0x61U, (uint8_t)0x6CU, (uint8_t)0x6CU,
+    (uint8_t)0x65U, (uint8_t)0x6CU, (uint8_t)0x48U, (uint8_t)0x61U, (uint8_t)0x73U, (uint8_t)0x68U
+  };
+
+/* Each block X_i is hashed as cSHAKE(X_i, 2 * security, "", ""), i.e. with
+   SHAKE and a digest of twice the security level; rateInBytes selects between
+   ParallelHash128 (168, 32-byte digests) and ParallelHash256 (136, 64-byte
+   digests). With vec256, groups of four full blocks go through the 4-way
+   Keccak; the leftover blocks, including a trailing partial block, go through
+   the scalar one. Fails, leaving output untouched, if blockByteLen is 0: SP
+   800-185 requires B > 0. */
+static bool
+parallelhash(
+  bool vec256,
+  uint32_t rateInBytes,
+  uint32_t blockByteLen,
+  uint32_t inputByteLen,
+  uint8_t *input,
+  uint32_t customByteLen,
+  uint8_t *custom,
+  uint32_t outputByteLen,
+  uint8_t *output
+)
+{
+  if (blockByteLen == (uint32_t)0U)
+  {
+    return false;
+  }
+  uint32_t digestLen = (uint32_t)200U - rateInBytes;
+  uint32_t nb = inputByteLen / blockByteLen;
+  uint32_t rem = inputByteLen % blockByteLen;
+  uint32_t n = nb + (uint32_t)(rem > (uint32_t)0U);
+  uint8_t digests[256U] = { 0U };
+  cshake_state p;
+  uint8_t
+  suffix =
+    cshake_init(&p,
+      rateInBytes,
+      (uint32_t)12U,
+      parallelhash_name,
+      customByteLen,
+      custom);
+  cshake_update_encoded(&p, false, (uint64_t)blockByteLen);
+  uint32_t i = (uint32_t)0U;
+  if (vec256)
+  {
+    for (; i + (uint32_t)4U <= nb; i = i + (uint32_t)4U)
+    {
+      uint8_t *b = input + i * blockByteLen;
+      if (rateInBytes == (uint32_t)168U)
+      {
+        Hacl_SHA3_Vec256_shake128_4(blockByteLen,
+          b,
+          b + blockByteLen,
+          b + (uint32_t)2U * blockByteLen,
+          b + (uint32_t)3U * blockByteLen,
+          digestLen,
+          digests,
+          digests + digestLen,
+          digests + (uint32_t)2U * digestLen,
+          digests + (uint32_t)3U * digestLen);
+      }
+      else
+      {
+        Hacl_SHA3_Vec256_shake256_4(blockByteLen,
+          b,
+          b + blockByteLen,
+          b + (uint32_t)2U * blockByteLen,
+          b + (uint32_t)3U * blockByteLen,
+          digestLen,
+          digests,
+          digests + digestLen,
+          digests + (uint32_t)2U * digestLen,
+          digests + (uint32_t)3U * digestLen);
+      }
+      cshake_update(&p, (uint32_t)4U * digestLen, digests);
+    }
+  }
+  for (; i < n; i++)
+  {
+    uint8_t *b = input + i * blockByteLen;
+    uint32_t len = i < nb ? blockByteLen : rem;
+    Hacl_Impl_SHA3_keccak((uint32_t)8U * rateInBytes,
+      (uint32_t)1600U - (uint32_t)8U * rateInBytes,
+      len,
+      b,
+      (uint8_t)0x1FU,
+      digestLen,
+      digests);
+    cshake_update(&p, digestLen, digests);
+  }
+  cshake_update_encoded(&p, true, (uint64_t)n);
+  cshake_update_encoded(&p, true, (uint64_t)outputByteLen * (uint64_t)8U);
+  cshake_finish(&p, suffix, outputByteLen, output);
+  Lib_Memzero0_memzero(digests, (uint32_t)256U * sizeof (digests[0U]));
+  return true;
+}
+
+void
+Hacl_SP800_185_cshake128(
+  uint32_t inputByteLen,
+  uint8_t *input,
+  uint32_t nameByteLen,
+  uint8_t *name,
+  uint32_t customByteLen,
+  uint8_t *custom,
+  uint32_t outputByteLen,
+  uint8_t *output
+)
+{
+  cshake((uint32_t)168U,
+    inputByteLen,
+    input,
+    nameByteLen,
+    name,
+    customByteLen,
+    custom,
+    outputByteLen,
+    output);
+}
+
+void
+Hacl_SP800_185_cshake256(
+  uint32_t inputByteLen,
+  uint8_t *input,
+  uint32_t nameByteLen,
+  uint8_t *name,
+  uint32_t customByteLen,
+  uint8_t *custom,
+  uint32_t outputByteLen,
+  uint8_t *output
+)
+{
+  cshake((uint32_t)136U,
+    inputByteLen,
+    input,
+    nameByteLen,
+    name,
+    customByteLen,
+    custom,
+    outputByteLen,
+    output);
+}
+
+void
+Hacl_SP800_185_kmac128(
+  uint32_t keyByteLen,
+  uint8_t *key,
+  uint32_t inputByteLen,
+  uint8_t *input,
+  uint32_t customByteLen,
+  uint8_t *custom,
+  uint32_t outputByteLen,
+  uint8_t *output
+)
+{
+  kmac((uint32_t)168U,
+    keyByteLen,
+    key,
+    inputByteLen,
+    input,
+    customByteLen,
+    custom,
+    outputByteLen,
+    output);
+}
+
+void
+Hacl_SP800_185_kmac256(
+  uint32_t keyByteLen,
+  uint8_t *key,
+  uint32_t inputByteLen,
+  uint8_t *input,
+  uint32_t customByteLen,
+  uint8_t *custom,
+  uint32_t outputByteLen,
+  uint8_t *output
+)
+{
+  kmac((uint32_t)136U,
+    keyByteLen,
+    key,
+    inputByteLen,
+    input,
+    customByteLen,
+    custom,
+    outputByteLen,
+    output);
+}
+
+bool
+Hacl_SP800_185_parallelhash128(
+  uint32_t blockByteLen,
+  uint32_t inputByteLen,
+  uint8_t *input,
+  uint32_t customByteLen,
+  uint8_t *custom,
+  uint32_t outputByteLen,
+  uint8_t *output
+)
+{
+  return
+    parallelhash(false,
+      (uint32_t)168U,
+      blockByteLen,
+      inputByteLen,
+      input,
+      customByteLen,
+      custom,
+      outputByteLen,
+      output);
+}
+
+bool
+Hacl_SP800_185_parallelhash256(
+  uint32_t blockByteLen,
+  uint32_t inputByteLen,
+  uint8_t *input,
+  uint32_t customByteLen,
+  uint8_t *custom,
+  uint32_t outputByteLen,
+  uint8_t *output
+)
+{
+  return
+    parallelhash(false,
+      (uint32_t)136U,
+      blockByteLen,
+      inputByteLen,
+      input,
+      customByteLen,
+      custom,
+      outputByteLen,
+      output);
+}
+
+bool
+Hacl_SP800_185_parallelhash128_vec256(
+  uint32_t blockByteLen,
+  uint32_t inputByteLen,
+  uint8_t *input,
+  uint32_t customByteLen,
+  uint8_t *custom,
+  uint32_t outputByteLen,
+  uint8_t *output
+)
+{
+  return
+    parallelhash(true,
+      (uint32_t)168U,
+      blockByteLen,
+      inputByteLen,
+      input,
+      customByteLen,
+      custom,
+      outputByteLen,
+      output);
+}
+
+bool
+Hacl_SP800_185_parallelhash256_vec256(
+  uint32_t blockByteLen,
+  uint32_t inputByteLen,
+  uint8_t *input,
+  uint32_t customByteLen,
+  uint8_t *custom,
+  uint32_t outputByteLen,
+  uint8_t *output
+)
+{
+  return
+    parallelhash(true,
+      (uint32_t)136U,
+      blockByteLen,
+      inputByteLen,
+      input,
+      customByteLen,
+      custom,
+      outputByteLen,
+      output);
+}
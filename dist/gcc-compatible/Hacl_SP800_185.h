@@ -0,0 +1,142 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "evercrypt_targetconfig.h"
+#include "libintvector.h"
+#include "kremlin/internal/types.h"
+#include "kremlin/lowstar_endianness.h"
+#include <string.h>
+#include "kremlin/internal/target.h"
+
+#ifndef __Hacl_SP800_185_H
+#define __Hacl_SP800_185_H
+
+#include "Hacl_SHA3.h"
+#include "Hacl_SHA3_Vec256.h"
+#include "Hacl_Kremlib.h"
+
+
+/* NIST SP 800-185 derived functions over the Keccak core of Hacl_SHA3.
+
+   All output lengths are in bytes; the encoded output length L is
+   8 * outputByteLen bits. When both the function name and the customization
+   string are empty, cSHAKE is SHAKE, as per the standard. */
+void
+Hacl_SP800_185_cshake128(
+  uint32_t inputByteLen,
+  uint8_t *input,
+  uint32_t nameByteLen,
+  uint8_t *name,
+  uint32_t customByteLen,
+  uint8_t *custom,
+  uint32_t outputByteLen,
+  uint8_t *output
+);
+
+void
+Hacl_SP800_185_cshake256(
+  uint32_t inputByteLen,
+  uint8_t *input,
+  uint32_t nameByteLen,
+  uint8_t *name,
+  uint32_t customByteLen,
+  uint8_t *custom,
+  uint32_t outputByteLen,
+  uint8_t *output
+);
+
+void
+Hacl_SP800_185_kmac128(
+  uint32_t keyByteLen,
+  uint8_t *key,
+  uint32_t inputByteLen,
+  uint8_t *input,
+  uint32_t customByteLen,
+  uint8_t *custom,
+  uint32_t outputByteLen,
+  uint8_t *output
+);
+
+void
+Hacl_SP800_185_kmac256(
+  uint32_t keyByteLen,
+  uint8_t *key,
+  uint32_t inputByteLen,
+  uint8_t *input,
+  uint32_t customByteLen,
+  uint8_t *custom,
+  uint32_t outputByteLen,
+  uint8_t *output
+);
+
+/* blockByteLen is the ParallelHash block size B, in bytes. SP 800-185 requires
+   B > 0: with blockByteLen = 0, these return false and leave output untouched;
+   they return true otherwise. */
+bool
+Hacl_SP800_185_parallelhash128(
+  uint32_t blockByteLen,
+  uint32_t inputByteLen,
+  uint8_t *input,
+  uint32_t customByteLen,
+  uint8_t *custom,
+  uint32_t outputByteLen,
+  uint8_t *output
+);
+
+bool
+Hacl_SP800_185_parallelhash256(
+  uint32_t blockByteLen,
+  uint32_t inputByteLen,
+  uint8_t *input,
+  uint32_t customByteLen,
+  uint8_t *custom,
+  uint32_t outputByteLen,
+  uint8_t *output
+);
+
+/* Same as above, but hashes the blocks four at a time with Hacl_SHA3_Vec256.
+   Requires AVX2. */
+bool
+Hacl_SP800_185_parallelhash128_vec256(
+  uint32_t blockByteLen,
+  uint32_t inputByteLen,
+  uint8_t *input,
+  uint32_t customByteLen,
+  uint8_t *custom,
+  uint32_t outputByteLen,
+  uint8_t *output
+);
+
+bool
+Hacl_SP800_185_parallelhash256_vec256(
+  uint32_t blockByteLen,
+  uint32_t inputByteLen,
+  uint8_t *input,
+  uint32_t customByteLen,
+  uint8_t *custom,
+  uint32_t outputByteLen,
+  uint8_t *output
+);
+
+#define __Hacl_SP800_185_H_DEFINED
+#endif
@@ -41,6 +41,30 @@ Spec_Cipher_Expansion_cipher_alg_of_impl(Spec_Cipher_Expansion_impl i)
       {
         return Spec_Agile_Cipher_AES256;
       }
+    case Spec_Cipher_Expansion_Hacl_AES128:
+      {
+        return Spec_Agile_Cipher_AES128;
+      }
+    case Spec_Cipher_Expansion_Hacl_AES256:
+      {
+        return Spec_Agile_Cipher_AES256;
+      }
+    case Spec_Cipher_Expansion_Hacl_AES128_NI:
+      {
+        return Spec_Agile_Cipher_AES128;
+      }
+    case Spec_Cipher_Expansion_Hacl_AES256_NI:
+      {
+        return Spec_Agile_Cipher_AES256;
+      }
+    case Spec_Cipher_Expansion_Hacl_XCHACHA20:
+      {
+        return Spec_Agile_Cipher_CHACHA20;
+      }
+    case Spec_Cipher_Expansion_Hacl_AES256_SIV_NI:
+      {
+        return Spec_Agile_Cipher_AES256;
+      }
     default:
       {
         KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
@@ -64,6 +64,12 @@ typedef uint8_t Spec_Agile_Cipher_cipher_alg;
 #define Spec_Cipher_Expansion_Hacl_CHACHA20 0
 #define Spec_Cipher_Expansion_Vale_AES128 1
 #define Spec_Cipher_Expansion_Vale_AES256 2
+#define Spec_Cipher_Expansion_Hacl_AES128 3
+#define Spec_Cipher_Expansion_Hacl_AES256 4
+#define Spec_Cipher_Expansion_Hacl_AES128_NI 5
+#define Spec_Cipher_Expansion_Hacl_AES256_NI 6
+#define Spec_Cipher_Expansion_Hacl_XCHACHA20 7
+#define Spec_Cipher_Expansion_Hacl_AES256_SIV_NI 8
 
 typedef uint8_t Spec_Cipher_Expansion_impl;
 
@@ -77,6 +83,8 @@ Spec_Cipher_Expansion_cipher_alg_of_impl(Spec_Cipher_Expansion_impl i);
 #define Spec_Agile_AEAD_AES256_CCM 4
 #define Spec_Agile_AEAD_AES128_CCM8 5
 #define Spec_Agile_AEAD_AES256_CCM8 6
+#define Spec_Agile_AEAD_XCHACHA20_POLY1305 7
+#define Spec_Agile_AEAD_AES256_GCM_SIV 8
 
 typedef uint8_t Spec_Agile_AEAD_alg;
 
@@ -66,6 +66,22 @@ Spec_Agile_AEAD_alg EverCrypt_AEAD_alg_of_state(EverCrypt_AEAD_state_s *s)
       {
         return Spec_Agile_AEAD_AES256_GCM;
       }
+    case Spec_Cipher_Expansion_Hacl_AES128:
+      {
+        return Spec_Agile_AEAD_AES128_GCM;
+      }
+    case Spec_Cipher_Expansion_Hacl_AES256:
+      {
+        return Spec_Agile_AEAD_AES256_GCM;
+      }
+    case Spec_Cipher_Expansion_Hacl_AES128_NI:
+      {
+        return Spec_Agile_AEAD_AES128_GCM;
+      }
+    case Spec_Cipher_Expansion_Hacl_AES256_NI:
+      {
+        return Spec_Agile_AEAD_AES256_GCM;
+      }
     default:
       {
         KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
@@ -94,10 +110,11 @@ create_in_aes128_gcm(EverCrypt_AEAD_state_s **dst, uint8_t *k)
   bool has_avx = EverCrypt_AutoConfig2_has_avx();
   bool has_sse = EverCrypt_AutoConfig2_has_sse();
   bool has_movbe = EverCrypt_AutoConfig2_has_movbe();
+  bool vale = EverCrypt_AutoConfig2_wants_vale();
   #if EVERCRYPT_TARGETCONFIG_X64
-  if (has_aesni && has_pclmulqdq && has_avx && has_sse && has_movbe)
+  if (has_aesni && has_pclmulqdq && has_avx && has_sse && has_movbe && vale)
   {
-    uint8_t *ek = KRML_HOST_CALLOC((uint32_t)480U, sizeof (uint8_t));
+    uint8_t *ek = KRML_HOST_CALLOC((uint32_t)304U, sizeof (uint8_t));
     uint8_t *keys_b = ek;
     uint8_t *hkeys_b = ek + (uint32_t)176U;
     uint64_t scrut = aes128_key_expansion(k, keys_b);
@@ -109,7 +126,30 @@ create_in_aes128_gcm(EverCrypt_AEAD_state_s **dst, uint8_t *k)
     return EverCrypt_Error_Success;
   }
   #endif
-  return EverCrypt_Error_UnsupportedAlgorithm;
+  /* Without Vale (not compiled in, as on x86, or disabled), or without the other extensions that
+     it needs, AES-NI and PCLMULQDQ are still used through Hacl_AES_GCM_NI. Its expanded key has
+     the size of the Vale one. */
+  #if EVERCRYPT_TARGETCONFIG_X64 || EVERCRYPT_TARGETCONFIG_X86
+  if (has_aesni && has_pclmulqdq && has_sse)
+  {
+    uint8_t *ek = KRML_HOST_CALLOC((uint32_t)304U, sizeof (uint8_t));
+    Hacl_AES_GCM_NI_key_expansion((uint32_t)10U, k, ek);
+    KRML_CHECK_SIZE(sizeof (EverCrypt_AEAD_state_s), (uint32_t)1U);
+    EverCrypt_AEAD_state_s *p = KRML_HOST_MALLOC(sizeof (EverCrypt_AEAD_state_s));
+    p[0U] = ((EverCrypt_AEAD_state_s){ .impl = Spec_Cipher_Expansion_Hacl_AES128_NI, .ek = ek });
+    *dst = p;
+    return EverCrypt_Error_Success;
+  }
+  #endif
+  /* Elsewhere, fall back onto the portable, constant-time Hacl_AES_GCM_CT. Its key schedule is
+     smaller than the Vale expanded key. */
+  uint8_t *ek = KRML_HOST_CALLOC((uint32_t)176U, sizeof (uint8_t));
+  Hacl_AES_GCM_CT_key_expansion((uint32_t)10U, k, ek);
+  KRML_CHECK_SIZE(sizeof (EverCrypt_AEAD_state_s), (uint32_t)1U);
+  EverCrypt_AEAD_state_s *p = KRML_HOST_MALLOC(sizeof (EverCrypt_AEAD_state_s));
+  p[0U] = ((EverCrypt_AEAD_state_s){ .impl = Spec_Cipher_Expansion_Hacl_AES128, .ek = ek });
+  *dst = p;
+  return EverCrypt_Error_Success;
 }
 
 static EverCrypt_Error_error_code
@@ -120,10 +160,11 @@ create_in_aes256_gcm(EverCrypt_AEAD_state_s **dst, uint8_t *k)
   bool has_avx = EverCrypt_AutoConfig2_has_avx();
   bool has_sse = EverCrypt_AutoConfig2_has_sse();
   bool has_movbe = EverCrypt_AutoConfig2_has_movbe();
+  bool vale = EverCrypt_AutoConfig2_wants_vale();
   #if EVERCRYPT_TARGETCONFIG_X64
-  if (has_aesni && has_pclmulqdq && has_avx && has_sse && has_movbe)
+  if (has_aesni && has_pclmulqdq && has_avx && has_sse && has_movbe && vale)
   {
-    uint8_t *ek = KRML_HOST_CALLOC((uint32_t)544U, sizeof (uint8_t));
+    uint8_t *ek = KRML_HOST_CALLOC((uint32_t)368U, sizeof (uint8_t));
     uint8_t *keys_b = ek;
     uint8_t *hkeys_b = ek + (uint32_t)240U;
     uint64_t scrut = aes256_key_expansion(k, keys_b);
@@ -135,7 +176,25 @@ create_in_aes256_gcm(EverCrypt_AEAD_state_s **dst, uint8_t *k)
     return EverCrypt_Error_Success;
   }
   #endif
-  return EverCrypt_Error_UnsupportedAlgorithm;
+  #if EVERCRYPT_TARGETCONFIG_X64 || EVERCRYPT_TARGETCONFIG_X86
+  if (has_aesni && has_pclmulqdq && has_sse)
+  {
+    uint8_t *ek = KRML_HOST_CALLOC((uint32_t)368U, sizeof (uint8_t));
+    Hacl_AES_GCM_NI_key_expansion((uint32_t)14U, k, ek);
+    KRML_CHECK_SIZE(sizeof (EverCrypt_AEAD_state_s), (uint32_t)1U);
+    EverCrypt_AEAD_state_s *p = KRML_HOST_MALLOC(sizeof (EverCrypt_AEAD_state_s));
+    p[0U] = ((EverCrypt_AEAD_state_s){ .impl = Spec_Cipher_Expansion_Hacl_AES256_NI, .ek = ek });
+    *dst = p;
+    return EverCrypt_Error_Success;
+  }
+  #endif
+  uint8_t *ek = KRML_HOST_CALLOC((uint32_t)240U, sizeof (uint8_t));
+  Hacl_AES_GCM_CT_key_expansion((uint32_t)14U, k, ek);
+  KRML_CHECK_SIZE(sizeof (EverCrypt_AEAD_state_s), (uint32_t)1U);
+  EverCrypt_AEAD_state_s *p = KRML_HOST_MALLOC(sizeof (EverCrypt_AEAD_state_s));
+  p[0U] = ((EverCrypt_AEAD_state_s){ .impl = Spec_Cipher_Expansion_Hacl_AES256, .ek = ek });
+  *dst = p;
+  return EverCrypt_Error_Success;
 }
 
 EverCrypt_Error_error_code
@@ -186,7 +245,7 @@ encrypt_aes128_gcm(
   }
   EverCrypt_AEAD_state_s scrut = *s;
   uint8_t *ek = scrut.ek;
-  uint8_t *scratch_b = ek + (uint32_t)304U;
+  uint8_t scratch_b[176U] = { 0U };
   uint8_t *ek1 = ek;
   uint8_t *keys_b = ek1;
   uint8_t *hkeys_b = ek1 + (uint32_t)176U;
@@ -308,7 +367,7 @@ encrypt_aes256_gcm(
   }
   EverCrypt_AEAD_state_s scrut = *s;
   uint8_t *ek = scrut.ek;
-  uint8_t *scratch_b = ek + (uint32_t)368U;
+  uint8_t scratch_b[176U] = { 0U };
   uint8_t *ek1 = ek;
   uint8_t *keys_b = ek1;
   uint8_t *hkeys_b = ek1 + (uint32_t)240U;
@@ -406,6 +465,74 @@ encrypt_aes256_gcm(
   #endif
 }
 
+/* The portable AES-GCM, for machines without the Vale AES-NI/PCLMULQDQ path: the whole
+   message goes through the streaming Hacl_AES_GCM_CT in a single chunk. */
+static EverCrypt_Error_error_code
+encrypt_aes_gcm_ct(
+  EverCrypt_AEAD_state_s *s,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint8_t *ad,
+  uint32_t ad_len,
+  uint8_t *plain,
+  uint32_t plain_len,
+  uint8_t *cipher,
+  uint8_t *tag
+)
+{
+  if (iv_len == (uint32_t)0U)
+  {
+    return EverCrypt_Error_InvalidIVLength;
+  }
+  EverCrypt_AEAD_state_s scrut = *s;
+  uint32_t nr = (uint32_t)10U;
+  if (scrut.impl == Spec_Cipher_Expansion_Hacl_AES256)
+  {
+    nr = (uint32_t)14U;
+  }
+  Hacl_AES_GCM_CT_state st;
+  Hacl_AES_GCM_CT_init(&st, nr, scrut.ek, iv, iv_len);
+  Hacl_AES_GCM_CT_aad(&st, ad_len, ad);
+  Hacl_AES_GCM_CT_encrypt(&st, plain_len, cipher, plain);
+  Hacl_AES_GCM_CT_finish(&st, tag);
+  Lib_Memzero0_memzero(&st, sizeof (st));
+  return EverCrypt_Error_Success;
+}
+
+/* AES-NI and PCLMULQDQ without Vale: the streaming Hacl_AES_GCM_NI, started from the powers of
+   H in the expanded key. */
+static EverCrypt_Error_error_code
+encrypt_aes_gcm_ni(
+  EverCrypt_AEAD_state_s *s,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint8_t *ad,
+  uint32_t ad_len,
+  uint8_t *plain,
+  uint32_t plain_len,
+  uint8_t *cipher,
+  uint8_t *tag
+)
+{
+  if (iv_len == (uint32_t)0U)
+  {
+    return EverCrypt_Error_InvalidIVLength;
+  }
+  EverCrypt_AEAD_state_s scrut = *s;
+  uint32_t nr = (uint32_t)10U;
+  if (scrut.impl == Spec_Cipher_Expansion_Hacl_AES256_NI)
+  {
+    nr = (uint32_t)14U;
+  }
+  Hacl_AES_GCM_NI_state st;
+  Hacl_AES_GCM_NI_init_expanded(&st, nr, scrut.ek, iv, iv_len);
+  Hacl_AES_GCM_NI_aad(&st, ad_len, ad);
+  Hacl_AES_GCM_NI_encrypt(&st, plain_len, cipher, plain);
+  Hacl_AES_GCM_NI_finish(&st, tag);
+  Lib_Memzero0_memzero(&st, sizeof (st));
+  return EverCrypt_Error_Success;
+}
+
 EverCrypt_Error_error_code
 EverCrypt_AEAD_encrypt(
   EverCrypt_AEAD_state_s *s,
@@ -436,6 +563,16 @@ EverCrypt_AEAD_encrypt(
       {
         return encrypt_aes256_gcm(s, iv, iv_len, ad, ad_len, plain, plain_len, cipher, tag);
       }
+    case Spec_Cipher_Expansion_Hacl_AES128:
+    case Spec_Cipher_Expansion_Hacl_AES256:
+      {
+        return encrypt_aes_gcm_ct(s, iv, iv_len, ad, ad_len, plain, plain_len, cipher, tag);
+      }
+    case Spec_Cipher_Expansion_Hacl_AES128_NI:
+    case Spec_Cipher_Expansion_Hacl_AES256_NI:
+      {
+        return encrypt_aes_gcm_ni(s, iv, iv_len, ad, ad_len, plain, plain_len, cipher, tag);
+      }
     case Spec_Cipher_Expansion_Hacl_CHACHA20:
       {
         if (iv_len != (uint32_t)12U)
@@ -471,8 +608,9 @@ EverCrypt_AEAD_encrypt_expand_aes128_gcm(
   bool has_sse = EverCrypt_AutoConfig2_has_sse();
   bool has_movbe = EverCrypt_AutoConfig2_has_movbe();
   bool has_aesni = EverCrypt_AutoConfig2_has_aesni();
+  bool vale = EverCrypt_AutoConfig2_wants_vale();
   #if EVERCRYPT_TARGETCONFIG_X64
-  if (has_aesni && has_pclmulqdq && has_avx && has_sse && has_movbe)
+  if (has_aesni && has_pclmulqdq && has_avx && has_sse && has_movbe && vale)
   {
     uint8_t ek[480U] = { 0U };
     uint8_t *keys_b0 = ek;
@@ -589,7 +727,19 @@ EverCrypt_AEAD_encrypt_expand_aes128_gcm(
     return EverCrypt_Error_Success;
   }
   #endif
-  return EverCrypt_Error_UnsupportedAlgorithm;
+  #if EVERCRYPT_TARGETCONFIG_X64 || EVERCRYPT_TARGETCONFIG_X86
+  if (has_aesni && has_pclmulqdq && has_sse)
+  {
+    uint8_t ek[304U] = { 0U };
+    Hacl_AES_GCM_NI_key_expansion((uint32_t)10U, k, ek);
+    EverCrypt_AEAD_state_s p = { .impl = Spec_Cipher_Expansion_Hacl_AES128_NI, .ek = ek };
+    return encrypt_aes_gcm_ni(&p, iv, iv_len, ad, ad_len, plain, plain_len, cipher, tag);
+  }
+  #endif
+  uint8_t ek[176U] = { 0U };
+  Hacl_AES_GCM_CT_key_expansion((uint32_t)10U, k, ek);
+  EverCrypt_AEAD_state_s p = { .impl = Spec_Cipher_Expansion_Hacl_AES128, .ek = ek };
+  return encrypt_aes_gcm_ct(&p, iv, iv_len, ad, ad_len, plain, plain_len, cipher, tag);
 }
 
 EverCrypt_Error_error_code
@@ -610,8 +760,9 @@ EverCrypt_AEAD_encrypt_expand_aes256_gcm(
   bool has_sse = EverCrypt_AutoConfig2_has_sse();
   bool has_movbe = EverCrypt_AutoConfig2_has_movbe();
   bool has_aesni = EverCrypt_AutoConfig2_has_aesni();
+  bool vale = EverCrypt_AutoConfig2_wants_vale();
   #if EVERCRYPT_TARGETCONFIG_X64
-  if (has_aesni && has_pclmulqdq && has_avx && has_sse && has_movbe)
+  if (has_aesni && has_pclmulqdq && has_avx && has_sse && has_movbe && vale)
   {
     uint8_t ek[544U] = { 0U };
     uint8_t *keys_b0 = ek;
@@ -728,7 +879,19 @@ EverCrypt_AEAD_encrypt_expand_aes256_gcm(
     return EverCrypt_Error_Success;
   }
   #endif
-  return EverCrypt_Error_UnsupportedAlgorithm;
+  #if EVERCRYPT_TARGETCONFIG_X64 || EVERCRYPT_TARGETCONFIG_X86
+  if (has_aesni && has_pclmulqdq && has_sse)
+  {
+    uint8_t ek[368U] = { 0U };
+    Hacl_AES_GCM_NI_key_expansion((uint32_t)14U, k, ek);
+    EverCrypt_AEAD_state_s p = { .impl = Spec_Cipher_Expansion_Hacl_AES256_NI, .ek = ek };
+    return encrypt_aes_gcm_ni(&p, iv, iv_len, ad, ad_len, plain, plain_len, cipher, tag);
+  }
+  #endif
+  uint8_t ek[240U] = { 0U };
+  Hacl_AES_GCM_CT_key_expansion((uint32_t)14U, k, ek);
+  EverCrypt_AEAD_state_s p = { .impl = Spec_Cipher_Expansion_Hacl_AES256, .ek = ek };
+  return encrypt_aes_gcm_ct(&p, iv, iv_len, ad, ad_len, plain, plain_len, cipher, tag);
 }
 
 EverCrypt_Error_error_code
@@ -841,7 +1004,7 @@ decrypt_aes128_gcm(
   }
   EverCrypt_AEAD_state_s scrut = *s;
   uint8_t *ek = scrut.ek;
-  uint8_t *scratch_b = ek + (uint32_t)304U;
+  uint8_t scratch_b[176U] = { 0U };
   uint8_t *ek1 = ek;
   uint8_t *keys_b = ek1;
   uint8_t *hkeys_b = ek1 + (uint32_t)176U;
@@ -973,7 +1136,7 @@ decrypt_aes256_gcm(
   }
   EverCrypt_AEAD_state_s scrut = *s;
   uint8_t *ek = scrut.ek;
-  uint8_t *scratch_b = ek + (uint32_t)368U;
+  uint8_t scratch_b[176U] = { 0U };
   uint8_t *ek1 = ek;
   uint8_t *keys_b = ek1;
   uint8_t *hkeys_b = ek1 + (uint32_t)240U;
@@ -1113,6 +1276,96 @@ decrypt_chacha20_poly1305(
   return EverCrypt_Error_AuthenticationFailure;
 }
 
+/* Decrypts into dst before checking the tag, and wipes dst if it does not match. */
+static EverCrypt_Error_error_code
+decrypt_aes_gcm_ct(
+  EverCrypt_AEAD_state_s *s,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint8_t *ad,
+  uint32_t ad_len,
+  uint8_t *cipher,
+  uint32_t cipher_len,
+  uint8_t *tag,
+  uint8_t *dst
+)
+{
+  if (iv_len == (uint32_t)0U)
+  {
+    return EverCrypt_Error_InvalidIVLength;
+  }
+  EverCrypt_AEAD_state_s scrut = *s;
+  uint32_t nr = (uint32_t)10U;
+  if (scrut.impl == Spec_Cipher_Expansion_Hacl_AES256)
+  {
+    nr = (uint32_t)14U;
+  }
+  uint8_t computed_tag[16U] = { 0U };
+  Hacl_AES_GCM_CT_state st;
+  Hacl_AES_GCM_CT_init(&st, nr, scrut.ek, iv, iv_len);
+  Hacl_AES_GCM_CT_aad(&st, ad_len, ad);
+  Hacl_AES_GCM_CT_decrypt(&st, cipher_len, dst, cipher);
+  Hacl_AES_GCM_CT_finish(&st, computed_tag);
+  Lib_Memzero0_memzero(&st, sizeof (st));
+  uint8_t res = (uint8_t)255U;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+  {
+    uint8_t uu____0 = FStar_UInt8_eq_mask(computed_tag[i], tag[i]);
+    res = uu____0 & res;
+  }
+  if (res == (uint8_t)255U)
+  {
+    return EverCrypt_Error_Success;
+  }
+  Lib_Memzero0_memzero(dst, cipher_len);
+  return EverCrypt_Error_AuthenticationFailure;
+}
+
+/* As decrypt_aes_gcm_ct, with Hacl_AES_GCM_NI. */
+static EverCrypt_Error_error_code
+decrypt_aes_gcm_ni(
+  EverCrypt_AEAD_state_s *s,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint8_t *ad,
+  uint32_t ad_len,
+  uint8_t *cipher,
+  uint32_t cipher_len,
+  uint8_t *tag,
+  uint8_t *dst
+)
+{
+  if (iv_len == (uint32_t)0U)
+  {
+    return EverCrypt_Error_InvalidIVLength;
+  }
+  EverCrypt_AEAD_state_s scrut = *s;
+  uint32_t nr = (uint32_t)10U;
+  if (scrut.impl == Spec_Cipher_Expansion_Hacl_AES256_NI)
+  {
+    nr = (uint32_t)14U;
+  }
+  uint8_t computed_tag[16U] = { 0U };
+  Hacl_AES_GCM_NI_state st;
+  Hacl_AES_GCM_NI_init_expanded(&st, nr, scrut.ek, iv, iv_len);
+  Hacl_AES_GCM_NI_aad(&st, ad_len, ad);
+  Hacl_AES_GCM_NI_decrypt(&st, cipher_len, dst, cipher);
+  Hacl_AES_GCM_NI_finish(&st, computed_tag);
+  Lib_Memzero0_memzero(&st, sizeof (st));
+  uint8_t res = (uint8_t)255U;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+  {
+    uint8_t uu____0 = FStar_UInt8_eq_mask(computed_tag[i], tag[i]);
+    res = uu____0 & res;
+  }
+  if (res == (uint8_t)255U)
+  {
+    return EverCrypt_Error_Success;
+  }
+  Lib_Memzero0_memzero(dst, cipher_len);
+  return EverCrypt_Error_AuthenticationFailure;
+}
+
 EverCrypt_Error_error_code
 EverCrypt_AEAD_decrypt(
   EverCrypt_AEAD_state_s *s,
@@ -1142,6 +1395,16 @@ EverCrypt_AEAD_decrypt(
       {
         return decrypt_aes256_gcm(s, iv, iv_len, ad, ad_len, cipher, cipher_len, tag, dst);
       }
+    case Spec_Cipher_Expansion_Hacl_AES128:
+    case Spec_Cipher_Expansion_Hacl_AES256:
+      {
+        return decrypt_aes_gcm_ct(s, iv, iv_len, ad, ad_len, cipher, cipher_len, tag, dst);
+      }
+    case Spec_Cipher_Expansion_Hacl_AES128_NI:
+    case Spec_Cipher_Expansion_Hacl_AES256_NI:
+      {
+        return decrypt_aes_gcm_ni(s, iv, iv_len, ad, ad_len, cipher, cipher_len, tag, dst);
+      }
     case Spec_Cipher_Expansion_Hacl_CHACHA20:
       {
         return decrypt_chacha20_poly1305(s, iv, iv_len, ad, ad_len, cipher, cipher_len, tag, dst);
@@ -1172,8 +1435,9 @@ EverCrypt_AEAD_decrypt_expand_aes128_gcm(
   bool has_sse = EverCrypt_AutoConfig2_has_sse();
   bool has_movbe = EverCrypt_AutoConfig2_has_movbe();
   bool has_aesni = EverCrypt_AutoConfig2_has_aesni();
+  bool vale = EverCrypt_AutoConfig2_wants_vale();
   #if EVERCRYPT_TARGETCONFIG_X64
-  if (has_aesni && has_pclmulqdq && has_avx && has_sse && has_movbe)
+  if (has_aesni && has_pclmulqdq && has_avx && has_sse && has_movbe && vale)
   {
     uint8_t ek[480U] = { 0U };
     uint8_t *keys_b0 = ek;
@@ -1301,7 +1565,19 @@ EverCrypt_AEAD_decrypt_expand_aes128_gcm(
     }
   }
   #endif
-  return EverCrypt_Error_UnsupportedAlgorithm;
+  #if EVERCRYPT_TARGETCONFIG_X64 || EVERCRYPT_TARGETCONFIG_X86
+  if (has_aesni && has_pclmulqdq && has_sse)
+  {
+    uint8_t ek[304U] = { 0U };
+    Hacl_AES_GCM_NI_key_expansion((uint32_t)10U, k, ek);
+    EverCrypt_AEAD_state_s p = { .impl = Spec_Cipher_Expansion_Hacl_AES128_NI, .ek = ek };
+    return decrypt_aes_gcm_ni(&p, iv, iv_len, ad, ad_len, cipher, cipher_len, tag, dst);
+  }
+  #endif
+  uint8_t ek[176U] = { 0U };
+  Hacl_AES_GCM_CT_key_expansion((uint32_t)10U, k, ek);
+  EverCrypt_AEAD_state_s p = { .impl = Spec_Cipher_Expansion_Hacl_AES128, .ek = ek };
+  return decrypt_aes_gcm_ct(&p, iv, iv_len, ad, ad_len, cipher, cipher_len, tag, dst);
 }
 
 EverCrypt_Error_error_code
@@ -1322,8 +1598,9 @@ EverCrypt_AEAD_decrypt_expand_aes256_gcm(
   bool has_sse = EverCrypt_AutoConfig2_has_sse();
   bool has_movbe = EverCrypt_AutoConfig2_has_movbe();
   bool has_aesni = EverCrypt_AutoConfig2_has_aesni();
+  bool vale = EverCrypt_AutoConfig2_wants_vale();
   #if EVERCRYPT_TARGETCONFIG_X64
-  if (has_aesni && has_pclmulqdq && has_avx && has_sse && has_movbe)
+  if (has_aesni && has_pclmulqdq && has_avx && has_sse && has_movbe && vale)
   {
     uint8_t ek[544U] = { 0U };
     uint8_t *keys_b0 = ek;
@@ -1451,7 +1728,19 @@ EverCrypt_AEAD_decrypt_expand_aes256_gcm(
     }
   }
   #endif
-  return EverCrypt_Error_UnsupportedAlgorithm;
+  #if EVERCRYPT_TARGETCONFIG_X64 || EVERCRYPT_TARGETCONFIG_X86
+  if (has_aesni && has_pclmulqdq && has_sse)
+  {
+    uint8_t ek[368U] = { 0U };
+    Hacl_AES_GCM_NI_key_expansion((uint32_t)14U, k, ek);
+    EverCrypt_AEAD_state_s p = { .impl = Spec_Cipher_Expansion_Hacl_AES256_NI, .ek = ek };
+    return decrypt_aes_gcm_ni(&p, iv, iv_len, ad, ad_len, cipher, cipher_len, tag, dst);
+  }
+  #endif
+  uint8_t ek[240U] = { 0U };
+  Hacl_AES_GCM_CT_key_expansion((uint32_t)14U, k, ek);
+  EverCrypt_AEAD_state_s p = { .impl = Spec_Cipher_Expansion_Hacl_AES256, .ek = ek };
+  return decrypt_aes_gcm_ct(&p, iv, iv_len, ad, ad_len, cipher, cipher_len, tag, dst);
 }
 
 EverCrypt_Error_error_code
@@ -97,7 +97,7 @@ create_in_aes128_gcm(EverCrypt_AEAD_state_s **dst, uint8_t *k)
   #if EVERCRYPT_TARGETCONFIG_X64
   if (has_aesni && has_pclmulqdq && has_avx && has_sse && has_movbe)
   {
-    uint8_t *ek = KRML_HOST_CALLOC((uint32_t)480U, sizeof (uint8_t));
+    uint8_t *ek = KRML_HOST_CALLOC((uint32_t)304U, sizeof (uint8_t));
     uint8_t *keys_b = ek;
     uint8_t *hkeys_b = ek + (uint32_t)176U;
     uint64_t scrut = aes128_key_expansion(k, keys_b);
@@ -123,7 +123,7 @@ create_in_aes256_gcm(EverCrypt_AEAD_state_s **dst, uint8_t *k)
   #if EVERCRYPT_TARGETCONFIG_X64
   if (has_aesni && has_pclmulqdq && has_avx && has_sse && has_movbe)
   {
-    uint8_t *ek = KRML_HOST_CALLOC((uint32_t)544U, sizeof (uint8_t));
+    uint8_t *ek = KRML_HOST_CALLOC((uint32_t)368U, sizeof (uint8_t));
     uint8_t *keys_b = ek;
     uint8_t *hkeys_b = ek + (uint32_t)240U;
     uint64_t scrut = aes256_key_expansion(k, keys_b);
@@ -186,7 +186,7 @@ encrypt_aes128_gcm(
   }
   EverCrypt_AEAD_state_s scrut = *s;
   uint8_t *ek = scrut.ek;
-  uint8_t *scratch_b = ek + (uint32_t)304U;
+  uint8_t scratch_b[176U] = { 0U };
   uint8_t *ek1 = ek;
   uint8_t *keys_b = ek1;
   uint8_t *hkeys_b = ek1 + (uint32_t)176U;
@@ -308,7 +308,7 @@ encrypt_aes256_gcm(
   }
   EverCrypt_AEAD_state_s scrut = *s;
   uint8_t *ek = scrut.ek;
-  uint8_t *scratch_b = ek + (uint32_t)368U;
+  uint8_t scratch_b[176U] = { 0U };
   uint8_t *ek1 = ek;
   uint8_t *keys_b = ek1;
   uint8_t *hkeys_b = ek1 + (uint32_t)240U;
@@ -474,7 +474,7 @@ EverCrypt_AEAD_encrypt_expand_aes128_gcm(
   #if EVERCRYPT_TARGETCONFIG_X64
   if (has_aesni && has_pclmulqdq && has_avx && has_sse && has_movbe)
   {
-    uint8_t ek[480U] = { 0U };
+    uint8_t ek[304U] = { 0U };
     uint8_t *keys_b0 = ek;
     uint8_t *hkeys_b0 = ek + (uint32_t)176U;
     uint64_t scrut0 = aes128_key_expansion(k, keys_b0);
@@ -494,7 +494,7 @@ EverCrypt_AEAD_encrypt_expand_aes128_gcm(
     {
       EverCrypt_AEAD_state_s scrut = *s;
       uint8_t *ek0 = scrut.ek;
-      uint8_t *scratch_b = ek0 + (uint32_t)304U;
+      uint8_t scratch_b[176U] = { 0U };
       uint8_t *ek1 = ek0;
       uint8_t *keys_b = ek1;
       uint8_t *hkeys_b = ek1 + (uint32_t)176U;
@@ -613,7 +613,7 @@ EverCrypt_AEAD_encrypt_expand_aes256_gcm(
   #if EVERCRYPT_TARGETCONFIG_X64
   if (has_aesni && has_pclmulqdq && has_avx && has_sse && has_movbe)
   {
-    uint8_t ek[544U] = { 0U };
+    uint8_t ek[368U] = { 0U };
     uint8_t *keys_b0 = ek;
     uint8_t *hkeys_b0 = ek + (uint32_t)240U;
     uint64_t scrut0 = aes256_key_expansion(k, keys_b0);
@@ -633,7 +633,7 @@ EverCrypt_AEAD_encrypt_expand_aes256_gcm(
     {
       EverCrypt_AEAD_state_s scrut = *s;
       uint8_t *ek0 = scrut.ek;
-      uint8_t *scratch_b = ek0 + (uint32_t)368U;
+      uint8_t scratch_b[176U] = { 0U };
       uint8_t *ek1 = ek0;
       uint8_t *keys_b = ek1;
       uint8_t *hkeys_b = ek1 + (uint32_t)240U;
@@ -817,6 +817,191 @@ EverCrypt_AEAD_encrypt_expand(
   }
 }
 
+static uint64_t iov_length(uint32_t cnt, EverCrypt_Helpers_iovec *v)
+{
+  uint64_t len = (uint64_t)0U;
+  for (uint32_t i = (uint32_t)0U; i < cnt; i++)
+  {
+    len = len + (uint64_t)v[i].len;
+  }
+  return len;
+}
+
+/* Runs the bytes of in through st, in chunks that fit both the current input and output
+   segments. The caller has checked that both lists have the same total length. */
+static void
+gcm_iov(
+  Hacl_AES_GCM_NI_state *st,
+  bool enc,
+  uint32_t out_cnt,
+  EverCrypt_Helpers_iovec *out,
+  uint32_t in_cnt,
+  EverCrypt_Helpers_iovec *in
+)
+{
+  uint32_t i = (uint32_t)0U;
+  uint32_t j = (uint32_t)0U;
+  uint32_t in_off = (uint32_t)0U;
+  uint32_t out_off = (uint32_t)0U;
+  while (i < in_cnt && j < out_cnt)
+  {
+    uint32_t len = in[i].len - in_off;
+    if (out[j].len - out_off < len)
+    {
+      len = out[j].len - out_off;
+    }
+    if (enc)
+    {
+      Hacl_AES_GCM_NI_encrypt(st, len, out[j].base + out_off, in[i].base + in_off);
+    }
+    else
+    {
+      Hacl_AES_GCM_NI_decrypt(st, len, out[j].base + out_off, in[i].base + in_off);
+    }
+    in_off = in_off + len;
+    out_off = out_off + len;
+    if (in_off == in[i].len)
+    {
+      i++;
+      in_off = (uint32_t)0U;
+    }
+    if (out_off == out[j].len)
+    {
+      j++;
+      out_off = (uint32_t)0U;
+    }
+  }
+}
+
+/* The Vale AES-GCM kernels only take contiguous buffers, so scattered messages go through
+   the streaming AES-NI/PCLMULQDQ code instead, with the same round keys. */
+static EverCrypt_Error_error_code
+crypt_iov_aes_gcm(
+  EverCrypt_AEAD_state_s *s,
+  bool enc,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint32_t ad_cnt,
+  EverCrypt_Helpers_iovec *ad,
+  uint32_t in_cnt,
+  EverCrypt_Helpers_iovec *in,
+  uint32_t out_cnt,
+  EverCrypt_Helpers_iovec *out,
+  uint8_t *tag
+)
+{
+  #if EVERCRYPT_TARGETCONFIG_X64
+  if (iv_len == (uint32_t)0U)
+  {
+    return EverCrypt_Error_InvalidIVLength;
+  }
+  EverCrypt_AEAD_state_s scrut = *s;
+  uint32_t nr = (uint32_t)10U;
+  if (scrut.impl == Spec_Cipher_Expansion_Vale_AES256)
+  {
+    nr = (uint32_t)14U;
+  }
+  Hacl_AES_GCM_NI_state st;
+  Hacl_AES_GCM_NI_init_vale(&st, nr, scrut.ek, iv, iv_len);
+  for (uint32_t i = (uint32_t)0U; i < ad_cnt; i++)
+  {
+    Hacl_AES_GCM_NI_aad(&st, ad[i].len, ad[i].base);
+  }
+  gcm_iov(&st, enc, out_cnt, out, in_cnt, in);
+  Hacl_AES_GCM_NI_finish(&st, tag);
+  Lib_Memzero0_memzero(&st, sizeof (st));
+  return EverCrypt_Error_Success;
+  #else
+  KRML_HOST_EPRINTF("KreMLin abort at %s:%d\n%s\n",
+    __FILE__,
+    __LINE__,
+    "statically unreachable");
+  KRML_HOST_EXIT(255U);
+  #endif
+}
+
+EverCrypt_Error_error_code
+EverCrypt_AEAD_encrypt_iov(
+  EverCrypt_AEAD_state_s *s,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint32_t ad_cnt,
+  EverCrypt_Helpers_iovec *ad,
+  uint32_t plain_cnt,
+  EverCrypt_Helpers_iovec *plain,
+  uint32_t cipher_cnt,
+  EverCrypt_Helpers_iovec *cipher,
+  uint8_t *tag
+)
+{
+  if (s == NULL)
+  {
+    return EverCrypt_Error_InvalidKey;
+  }
+  if (iov_length(plain_cnt, plain) != iov_length(cipher_cnt, cipher))
+  {
+    return EverCrypt_Error_DecodeError;
+  }
+  EverCrypt_AEAD_state_s scrut = *s;
+  Spec_Cipher_Expansion_impl i = scrut.impl;
+  uint8_t *ek = scrut.ek;
+  switch (i)
+  {
+    case Spec_Cipher_Expansion_Vale_AES128:
+      {
+        return
+          crypt_iov_aes_gcm(s,
+            true,
+            iv,
+            iv_len,
+            ad_cnt,
+            ad,
+            plain_cnt,
+            plain,
+            cipher_cnt,
+            cipher,
+            tag);
+      }
+    case Spec_Cipher_Expansion_Vale_AES256:
+      {
+        return
+          crypt_iov_aes_gcm(s,
+            true,
+            iv,
+            iv_len,
+            ad_cnt,
+            ad,
+            plain_cnt,
+            plain,
+            cipher_cnt,
+            cipher,
+            tag);
+      }
+    case Spec_Cipher_Expansion_Hacl_CHACHA20:
+      {
+        if (iv_len != (uint32_t)12U)
+        {
+          return EverCrypt_Error_InvalidIVLength;
+        }
+        EverCrypt_Chacha20Poly1305_aead_encrypt_iov(ek,
+          iv,
+          ad_cnt,
+          ad,
+          plain_cnt,
+          plain,
+          cipher_cnt,
+          cipher,
+          tag);
+        return EverCrypt_Error_Success;
+      }
+    default:
+      {
+        KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
+        KRML_HOST_EXIT(253U);
+      }
+  }
+}
+
 static EverCrypt_Error_error_code
 decrypt_aes128_gcm(
   EverCrypt_AEAD_state_s *s,
@@ -841,7 +1026,7 @@ decrypt_aes128_gcm(
   }
   EverCrypt_AEAD_state_s scrut = *s;
   uint8_t *ek = scrut.ek;
-  uint8_t *scratch_b = ek + (uint32_t)304U;
+  uint8_t scratch_b[176U] = { 0U };
   uint8_t *ek1 = ek;
   uint8_t *keys_b = ek1;
   uint8_t *hkeys_b = ek1 + (uint32_t)176U;
@@ -973,7 +1158,7 @@ decrypt_aes256_gcm(
   }
   EverCrypt_AEAD_state_s scrut = *s;
   uint8_t *ek = scrut.ek;
-  uint8_t *scratch_b = ek + (uint32_t)368U;
+  uint8_t scratch_b[176U] = { 0U };
   uint8_t *ek1 = ek;
   uint8_t *keys_b = ek1;
   uint8_t *hkeys_b = ek1 + (uint32_t)240U;
@@ -1175,7 +1360,7 @@ EverCrypt_AEAD_decrypt_expand_aes128_gcm(
   #if EVERCRYPT_TARGETCONFIG_X64
   if (has_aesni && has_pclmulqdq && has_avx && has_sse && has_movbe)
   {
-    uint8_t ek[480U] = { 0U };
+    uint8_t ek[304U] = { 0U };
     uint8_t *keys_b0 = ek;
     uint8_t *hkeys_b0 = ek + (uint32_t)176U;
     uint64_t scrut = aes128_key_expansion(k, keys_b0);
@@ -1194,7 +1379,7 @@ EverCrypt_AEAD_decrypt_expand_aes128_gcm(
     {
       EverCrypt_AEAD_state_s scrut1 = *s;
       uint8_t *ek0 = scrut1.ek;
-      uint8_t *scratch_b = ek0 + (uint32_t)304U;
+      uint8_t scratch_b[176U] = { 0U };
       uint8_t *ek1 = ek0;
       uint8_t *keys_b = ek1;
       uint8_t *hkeys_b = ek1 + (uint32_t)176U;
@@ -1325,7 +1510,7 @@ EverCrypt_AEAD_decrypt_expand_aes256_gcm(
   #if EVERCRYPT_TARGETCONFIG_X64
   if (has_aesni && has_pclmulqdq && has_avx && has_sse && has_movbe)
   {
-    uint8_t ek[544U] = { 0U };
+    uint8_t ek[368U] = { 0U };
     uint8_t *keys_b0 = ek;
     uint8_t *hkeys_b0 = ek + (uint32_t)240U;
     uint64_t scrut = aes256_key_expansion(k, keys_b0);
@@ -1344,7 +1529,7 @@ EverCrypt_AEAD_decrypt_expand_aes256_gcm(
     {
       EverCrypt_AEAD_state_s scrut1 = *s;
       uint8_t *ek0 = scrut1.ek;
-      uint8_t *scratch_b = ek0 + (uint32_t)368U;
+      uint8_t scratch_b[176U] = { 0U };
       uint8_t *ek1 = ek0;
       uint8_t *keys_b = ek1;
       uint8_t *hkeys_b = ek1 + (uint32_t)240U;
@@ -1539,6 +1724,180 @@ EverCrypt_AEAD_decrypt_expand(
   }
 }
 
+EverCrypt_Error_error_code
+EverCrypt_AEAD_decrypt_iov(
+  EverCrypt_AEAD_state_s *s,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint32_t ad_cnt,
+  EverCrypt_Helpers_iovec *ad,
+  uint32_t cipher_cnt,
+  EverCrypt_Helpers_iovec *cipher,
+  uint8_t *tag,
+  uint32_t dst_cnt,
+  EverCrypt_Helpers_iovec *dst
+)
+{
+  if (s == NULL)
+  {
+    return EverCrypt_Error_InvalidKey;
+  }
+  if (iov_length(cipher_cnt, cipher) != iov_length(dst_cnt, dst))
+  {
+    return EverCrypt_Error_DecodeError;
+  }
+  EverCrypt_AEAD_state_s scrut = *s;
+  Spec_Cipher_Expansion_impl i = scrut.impl;
+  uint8_t *ek = scrut.ek;
+  if (i == Spec_Cipher_Expansion_Hacl_CHACHA20)
+  {
+    if (iv_len != (uint32_t)12U)
+    {
+      return EverCrypt_Error_InvalidIVLength;
+    }
+    uint32_t
+    r =
+      EverCrypt_Chacha20Poly1305_aead_decrypt_iov(ek,
+        iv,
+        ad_cnt,
+        ad,
+        dst_cnt,
+        dst,
+        cipher_cnt,
+        cipher,
+        tag);
+    if (r == (uint32_t)0U)
+    {
+      return EverCrypt_Error_Success;
+    }
+    return EverCrypt_Error_AuthenticationFailure;
+  }
+  uint8_t computed_tag[16U] = { 0U };
+  EverCrypt_Error_error_code
+  r =
+    crypt_iov_aes_gcm(s,
+      false,
+      iv,
+      iv_len,
+      ad_cnt,
+      ad,
+      cipher_cnt,
+      cipher,
+      dst_cnt,
+      dst,
+      computed_tag);
+  if (r != EverCrypt_Error_Success)
+  {
+    return r;
+  }
+  uint8_t res = (uint8_t)255U;
+  for (uint32_t i0 = (uint32_t)0U; i0 < (uint32_t)16U; i0++)
+  {
+    uint8_t uu____0 = FStar_UInt8_eq_mask(computed_tag[i0], tag[i0]);
+    res = uu____0 & res;
+  }
+  if (res == (uint8_t)255U)
+  {
+    return EverCrypt_Error_Success;
+  }
+  for (uint32_t i0 = (uint32_t)0U; i0 < dst_cnt; i0++)
+  {
+    Lib_Memzero0_memzero(dst[i0].base, dst[i0].len);
+  }
+  return EverCrypt_Error_AuthenticationFailure;
+}
+
+static EverCrypt_Error_error_code
+crypt_batch(
+  bool enc,
+  uint32_t num,
+  EverCrypt_AEAD_state_s **s,
+  uint8_t **iv,
+  uint32_t iv_len,
+  uint8_t **ad,
+  uint32_t *ad_len,
+  uint8_t **in,
+  uint32_t *len,
+  uint8_t **out,
+  uint8_t **tag,
+  EverCrypt_Error_error_code *res
+)
+{
+  for (uint32_t j = (uint32_t)0U; j < num; j++)
+  {
+    if (enc)
+    {
+      res[j] =
+        EverCrypt_AEAD_encrypt(s[j],
+          iv[j],
+          iv_len,
+          ad[j],
+          ad_len[j],
+          in[j],
+          len[j],
+          out[j],
+          tag[j]);
+    }
+    else
+    {
+      res[j] =
+        EverCrypt_AEAD_decrypt(s[j],
+          iv[j],
+          iv_len,
+          ad[j],
+          ad_len[j],
+          in[j],
+          len[j],
+          tag[j],
+          out[j]);
+    }
+  }
+  for (uint32_t j = (uint32_t)0U; j < num; j++)
+  {
+    if (res[j] != EverCrypt_Error_Success)
+    {
+      return res[j];
+    }
+  }
+  return EverCrypt_Error_Success;
+}
+
+EverCrypt_Error_error_code
+EverCrypt_AEAD_encrypt_batch(
+  uint32_t num,
+  EverCrypt_AEAD_state_s **s,
+  uint8_t **iv,
+  uint32_t iv_len,
+  uint8_t **ad,
+  uint32_t *ad_len,
+  uint8_t **plain,
+  uint32_t *plain_len,
+  uint8_t **cipher,
+  uint8_t **tag,
+  EverCrypt_Error_error_code *res
+)
+{
+  return crypt_batch(true, num, s, iv, iv_len, ad, ad_len, plain, plain_len, cipher, tag, res);
+}
+
+EverCrypt_Error_error_code
+EverCrypt_AEAD_decrypt_batch(
+  uint32_t num,
+  EverCrypt_AEAD_state_s **s,
+  uint8_t **iv,
+  uint32_t iv_len,
+  uint8_t **ad,
+  uint32_t *ad_len,
+  uint8_t **cipher,
+  uint32_t *cipher_len,
+  uint8_t **tag,
+  uint8_t **dst,
+  EverCrypt_Error_error_code *res
+)
+{
+  return crypt_batch(false, num, s, iv, iv_len, ad, ad_len, cipher, cipher_len, dst, tag, res);
+}
+
 void EverCrypt_AEAD_free(EverCrypt_AEAD_state_s *s)
 {
   EverCrypt_AEAD_state_s scrut = *s;
@@ -37,6 +37,8 @@
 #include "EverCrypt_AutoConfig2.h"
 #include "EverCrypt_Error.h"
 #include "Hacl_Spec.h"
+#include "Hacl_AES_GCM_NI.h"
+#include "EverCrypt_Helpers.h"
 
 
 typedef struct EverCrypt_AEAD_state_s_s EverCrypt_AEAD_state_s;
@@ -54,6 +56,9 @@ Spec_Agile_AEAD_alg EverCrypt_AEAD_alg_of_state(EverCrypt_AEAD_state_s *s);
 EverCrypt_Error_error_code
 EverCrypt_AEAD_create_in(Spec_Agile_AEAD_alg a, EverCrypt_AEAD_state_s **dst, uint8_t *k);
 
+/* Encrypts the plain_len bytes of plain into cipher and writes the 16-byte tag to tag.
+   cipher may be plain itself, to encrypt in place, e.g. within a packet buffer; buffers that
+   overlap only partially are not supported. The same holds for the _expand variants. */
 EverCrypt_Error_error_code
 EverCrypt_AEAD_encrypt(
   EverCrypt_AEAD_state_s *s,
@@ -120,6 +125,29 @@ EverCrypt_AEAD_encrypt_expand(
   uint8_t *tag
 );
 
+/* Like EverCrypt_AEAD_encrypt, but the additional data, the plaintext and the ciphertext
+   are lists of segments, so that scattered packets need not be copied into one buffer.
+   Segment boundaries need not line up between plain and cipher; their total lengths must be
+   equal, or EverCrypt_Error_DecodeError is returned. */
+EverCrypt_Error_error_code
+EverCrypt_AEAD_encrypt_iov(
+  EverCrypt_AEAD_state_s *s,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint32_t ad_cnt,
+  EverCrypt_Helpers_iovec *ad,
+  uint32_t plain_cnt,
+  EverCrypt_Helpers_iovec *plain,
+  uint32_t cipher_cnt,
+  EverCrypt_Helpers_iovec *cipher,
+  uint8_t *tag
+);
+
+/* Decrypts the cipher_len bytes of cipher into dst, provided tag authenticates them together
+   with ad. dst may be cipher itself, to decrypt in place; buffers that overlap only partially
+   are not supported. When EverCrypt_Error_AuthenticationFailure is returned, the contents of
+   dst are unspecified: in particular, decrypting in place does not preserve the ciphertext.
+   The same holds for the _expand variants. */
 EverCrypt_Error_error_code
 EverCrypt_AEAD_decrypt(
   EverCrypt_AEAD_state_s *s,
@@ -186,6 +214,58 @@ EverCrypt_AEAD_decrypt_expand(
   uint8_t *dst
 );
 
+/* Like EverCrypt_AEAD_decrypt, over lists of segments. The ciphertext is decrypted in the
+   same pass that authenticates it: if the tag does not match, every byte of dst is zeroed
+   before EverCrypt_Error_AuthenticationFailure is returned. */
+EverCrypt_Error_error_code
+EverCrypt_AEAD_decrypt_iov(
+  EverCrypt_AEAD_state_s *s,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint32_t ad_cnt,
+  EverCrypt_Helpers_iovec *ad,
+  uint32_t cipher_cnt,
+  EverCrypt_Helpers_iovec *cipher,
+  uint8_t *tag,
+  uint32_t dst_cnt,
+  EverCrypt_Helpers_iovec *dst
+);
+
+/* Encrypts num independent packets, each under its own key s[i] and IV iv[i], into cipher[i]
+   and tag[i]. In this configuration AES-GCM runs on Vale, whose kernels are fastest one packet
+   at a time, so the packets are encrypted one by one. Sets res[i] to the result of packet i,
+   and returns EverCrypt_Error_Success or the first error among them. */
+EverCrypt_Error_error_code
+EverCrypt_AEAD_encrypt_batch(
+  uint32_t num,
+  EverCrypt_AEAD_state_s **s,
+  uint8_t **iv,
+  uint32_t iv_len,
+  uint8_t **ad,
+  uint32_t *ad_len,
+  uint8_t **plain,
+  uint32_t *plain_len,
+  uint8_t **cipher,
+  uint8_t **tag,
+  EverCrypt_Error_error_code *res
+);
+
+/* The batch counterpart of EverCrypt_AEAD_decrypt. */
+EverCrypt_Error_error_code
+EverCrypt_AEAD_decrypt_batch(
+  uint32_t num,
+  EverCrypt_AEAD_state_s **s,
+  uint8_t **iv,
+  uint32_t iv_len,
+  uint8_t **ad,
+  uint32_t *ad_len,
+  uint8_t **cipher,
+  uint32_t *cipher_len,
+  uint8_t **tag,
+  uint8_t **dst,
+  EverCrypt_Error_error_code *res
+);
+
 void EverCrypt_AEAD_free(EverCrypt_AEAD_state_s *s);
 
 #define __EverCrypt_AEAD_H_DEFINED
@@ -32,11 +32,15 @@
 #define __EverCrypt_Chacha20Poly1305_H
 
 #include "EverCrypt_AutoConfig2.h"
+#include "EverCrypt_Helpers.h"
+#include "Lib_Memzero0.h"
 #include "Hacl_Chacha20Poly1305_128.h"
 #include "Hacl_Chacha20Poly1305_32.h"
 #include "Hacl_Chacha20Poly1305_256.h"
 
 
+/* Dispatches to the widest Hacl_Chacha20Poly1305 implementation the CPU supports. As
+   there, cipher may be m itself, and m is not written when decryption fails. */
 void
 EverCrypt_Chacha20Poly1305_aead_encrypt(
   uint8_t *k,
@@ -61,5 +65,37 @@ EverCrypt_Chacha20Poly1305_aead_decrypt(
   uint8_t *tag
 );
 
+/* Like EverCrypt_Chacha20Poly1305_aead_encrypt, but the additional data, the message and
+   the ciphertext are lists of segments. Segment boundaries need not line up between m and
+   cipher, whose total lengths must be equal. */
+void
+EverCrypt_Chacha20Poly1305_aead_encrypt_iov(
+  uint8_t *k,
+  uint8_t *n,
+  uint32_t aad_cnt,
+  EverCrypt_Helpers_iovec *aad,
+  uint32_t m_cnt,
+  EverCrypt_Helpers_iovec *m,
+  uint32_t cipher_cnt,
+  EverCrypt_Helpers_iovec *cipher,
+  uint8_t *tag
+);
+
+/* Like EverCrypt_Chacha20Poly1305_aead_decrypt, over lists of segments. The message is
+   decrypted in the same pass that authenticates it; if the tag does not match, 1 is
+   returned and every byte of m is zeroed. */
+uint32_t
+EverCrypt_Chacha20Poly1305_aead_decrypt_iov(
+  uint8_t *k,
+  uint8_t *n,
+  uint32_t aad_cnt,
+  EverCrypt_Helpers_iovec *aad,
+  uint32_t m_cnt,
+  EverCrypt_Helpers_iovec *m,
+  uint32_t cipher_cnt,
+  EverCrypt_Helpers_iovec *cipher,
+  uint8_t *tag
+);
+
 #define __EverCrypt_Chacha20Poly1305_H_DEFINED
 #endif
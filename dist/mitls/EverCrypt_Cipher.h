@@ -31,9 +31,14 @@
 #ifndef __EverCrypt_Cipher_H
 #define __EverCrypt_Cipher_H
 
+#include "EverCrypt_AutoConfig2.h"
 #include "Hacl_Chacha20.h"
+#include "Hacl_Chacha20_Vec128.h"
+#include "Hacl_Chacha20_Vec256.h"
 
 
+/* Uses the 128-bit or 256-bit vectorized implementation when the CPU supports it and len
+   spans enough blocks to benefit from it. dst may be src itself. */
 void
 EverCrypt_Cipher_chacha20(
   uint32_t len,
@@ -44,5 +49,11 @@ EverCrypt_Cipher_chacha20(
   uint32_t ctr
 );
 
+/* Computes n ChaCha20 header-protection masks (RFC 9001, 5.4.4) under key: the 16-byte
+   sample at samples + 16 i yields the 5-byte mask at masks + 5 i. Up to 8 samples are
+   processed per vectorized call of the ChaCha20 core. */
+void
+EverCrypt_Cipher_chacha20_hp_masks(uint32_t n, uint8_t *masks, uint8_t *key, uint8_t *samples);
+
 #define __EverCrypt_Cipher_H_DEFINED
 #endif
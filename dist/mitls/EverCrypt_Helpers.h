@@ -50,5 +50,13 @@ typedef uint32_t *EverCrypt_Helpers_uint32_p;
 
 typedef uint64_t *EverCrypt_Helpers_uint64_p;
 
+/* One segment of a scattered buffer, as taken by the _iov variants of the AEAD functions. */
+typedef struct EverCrypt_Helpers_iovec_s
+{
+  uint8_t *base;
+  uint32_t len;
+}
+EverCrypt_Helpers_iovec;
+
 #define __EverCrypt_Helpers_H_DEFINED
 #endif
@@ -0,0 +1,573 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "Hacl_AES_GCM_NI.h"
+
+#if EVERCRYPT_TARGETCONFIG_X64
+
+/* GHASH operands are kept byte-reversed (as loaded by vec128_load_be), so that the
+   carry-less products are computed on whole 64-bit lanes. The 256-bit products of several
+   blocks are summed before a single reduction. */
+
+static inline void
+clmul_wide(
+  Lib_IntVector_Intrinsics_vec128 a,
+  Lib_IntVector_Intrinsics_vec128 b,
+  Lib_IntVector_Intrinsics_vec128 *lo,
+  Lib_IntVector_Intrinsics_vec128 *mid,
+  Lib_IntVector_Intrinsics_vec128 *hi
+)
+{
+  lo[0U] =
+    Lib_IntVector_Intrinsics_vec128_xor(lo[0U],
+      Lib_IntVector_Intrinsics_ni_clmul(a, b, 0x00));
+  mid[0U] =
+    Lib_IntVector_Intrinsics_vec128_xor(mid[0U],
+      Lib_IntVector_Intrinsics_vec128_xor(Lib_IntVector_Intrinsics_ni_clmul(a, b, 0x01),
+        Lib_IntVector_Intrinsics_ni_clmul(a, b, 0x10)));
+  hi[0U] =
+    Lib_IntVector_Intrinsics_vec128_xor(hi[0U],
+      Lib_IntVector_Intrinsics_ni_clmul(a, b, 0x11));
+}
+
+static inline Lib_IntVector_Intrinsics_vec128
+reduce(
+  Lib_IntVector_Intrinsics_vec128 lo,
+  Lib_IntVector_Intrinsics_vec128 mid,
+  Lib_IntVector_Intrinsics_vec128 hi
+)
+{
+  Lib_IntVector_Intrinsics_vec128
+  l = Lib_IntVector_Intrinsics_vec128_xor(lo, Lib_IntVector_Intrinsics_vec128_shift_left(mid, 64));
+  Lib_IntVector_Intrinsics_vec128
+  h = Lib_IntVector_Intrinsics_vec128_xor(hi, Lib_IntVector_Intrinsics_vec128_shift_right(mid, 64));
+  /* The operands are bit-reflected: shift the product left by one. */
+  Lib_IntVector_Intrinsics_vec128 lc = Lib_IntVector_Intrinsics_vec128_shift_right32(l, 31);
+  Lib_IntVector_Intrinsics_vec128 hc = Lib_IntVector_Intrinsics_vec128_shift_right32(h, 31);
+  Lib_IntVector_Intrinsics_vec128 c = Lib_IntVector_Intrinsics_vec128_shift_right(lc, 96);
+  l =
+    Lib_IntVector_Intrinsics_vec128_or(Lib_IntVector_Intrinsics_vec128_shift_left32(l, 1),
+      Lib_IntVector_Intrinsics_vec128_shift_left(lc, 32));
+  h =
+    Lib_IntVector_Intrinsics_vec128_or(Lib_IntVector_Intrinsics_vec128_shift_left32(h, 1),
+      Lib_IntVector_Intrinsics_vec128_shift_left(hc, 32));
+  h = Lib_IntVector_Intrinsics_vec128_or(h, c);
+  /* Reduce modulo x^128 + x^7 + x^2 + x + 1. */
+  Lib_IntVector_Intrinsics_vec128
+  a =
+    Lib_IntVector_Intrinsics_vec128_xor(Lib_IntVector_Intrinsics_vec128_shift_left32(l, 31),
+      Lib_IntVector_Intrinsics_vec128_xor(Lib_IntVector_Intrinsics_vec128_shift_left32(l, 30),
+        Lib_IntVector_Intrinsics_vec128_shift_left32(l, 25)));
+  Lib_IntVector_Intrinsics_vec128 b = Lib_IntVector_Intrinsics_vec128_shift_right(a, 32);
+  l = Lib_IntVector_Intrinsics_vec128_xor(l, Lib_IntVector_Intrinsics_vec128_shift_left(a, 96));
+  Lib_IntVector_Intrinsics_vec128
+  d =
+    Lib_IntVector_Intrinsics_vec128_xor(Lib_IntVector_Intrinsics_vec128_shift_right32(l, 1),
+      Lib_IntVector_Intrinsics_vec128_xor(Lib_IntVector_Intrinsics_vec128_shift_right32(l, 2),
+        Lib_IntVector_Intrinsics_vec128_shift_right32(l, 7)));
+  d = Lib_IntVector_Intrinsics_vec128_xor(d, b);
+  l = Lib_IntVector_Intrinsics_vec128_xor(l, d);
+  return Lib_IntVector_Intrinsics_vec128_xor(h, l);
+}
+
+static inline Lib_IntVector_Intrinsics_vec128
+gf128_mul(Lib_IntVector_Intrinsics_vec128 a, Lib_IntVector_Intrinsics_vec128 b)
+{
+  Lib_IntVector_Intrinsics_vec128 lo = Lib_IntVector_Intrinsics_vec128_zero;
+  Lib_IntVector_Intrinsics_vec128 mid = Lib_IntVector_Intrinsics_vec128_zero;
+  Lib_IntVector_Intrinsics_vec128 hi = Lib_IntVector_Intrinsics_vec128_zero;
+  clmul_wide(a, b, &lo, &mid, &hi);
+  return reduce(lo, mid, hi);
+}
+
+/* acc = (acc + x0) * H^4 + x1 * H^3 + x2 * H^2 + x3 * H, for four consecutive blocks. */
+static inline Lib_IntVector_Intrinsics_vec128
+ghash4(
+  Lib_IntVector_Intrinsics_vec128 *h,
+  Lib_IntVector_Intrinsics_vec128 acc,
+  Lib_IntVector_Intrinsics_vec128 x0,
+  Lib_IntVector_Intrinsics_vec128 x1,
+  Lib_IntVector_Intrinsics_vec128 x2,
+  Lib_IntVector_Intrinsics_vec128 x3
+)
+{
+  Lib_IntVector_Intrinsics_vec128 lo = Lib_IntVector_Intrinsics_vec128_zero;
+  Lib_IntVector_Intrinsics_vec128 mid = Lib_IntVector_Intrinsics_vec128_zero;
+  Lib_IntVector_Intrinsics_vec128 hi = Lib_IntVector_Intrinsics_vec128_zero;
+  clmul_wide(Lib_IntVector_Intrinsics_vec128_xor(acc, x0), h[3U], &lo, &mid, &hi);
+  clmul_wide(x1, h[2U], &lo, &mid, &hi);
+  clmul_wide(x2, h[1U], &lo, &mid, &hi);
+  clmul_wide(x3, h[0U], &lo, &mid, &hi);
+  return reduce(lo, mid, hi);
+}
+
+/* Absorbs blocks of data; len is a multiple of 16. */
+static inline Lib_IntVector_Intrinsics_vec128
+ghash_blocks(
+  Lib_IntVector_Intrinsics_vec128 *h,
+  Lib_IntVector_Intrinsics_vec128 acc,
+  uint32_t len,
+  uint8_t *data
+)
+{
+  uint32_t i = (uint32_t)0U;
+  for (; i + (uint32_t)64U <= len; i = i + (uint32_t)64U)
+  {
+    acc =
+      ghash4(h,
+        acc,
+        Lib_IntVector_Intrinsics_vec128_load_be(data + i),
+        Lib_IntVector_Intrinsics_vec128_load_be(data + i + (uint32_t)16U),
+        Lib_IntVector_Intrinsics_vec128_load_be(data + i + (uint32_t)32U),
+        Lib_IntVector_Intrinsics_vec128_load_be(data + i + (uint32_t)48U));
+  }
+  for (; i < len; i = i + (uint32_t)16U)
+  {
+    Lib_IntVector_Intrinsics_vec128 x = Lib_IntVector_Intrinsics_vec128_load_be(data + i);
+    acc = gf128_mul(Lib_IntVector_Intrinsics_vec128_xor(acc, x), h[0U]);
+  }
+  return acc;
+}
+
+/* Absorbs the first len bytes of buf, zero-padded to a block. */
+static inline Lib_IntVector_Intrinsics_vec128
+ghash_padded(
+  Lib_IntVector_Intrinsics_vec128 *h,
+  Lib_IntVector_Intrinsics_vec128 acc,
+  uint32_t len,
+  uint8_t *buf
+)
+{
+  uint8_t block[16U] = { 0U };
+  memcpy(block, buf, len * sizeof (buf[0U]));
+  Lib_IntVector_Intrinsics_vec128 x = Lib_IntVector_Intrinsics_vec128_load_be(block);
+  return gf128_mul(Lib_IntVector_Intrinsics_vec128_xor(acc, x), h[0U]);
+}
+
+static inline void load_round_keys(Hacl_AES_GCM_NI_state *st, Lib_IntVector_Intrinsics_vec128 *k)
+{
+  for (uint32_t i = (uint32_t)0U; i <= st->nr; i++)
+  {
+    k[i] = Lib_IntVector_Intrinsics_vec128_load_le(st->round_keys + (uint32_t)16U * i);
+  }
+}
+
+static inline void load_hkeys(Hacl_AES_GCM_NI_state *st, Lib_IntVector_Intrinsics_vec128 *h)
+{
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    h[i] = Lib_IntVector_Intrinsics_vec128_load_le(st->hkeys + (uint32_t)16U * i);
+  }
+}
+
+static inline Lib_IntVector_Intrinsics_vec128
+aes_enc(Lib_IntVector_Intrinsics_vec128 *k, uint32_t nr, Lib_IntVector_Intrinsics_vec128 b)
+{
+  b = Lib_IntVector_Intrinsics_vec128_xor(b, k[0U]);
+  for (uint32_t r = (uint32_t)1U; r < nr; r++)
+  {
+    b = Lib_IntVector_Intrinsics_ni_aes_enc(b, k[r]);
+  }
+  return Lib_IntVector_Intrinsics_ni_aes_enc_last(b, k[nr]);
+}
+
+/* The counter block for 32-bit counter c: the last word of J0 is replaced, big-endian. */
+static inline Lib_IntVector_Intrinsics_vec128
+counter_block(Lib_IntVector_Intrinsics_vec128 j0, uint32_t c)
+{
+  return Lib_IntVector_Intrinsics_vec128_insert32(j0, htobe32(c), 3);
+}
+
+/* Absorbs any pending partial block of additional data, once the text starts. */
+static inline Lib_IntVector_Intrinsics_vec128
+flush_aad(
+  Hacl_AES_GCM_NI_state *st,
+  Lib_IntVector_Intrinsics_vec128 *h,
+  Lib_IntVector_Intrinsics_vec128 acc
+)
+{
+  uint32_t off = (uint32_t)(st->ad_len % (uint64_t)16U);
+  if (off != (uint32_t)0U)
+  {
+    return ghash_padded(h, acc, off, st->buf);
+  }
+  return acc;
+}
+
+/* Bulk CTR and GHASH over the ciphertext. For decryption, every input block is read before
+   the corresponding output block is written, so that out may alias in. */
+static void
+crypt(Hacl_AES_GCM_NI_state *st, bool enc, uint32_t len, uint8_t *out, uint8_t *in)
+{
+  if (len == (uint32_t)0U)
+  {
+    return;
+  }
+  Lib_IntVector_Intrinsics_vec128 k[15U];
+  Lib_IntVector_Intrinsics_vec128 h[4U];
+  load_round_keys(st, k);
+  load_hkeys(st, h);
+  uint32_t nr = st->nr;
+  Lib_IntVector_Intrinsics_vec128 acc = Lib_IntVector_Intrinsics_vec128_load_le(st->acc);
+  if (st->text_len == (uint64_t)0U)
+  {
+    acc = flush_aad(st, h, acc);
+  }
+  Lib_IntVector_Intrinsics_vec128 j0 = Lib_IntVector_Intrinsics_vec128_load_le(st->j0);
+  uint32_t c0 = load32_be(st->j0 + (uint32_t)12U) + (uint32_t)1U;
+  uint32_t off = (uint32_t)(st->text_len % (uint64_t)16U);
+  uint32_t i = (uint32_t)0U;
+  if (off != (uint32_t)0U)
+  {
+    /* Finish the partial block left over by the previous call. */
+    uint32_t n = (uint32_t)16U - off;
+    if (len < n)
+    {
+      n = len;
+    }
+    for (uint32_t j = (uint32_t)0U; j < n; j++)
+    {
+      uint8_t x = in[j];
+      uint8_t y = x ^ st->ks[off + j];
+      out[j] = y;
+      st->buf[off + j] = enc ? y : x;
+    }
+    i = n;
+    if (off + n == (uint32_t)16U)
+    {
+      acc = ghash_padded(h, acc, (uint32_t)16U, st->buf);
+    }
+  }
+  /* From here on, block i of the call is block c - c0 of the message. */
+  uint32_t c = c0 + (uint32_t)((st->text_len + (uint64_t)i) / (uint64_t)16U);
+  for (; i + (uint32_t)64U <= len; i = i + (uint32_t)64U)
+  {
+    Lib_IntVector_Intrinsics_vec128 b0 = counter_block(j0, c);
+    Lib_IntVector_Intrinsics_vec128 b1 = counter_block(j0, c + (uint32_t)1U);
+    Lib_IntVector_Intrinsics_vec128 b2 = counter_block(j0, c + (uint32_t)2U);
+    Lib_IntVector_Intrinsics_vec128 b3 = counter_block(j0, c + (uint32_t)3U);
+    c = c + (uint32_t)4U;
+    b0 = Lib_IntVector_Intrinsics_vec128_xor(b0, k[0U]);
+    b1 = Lib_IntVector_Intrinsics_vec128_xor(b1, k[0U]);
+    b2 = Lib_IntVector_Intrinsics_vec128_xor(b2, k[0U]);
+    b3 = Lib_IntVector_Intrinsics_vec128_xor(b3, k[0U]);
+    for (uint32_t r = (uint32_t)1U; r < nr; r++)
+    {
+      b0 = Lib_IntVector_Intrinsics_ni_aes_enc(b0, k[r]);
+      b1 = Lib_IntVector_Intrinsics_ni_aes_enc(b1, k[r]);
+      b2 = Lib_IntVector_Intrinsics_ni_aes_enc(b2, k[r]);
+      b3 = Lib_IntVector_Intrinsics_ni_aes_enc(b3, k[r]);
+    }
+    b0 = Lib_IntVector_Intrinsics_ni_aes_enc_last(b0, k[nr]);
+    b1 = Lib_IntVector_Intrinsics_ni_aes_enc_last(b1, k[nr]);
+    b2 = Lib_IntVector_Intrinsics_ni_aes_enc_last(b2, k[nr]);
+    b3 = Lib_IntVector_Intrinsics_ni_aes_enc_last(b3, k[nr]);
+    uint8_t *ct = enc ? out + i : in + i;
+    Lib_IntVector_Intrinsics_vec128 x0 = Lib_IntVector_Intrinsics_vec128_load_le(in + i);
+    Lib_IntVector_Intrinsics_vec128
+    x1 = Lib_IntVector_Intrinsics_vec128_load_le(in + i + (uint32_t)16U);
+    Lib_IntVector_Intrinsics_vec128
+    x2 = Lib_IntVector_Intrinsics_vec128_load_le(in + i + (uint32_t)32U);
+    Lib_IntVector_Intrinsics_vec128
+    x3 = Lib_IntVector_Intrinsics_vec128_load_le(in + i + (uint32_t)48U);
+    Lib_IntVector_Intrinsics_vec128 g0 = Lib_IntVector_Intrinsics_vec128_zero;
+    Lib_IntVector_Intrinsics_vec128 g1 = Lib_IntVector_Intrinsics_vec128_zero;
+    Lib_IntVector_Intrinsics_vec128 g2 = Lib_IntVector_Intrinsics_vec128_zero;
+    Lib_IntVector_Intrinsics_vec128 g3 = Lib_IntVector_Intrinsics_vec128_zero;
+    if (!enc)
+    {
+      g0 = Lib_IntVector_Intrinsics_vec128_load_be(ct);
+      g1 = Lib_IntVector_Intrinsics_vec128_load_be(ct + (uint32_t)16U);
+      g2 = Lib_IntVector_Intrinsics_vec128_load_be(ct + (uint32_t)32U);
+      g3 = Lib_IntVector_Intrinsics_vec128_load_be(ct + (uint32_t)48U);
+    }
+    Lib_IntVector_Intrinsics_vec128_store_le(out + i, Lib_IntVector_Intrinsics_vec128_xor(x0, b0));
+    Lib_IntVector_Intrinsics_vec128_store_le(out + i + (uint32_t)16U,
+      Lib_IntVector_Intrinsics_vec128_xor(x1, b1));
+    Lib_IntVector_Intrinsics_vec128_store_le(out + i + (uint32_t)32U,
+      Lib_IntVector_Intrinsics_vec128_xor(x2, b2));
+    Lib_IntVector_Intrinsics_vec128_store_le(out + i + (uint32_t)48U,
+      Lib_IntVector_Intrinsics_vec128_xor(x3, b3));
+    if (enc)
+    {
+      g0 = Lib_IntVector_Intrinsics_vec128_load_be(ct);
+      g1 = Lib_IntVector_Intrinsics_vec128_load_be(ct + (uint32_t)16U);
+      g2 = Lib_IntVector_Intrinsics_vec128_load_be(ct + (uint32_t)32U);
+      g3 = Lib_IntVector_Intrinsics_vec128_load_be(ct + (uint32_t)48U);
+    }
+    acc = ghash4(h, acc, g0, g1, g2, g3);
+  }
+  for (; i + (uint32_t)16U <= len; i = i + (uint32_t)16U)
+  {
+    Lib_IntVector_Intrinsics_vec128 b = aes_enc(k, nr, counter_block(j0, c));
+    c = c + (uint32_t)1U;
+    uint8_t *ct = enc ? out + i : in + i;
+    Lib_IntVector_Intrinsics_vec128 x = Lib_IntVector_Intrinsics_vec128_load_le(in + i);
+    Lib_IntVector_Intrinsics_vec128 g = Lib_IntVector_Intrinsics_vec128_zero;
+    if (!enc)
+    {
+      g = Lib_IntVector_Intrinsics_vec128_load_be(ct);
+    }
+    Lib_IntVector_Intrinsics_vec128_store_le(out + i, Lib_IntVector_Intrinsics_vec128_xor(x, b));
+    if (enc)
+    {
+      g = Lib_IntVector_Intrinsics_vec128_load_be(ct);
+    }
+    acc = gf128_mul(Lib_IntVector_Intrinsics_vec128_xor(acc, g), h[0U]);
+  }
+  if (i < len)
+  {
+    /* Start a partial block, and keep its keystream for the next call. */
+    Lib_IntVector_Intrinsics_vec128 b = aes_enc(k, nr, counter_block(j0, c));
+    Lib_IntVector_Intrinsics_vec128_store_le(st->ks, b);
+    for (uint32_t j = (uint32_t)0U; j < len - i; j++)
+    {
+      uint8_t x = in[i + j];
+      uint8_t y = x ^ st->ks[j];
+      out[i + j] = y;
+      st->buf[j] = enc ? y : x;
+    }
+  }
+  st->text_len = st->text_len + (uint64_t)len;
+  Lib_IntVector_Intrinsics_vec128_store_le(st->acc, acc);
+}
+
+/* Starts a message under iv, once the keys are in place. */
+static void
+init_iv(
+  Hacl_AES_GCM_NI_state *st,
+  Lib_IntVector_Intrinsics_vec128 *h,
+  uint8_t *iv,
+  uint32_t iv_len
+)
+{
+  st->ad_len = (uint64_t)0U;
+  st->text_len = (uint64_t)0U;
+  if (iv_len == (uint32_t)12U)
+  {
+    memcpy(st->j0, iv, (uint32_t)12U * sizeof (iv[0U]));
+    store32_be(st->j0 + (uint32_t)12U, (uint32_t)1U);
+  }
+  else
+  {
+    /* J0 = GHASH(iv || 0^s || 0^64 || [len(iv)]_64) */
+    uint32_t full = iv_len / (uint32_t)16U * (uint32_t)16U;
+    Lib_IntVector_Intrinsics_vec128
+    acc = ghash_blocks(h, Lib_IntVector_Intrinsics_vec128_zero, full, iv);
+    if (full < iv_len)
+    {
+      acc = ghash_padded(h, acc, iv_len - full, iv + full);
+    }
+    Lib_IntVector_Intrinsics_vec128
+    lb = Lib_IntVector_Intrinsics_vec128_load64s((uint64_t)iv_len * (uint64_t)8U, (uint64_t)0U);
+    acc = gf128_mul(Lib_IntVector_Intrinsics_vec128_xor(acc, lb), h[0U]);
+    Lib_IntVector_Intrinsics_vec128_store_be(st->j0, acc);
+  }
+  Lib_IntVector_Intrinsics_vec128_store_le(st->acc, Lib_IntVector_Intrinsics_vec128_zero);
+}
+
+/* The Vale table stores H^n multiplied by x, reduced modulo x^128 + x^7 + x^2 + x + 1 (the
+   constant 0xC2..01 in this bit order), in the same byte layout as hkeys: dividing by x gives
+   H^n back. */
+static inline void vale_hkey(uint8_t *dst, uint8_t *src)
+{
+  uint64_t lo = load64_le(src);
+  uint64_t hi = load64_le(src + (uint32_t)8U);
+  uint64_t m = (uint64_t)0U - (lo & (uint64_t)1U);
+  lo = lo ^ (m & (uint64_t)1U);
+  hi = hi ^ (m & (uint64_t)0xC200000000000000U);
+  store64_le(dst, lo >> (uint32_t)1U | hi << (uint32_t)63U);
+  store64_le(dst + (uint32_t)8U, hi >> (uint32_t)1U | m << (uint32_t)63U);
+}
+
+#endif
+
+void
+Hacl_AES_GCM_NI_init(
+  Hacl_AES_GCM_NI_state *st,
+  uint32_t nr,
+  uint8_t *round_keys,
+  uint8_t *iv,
+  uint32_t iv_len
+)
+{
+  #if EVERCRYPT_TARGETCONFIG_X64
+  st->round_keys = round_keys;
+  st->nr = nr;
+  Lib_IntVector_Intrinsics_vec128 k[15U];
+  load_round_keys(st, k);
+  /* H = E(0), then H^2 .. H^4 for the four-block aggregated GHASH. */
+  uint8_t hb[16U] = { 0U };
+  Lib_IntVector_Intrinsics_vec128_store_le(hb,
+    aes_enc(k, nr, Lib_IntVector_Intrinsics_vec128_zero));
+  Lib_IntVector_Intrinsics_vec128 h[4U];
+  h[0U] = Lib_IntVector_Intrinsics_vec128_load_be(hb);
+  h[1U] = gf128_mul(h[0U], h[0U]);
+  h[2U] = gf128_mul(h[1U], h[0U]);
+  h[3U] = gf128_mul(h[2U], h[0U]);
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec128_store_le(st->hkeys + (uint32_t)16U * i, h[i]);
+  }
+  init_iv(st, h, iv, iv_len);
+  #else
+  KRML_HOST_EPRINTF("KreMLin abort at %s:%d\n%s\n",
+    __FILE__,
+    __LINE__,
+    "statically unreachable");
+  KRML_HOST_EXIT(255U);
+  #endif
+}
+
+void
+Hacl_AES_GCM_NI_init_vale(
+  Hacl_AES_GCM_NI_state *st,
+  uint32_t nr,
+  uint8_t *ek,
+  uint8_t *iv,
+  uint32_t iv_len
+)
+{
+  #if EVERCRYPT_TARGETCONFIG_X64
+  st->round_keys = ek;
+  st->nr = nr;
+  /* H, H^2, H^3 and H^4 are entries 0, 1, 3 and 4 of the table after the round keys. */
+  uint8_t *vale = ek + (uint32_t)16U * (nr + (uint32_t)1U);
+  vale_hkey(st->hkeys, vale);
+  vale_hkey(st->hkeys + (uint32_t)16U, vale + (uint32_t)16U);
+  vale_hkey(st->hkeys + (uint32_t)32U, vale + (uint32_t)48U);
+  vale_hkey(st->hkeys + (uint32_t)48U, vale + (uint32_t)64U);
+  Lib_IntVector_Intrinsics_vec128 h[4U];
+  load_hkeys(st, h);
+  init_iv(st, h, iv, iv_len);
+  #else
+  KRML_HOST_EPRINTF("KreMLin abort at %s:%d\n%s\n",
+    __FILE__,
+    __LINE__,
+    "statically unreachable");
+  KRML_HOST_EXIT(255U);
+  #endif
+}
+
+void Hacl_AES_GCM_NI_aad(Hacl_AES_GCM_NI_state *st, uint32_t len, uint8_t *ad)
+{
+  #if EVERCRYPT_TARGETCONFIG_X64
+  Lib_IntVector_Intrinsics_vec128 h[4U];
+  load_hkeys(st, h);
+  Lib_IntVector_Intrinsics_vec128 acc = Lib_IntVector_Intrinsics_vec128_load_le(st->acc);
+  uint32_t off = (uint32_t)(st->ad_len % (uint64_t)16U);
+  uint32_t i = (uint32_t)0U;
+  if (off != (uint32_t)0U)
+  {
+    i = (uint32_t)16U - off;
+    if (len < i)
+    {
+      i = len;
+    }
+    memcpy(st->buf + off, ad, i * sizeof (ad[0U]));
+    if (off + i == (uint32_t)16U)
+    {
+      acc = ghash_padded(h, acc, (uint32_t)16U, st->buf);
+    }
+  }
+  uint32_t full = (len - i) / (uint32_t)16U * (uint32_t)16U;
+  acc = ghash_blocks(h, acc, full, ad + i);
+  i = i + full;
+  memcpy(st->buf, ad + i, (len - i) * sizeof (ad[0U]));
+  st->ad_len = st->ad_len + (uint64_t)len;
+  Lib_IntVector_Intrinsics_vec128_store_le(st->acc, acc);
+  #else
+  KRML_HOST_EPRINTF("KreMLin abort at %s:%d\n%s\n",
+    __FILE__,
+    __LINE__,
+    "statically unreachable");
+  KRML_HOST_EXIT(255U);
+  #endif
+}
+
+void
+Hacl_AES_GCM_NI_encrypt(Hacl_AES_GCM_NI_state *st, uint32_t len, uint8_t *out, uint8_t *text)
+{
+  #if EVERCRYPT_TARGETCONFIG_X64
+  crypt(st, true, len, out, text);
+  #else
+  KRML_HOST_EPRINTF("KreMLin abort at %s:%d\n%s\n",
+    __FILE__,
+    __LINE__,
+    "statically unreachable");
+  KRML_HOST_EXIT(255U);
+  #endif
+}
+
+void
+Hacl_AES_GCM_NI_decrypt(Hacl_AES_GCM_NI_state *st, uint32_t len, uint8_t *out, uint8_t *cipher)
+{
+  #if EVERCRYPT_TARGETCONFIG_X64
+  crypt(st, false, len, out, cipher);
+  #else
+  KRML_HOST_EPRINTF("KreMLin abort at %s:%d\n%s\n",
+    __FILE__,
+    __LINE__,
+    "statically unreachable");
+  KRML_HOST_EXIT(255U);
+  #endif
+}
+
+void Hacl_AES_GCM_NI_finish(Hacl_AES_GCM_NI_state *st, uint8_t *tag)
+{
+  #if EVERCRYPT_TARGETCONFIG_X64
+  Lib_IntVector_Intrinsics_vec128 k[15U];
+  Lib_IntVector_Intrinsics_vec128 h[4U];
+  load_round_keys(st, k);
+  load_hkeys(st, h);
+  Lib_IntVector_Intrinsics_vec128 acc = Lib_IntVector_Intrinsics_vec128_load_le(st->acc);
+  uint32_t off = (uint32_t)(st->text_len % (uint64_t)16U);
+  if (st->text_len == (uint64_t)0U)
+  {
+    acc = flush_aad(st, h, acc);
+  }
+  else if (off != (uint32_t)0U)
+  {
+    acc = ghash_padded(h, acc, off, st->buf);
+  }
+  Lib_IntVector_Intrinsics_vec128
+  lb =
+    Lib_IntVector_Intrinsics_vec128_load64s(st->text_len * (uint64_t)8U,
+      st->ad_len * (uint64_t)8U);
+  acc = gf128_mul(Lib_IntVector_Intrinsics_vec128_xor(acc, lb), h[0U]);
+  uint8_t s[16U] = { 0U };
+  Lib_IntVector_Intrinsics_vec128_store_be(s, acc);
+  Lib_IntVector_Intrinsics_vec128
+  t = aes_enc(k, st->nr, Lib_IntVector_Intrinsics_vec128_load_le(st->j0));
+  Lib_IntVector_Intrinsics_vec128_store_le(tag,
+    Lib_IntVector_Intrinsics_vec128_xor(t, Lib_IntVector_Intrinsics_vec128_load_le(s)));
+  #else
+  KRML_HOST_EPRINTF("KreMLin abort at %s:%d\n%s\n",
+    __FILE__,
+    __LINE__,
+    "statically unreachable");
+  KRML_HOST_EXIT(255U);
+  #endif
+}
+
@@ -891,3 +891,81 @@ Hacl_Chacha20_Vec256_chacha20_decrypt_256(
   }
 }
 
+static inline void
+chacha20_hp_masks_block_256(Lib_IntVector_Intrinsics_vec256 *ctx, uint8_t *masks, uint8_t *samples)
+{
+  Lib_IntVector_Intrinsics_vec256 k[16U];
+  for (uint32_t _i = 0U; _i < (uint32_t)16U; ++_i)
+    k[_i] = Lib_IntVector_Intrinsics_vec256_zero;
+  memcpy(k, ctx, (uint32_t)12U * sizeof (ctx[0U]));
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    uint8_t *s = samples + i * (uint32_t)4U;
+    k[(uint32_t)12U + i] =
+      Lib_IntVector_Intrinsics_vec256_load32s(load32_le(s + (uint32_t)0U),
+        load32_le(s + (uint32_t)16U),
+        load32_le(s + (uint32_t)32U),
+        load32_le(s + (uint32_t)48U),
+        load32_le(s + (uint32_t)64U),
+        load32_le(s + (uint32_t)80U),
+        load32_le(s + (uint32_t)96U),
+        load32_le(s + (uint32_t)112U));
+  }
+  double_round_256(k);
+  double_round_256(k);
+  double_round_256(k);
+  double_round_256(k);
+  double_round_256(k);
+  double_round_256(k);
+  double_round_256(k);
+  double_round_256(k);
+  double_round_256(k);
+  double_round_256(k);
+  Lib_IntVector_Intrinsics_vec256 w0 = Lib_IntVector_Intrinsics_vec256_add32(k[0U], ctx[0U]);
+  Lib_IntVector_Intrinsics_vec256 w1 = Lib_IntVector_Intrinsics_vec256_add32(k[1U], ctx[1U]);
+  uint8_t b0[32U] = { 0U };
+  uint8_t b1[32U] = { 0U };
+  Lib_IntVector_Intrinsics_vec256_store_le(b0, w0);
+  Lib_IntVector_Intrinsics_vec256_store_le(b1, w1);
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    uint8_t *m = masks + i * (uint32_t)5U;
+    memcpy(m, b0 + i * (uint32_t)4U, (uint32_t)4U * sizeof (b0[0U]));
+    m[4U] = b1[i * (uint32_t)4U];
+  }
+}
+
+void
+Hacl_Chacha20_Vec256_chacha20_hp_masks_256(
+  uint32_t n,
+  uint8_t *masks,
+  uint8_t *key,
+  uint8_t *samples
+)
+{
+  Lib_IntVector_Intrinsics_vec256 ctx[12U];
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    uint32_t x = Hacl_Impl_Chacha20_Vec_chacha20_constants[i];
+    ctx[i] = Lib_IntVector_Intrinsics_vec256_load32(x);
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    uint32_t x = load32_le(key + i * (uint32_t)4U);
+    ctx[(uint32_t)4U + i] = Lib_IntVector_Intrinsics_vec256_load32(x);
+  }
+  uint32_t nb = n / (uint32_t)8U;
+  uint32_t rem = n % (uint32_t)8U;
+  for (uint32_t i = (uint32_t)0U; i < nb; i++)
+  {
+    chacha20_hp_masks_block_256(ctx, masks + i * (uint32_t)40U, samples + i * (uint32_t)128U);
+  }
+  if (rem > (uint32_t)0U)
+  {
+    uint8_t s[128U] = { 0U };
+    uint8_t m[40U] = { 0U };
+    memcpy(s, samples + nb * (uint32_t)128U, rem * (uint32_t)16U * sizeof (samples[0U]));
+    chacha20_hp_masks_block_256(ctx, m, s);
+    memcpy(masks + nb * (uint32_t)40U, m, rem * (uint32_t)5U * sizeof (m[0U]));
+  }
+}
@@ -5,9 +5,10 @@
 
 #define Lib_IntVector_Intrinsics_bit_mask64(x) -((x) & 1)
 
-#if defined(__x86_64__) || defined(_M_X64)
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
 
 // The following functions are only available on machines that support Intel AVX
+// The 64-bit inserts and extracts are only available on x64
 
 #include <emmintrin.h>
 #include <tmmintrin.h>
@@ -382,6 +383,37 @@ typedef __m256i Lib_IntVector_Intrinsics_vec256;
   (_mm256_mullo_epi32(x0, _mm256_set1_epi32(x1)))
 
 
+#define Lib_IntVector_Intrinsics_vec256_add16(x0, x1) \
+  (_mm256_add_epi16(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec256_mul16(x0, x1) \
+  (_mm256_mullo_epi16(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec256_smul16(x0, x1) \
+  (_mm256_mullo_epi16(x0, _mm256_set1_epi16(x1)))
+
+#define Lib_IntVector_Intrinsics_vec256_sub16(x0, x1) \
+  (_mm256_sub_epi16(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec256_shift_left16(x0, x1) \
+  (_mm256_slli_epi16(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec256_shift_right16(x0, x1) \
+  (_mm256_srli_epi16(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec256_shuffle8(x0, x1) \
+  (_mm256_shuffle_epi8(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec256_load16(x) \
+  (_mm256_set1_epi16(x))
+
+#define Lib_IntVector_Intrinsics_vec256_load16_be(x0)		\
+  (_mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*)(x0)), _mm256_set_epi8(14, 15, 12, 13, 10, 11, 8, 9, 6, 7, 4, 5, 2, 3, 0, 1, 14, 15, 12, 13, 10, 11, 8, 9, 6, 7, 4, 5, 2, 3, 0, 1)))
+
+#define Lib_IntVector_Intrinsics_vec256_store16_be(x0, x1)	\
+  (_mm256_storeu_si256((__m256i*)(x0), _mm256_shuffle_epi8(x1, _mm256_set_epi8(14, 15, 12, 13, 10, 11, 8, 9, 6, 7, 4, 5, 2, 3, 0, 1, 14, 15, 12, 13, 10, 11, 8, 9, 6, 7, 4, 5, 2, 3, 0, 1))))
+
+
 #define Lib_IntVector_Intrinsics_vec256_load64(x1) \
   (_mm256_set1_epi64x(x1)) /* hi lo */
 
@@ -24,6 +24,12 @@
 
 #include "EverCrypt_AutoConfig2.h"
 
+#if EVERCRYPT_TARGETCONFIG_X86 && defined(_MSC_VER)
+#include <intrin.h>
+#elif EVERCRYPT_TARGETCONFIG_X86 && defined(__GNUC__)
+#include <cpuid.h>
+#endif
+
 /* SNIPPET_START: cpu_has_shaext */
 
 static bool cpu_has_shaext[1U] = { false };
@@ -310,6 +316,30 @@ void EverCrypt_AutoConfig2_init()
   {
     cpu_has_avx512[0U] = true;
   }
+  #elif EVERCRYPT_TARGETCONFIG_X86 && (defined(_MSC_VER) || defined(__GNUC__))
+  /* The Vale feature checks are x64-only. On x86, only the features that Hacl_AES_GCM_NI relies
+     on are detected, with the same cpuid bits. */
+  unsigned int ecx = 0U;
+  unsigned int edx = 0U;
+  #if defined(_MSC_VER)
+  int regs[4U] = { 0 };
+  __cpuid(regs, 1);
+  ecx = (unsigned int)regs[2U];
+  edx = (unsigned int)regs[3U];
+  #else
+  unsigned int eax = 0U;
+  unsigned int ebx = 0U;
+  __get_cpuid(1U, &eax, &ebx, &ecx, &edx);
+  #endif
+  if (ecx & 0x02000000U && ecx & 0x00000002U)
+  {
+    cpu_has_aesni[0U] = true;
+    cpu_has_pclmulqdq[0U] = true;
+  }
+  if (ecx & 0x00080000U && ecx & 0x00000200U && edx & 0x04000000U)
+  {
+    cpu_has_sse[0U] = true;
+  }
   #endif
   user_wants_hacl[0U] = true;
   user_wants_vale[0U] = true;
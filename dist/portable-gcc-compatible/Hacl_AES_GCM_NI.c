@@ -0,0 +1,826 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "Hacl_AES_GCM_NI.h"
+
+#if EVERCRYPT_TARGETCONFIG_X64 || EVERCRYPT_TARGETCONFIG_X86
+
+/* GHASH operands are kept byte-reversed (as loaded by vec128_load_be), so that the
+   carry-less products are computed on whole 64-bit lanes. The 256-bit products of several
+   blocks are summed before a single reduction. */
+
+/* SNIPPET_START: clmul_wide */
+
+static inline void
+clmul_wide(
+  Lib_IntVector_Intrinsics_vec128 a,
+  Lib_IntVector_Intrinsics_vec128 b,
+  Lib_IntVector_Intrinsics_vec128 *lo,
+  Lib_IntVector_Intrinsics_vec128 *mid,
+  Lib_IntVector_Intrinsics_vec128 *hi
+)
+{
+  lo[0U] =
+    Lib_IntVector_Intrinsics_vec128_xor(lo[0U],
+      Lib_IntVector_Intrinsics_ni_clmul(a, b, 0x00));
+  mid[0U] =
+    Lib_IntVector_Intrinsics_vec128_xor(mid[0U],
+      Lib_IntVector_Intrinsics_vec128_xor(Lib_IntVector_Intrinsics_ni_clmul(a, b, 0x01),
+        Lib_IntVector_Intrinsics_ni_clmul(a, b, 0x10)));
+  hi[0U] =
+    Lib_IntVector_Intrinsics_vec128_xor(hi[0U],
+      Lib_IntVector_Intrinsics_ni_clmul(a, b, 0x11));
+}
+
+/* SNIPPET_END: clmul_wide */
+
+/* SNIPPET_START: reduce */
+
+static inline Lib_IntVector_Intrinsics_vec128
+reduce(
+  Lib_IntVector_Intrinsics_vec128 lo,
+  Lib_IntVector_Intrinsics_vec128 mid,
+  Lib_IntVector_Intrinsics_vec128 hi
+)
+{
+  Lib_IntVector_Intrinsics_vec128
+  l = Lib_IntVector_Intrinsics_vec128_xor(lo, Lib_IntVector_Intrinsics_vec128_shift_left(mid, 64));
+  Lib_IntVector_Intrinsics_vec128
+  h = Lib_IntVector_Intrinsics_vec128_xor(hi, Lib_IntVector_Intrinsics_vec128_shift_right(mid, 64));
+  /* The operands are bit-reflected: shift the product left by one. */
+  Lib_IntVector_Intrinsics_vec128 lc = Lib_IntVector_Intrinsics_vec128_shift_right32(l, 31);
+  Lib_IntVector_Intrinsics_vec128 hc = Lib_IntVector_Intrinsics_vec128_shift_right32(h, 31);
+  Lib_IntVector_Intrinsics_vec128 c = Lib_IntVector_Intrinsics_vec128_shift_right(lc, 96);
+  l =
+    Lib_IntVector_Intrinsics_vec128_or(Lib_IntVector_Intrinsics_vec128_shift_left32(l, 1),
+      Lib_IntVector_Intrinsics_vec128_shift_left(lc, 32));
+  h =
+    Lib_IntVector_Intrinsics_vec128_or(Lib_IntVector_Intrinsics_vec128_shift_left32(h, 1),
+      Lib_IntVector_Intrinsics_vec128_shift_left(hc, 32));
+  h = Lib_IntVector_Intrinsics_vec128_or(h, c);
+  /* Reduce modulo x^128 + x^7 + x^2 + x + 1. */
+  Lib_IntVector_Intrinsics_vec128
+  a =
+    Lib_IntVector_Intrinsics_vec128_xor(Lib_IntVector_Intrinsics_vec128_shift_left32(l, 31),
+      Lib_IntVector_Intrinsics_vec128_xor(Lib_IntVector_Intrinsics_vec128_shift_left32(l, 30),
+        Lib_IntVector_Intrinsics_vec128_shift_left32(l, 25)));
+  Lib_IntVector_Intrinsics_vec128 b = Lib_IntVector_Intrinsics_vec128_shift_right(a, 32);
+  l = Lib_IntVector_Intrinsics_vec128_xor(l, Lib_IntVector_Intrinsics_vec128_shift_left(a, 96));
+  Lib_IntVector_Intrinsics_vec128
+  d =
+    Lib_IntVector_Intrinsics_vec128_xor(Lib_IntVector_Intrinsics_vec128_shift_right32(l, 1),
+      Lib_IntVector_Intrinsics_vec128_xor(Lib_IntVector_Intrinsics_vec128_shift_right32(l, 2),
+        Lib_IntVector_Intrinsics_vec128_shift_right32(l, 7)));
+  d = Lib_IntVector_Intrinsics_vec128_xor(d, b);
+  l = Lib_IntVector_Intrinsics_vec128_xor(l, d);
+  return Lib_IntVector_Intrinsics_vec128_xor(h, l);
+}
+
+/* SNIPPET_END: reduce */
+
+/* SNIPPET_START: gf128_mul */
+
+static inline Lib_IntVector_Intrinsics_vec128
+gf128_mul(Lib_IntVector_Intrinsics_vec128 a, Lib_IntVector_Intrinsics_vec128 b)
+{
+  Lib_IntVector_Intrinsics_vec128 lo = Lib_IntVector_Intrinsics_vec128_zero;
+  Lib_IntVector_Intrinsics_vec128 mid = Lib_IntVector_Intrinsics_vec128_zero;
+  Lib_IntVector_Intrinsics_vec128 hi = Lib_IntVector_Intrinsics_vec128_zero;
+  clmul_wide(a, b, &lo, &mid, &hi);
+  return reduce(lo, mid, hi);
+}
+
+/* SNIPPET_END: gf128_mul */
+
+/* SNIPPET_START: ghash_n */
+
+/* acc = (acc + x[0]) * H^n + x[1] * H^(n - 1) + ... + x[n - 1] * H, for 1 <= n <= 8
+   consecutive blocks. */
+static inline Lib_IntVector_Intrinsics_vec128
+ghash_n(
+  Lib_IntVector_Intrinsics_vec128 *h,
+  Lib_IntVector_Intrinsics_vec128 acc,
+  uint32_t n,
+  Lib_IntVector_Intrinsics_vec128 *x
+)
+{
+  Lib_IntVector_Intrinsics_vec128 lo = Lib_IntVector_Intrinsics_vec128_zero;
+  Lib_IntVector_Intrinsics_vec128 mid = Lib_IntVector_Intrinsics_vec128_zero;
+  Lib_IntVector_Intrinsics_vec128 hi = Lib_IntVector_Intrinsics_vec128_zero;
+  clmul_wide(Lib_IntVector_Intrinsics_vec128_xor(acc, x[0U]), h[n - (uint32_t)1U], &lo, &mid, &hi);
+  for (uint32_t j = (uint32_t)1U; j < n; j++)
+  {
+    clmul_wide(x[j], h[n - (uint32_t)1U - j], &lo, &mid, &hi);
+  }
+  return reduce(lo, mid, hi);
+}
+
+/* SNIPPET_END: ghash_n */
+
+/* SNIPPET_START: batch */
+
+/* The number of blocks to process next, out of n available: batches of 8 (when hn is, and
+   H^5 .. H^8 are available), 4, or single blocks. Fixed batch sizes let the batches be fully
+   unrolled. */
+static inline uint32_t batch(uint32_t hn, uint32_t n)
+{
+  if (n >= hn)
+  {
+    return hn;
+  }
+  if (n >= (uint32_t)4U)
+  {
+    return (uint32_t)4U;
+  }
+  return (uint32_t)1U;
+}
+
+/* SNIPPET_END: batch */
+
+/* SNIPPET_START: ghash_load_n */
+
+static inline Lib_IntVector_Intrinsics_vec128
+ghash_load_n(
+  Lib_IntVector_Intrinsics_vec128 *h,
+  Lib_IntVector_Intrinsics_vec128 acc,
+  uint32_t n,
+  uint8_t *data
+)
+{
+  Lib_IntVector_Intrinsics_vec128 x[8U];
+  for (uint32_t j = (uint32_t)0U; j < n; j++)
+  {
+    x[j] = Lib_IntVector_Intrinsics_vec128_load_be(data + (uint32_t)16U * j);
+  }
+  return ghash_n(h, acc, n, x);
+}
+
+/* SNIPPET_END: ghash_load_n */
+
+/* SNIPPET_START: ghash_blocks */
+
+/* Absorbs blocks of data, up to hn at a time; len is a multiple of 16. */
+static inline Lib_IntVector_Intrinsics_vec128
+ghash_blocks(
+  Lib_IntVector_Intrinsics_vec128 *h,
+  uint32_t hn,
+  Lib_IntVector_Intrinsics_vec128 acc,
+  uint32_t len,
+  uint8_t *data
+)
+{
+  uint32_t i = (uint32_t)0U;
+  while (i < len)
+  {
+    uint32_t n = batch(hn, (len - i) / (uint32_t)16U);
+    if (n == (uint32_t)8U)
+    {
+      acc = ghash_load_n(h, acc, (uint32_t)8U, data + i);
+    }
+    else if (n == (uint32_t)4U)
+    {
+      acc = ghash_load_n(h, acc, (uint32_t)4U, data + i);
+    }
+    else
+    {
+      acc = ghash_load_n(h, acc, (uint32_t)1U, data + i);
+    }
+    i = i + (uint32_t)16U * n;
+  }
+  return acc;
+}
+
+/* SNIPPET_END: ghash_blocks */
+
+/* SNIPPET_START: ghash_padded */
+
+/* Absorbs the first len bytes of buf, zero-padded to a block. */
+static inline Lib_IntVector_Intrinsics_vec128
+ghash_padded(
+  Lib_IntVector_Intrinsics_vec128 *h,
+  Lib_IntVector_Intrinsics_vec128 acc,
+  uint32_t len,
+  uint8_t *buf
+)
+{
+  uint8_t block[16U] = { 0U };
+  memcpy(block, buf, len * sizeof (buf[0U]));
+  Lib_IntVector_Intrinsics_vec128 x = Lib_IntVector_Intrinsics_vec128_load_be(block);
+  return gf128_mul(Lib_IntVector_Intrinsics_vec128_xor(acc, x), h[0U]);
+}
+
+/* SNIPPET_END: ghash_padded */
+
+/* SNIPPET_START: load_round_keys */
+
+static inline void load_round_keys(Hacl_AES_GCM_NI_state *st, Lib_IntVector_Intrinsics_vec128 *k)
+{
+  for (uint32_t i = (uint32_t)0U; i <= st->nr; i++)
+  {
+    k[i] = Lib_IntVector_Intrinsics_vec128_load_le(st->round_keys + (uint32_t)16U * i);
+  }
+}
+
+/* SNIPPET_END: load_round_keys */
+
+/* SNIPPET_START: load_hkeys */
+
+/* Loads the powers of H computed so far. H^5 .. H^8 are only computed once an input is long
+   enough to use them. Returns the number of powers, which bounds the aggregation. */
+static inline uint32_t
+load_hkeys(Hacl_AES_GCM_NI_state *st, Lib_IntVector_Intrinsics_vec128 *h, uint32_t len)
+{
+  for (uint32_t i = (uint32_t)0U; i < st->hkeys_len; i++)
+  {
+    h[i] = Lib_IntVector_Intrinsics_vec128_load_le(st->hkeys + (uint32_t)16U * i);
+  }
+  if (st->hkeys_len < (uint32_t)8U && len >= (uint32_t)128U)
+  {
+    for (uint32_t i = st->hkeys_len; i < (uint32_t)8U; i++)
+    {
+      h[i] = gf128_mul(h[i - (uint32_t)1U], h[0U]);
+      Lib_IntVector_Intrinsics_vec128_store_le(st->hkeys + (uint32_t)16U * i, h[i]);
+    }
+    st->hkeys_len = (uint32_t)8U;
+  }
+  return st->hkeys_len;
+}
+
+/* SNIPPET_END: load_hkeys */
+
+/* SNIPPET_START: aes_enc */
+
+static inline Lib_IntVector_Intrinsics_vec128
+aes_enc(Lib_IntVector_Intrinsics_vec128 *k, uint32_t nr, Lib_IntVector_Intrinsics_vec128 b)
+{
+  b = Lib_IntVector_Intrinsics_vec128_xor(b, k[0U]);
+  for (uint32_t r = (uint32_t)1U; r < nr; r++)
+  {
+    b = Lib_IntVector_Intrinsics_ni_aes_enc(b, k[r]);
+  }
+  return Lib_IntVector_Intrinsics_ni_aes_enc_last(b, k[nr]);
+}
+
+/* SNIPPET_END: aes_enc */
+
+/* SNIPPET_START: counter_block */
+
+/* The counter block for 32-bit counter c: the last word of J0 is replaced, big-endian. */
+static inline Lib_IntVector_Intrinsics_vec128
+counter_block(Lib_IntVector_Intrinsics_vec128 j0, uint32_t c)
+{
+  return Lib_IntVector_Intrinsics_vec128_insert32(j0, htobe32(c), 3);
+}
+
+/* SNIPPET_END: counter_block */
+
+/* SNIPPET_START: flush_aad */
+
+/* Absorbs any pending partial block of additional data, once the text starts. */
+static inline Lib_IntVector_Intrinsics_vec128
+flush_aad(
+  Hacl_AES_GCM_NI_state *st,
+  Lib_IntVector_Intrinsics_vec128 *h,
+  Lib_IntVector_Intrinsics_vec128 acc
+)
+{
+  uint32_t off = (uint32_t)(st->ad_len % (uint64_t)16U);
+  if (off != (uint32_t)0U)
+  {
+    return ghash_padded(h, acc, off, st->buf);
+  }
+  return acc;
+}
+
+/* SNIPPET_END: flush_aad */
+
+/* SNIPPET_START: key_step */
+
+/* One step of the key schedule: each word of k is xored with all the previous ones, then with
+   the broadcast word t. */
+static inline Lib_IntVector_Intrinsics_vec128
+key_step(Lib_IntVector_Intrinsics_vec128 k, Lib_IntVector_Intrinsics_vec128 t)
+{
+  k = Lib_IntVector_Intrinsics_vec128_xor(k, Lib_IntVector_Intrinsics_vec128_shift_left(k, 32));
+  k = Lib_IntVector_Intrinsics_vec128_xor(k, Lib_IntVector_Intrinsics_vec128_shift_left(k, 32));
+  k = Lib_IntVector_Intrinsics_vec128_xor(k, Lib_IntVector_Intrinsics_vec128_shift_left(k, 32));
+  return Lib_IntVector_Intrinsics_vec128_xor(k, t);
+}
+
+/* SNIPPET_END: key_step */
+
+/* aeskeygenassist takes the round constant as an immediate, hence a macro. Word w of the
+   result is broadcast. */
+#define KEY_ASSIST(k, rcon, w) \
+  (Lib_IntVector_Intrinsics_vec128_shuffle32(Lib_IntVector_Intrinsics_ni_aes_keygen_assist(k, \
+        rcon), \
+      w, \
+      w, \
+      w, \
+      w))
+
+/* SNIPPET_START: key_expansion128 */
+
+static void key_expansion128(uint8_t *key, Lib_IntVector_Intrinsics_vec128 *k)
+{
+  k[0U] = Lib_IntVector_Intrinsics_vec128_load_le(key);
+  k[1U] = key_step(k[0U], KEY_ASSIST(k[0U], 0x01, 3));
+  k[2U] = key_step(k[1U], KEY_ASSIST(k[1U], 0x02, 3));
+  k[3U] = key_step(k[2U], KEY_ASSIST(k[2U], 0x04, 3));
+  k[4U] = key_step(k[3U], KEY_ASSIST(k[3U], 0x08, 3));
+  k[5U] = key_step(k[4U], KEY_ASSIST(k[4U], 0x10, 3));
+  k[6U] = key_step(k[5U], KEY_ASSIST(k[5U], 0x20, 3));
+  k[7U] = key_step(k[6U], KEY_ASSIST(k[6U], 0x40, 3));
+  k[8U] = key_step(k[7U], KEY_ASSIST(k[7U], 0x80, 3));
+  k[9U] = key_step(k[8U], KEY_ASSIST(k[8U], 0x1b, 3));
+  k[10U] = key_step(k[9U], KEY_ASSIST(k[9U], 0x36, 3));
+}
+
+/* SNIPPET_END: key_expansion128 */
+
+/* SNIPPET_START: key_expansion256 */
+
+static void key_expansion256(uint8_t *key, Lib_IntVector_Intrinsics_vec128 *k)
+{
+  k[0U] = Lib_IntVector_Intrinsics_vec128_load_le(key);
+  k[1U] = Lib_IntVector_Intrinsics_vec128_load_le(key + (uint32_t)16U);
+  k[2U] = key_step(k[0U], KEY_ASSIST(k[1U], 0x01, 3));
+  k[3U] = key_step(k[1U], KEY_ASSIST(k[2U], 0x00, 2));
+  k[4U] = key_step(k[2U], KEY_ASSIST(k[3U], 0x02, 3));
+  k[5U] = key_step(k[3U], KEY_ASSIST(k[4U], 0x00, 2));
+  k[6U] = key_step(k[4U], KEY_ASSIST(k[5U], 0x04, 3));
+  k[7U] = key_step(k[5U], KEY_ASSIST(k[6U], 0x00, 2));
+  k[8U] = key_step(k[6U], KEY_ASSIST(k[7U], 0x08, 3));
+  k[9U] = key_step(k[7U], KEY_ASSIST(k[8U], 0x00, 2));
+  k[10U] = key_step(k[8U], KEY_ASSIST(k[9U], 0x10, 3));
+  k[11U] = key_step(k[9U], KEY_ASSIST(k[10U], 0x00, 2));
+  k[12U] = key_step(k[10U], KEY_ASSIST(k[11U], 0x20, 3));
+  k[13U] = key_step(k[11U], KEY_ASSIST(k[12U], 0x00, 2));
+  k[14U] = key_step(k[12U], KEY_ASSIST(k[13U], 0x40, 3));
+}
+
+/* SNIPPET_END: key_expansion256 */
+
+/* SNIPPET_START: absorb_n */
+
+/* XORs the keystream blocks b into in, writing out, and absorbs the n resulting ciphertext
+   blocks. For decryption, the input blocks are read before the output blocks are written, so
+   that out may alias in. */
+static inline Lib_IntVector_Intrinsics_vec128
+absorb_n(
+  Lib_IntVector_Intrinsics_vec128 *h,
+  bool enc,
+  uint32_t n,
+  Lib_IntVector_Intrinsics_vec128 *b,
+  uint8_t *out,
+  uint8_t *in,
+  Lib_IntVector_Intrinsics_vec128 acc
+)
+{
+  Lib_IntVector_Intrinsics_vec128 g[8U];
+  if (!enc)
+  {
+    for (uint32_t j = (uint32_t)0U; j < n; j++)
+    {
+      g[j] = Lib_IntVector_Intrinsics_vec128_load_be(in + (uint32_t)16U * j);
+    }
+  }
+  for (uint32_t j = (uint32_t)0U; j < n; j++)
+  {
+    Lib_IntVector_Intrinsics_vec128
+    x = Lib_IntVector_Intrinsics_vec128_load_le(in + (uint32_t)16U * j);
+    Lib_IntVector_Intrinsics_vec128_store_le(out + (uint32_t)16U * j,
+      Lib_IntVector_Intrinsics_vec128_xor(x, b[j]));
+  }
+  if (enc)
+  {
+    for (uint32_t j = (uint32_t)0U; j < n; j++)
+    {
+      g[j] = Lib_IntVector_Intrinsics_vec128_load_be(out + (uint32_t)16U * j);
+    }
+  }
+  return ghash_n(h, acc, n, g);
+}
+
+/* SNIPPET_END: absorb_n */
+
+/* SNIPPET_START: crypt_n */
+
+/* CTR and GHASH over n whole blocks, from counter c. */
+static inline Lib_IntVector_Intrinsics_vec128
+crypt_n(
+  Lib_IntVector_Intrinsics_vec128 *k,
+  uint32_t nr,
+  Lib_IntVector_Intrinsics_vec128 *h,
+  Lib_IntVector_Intrinsics_vec128 j0,
+  uint32_t c,
+  bool enc,
+  uint32_t n,
+  uint8_t *out,
+  uint8_t *in,
+  Lib_IntVector_Intrinsics_vec128 acc
+)
+{
+  Lib_IntVector_Intrinsics_vec128 b[8U];
+  for (uint32_t j = (uint32_t)0U; j < n; j++)
+  {
+    b[j] = Lib_IntVector_Intrinsics_vec128_xor(counter_block(j0, c + j), k[0U]);
+  }
+  for (uint32_t r = (uint32_t)1U; r < nr; r++)
+  {
+    for (uint32_t j = (uint32_t)0U; j < n; j++)
+    {
+      b[j] = Lib_IntVector_Intrinsics_ni_aes_enc(b[j], k[r]);
+    }
+  }
+  for (uint32_t j = (uint32_t)0U; j < n; j++)
+  {
+    b[j] = Lib_IntVector_Intrinsics_ni_aes_enc_last(b[j], k[nr]);
+  }
+  return absorb_n(h, enc, n, b, out, in, acc);
+}
+
+/* SNIPPET_END: crypt_n */
+
+/* SNIPPET_START: crypt */
+
+/* Bulk CTR and GHASH over the ciphertext. */
+static void
+crypt(Hacl_AES_GCM_NI_state *st, bool enc, uint32_t len, uint8_t *out, uint8_t *in)
+{
+  if (len == (uint32_t)0U)
+  {
+    return;
+  }
+  Lib_IntVector_Intrinsics_vec128 k[15U];
+  Lib_IntVector_Intrinsics_vec128 h[8U];
+  load_round_keys(st, k);
+  uint32_t hn = load_hkeys(st, h, len);
+  uint32_t nr = st->nr;
+  Lib_IntVector_Intrinsics_vec128 acc = Lib_IntVector_Intrinsics_vec128_load_le(st->acc);
+  if (st->text_len == (uint64_t)0U)
+  {
+    acc = flush_aad(st, h, acc);
+  }
+  Lib_IntVector_Intrinsics_vec128 j0 = Lib_IntVector_Intrinsics_vec128_load_le(st->j0);
+  uint32_t c0 = load32_be(st->j0 + (uint32_t)12U) + (uint32_t)1U;
+  uint32_t off = (uint32_t)(st->text_len % (uint64_t)16U);
+  uint32_t i = (uint32_t)0U;
+  if (off != (uint32_t)0U)
+  {
+    /* Finish the partial block left over by the previous call. */
+    uint32_t n = (uint32_t)16U - off;
+    if (len < n)
+    {
+      n = len;
+    }
+    for (uint32_t j = (uint32_t)0U; j < n; j++)
+    {
+      uint8_t x = in[j];
+      uint8_t y = x ^ st->ks[off + j];
+      out[j] = y;
+      st->buf[off + j] = enc ? y : x;
+    }
+    i = n;
+    if (off + n == (uint32_t)16U)
+    {
+      acc = ghash_padded(h, acc, (uint32_t)16U, st->buf);
+    }
+  }
+  /* From here on, block i of the call is block c - c0 of the message. */
+  uint32_t c = c0 + (uint32_t)((st->text_len + (uint64_t)i) / (uint64_t)16U);
+  while (i + (uint32_t)16U <= len)
+  {
+    uint32_t n = batch(hn, (len - i) / (uint32_t)16U);
+    if (n == (uint32_t)8U)
+    {
+      acc = crypt_n(k, nr, h, j0, c, enc, (uint32_t)8U, out + i, in + i, acc);
+    }
+    else if (n == (uint32_t)4U)
+    {
+      acc = crypt_n(k, nr, h, j0, c, enc, (uint32_t)4U, out + i, in + i, acc);
+    }
+    else
+    {
+      acc = crypt_n(k, nr, h, j0, c, enc, (uint32_t)1U, out + i, in + i, acc);
+    }
+    c = c + n;
+    i = i + (uint32_t)16U * n;
+  }
+  if (i < len)
+  {
+    /* Start a partial block, and keep its keystream for the next call. */
+    Lib_IntVector_Intrinsics_vec128 b = aes_enc(k, nr, counter_block(j0, c));
+    Lib_IntVector_Intrinsics_vec128_store_le(st->ks, b);
+    for (uint32_t j = (uint32_t)0U; j < len - i; j++)
+    {
+      uint8_t x = in[i + j];
+      uint8_t y = x ^ st->ks[j];
+      out[i + j] = y;
+      st->buf[j] = enc ? y : x;
+    }
+  }
+  st->text_len = st->text_len + (uint64_t)len;
+  Lib_IntVector_Intrinsics_vec128_store_le(st->acc, acc);
+}
+
+/* SNIPPET_END: crypt */
+
+/* SNIPPET_START: hash_key */
+
+/* H = E(0), as loaded for GHASH. */
+static inline Lib_IntVector_Intrinsics_vec128
+hash_key(Lib_IntVector_Intrinsics_vec128 *k, uint32_t nr)
+{
+  uint8_t hb[16U] = { 0U };
+  Lib_IntVector_Intrinsics_vec128_store_le(hb,
+    aes_enc(k, nr, Lib_IntVector_Intrinsics_vec128_zero));
+  return Lib_IntVector_Intrinsics_vec128_load_be(hb);
+}
+
+/* SNIPPET_END: hash_key */
+
+/* SNIPPET_START: init_iv */
+
+/* Starts a message under iv, once the keys are in place. */
+static void
+init_iv(
+  Hacl_AES_GCM_NI_state *st,
+  Lib_IntVector_Intrinsics_vec128 *h,
+  uint8_t *iv,
+  uint32_t iv_len
+)
+{
+  st->ad_len = (uint64_t)0U;
+  st->text_len = (uint64_t)0U;
+  if (iv_len == (uint32_t)12U)
+  {
+    memcpy(st->j0, iv, (uint32_t)12U * sizeof (iv[0U]));
+    store32_be(st->j0 + (uint32_t)12U, (uint32_t)1U);
+  }
+  else
+  {
+    /* J0 = GHASH(iv || 0^s || 0^64 || [len(iv)]_64) */
+    uint32_t full = iv_len / (uint32_t)16U * (uint32_t)16U;
+    Lib_IntVector_Intrinsics_vec128
+    acc = ghash_blocks(h, (uint32_t)4U, Lib_IntVector_Intrinsics_vec128_zero, full, iv);
+    if (full < iv_len)
+    {
+      acc = ghash_padded(h, acc, iv_len - full, iv + full);
+    }
+    Lib_IntVector_Intrinsics_vec128
+    lb = Lib_IntVector_Intrinsics_vec128_load64s((uint64_t)iv_len * (uint64_t)8U, (uint64_t)0U);
+    acc = gf128_mul(Lib_IntVector_Intrinsics_vec128_xor(acc, lb), h[0U]);
+    Lib_IntVector_Intrinsics_vec128_store_be(st->j0, acc);
+  }
+  Lib_IntVector_Intrinsics_vec128_store_le(st->acc, Lib_IntVector_Intrinsics_vec128_zero);
+}
+
+/* SNIPPET_END: init_iv */
+
+#endif
+
+/* SNIPPET_START: Hacl_AES_GCM_NI_key_expansion */
+
+void Hacl_AES_GCM_NI_key_expansion(uint32_t nr, uint8_t *key, uint8_t *ek)
+{
+  #if EVERCRYPT_TARGETCONFIG_X64 || EVERCRYPT_TARGETCONFIG_X86
+  Lib_IntVector_Intrinsics_vec128 k[15U];
+  if (nr == (uint32_t)14U)
+  {
+    key_expansion256(key, k);
+  }
+  else
+  {
+    key_expansion128(key, k);
+  }
+  for (uint32_t i = (uint32_t)0U; i <= nr; i++)
+  {
+    Lib_IntVector_Intrinsics_vec128_store_le(ek + (uint32_t)16U * i, k[i]);
+  }
+  uint8_t *hkeys = ek + (uint32_t)16U * (nr + (uint32_t)1U);
+  Lib_IntVector_Intrinsics_vec128 h = hash_key(k, nr);
+  Lib_IntVector_Intrinsics_vec128 hi = h;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec128_store_le(hkeys + (uint32_t)16U * i, hi);
+    hi = gf128_mul(hi, h);
+  }
+  #else
+  KRML_HOST_EPRINTF("KreMLin abort at %s:%d\n%s\n",
+    __FILE__,
+    __LINE__,
+    "statically unreachable");
+  KRML_HOST_EXIT(255U);
+  #endif
+}
+
+/* SNIPPET_END: Hacl_AES_GCM_NI_key_expansion */
+
+/* SNIPPET_START: Hacl_AES_GCM_NI_init */
+
+void
+Hacl_AES_GCM_NI_init(
+  Hacl_AES_GCM_NI_state *st,
+  uint32_t nr,
+  uint8_t *round_keys,
+  uint8_t *iv,
+  uint32_t iv_len
+)
+{
+  #if EVERCRYPT_TARGETCONFIG_X64 || EVERCRYPT_TARGETCONFIG_X86
+  st->round_keys = round_keys;
+  st->nr = nr;
+  Lib_IntVector_Intrinsics_vec128 k[15U];
+  load_round_keys(st, k);
+  /* H, then H^2 .. H^4 for the aggregated GHASH; the other powers are computed on demand. */
+  Lib_IntVector_Intrinsics_vec128 h[8U];
+  h[0U] = hash_key(k, nr);
+  for (uint32_t i = (uint32_t)1U; i < (uint32_t)4U; i++)
+  {
+    h[i] = gf128_mul(h[i - (uint32_t)1U], h[0U]);
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec128_store_le(st->hkeys + (uint32_t)16U * i, h[i]);
+  }
+  st->hkeys_len = (uint32_t)4U;
+  init_iv(st, h, iv, iv_len);
+  #else
+  KRML_HOST_EPRINTF("KreMLin abort at %s:%d\n%s\n",
+    __FILE__,
+    __LINE__,
+    "statically unreachable");
+  KRML_HOST_EXIT(255U);
+  #endif
+}
+
+/* SNIPPET_END: Hacl_AES_GCM_NI_init */
+
+/* SNIPPET_START: Hacl_AES_GCM_NI_init_expanded */
+
+void
+Hacl_AES_GCM_NI_init_expanded(
+  Hacl_AES_GCM_NI_state *st,
+  uint32_t nr,
+  uint8_t *ek,
+  uint8_t *iv,
+  uint32_t iv_len
+)
+{
+  #if EVERCRYPT_TARGETCONFIG_X64 || EVERCRYPT_TARGETCONFIG_X86
+  st->round_keys = ek;
+  st->nr = nr;
+  memcpy(st->hkeys, ek + (uint32_t)16U * (nr + (uint32_t)1U), (uint32_t)128U * sizeof (ek[0U]));
+  st->hkeys_len = (uint32_t)8U;
+  Lib_IntVector_Intrinsics_vec128 h[8U];
+  load_hkeys(st, h, (uint32_t)0U);
+  init_iv(st, h, iv, iv_len);
+  #else
+  KRML_HOST_EPRINTF("KreMLin abort at %s:%d\n%s\n",
+    __FILE__,
+    __LINE__,
+    "statically unreachable");
+  KRML_HOST_EXIT(255U);
+  #endif
+}
+
+/* SNIPPET_END: Hacl_AES_GCM_NI_init_expanded */
+
+/* SNIPPET_START: Hacl_AES_GCM_NI_aad */
+
+void Hacl_AES_GCM_NI_aad(Hacl_AES_GCM_NI_state *st, uint32_t len, uint8_t *ad)
+{
+  #if EVERCRYPT_TARGETCONFIG_X64 || EVERCRYPT_TARGETCONFIG_X86
+  Lib_IntVector_Intrinsics_vec128 h[8U];
+  uint32_t hn = load_hkeys(st, h, len);
+  Lib_IntVector_Intrinsics_vec128 acc = Lib_IntVector_Intrinsics_vec128_load_le(st->acc);
+  uint32_t off = (uint32_t)(st->ad_len % (uint64_t)16U);
+  uint32_t i = (uint32_t)0U;
+  if (off != (uint32_t)0U)
+  {
+    i = (uint32_t)16U - off;
+    if (len < i)
+    {
+      i = len;
+    }
+    memcpy(st->buf + off, ad, i * sizeof (ad[0U]));
+    if (off + i == (uint32_t)16U)
+    {
+      acc = ghash_padded(h, acc, (uint32_t)16U, st->buf);
+    }
+  }
+  uint32_t full = (len - i) / (uint32_t)16U * (uint32_t)16U;
+  acc = ghash_blocks(h, hn, acc, full, ad + i);
+  i = i + full;
+  memcpy(st->buf, ad + i, (len - i) * sizeof (ad[0U]));
+  st->ad_len = st->ad_len + (uint64_t)len;
+  Lib_IntVector_Intrinsics_vec128_store_le(st->acc, acc);
+  #else
+  KRML_HOST_EPRINTF("KreMLin abort at %s:%d\n%s\n",
+    __FILE__,
+    __LINE__,
+    "statically unreachable");
+  KRML_HOST_EXIT(255U);
+  #endif
+}
+
+/* SNIPPET_END: Hacl_AES_GCM_NI_aad */
+
+/* SNIPPET_START: Hacl_AES_GCM_NI_encrypt */
+
+void
+Hacl_AES_GCM_NI_encrypt(Hacl_AES_GCM_NI_state *st, uint32_t len, uint8_t *out, uint8_t *text)
+{
+  #if EVERCRYPT_TARGETCONFIG_X64 || EVERCRYPT_TARGETCONFIG_X86
+  crypt(st, true, len, out, text);
+  #else
+  KRML_HOST_EPRINTF("KreMLin abort at %s:%d\n%s\n",
+    __FILE__,
+    __LINE__,
+    "statically unreachable");
+  KRML_HOST_EXIT(255U);
+  #endif
+}
+
+/* SNIPPET_END: Hacl_AES_GCM_NI_encrypt */
+
+/* SNIPPET_START: Hacl_AES_GCM_NI_decrypt */
+
+void
+Hacl_AES_GCM_NI_decrypt(Hacl_AES_GCM_NI_state *st, uint32_t len, uint8_t *out, uint8_t *cipher)
+{
+  #if EVERCRYPT_TARGETCONFIG_X64 || EVERCRYPT_TARGETCONFIG_X86
+  crypt(st, false, len, out, cipher);
+  #else
+  KRML_HOST_EPRINTF("KreMLin abort at %s:%d\n%s\n",
+    __FILE__,
+    __LINE__,
+    "statically unreachable");
+  KRML_HOST_EXIT(255U);
+  #endif
+}
+
+/* SNIPPET_END: Hacl_AES_GCM_NI_decrypt */
+
+/* SNIPPET_START: Hacl_AES_GCM_NI_finish */
+
+void Hacl_AES_GCM_NI_finish(Hacl_AES_GCM_NI_state *st, uint8_t *tag)
+{
+  #if EVERCRYPT_TARGETCONFIG_X64 || EVERCRYPT_TARGETCONFIG_X86
+  Lib_IntVector_Intrinsics_vec128 k[15U];
+  Lib_IntVector_Intrinsics_vec128 h[8U];
+  load_round_keys(st, k);
+  load_hkeys(st, h, (uint32_t)0U);
+  Lib_IntVector_Intrinsics_vec128 acc = Lib_IntVector_Intrinsics_vec128_load_le(st->acc);
+  uint32_t off = (uint32_t)(st->text_len % (uint64_t)16U);
+  if (st->text_len == (uint64_t)0U)
+  {
+    acc = flush_aad(st, h, acc);
+  }
+  else if (off != (uint32_t)0U)
+  {
+    acc = ghash_padded(h, acc, off, st->buf);
+  }
+  Lib_IntVector_Intrinsics_vec128
+  lb =
+    Lib_IntVector_Intrinsics_vec128_load64s(st->text_len * (uint64_t)8U,
+      st->ad_len * (uint64_t)8U);
+  acc = gf128_mul(Lib_IntVector_Intrinsics_vec128_xor(acc, lb), h[0U]);
+  uint8_t s[16U] = { 0U };
+  Lib_IntVector_Intrinsics_vec128_store_be(s, acc);
+  Lib_IntVector_Intrinsics_vec128
+  t = aes_enc(k, st->nr, Lib_IntVector_Intrinsics_vec128_load_le(st->j0));
+  Lib_IntVector_Intrinsics_vec128_store_le(tag,
+    Lib_IntVector_Intrinsics_vec128_xor(t, Lib_IntVector_Intrinsics_vec128_load_le(s)));
+  #else
+  KRML_HOST_EPRINTF("KreMLin abort at %s:%d\n%s\n",
+    __FILE__,
+    __LINE__,
+    "statically unreachable");
+  KRML_HOST_EXIT(255U);
+  #endif
+}
+
+/* SNIPPET_END: Hacl_AES_GCM_NI_finish */
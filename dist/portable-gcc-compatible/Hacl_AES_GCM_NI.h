@@ -0,0 +1,132 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "evercrypt_targetconfig.h"
+#include "libintvector.h"
+#include "kremlin/internal/types.h"
+#include "kremlin/lowstar_endianness.h"
+#include <string.h>
+#include "kremlin/internal/target.h"
+
+#ifndef __Hacl_AES_GCM_NI_H
+#define __Hacl_AES_GCM_NI_H
+
+#include "Hacl_Kremlib.h"
+#include "Lib_Memzero0.h"
+
+
+/* SNIPPET_START: Hacl_AES_GCM_NI_state */
+
+/* Streaming AES-GCM with AES-NI and PCLMULQDQ, for x64 and x86. The round keys are the
+   standard AES key schedule (11 or 15 round keys), as laid out at the start of the Vale
+   expanded keys or written by Hacl_AES_GCM_NI_key_expansion. They are not copied and must
+   outlive the state. Up to eight blocks are processed at a time, with an aggregated GHASH over
+   H .. H^8 (hkeys_len of which have been computed).
+
+   A message is processed as: init, any number of aad calls, any number of encrypt (or
+   decrypt) calls, then finish. Every call accepts arbitrary lengths; partial blocks are
+   carried over in the state. Output may alias input exactly. */
+typedef struct Hacl_AES_GCM_NI_state_s
+{
+  uint8_t *round_keys;
+  uint32_t nr;
+  uint8_t hkeys[128U];
+  uint32_t hkeys_len;
+  uint8_t j0[16U];
+  uint8_t acc[16U];
+  uint8_t ks[16U];
+  uint8_t buf[16U];
+  uint64_t ad_len;
+  uint64_t text_len;
+}
+Hacl_AES_GCM_NI_state;
+
+/* SNIPPET_END: Hacl_AES_GCM_NI_state */
+
+/* SNIPPET_START: Hacl_AES_GCM_NI_key_expansion */
+
+/* nr is the number of rounds: 10 for AES-128, 14 for AES-256. Writes the 16 * (nr + 1) bytes
+   of round keys for the 16- or 32-byte key, followed by the 128 bytes of H .. H^8: 304 or 368
+   bytes in total, the size of the Vale expanded keys. */
+void Hacl_AES_GCM_NI_key_expansion(uint32_t nr, uint8_t *key, uint8_t *ek);
+
+/* SNIPPET_END: Hacl_AES_GCM_NI_key_expansion */
+
+/* SNIPPET_START: Hacl_AES_GCM_NI_init */
+
+/* iv_len must be non-zero. */
+void
+Hacl_AES_GCM_NI_init(
+  Hacl_AES_GCM_NI_state *st,
+  uint32_t nr,
+  uint8_t *round_keys,
+  uint8_t *iv,
+  uint32_t iv_len
+);
+
+/* SNIPPET_END: Hacl_AES_GCM_NI_init */
+
+/* SNIPPET_START: Hacl_AES_GCM_NI_init_expanded */
+
+/* As init, with keys from Hacl_AES_GCM_NI_key_expansion, which saves computing the powers of
+   H. */
+void
+Hacl_AES_GCM_NI_init_expanded(
+  Hacl_AES_GCM_NI_state *st,
+  uint32_t nr,
+  uint8_t *ek,
+  uint8_t *iv,
+  uint32_t iv_len
+);
+
+/* SNIPPET_END: Hacl_AES_GCM_NI_init_expanded */
+
+/* SNIPPET_START: Hacl_AES_GCM_NI_aad */
+
+void Hacl_AES_GCM_NI_aad(Hacl_AES_GCM_NI_state *st, uint32_t len, uint8_t *ad);
+
+/* SNIPPET_END: Hacl_AES_GCM_NI_aad */
+
+/* SNIPPET_START: Hacl_AES_GCM_NI_encrypt */
+
+void
+Hacl_AES_GCM_NI_encrypt(Hacl_AES_GCM_NI_state *st, uint32_t len, uint8_t *out, uint8_t *text);
+
+/* SNIPPET_END: Hacl_AES_GCM_NI_encrypt */
+
+/* SNIPPET_START: Hacl_AES_GCM_NI_decrypt */
+
+void
+Hacl_AES_GCM_NI_decrypt(Hacl_AES_GCM_NI_state *st, uint32_t len, uint8_t *out, uint8_t *cipher);
+
+/* SNIPPET_END: Hacl_AES_GCM_NI_decrypt */
+
+/* SNIPPET_START: Hacl_AES_GCM_NI_finish */
+
+/* Writes the 16-byte tag. The state must be initialized again before reuse. */
+void Hacl_AES_GCM_NI_finish(Hacl_AES_GCM_NI_state *st, uint8_t *tag);
+
+/* SNIPPET_END: Hacl_AES_GCM_NI_finish */
+
+#define __Hacl_AES_GCM_NI_H_DEFINED
+#endif
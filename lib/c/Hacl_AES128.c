@@ -0,0 +1,121 @@
+#include "Hacl_AES128.h"
+#include "Hacl_AES.h"
+#include "EverCrypt_AutoConfig2.h"
+
+#if EVERCRYPT_TARGETCONFIG_X64
+#include "Vale.h"
+#endif
+
+/* Implementation of the Hacl.AES128 interface, which FrodoKEM uses to expand
+   its public matrix A from seed_A.
+
+   On x64 machines with AES-NI the key schedule is computed by the Vale AES
+   code and blocks are encrypted with AES-NI. Elsewhere, we fall back onto the
+   byte-oriented implementation of Hacl_AES. Both produce the standard
+   176-byte expanded key, so either encryption path may be used with either
+   key schedule.
+
+   The fallback uses table lookups and is therefore NOT constant-time. This is
+   fine for FrodoKEM, where the key is public, but this interface should not be
+   used with secret keys. */
+
+static bool has_aes_ni() {
+#if EVERCRYPT_TARGETCONFIG_X64
+  return EverCrypt_AutoConfig2_has_aesni() && EverCrypt_AutoConfig2_has_avx() &&
+    EverCrypt_AutoConfig2_has_sse();
+#else
+  return false;
+#endif
+}
+
+void Hacl_AES128_aes128_key_expansion(uint8_t *key, uint8_t *expanded_key) {
+#if EVERCRYPT_TARGETCONFIG_X64
+  if (has_aes_ni()) {
+    aes128_key_expansion(key, expanded_key);
+    return;
+  }
+#endif
+  uint8_t sbox[256U] = { 0U };
+  Crypto_Symmetric_AES128_mk_sbox(sbox);
+  Crypto_Symmetric_AES128_keyExpansion(key, expanded_key, sbox);
+}
+
+#if EVERCRYPT_TARGETCONFIG_X64
+static void
+encrypt_blocks_ni(uint32_t nblocks, uint8_t *cipher, uint8_t *plain, uint8_t *expanded_key) {
+  Lib_IntVector_Intrinsics_vec128 k[11U];
+  for (uint32_t i = 0U; i < 11U; i++)
+    k[i] = Lib_IntVector_Intrinsics_vec128_load_le(expanded_key + 16U * i);
+  uint32_t i = 0U;
+  /* Four independent blocks in flight hide the latency of aesenc. */
+  for (; i + 4U <= nblocks; i += 4U) {
+    Lib_IntVector_Intrinsics_vec128 b0 =
+      Lib_IntVector_Intrinsics_vec128_load_le(plain + 16U * i);
+    Lib_IntVector_Intrinsics_vec128 b1 =
+      Lib_IntVector_Intrinsics_vec128_load_le(plain + 16U * i + 16U);
+    Lib_IntVector_Intrinsics_vec128 b2 =
+      Lib_IntVector_Intrinsics_vec128_load_le(plain + 16U * i + 32U);
+    Lib_IntVector_Intrinsics_vec128 b3 =
+      Lib_IntVector_Intrinsics_vec128_load_le(plain + 16U * i + 48U);
+    b0 = Lib_IntVector_Intrinsics_vec128_xor(b0, k[0U]);
+    b1 = Lib_IntVector_Intrinsics_vec128_xor(b1, k[0U]);
+    b2 = Lib_IntVector_Intrinsics_vec128_xor(b2, k[0U]);
+    b3 = Lib_IntVector_Intrinsics_vec128_xor(b3, k[0U]);
+    for (uint32_t r = 1U; r < 10U; r++) {
+      b0 = Lib_IntVector_Intrinsics_ni_aes_enc(b0, k[r]);
+      b1 = Lib_IntVector_Intrinsics_ni_aes_enc(b1, k[r]);
+      b2 = Lib_IntVector_Intrinsics_ni_aes_enc(b2, k[r]);
+      b3 = Lib_IntVector_Intrinsics_ni_aes_enc(b3, k[r]);
+    }
+    b0 = Lib_IntVector_Intrinsics_ni_aes_enc_last(b0, k[10U]);
+    b1 = Lib_IntVector_Intrinsics_ni_aes_enc_last(b1, k[10U]);
+    b2 = Lib_IntVector_Intrinsics_ni_aes_enc_last(b2, k[10U]);
+    b3 = Lib_IntVector_Intrinsics_ni_aes_enc_last(b3, k[10U]);
+    Lib_IntVector_Intrinsics_vec128_store_le(cipher + 16U * i, b0);
+    Lib_IntVector_Intrinsics_vec128_store_le(cipher + 16U * i + 16U, b1);
+    Lib_IntVector_Intrinsics_vec128_store_le(cipher + 16U * i + 32U, b2);
+    Lib_IntVector_Intrinsics_vec128_store_le(cipher + 16U * i + 48U, b3);
+  }
+  for (; i < nblocks; i++) {
+    Lib_IntVector_Intrinsics_vec128 b0 =
+      Lib_IntVector_Intrinsics_vec128_load_le(plain + 16U * i);
+    b0 = Lib_IntVector_Intrinsics_vec128_xor(b0, k[0U]);
+    for (uint32_t r = 1U; r < 10U; r++)
+      b0 = Lib_IntVector_Intrinsics_ni_aes_enc(b0, k[r]);
+    b0 = Lib_IntVector_Intrinsics_ni_aes_enc_last(b0, k[10U]);
+    Lib_IntVector_Intrinsics_vec128_store_le(cipher + 16U * i, b0);
+  }
+}
+#endif
+
+void
+Hacl_AES128_aes128_encrypt_blocks(
+  uint32_t nblocks,
+  uint16_t *cipher,
+  uint16_t *plain,
+  uint8_t *expanded_key
+) {
+  /* Blocks are sequences of eight little-endian 16-bit words. */
+  KRML_CHECK_SIZE(sizeof (uint8_t), 16U * nblocks);
+  uint8_t buf[16U * nblocks];
+  for (uint32_t i = 0U; i < 8U * nblocks; i++)
+    store16_le(buf + 2U * i, plain[i]);
+#if EVERCRYPT_TARGETCONFIG_X64
+  if (has_aes_ni()) {
+    encrypt_blocks_ni(nblocks, buf, buf, expanded_key);
+  } else
+#endif
+  {
+    uint8_t sbox[256U] = { 0U };
+    Crypto_Symmetric_AES128_mk_sbox(sbox);
+    for (uint32_t i = 0U; i < nblocks; i++)
+      Crypto_Symmetric_AES128_cipher(buf + 16U * i, buf + 16U * i, expanded_key, sbox);
+  }
+  for (uint32_t i = 0U; i < 8U * nblocks; i++)
+    cipher[i] = load16_le(buf + 2U * i);
+}
+
+void
+Hacl_AES128_aes128_encrypt_block(uint16_t *cipher, uint16_t *plain, uint8_t *expanded_key) {
+  Hacl_AES128_aes128_encrypt_blocks(1U, cipher, plain, expanded_key);
+}
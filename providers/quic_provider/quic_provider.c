@@ -11,12 +11,17 @@
 
 #include "kremlib.h"
 #include "EverCrypt.h"
+#include "EverCrypt_AEAD.h"
+#include "EverCrypt_Cipher.h"
 #include "quic_provider.h"
 
 typedef struct quic_key {
   mitls_aead alg;
   unsigned char key[32];
   unsigned char static_iv[12];
+  // Expanded key for the scatter/gather functions; NULL if the algorithm
+  // is not supported by EverCrypt_AEAD on this machine
+  EverCrypt_AEAD_state_s *aead;
   union {
     unsigned char case_chacha20[32];
     EverCrypt_aes128_key case_aes128;
@@ -205,7 +210,35 @@ int MITLS_CALLCONV quic_derive_initial_secrets(quic_secret *client_in, quic_secr
   return 1;
 }
 
-int MITLS_CALLCONV quic_crypto_derive_key(quic_key **k, const quic_secret *secret)
+static void create_aead(quic_key *key)
+{
+  Spec_Agile_AEAD_alg a = Spec_Agile_AEAD_CHACHA20_POLY1305;
+  if(key->alg == TLS_aead_AES_128_GCM)
+    a = Spec_Agile_AEAD_AES128_GCM;
+  else if(key->alg == TLS_aead_AES_256_GCM)
+    a = Spec_Agile_AEAD_AES256_GCM;
+
+  key->aead = NULL;
+  if(EverCrypt_AEAD_create_in(a, &key->aead, key->key) != EverCrypt_Error_Success)
+    key->aead = NULL;
+}
+
+// The header protection key of a secret (quic-tls#4, 5.4)
+static int derive_hp_key(const quic_secret *secret, unsigned char *pnkey)
+{
+  uint32_t klen = (secret->ae == TLS_aead_AES_128_GCM ? 16 : 32);
+  uint32_t slen = (secret->hash == TLS_hash_SHA256 ? 32 : (secret->hash == TLS_hash_SHA384 ? 48 : 64));
+  unsigned char info[259] = {0};
+  size_t info_len;
+
+  if(!quic_crypto_hkdf_label(secret->hash, info, &info_len, "pn", klen))
+    return 0;
+  return quic_crypto_hkdf_expand(secret->hash, pnkey, klen, (uint8_t *) secret->secret, slen, info, info_len);
+}
+
+// Derives the AEAD key and IV from secret; the header protection key is
+// hp if it is not NULL, and is derived from secret otherwise
+static int derive_key(quic_key **k, const quic_secret *secret, const unsigned char *hp)
 {
   quic_key *key = KRML_HOST_MALLOC(sizeof(quic_key));
   if(!key) return 0;
@@ -228,9 +261,9 @@ int MITLS_CALLCONV quic_crypto_derive_key(quic_key **k, const quic_secret *secre
   if(!quic_crypto_hkdf_expand(secret->hash, key->static_iv, 12, (uint8_t *) secret->secret, slen, info, info_len))
     return 0;
 
-  if(!quic_crypto_hkdf_label(secret->hash, info, &info_len, "pn", klen))
-    return 0;
-  if(!quic_crypto_hkdf_expand(secret->hash, pnkey, klen, (uint8_t *) secret->secret, slen, info, info_len))
+  if(hp != NULL)
+    memcpy(pnkey, hp, klen);
+  else if(!derive_hp_key(secret, pnkey))
     return 0;
 
 #if DEBUG
@@ -252,10 +285,16 @@ int MITLS_CALLCONV quic_crypto_derive_key(quic_key **k, const quic_secret *secre
      memcpy(key->pne.case_chacha20, pnkey, 32);
    }
 
+  create_aead(key);
   *k = key;
   return 1;
 }
 
+int MITLS_CALLCONV quic_crypto_derive_key(quic_key **k, const quic_secret *secret)
+{
+  return derive_key(k, secret, NULL);
+}
+
 static inline void sn_to_iv(unsigned char *iv, uint64_t sn)
 {
   for(int i = 4; i < 12; i++)
@@ -279,6 +318,7 @@ int MITLS_CALLCONV quic_crypto_create(quic_key **key, mitls_aead alg, const unsi
   else if(alg == TLS_aead_CHACHA20_POLY1305)
     memcpy(k->pne.case_chacha20, pne_key, 32);
 
+  create_aead(k);
   *key = k;
   return 1;
 }
@@ -290,7 +330,13 @@ int MITLS_CALLCONV quic_crypto_encrypt(quic_key *key, unsigned char *cipher, uin
   memcpy(iv, key->static_iv, 12);
   sn_to_iv(iv, sn);
 
-  if(key->alg == TLS_aead_AES_128_GCM)
+  // The cached key encrypts directly into cipher, which may be plain itself;
+  // the older entry points below go through temporary copies
+  if(key->aead != NULL)
+  {
+    EverCrypt_AEAD_encrypt(key->aead, iv, 12, (uint8_t*)ad, ad_len, (uint8_t*)plain, plain_len, cipher, cipher + plain_len);
+  }
+  else if(key->alg == TLS_aead_AES_128_GCM)
   {
     EverCrypt_aes128_gcm_encrypt(key->key, iv, (uint8_t*)ad, ad_len, (uint8_t*)plain, plain_len, cipher, (cipher+plain_len));
   }
@@ -329,7 +375,11 @@ int MITLS_CALLCONV quic_crypto_decrypt(quic_key *key, unsigned char *plain, uint
 
   uint32_t r = 0, plain_len = cipher_len - quic_crypto_tag_length(key);
 
-  if(key->alg == TLS_aead_AES_128_GCM)
+  if(key->aead != NULL)
+  {
+    r = EverCrypt_AEAD_decrypt(key->aead, iv, 12, (uint8_t*)ad, ad_len, (uint8_t*)cipher, plain_len, (uint8_t*)(cipher+plain_len), plain) == EverCrypt_Error_Success;
+  }
+  else if(key->alg == TLS_aead_AES_128_GCM)
   {
     r = EverCrypt_aes128_gcm_decrypt(key->key, iv, (uint8_t*)ad, ad_len, plain, plain_len, (uint8_t*)cipher, (uint8_t*)(cipher+plain_len));
   }
@@ -356,6 +406,105 @@ int MITLS_CALLCONV quic_crypto_decrypt(quic_key *key, unsigned char *plain, uint
   return r;
 }
 
+static uint64_t iov_total(const quic_iovec *v, size_t cnt)
+{
+  uint64_t total = 0;
+  for(size_t i = 0; i < cnt; i++)
+    total += v[i].len;
+  return total;
+}
+
+// Describes bytes [from, from + len) of the chain v as EverCrypt segments,
+// returning how many were written to dst (at most cnt)
+static uint32_t iov_slice(EverCrypt_Helpers_iovec *dst, const quic_iovec *v, size_t cnt, uint64_t from, uint64_t len)
+{
+  uint32_t n = 0;
+  for(size_t i = 0; i < cnt && len > 0; i++)
+  {
+    if(from >= v[i].len)
+    {
+      from -= v[i].len;
+      continue;
+    }
+    uint64_t l = v[i].len - from;
+    if(l > len) l = len;
+    dst[n].base = v[i].base + from;
+    dst[n].len = (uint32_t)l;
+    n++;
+    len -= l;
+    from = 0;
+  }
+  return n;
+}
+
+// Copies the 16-byte tag between buf and the last 16 bytes of the chain
+static void iov_tag(const quic_iovec *v, size_t cnt, uint64_t from, unsigned char *buf, int to_chain)
+{
+  EverCrypt_Helpers_iovec *segs = alloca(cnt * sizeof(EverCrypt_Helpers_iovec));
+  uint32_t n = iov_slice(segs, v, cnt, from, 16);
+  for(uint32_t i = 0; i < n; i++)
+  {
+    if(to_chain)
+      memcpy(segs[i].base, buf, segs[i].len);
+    else
+      memcpy(buf, segs[i].base, segs[i].len);
+    buf += segs[i].len;
+  }
+}
+
+int MITLS_CALLCONV quic_crypto_encrypt_iov(quic_key *key, const quic_iovec *cipher, size_t cipher_cnt, uint64_t sn,
+  const quic_iovec *ad, size_t ad_cnt, const quic_iovec *plain, size_t plain_cnt)
+{
+  unsigned char iv[12];
+  unsigned char tag[16];
+  memcpy(iv, key->static_iv, 12);
+  sn_to_iv(iv, sn);
+
+  uint64_t plain_len = iov_total(plain, plain_cnt);
+  if(key->aead == NULL || iov_total(cipher, cipher_cnt) != plain_len + quic_crypto_tag_length(key))
+    return 0;
+
+  EverCrypt_Helpers_iovec *ad_v = alloca((ad_cnt + 1) * sizeof(EverCrypt_Helpers_iovec));
+  EverCrypt_Helpers_iovec *plain_v = alloca((plain_cnt + 1) * sizeof(EverCrypt_Helpers_iovec));
+  EverCrypt_Helpers_iovec *cipher_v = alloca((cipher_cnt + 1) * sizeof(EverCrypt_Helpers_iovec));
+  uint32_t ad_n = iov_slice(ad_v, ad, ad_cnt, 0, UINT64_MAX);
+  uint32_t plain_n = iov_slice(plain_v, plain, plain_cnt, 0, UINT64_MAX);
+  uint32_t cipher_n = iov_slice(cipher_v, cipher, cipher_cnt, 0, plain_len);
+
+  if(EverCrypt_AEAD_encrypt_iov(key->aead, iv, 12, ad_n, ad_v, plain_n, plain_v, cipher_n, cipher_v, tag) != EverCrypt_Error_Success)
+    return 0;
+
+  iov_tag(cipher, cipher_cnt, plain_len, tag, 1);
+  return 1;
+}
+
+int MITLS_CALLCONV quic_crypto_decrypt_iov(quic_key *key, const quic_iovec *plain, size_t plain_cnt, uint64_t sn,
+  const quic_iovec *ad, size_t ad_cnt, const quic_iovec *cipher, size_t cipher_cnt)
+{
+  unsigned char iv[12];
+  unsigned char tag[16];
+  memcpy(iv, key->static_iv, 12);
+  sn_to_iv(iv, sn);
+
+  uint64_t cipher_len = iov_total(cipher, cipher_cnt);
+  if(key->aead == NULL || cipher_len < quic_crypto_tag_length(key))
+    return 0;
+
+  uint64_t plain_len = cipher_len - quic_crypto_tag_length(key);
+  if(iov_total(plain, plain_cnt) != plain_len)
+    return 0;
+
+  EverCrypt_Helpers_iovec *ad_v = alloca((ad_cnt + 1) * sizeof(EverCrypt_Helpers_iovec));
+  EverCrypt_Helpers_iovec *plain_v = alloca((plain_cnt + 1) * sizeof(EverCrypt_Helpers_iovec));
+  EverCrypt_Helpers_iovec *cipher_v = alloca((cipher_cnt + 1) * sizeof(EverCrypt_Helpers_iovec));
+  uint32_t ad_n = iov_slice(ad_v, ad, ad_cnt, 0, UINT64_MAX);
+  uint32_t plain_n = iov_slice(plain_v, plain, plain_cnt, 0, UINT64_MAX);
+  uint32_t cipher_n = iov_slice(cipher_v, cipher, cipher_cnt, 0, plain_len);
+  iov_tag(cipher, cipher_cnt, plain_len, tag, 0);
+
+  return EverCrypt_AEAD_decrypt_iov(key->aead, iv, 12, ad_n, ad_v, cipher_n, cipher_v, tag, plain_n, plain_v) == EverCrypt_Error_Success;
+}
+
 int MITLS_CALLCONV quic_crypto_hp_mask(quic_key *key, const unsigned char *sample, unsigned char *mask)
 {
   unsigned char block[16];
@@ -375,17 +524,266 @@ int MITLS_CALLCONV quic_crypto_hp_mask(quic_key *key, const unsigned char *sampl
 
   if(key->alg == TLS_aead_CHACHA20_POLY1305)
   {
-    uint8_t zero[5] = {0};
-    uint32_t ctr = sample[0] + (sample[1] << 8) + (sample[2] << 16) + (sample[3] << 24);
-
-    EverCrypt_Cipher_chacha20(5, mask, zero, (uint8_t*)key->pne.case_chacha20,
-        (uint8_t*)sample+4, ctr);
+    EverCrypt_Cipher_chacha20_hp_masks(1, mask, (uint8_t*)key->pne.case_chacha20, (uint8_t*)sample);
     return 1;
   }
 
   return 0;
 }
 
+int MITLS_CALLCONV quic_crypto_hp_masks(quic_key *key, size_t n, const unsigned char *samples, unsigned char *masks)
+{
+  if(key->alg == TLS_aead_CHACHA20_POLY1305)
+  {
+    if(n > UINT32_MAX / 16) return 0;
+    EverCrypt_Cipher_chacha20_hp_masks((uint32_t)n, masks, (uint8_t*)key->pne.case_chacha20, (uint8_t*)samples);
+    return 1;
+  }
+
+  for(size_t i = 0; i < n; i++)
+  {
+    if(!quic_crypto_hp_mask(key, samples + 16 * i, masks + 5 * i))
+      return 0;
+  }
+  return 1;
+}
+
+// Packet protection. Header protection covers the low bits of the first
+// byte and the packet number field; the 16-byte sample starts 4 bytes after
+// the start of the packet number field, whatever its length.
+#define QUIC_SAMPLE_OFFSET 4
+#define QUIC_BATCH 16
+
+static inline uint32_t pn_length(const unsigned char *base)
+{
+  return (base[0] & 3) + 1;
+}
+
+static inline void hp_apply(unsigned char *base, uint32_t pn_offset, uint32_t pn_len, const unsigned char *mask)
+{
+  base[0] ^= mask[0] & (base[0] & 0x80 ? 0x0f : 0x1f);
+  for(uint32_t i = 0; i < pn_len; i++)
+    base[pn_offset + i] ^= mask[1 + i];
+}
+
+// RFC 9000, A.3
+static uint64_t pn_decode(uint64_t largest_pn, uint64_t truncated, uint32_t pn_len)
+{
+  uint64_t expected = largest_pn + 1;
+  uint64_t win = (uint64_t)1 << (8 * pn_len);
+  uint64_t hwin = win / 2;
+  uint64_t candidate = (expected & ~(win - 1)) | truncated;
+  if(candidate + hwin <= expected && candidate < ((uint64_t)1 << 62) - win)
+    return candidate + win;
+  if(candidate > expected + hwin && candidate >= win)
+    return candidate - win;
+  return candidate;
+}
+
+// Returns the length of a packet to protect, or 0 if its fields are out
+// of range, it is too short to be sampled, or its buffer cannot hold it
+static uint32_t protect_length(const quic_packet *p)
+{
+  uint32_t hdr_len = p->pn_offset + pn_length(p->base);
+  if(p->pn_offset > UINT32_MAX - 20 || p->payload_len > UINT32_MAX - 16 - hdr_len)
+    return 0;
+  uint32_t len = hdr_len + p->payload_len + 16;
+  if(len < p->pn_offset + QUIC_SAMPLE_OFFSET + 16 || len > p->packet_len)
+    return 0;
+  return len;
+}
+
+static void write_pn(quic_packet *p, uint32_t len)
+{
+  uint32_t pn_len = pn_length(p->base);
+  for(uint32_t i = 0; i < pn_len; i++)
+    p->base[p->pn_offset + i] = (p->pn >> (8 * (pn_len - 1 - i))) & 255;
+  p->packet_len = len;
+}
+
+// Removes header protection with mask, and decodes the packet number
+static void unprotect_header(quic_packet *p, const unsigned char *mask, uint64_t largest_pn)
+{
+  uint64_t truncated = 0;
+  p->base[0] ^= mask[0] & (p->base[0] & 0x80 ? 0x0f : 0x1f);
+  uint32_t pn_len = pn_length(p->base);
+  for(uint32_t i = 0; i < pn_len; i++)
+  {
+    p->base[p->pn_offset + i] ^= mask[1 + i];
+    truncated = (truncated << 8) | p->base[p->pn_offset + i];
+  }
+  p->pn = pn_decode(largest_pn, truncated, pn_len);
+  p->payload_len = p->packet_len - p->pn_offset - pn_len - 16;
+}
+
+int MITLS_CALLCONV quic_crypto_protect_packet(quic_key *key, quic_packet *p)
+{
+  unsigned char mask[5];
+  uint32_t len = protect_length(p);
+  if(len == 0)
+    return 0;
+  write_pn(p, len);
+
+  uint32_t pn_len = pn_length(p->base);
+  uint32_t hdr_len = p->pn_offset + pn_len;
+  unsigned char *payload = p->base + hdr_len;
+  if(!quic_crypto_encrypt(key, payload, p->pn, p->base, hdr_len, payload, p->payload_len))
+    return 0;
+  if(!quic_crypto_hp_mask(key, p->base + p->pn_offset + QUIC_SAMPLE_OFFSET, mask))
+    return 0;
+  hp_apply(p->base, p->pn_offset, pn_len, mask);
+  return 1;
+}
+
+int MITLS_CALLCONV quic_crypto_unprotect_packet(quic_key *key, quic_packet *p, uint64_t largest_pn)
+{
+  unsigned char mask[5];
+  if(p->pn_offset > UINT32_MAX - 20 || p->packet_len < p->pn_offset + QUIC_SAMPLE_OFFSET + 16)
+    return 0;
+  if(!quic_crypto_hp_mask(key, p->base + p->pn_offset + QUIC_SAMPLE_OFFSET, mask))
+    return 0;
+  unprotect_header(p, mask, largest_pn);
+
+  uint32_t hdr_len = p->packet_len - p->payload_len - 16;
+  unsigned char *payload = p->base + hdr_len;
+  return quic_crypto_decrypt(key, payload, p->pn, p->base, hdr_len, payload, p->payload_len + 16);
+}
+
+// The packets are processed QUIC_BATCH at a time: the AEAD of all of them,
+// then all of their masks
+int MITLS_CALLCONV quic_crypto_protect_packets(quic_key *key, size_t n, quic_packet *p)
+{
+  unsigned char samples[QUIC_BATCH * 16];
+  unsigned char masks[QUIC_BATCH * 5];
+  unsigned char ivs[QUIC_BATCH][12];
+  EverCrypt_AEAD_state_s *s[QUIC_BATCH];
+  uint8_t *iv[QUIC_BATCH], *ad[QUIC_BATCH], *payload[QUIC_BATCH], *tag[QUIC_BATCH];
+  uint32_t ad_len[QUIC_BATCH], len[QUIC_BATCH];
+  EverCrypt_Error_error_code res[QUIC_BATCH];
+
+  // No packet is modified unless all of them can be protected
+  for(size_t i = 0; i < n; i++)
+    if(protect_length(&p[i]) == 0)
+      return 0;
+  for(size_t i = 0; i < n; i++)
+    write_pn(&p[i], protect_length(&p[i]));
+
+  for(size_t i0 = 0; i0 < n; i0 += QUIC_BATCH)
+  {
+    uint32_t m = n - i0 < QUIC_BATCH ? (uint32_t)(n - i0) : QUIC_BATCH;
+    quic_packet *q = p + i0;
+    for(uint32_t j = 0; j < m; j++)
+    {
+      ad_len[j] = q[j].pn_offset + pn_length(q[j].base);
+      s[j] = key->aead;
+      memcpy(ivs[j], key->static_iv, 12);
+      sn_to_iv(ivs[j], q[j].pn);
+      iv[j] = ivs[j];
+      ad[j] = q[j].base;
+      payload[j] = q[j].base + ad_len[j];
+      len[j] = q[j].payload_len;
+      tag[j] = payload[j] + len[j];
+    }
+    if(key->aead != NULL)
+    {
+      if(EverCrypt_AEAD_encrypt_batch(m, s, iv, 12, ad, ad_len, payload, len, payload, tag, res) != EverCrypt_Error_Success)
+        return 0;
+    }
+    else
+    {
+      for(uint32_t j = 0; j < m; j++)
+        if(!quic_crypto_encrypt(key, payload[j], q[j].pn, ad[j], ad_len[j], payload[j], len[j]))
+          return 0;
+    }
+
+    for(uint32_t j = 0; j < m; j++)
+      memcpy(samples + 16 * j, q[j].base + q[j].pn_offset + QUIC_SAMPLE_OFFSET, 16);
+    if(!quic_crypto_hp_masks(key, m, samples, masks))
+      return 0;
+    for(uint32_t j = 0; j < m; j++)
+      hp_apply(q[j].base, q[j].pn_offset, pn_length(q[j].base), masks + 5 * j);
+  }
+  return 1;
+}
+
+int MITLS_CALLCONV quic_crypto_unprotect_packets(quic_key *key, size_t n, quic_packet *p, uint64_t *largest_pn, int *ok)
+{
+  unsigned char samples[QUIC_BATCH * 16];
+  unsigned char masks[QUIC_BATCH * 5];
+  unsigned char ivs[QUIC_BATCH][12];
+  EverCrypt_AEAD_state_s *s[QUIC_BATCH];
+  uint8_t *iv[QUIC_BATCH], *ad[QUIC_BATCH], *payload[QUIC_BATCH], *tag[QUIC_BATCH];
+  uint32_t ad_len[QUIC_BATCH], len[QUIC_BATCH], idx[QUIC_BATCH];
+  EverCrypt_Error_error_code res[QUIC_BATCH];
+  uint64_t largest = *largest_pn;
+  int all = 1;
+
+  for(size_t i0 = 0; i0 < n; i0 += QUIC_BATCH)
+  {
+    size_t end = n - i0 < QUIC_BATCH ? n : i0 + QUIC_BATCH;
+    // The packets too short to be sampled fail right away
+    uint32_t m = 0;
+    for(size_t i = i0; i < end; i++)
+    {
+      ok[i] = 0;
+      if(p[i].pn_offset > UINT32_MAX - 20 || p[i].packet_len < p[i].pn_offset + QUIC_SAMPLE_OFFSET + 16)
+        all = 0;
+      else
+      {
+        memcpy(samples + 16 * m, p[i].base + p[i].pn_offset + QUIC_SAMPLE_OFFSET, 16);
+        idx[m++] = (uint32_t)(i - i0);
+      }
+    }
+    // The earlier batches are already decrypted in place: keep their results
+    // and fail the packets left
+    if(!quic_crypto_hp_masks(key, m, samples, masks))
+    {
+      for(size_t i = end; i < n; i++)
+        ok[i] = 0;
+      *largest_pn = largest;
+      return 0;
+    }
+
+    quic_packet *q = p + i0;
+    for(uint32_t j = 0; j < m; j++)
+    {
+      quic_packet *pj = &q[idx[j]];
+      unprotect_header(pj, masks + 5 * j, *largest_pn);
+      ad_len[j] = pj->packet_len - pj->payload_len - 16;
+      s[j] = key->aead;
+      memcpy(ivs[j], key->static_iv, 12);
+      sn_to_iv(ivs[j], pj->pn);
+      iv[j] = ivs[j];
+      ad[j] = pj->base;
+      payload[j] = pj->base + ad_len[j];
+      len[j] = pj->payload_len;
+      tag[j] = payload[j] + len[j];
+    }
+    if(key->aead != NULL)
+    {
+      EverCrypt_AEAD_decrypt_batch(m, s, iv, 12, ad, ad_len, payload, len, tag, payload, res);
+      for(uint32_t j = 0; j < m; j++)
+        ok[i0 + idx[j]] = res[j] == EverCrypt_Error_Success;
+    }
+    else
+    {
+      for(uint32_t j = 0; j < m; j++)
+        ok[i0 + idx[j]] = quic_crypto_decrypt(key, payload[j], q[idx[j]].pn, ad[j], ad_len[j], payload[j], len[j] + 16);
+    }
+
+    for(uint32_t j = 0; j < m; j++)
+    {
+      quic_packet *pj = &q[idx[j]];
+      if(!ok[i0 + idx[j]])
+        all = 0;
+      else if(pj->pn > largest)
+        largest = pj->pn;
+    }
+  }
+  *largest_pn = largest;
+  return all;
+}
+
 int MITLS_CALLCONV quic_crypto_free_key(quic_key *key)
 {
   if(key != NULL)
@@ -394,7 +792,131 @@ int MITLS_CALLCONV quic_crypto_free_key(quic_key *key)
       EverCrypt_aes128_free(key->pne.case_aes128);
     if(key->alg == TLS_aead_AES_256_GCM)
       EverCrypt_aes256_free(key->pne.case_aes256);
+    if(key->aead != NULL)
+      EverCrypt_AEAD_free(key->aead);
     KRML_HOST_FREE(key);
   }
   return 1;
 }
+
+// The key phase counters are read and written with acquire and release
+// semantics. MSVC's C compiler has no <stdatomic.h>, hence the interlocked
+// intrinsics there; _InterlockedCompareExchange64 is a full barrier, and is
+// also available on 32-bit x86.
+#if defined(_MSC_VER)
+#include <intrin.h>
+
+static inline uint64_t load_acquire(volatile uint64_t *p)
+{
+  return (uint64_t)_InterlockedCompareExchange64((volatile __int64 *)p, 0, 0);
+}
+
+static inline void store_release(volatile uint64_t *p, uint64_t v)
+{
+  __int64 old = (__int64)*p;
+  __int64 seen;
+  while((seen = _InterlockedCompareExchange64((volatile __int64 *)p, (__int64)v, old)) != old)
+    old = seen;
+}
+#else
+static inline uint64_t load_acquire(volatile uint64_t *p)
+{
+  return __atomic_load_n(p, __ATOMIC_ACQUIRE);
+}
+
+static inline void store_release(volatile uint64_t *p, uint64_t v)
+{
+  __atomic_store_n(p, v, __ATOMIC_RELEASE);
+}
+#endif
+
+struct quic_key_phase {
+  // The secret of the newest prepared generation, and its label
+  quic_secret secret;
+  char label[181];
+  // The header protection key of generation 0, which key updates keep
+  unsigned char hp[32];
+  // The key of generation g is in keys[g % 3]
+  quic_key *keys[3];
+  volatile uint64_t generation;
+  volatile uint64_t prepared;
+};
+
+int MITLS_CALLCONV quic_crypto_key_phase_create(quic_key_phase **kp, const quic_secret *secret, const char *label)
+{
+  if(strlen(label) > 180)
+    return 0;
+  quic_key_phase *p = KRML_HOST_CALLOC(1, sizeof(quic_key_phase));
+  if(!p) return 0;
+  p->secret = *secret;
+  strcpy(p->label, label);
+  if(!derive_hp_key(secret, p->hp) || !derive_key(&p->keys[0], secret, p->hp)
+    || !quic_crypto_key_phase_prepare(p))
+  {
+    quic_crypto_key_phase_free(p);
+    return 0;
+  }
+  *kp = p;
+  return 1;
+}
+
+int MITLS_CALLCONV quic_crypto_key_phase_prepare(quic_key_phase *kp)
+{
+  uint64_t g = load_acquire(&kp->generation);
+  uint64_t next = load_acquire(&kp->prepared);
+  quic_secret s;
+  quic_key *k;
+
+  if(next > g)
+    return 1;
+  if(!quic_crypto_tls_derive_secret(&s, &kp->secret, kp->label))
+    return 0;
+  // RFC 9001, 6: the header protection key is not updated
+  if(!derive_key(&k, &s, kp->hp))
+    return 0;
+
+  quic_crypto_free_key(kp->keys[(next + 1) % 3]);
+  kp->keys[(next + 1) % 3] = k;
+  kp->secret = s;
+  memset(&s, 0, sizeof(s));
+  // Publishes the key to the threads that see the new value
+  store_release(&kp->prepared, next + 1);
+  return 1;
+}
+
+int MITLS_CALLCONV quic_crypto_key_phase_update(quic_key_phase *kp)
+{
+  uint64_t g = load_acquire(&kp->generation);
+  if(load_acquire(&kp->prepared) <= g)
+    return 0;
+  store_release(&kp->generation, g + 1);
+  return 1;
+}
+
+uint64_t MITLS_CALLCONV quic_crypto_key_phase_generation(quic_key_phase *kp)
+{
+  return load_acquire(&kp->generation);
+}
+
+quic_key* MITLS_CALLCONV quic_crypto_key_phase_key(quic_key_phase *kp, int delta)
+{
+  uint64_t g = load_acquire(&kp->generation);
+  if(delta < -1 || delta > 1 || (delta < 0 && g == 0))
+    return NULL;
+  if(delta > 0 && load_acquire(&kp->prepared) <= g)
+    return NULL;
+  return kp->keys[(g + 3 + delta) % 3];
+}
+
+int MITLS_CALLCONV quic_crypto_key_phase_free(quic_key_phase *kp)
+{
+  if(kp != NULL)
+  {
+    for(int i = 0; i < 3; i++)
+      quic_crypto_free_key(kp->keys[i]);
+    memset(&kp->secret, 0, sizeof(kp->secret));
+    memset(kp->hp, 0, sizeof(kp->hp));
+    KRML_HOST_FREE(kp);
+  }
+  return 1;
+}
@@ -54,8 +54,9 @@ int MITLS_CALLCONV quic_crypto_derive_key(/*out*/quic_key **key, const quic_secr
 int MITLS_CALLCONV quic_crypto_create(quic_key **key, mitls_aead alg, const unsigned char *raw_key, const unsigned char *iv, const unsigned char *pne_key);
 
 // AEAD-encrypts plain with additional data ad, using counter sn,
-// writing plain_len + 16 bytes to the output cipher. The input and
-// output buffer must not overlap.
+// writing plain_len + 16 bytes to the output cipher. cipher may be
+// plain itself, to encrypt in place in the packet buffer; other overlaps
+// are not supported.
 //
 // The packet number sn is internally combined with the static IV
 // to form the 12-byte AEAD IV
@@ -65,17 +66,115 @@ int MITLS_CALLCONV quic_crypto_encrypt(quic_key *key, /*out*/ unsigned char *cip
 
 // AEAD-decrypts cipher and authenticate additional data ad, using
 // counter; when successful, writes cipher_len - 16 bytes to the
-// output plain. The input and output buffers must not overlap.
+// output plain. plain may be cipher itself, to decrypt in place; other
+// overlaps are not supported. When decryption fails, the contents of
+// plain are unspecified (in place, the ciphertext is not preserved).
 int MITLS_CALLCONV quic_crypto_decrypt(quic_key *key, /*out*/ unsigned char *plain, uint64_t sn, const unsigned char *ad, uint32_t ad_len, const unsigned char *cipher, uint32_t cipher_len);
 
+// A segment of a scattered packet buffer.
+typedef struct quic_iovec {
+  unsigned char *base;
+  uint32_t len;
+} quic_iovec;
+
+// Scatter/gather variants of quic_crypto_encrypt and quic_crypto_decrypt,
+// for packets held as chains of buffer segments. Segment boundaries need not
+// line up between the input and the output. As for the contiguous versions,
+// the ciphertext is plain_len + 16 bytes in total, the last 16 being the tag.
+// When decryption fails, the plaintext segments are zeroed.
+int MITLS_CALLCONV quic_crypto_encrypt_iov(quic_key *key, /*out*/ const quic_iovec *cipher, size_t cipher_cnt, uint64_t sn, const quic_iovec *ad, size_t ad_cnt, const quic_iovec *plain, size_t plain_cnt);
+int MITLS_CALLCONV quic_crypto_decrypt_iov(quic_key *key, /*out*/ const quic_iovec *plain, size_t plain_cnt, uint64_t sn, const quic_iovec *ad, size_t ad_cnt, const quic_iovec *cipher, size_t cipher_cnt);
+
 // Compute a one time pad to obfuscate the packet number from the encrypted packet contents
 // *sample must point to the start of the encrypted packet payload
 // 5 bytes will be written to *mask
 int MITLS_CALLCONV quic_crypto_hp_mask(quic_key *key, const unsigned char *sample, unsigned char *mask);
 
+// Batch variant of quic_crypto_hp_mask: the 16-byte sample of packet i is read
+// from samples + 16*i and its 5-byte mask is written to masks + 5*i. With
+// ChaCha20, the masks are computed up to 8 at a time by the vectorized cipher.
+int MITLS_CALLCONV quic_crypto_hp_masks(quic_key *key, size_t n, const unsigned char *samples, unsigned char *masks);
+
+// Fused packet protection (RFC 9001, 5): AEAD on the payload, with the
+// header as additional data, then header protection, in one call.
+// A packet is its header, whose packet number field of 1 to 4 bytes starts
+// at pn_offset and ends the header, followed by the payload. The length of
+// the packet number field is taken from the two low bits of the first byte;
+// headers with the high bit set are long headers, whose first four bits are
+// not protected, others are short headers.
+typedef struct quic_packet {
+  unsigned char *base;
+  uint32_t pn_offset;
+  // Protect: the length of the plaintext (in); the size of the buffer at
+  // base (in), then the length of the packet, which gains the 16-byte tag
+  // (out). Unprotect: the length of the packet (in), and of the plaintext
+  // (out).
+  uint32_t payload_len;
+  uint32_t packet_len;
+  // The full packet number: in for protect, out for unprotect.
+  uint64_t pn;
+} quic_packet;
+
+// Writes the low bytes of p->pn into the packet number field, encrypts the
+// payload in place and protects the header. Fails, leaving the packet
+// untouched, unless the buffer has room for the tag and the packet is long
+// enough to be sampled: at least 20 bytes from pn_offset on, tag included.
+int MITLS_CALLCONV quic_crypto_protect_packet(quic_key *key, quic_packet *p);
+
+// Removes header protection, decodes the packet number against the largest
+// one received so far (RFC 9000, A.3), and decrypts the payload in place.
+// When authentication fails, 0 is returned and the packet is left with its
+// header unprotected and its payload unspecified.
+int MITLS_CALLCONV quic_crypto_unprotect_packet(quic_key *key, quic_packet *p, uint64_t largest_pn);
+
+// Batch variants, for the n packets of p. The AEAD runs through
+// EverCrypt_AEAD_encrypt_batch or decrypt_batch and the masks through
+// quic_crypto_hp_masks. protect_packets checks all packets before it
+// modifies any of them, and returns 1 if all packets were protected.
+// unprotect_packets decodes the packet numbers of all packets against
+// *largest_pn, raises it to the largest number that authenticated, sets
+// ok[i] to the result of packet i, and returns 1 if all succeeded. If the
+// masks of a batch fail, the packets of the earlier batches keep their
+// results and the others get ok[i] = 0.
+int MITLS_CALLCONV quic_crypto_protect_packets(quic_key *key, size_t n, quic_packet *p);
+int MITLS_CALLCONV quic_crypto_unprotect_packets(quic_key *key, size_t n, quic_packet *p, uint64_t *largest_pn, /*out*/ int *ok);
+
 // Keys allocated by quic_crypto_derive_key and quic_crypto_create must be freed
 int MITLS_CALLCONV quic_crypto_free_key(quic_key *key);
 
+// Key updates (step 4 above) without derivation on the packet path. A
+// key phase holds the keys of three consecutive generations side by side:
+// the previous one, kept for reordered packets, the current one, and the
+// next one, derived ahead of time from the current secret with label
+// (as by quic_crypto_tls_derive_secret then quic_crypto_derive_key). All
+// generations keep the header protection key of generation 0 (RFC 9001,
+// 6).
+//
+// quic_crypto_key_phase_update only swaps the next generation in, with an
+// atomic increment, and fails if it has not been prepared yet.
+// quic_crypto_key_phase_prepare derives the generation after it, in the
+// slot of the generation before the previous one, whose key it frees: it
+// belongs off the packet path, e.g. once the old keys may be discarded.
+// update and key may be called from other threads than prepare, but calls
+// to update and to prepare must each be serialized.
+typedef struct quic_key_phase quic_key_phase;
+
+// Creates generation 0 from secret and prepares generation 1
+int MITLS_CALLCONV quic_crypto_key_phase_create(/*out*/ quic_key_phase **kp, const quic_secret *secret, const char *label);
+int MITLS_CALLCONV quic_crypto_key_phase_prepare(quic_key_phase *kp);
+int MITLS_CALLCONV quic_crypto_key_phase_update(quic_key_phase *kp);
+// The current generation; its low bit is the key phase bit of its packets
+uint64_t MITLS_CALLCONV quic_crypto_key_phase_generation(quic_key_phase *kp);
+// The key of the current generation plus delta, for delta -1, 0 or 1, or
+// NULL if it is not available. The key is owned by kp and is not reference
+// counted: the key of generation g is freed by the first call to
+// quic_crypto_key_phase_prepare once the current generation is g + 2. The
+// caller must make sure that no thread still uses it by then, e.g. by
+// calling prepare only after the packets in flight under the previous key
+// phase have been processed.
+quic_key* MITLS_CALLCONV quic_crypto_key_phase_key(quic_key_phase *kp, int delta);
+int MITLS_CALLCONV quic_crypto_key_phase_free(quic_key_phase *kp);
+
 // Auxiliary crypto functions, possibly useful elsewhere in QUIC.
 // Hash, HMAC and HKDF only suport SHA256, SHA384, and SHA512
 int MITLS_CALLCONV quic_crypto_hash(quic_hash a, /*out*/ unsigned char *hash, const unsigned char *data, size_t data_len);
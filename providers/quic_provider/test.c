@@ -3,6 +3,7 @@
 #include <stdint.h>
 #include <string.h>
 #include <assert.h>
+#include <pthread.h>
 
 #include "EverCrypt.h"
 #include "quic_provider.h"
@@ -37,6 +38,21 @@ void check_result(const char* testname, const unsigned char *actual, const unsig
     }
 }
 
+// The batch masks must match the ones computed one sample at a time.
+void check_hp_masks(quic_key *k)
+{
+  unsigned char samples[11 * 16];
+  unsigned char masks[11 * 5];
+  unsigned char mask[5];
+  for(int i = 0; i < 11 * 16; i++) samples[i] = i * 29 + 3;
+  assert(quic_crypto_hp_masks(k, 11, samples, masks) == 1);
+  for(int i = 0; i < 11; i++)
+  {
+    assert(quic_crypto_hp_mask(k, samples + 16 * i, mask) == 1);
+    check_result("PN encryption masks", masks + 5 * i, mask, sizeof(mask));
+  }
+}
+
 // Older coverage tests
 void coverage(void)
 {
@@ -135,6 +151,7 @@ void coverage(void)
     printf("PN encryption failed.\n");
     exit(1);
   }
+  check_hp_masks(k);
 
   if(quic_crypto_decrypt(k, hash, 0, salt, 13, cipher, 28+16)) {
     printf("DECRYPT SUCCESS: \n");
@@ -169,6 +186,7 @@ void coverage(void)
     printf("PN encryption failed.\n");
     exit(1);
   }
+  check_hp_masks(k);
 
   if(quic_crypto_decrypt(k, hash, 0x29e255a7, salt, 13, cipher, 28+16)) {
     printf("DECRYPT SUCCESS: \n");
@@ -472,6 +490,44 @@ void test_crypto(const quic_secret *secret, const unsigned char *expected_cipher
     }
     check_result("quic_crypto_decrypt", decrypted, plain, sizeof(decrypted));
 
+    // Same again, with every buffer split in two and the tag straddling
+    // the last two ciphertext segments
+    unsigned char cipher2[plain_len+16];
+    unsigned char decrypted2[plain_len];
+    quic_iovec ad_v[2] = { { (unsigned char *)ad, ad_len / 2 },
+        { (unsigned char *)ad + ad_len / 2, ad_len - ad_len / 2 } };
+    quic_iovec plain_v[2] = { { (unsigned char *)plain, 7 }, { (unsigned char *)plain + 7, plain_len - 7 } };
+    quic_iovec cipher_v[2] = { { cipher2, plain_len + 5 }, { cipher2 + plain_len + 5, 11 } };
+    quic_iovec decrypted_v[2] = { { decrypted2, plain_len - 3 }, { decrypted2 + plain_len - 3, 3 } };
+    result = quic_crypto_encrypt_iov(key, cipher_v, 2, sn, ad_v, 2, plain_v, 2);
+    if (result == 0) {
+        printf("FAIL: quic_crypto_encrypt_iov failed\n");
+        exit(1);
+    }
+    check_result("quic_crypto_encrypt_iov", cipher2, cipher, sizeof(cipher));
+    result = quic_crypto_decrypt_iov(key, decrypted_v, 2, sn, ad_v, 2, cipher_v, 2);
+    if (result == 0) {
+        printf("FAIL: quic_crypto_decrypt_iov failed\n");
+        exit(1);
+    }
+    check_result("quic_crypto_decrypt_iov", decrypted2, plain, sizeof(decrypted2));
+
+    // And in place, in a single packet buffer
+    unsigned char packet[plain_len+16];
+    memcpy(packet, plain, plain_len);
+    result = quic_crypto_encrypt(key, packet, sn, ad, ad_len, packet, plain_len);
+    if (result == 0) {
+        printf("FAIL: in-place quic_crypto_encrypt failed\n");
+        exit(1);
+    }
+    check_result("in-place quic_crypto_encrypt", packet, cipher, sizeof(cipher));
+    result = quic_crypto_decrypt(key, packet, sn, ad, ad_len, packet, sizeof(packet));
+    if (result == 0) {
+        printf("FAIL: in-place quic_crypto_decrypt failed\n");
+        exit(1);
+    }
+    check_result("in-place quic_crypto_decrypt", packet, plain, plain_len);
+
     result = quic_crypto_free_key(key);
     if (result == 0) {
         printf("FAIL: quic_crypto_free_key failed\n");
@@ -579,6 +635,250 @@ void test_initial_secrets()
     printf("==== PASS: test_initial_secrets ==== \n");
 }
 
+void test_packet_protection()
+{
+  printf("==== test_packet_protection() ====\n");
+
+  /* RFC 9001, A.5: ChaCha20-Poly1305 short header packet */
+  static const uint8_t key_bytes[] = {
+    0xc6,0xd9,0x8f,0xf3,0x44,0x1c,0x3f,0xe1,0xb2,0x18,0x20,0x94,0xf6,0x9c,0xaa,0x2e,
+    0xd4,0xb7,0x16,0xb6,0x54,0x88,0x96,0x0a,0x7a,0x98,0x49,0x79,0xfb,0x23,0xe1,0xc8 };
+  static const uint8_t iv[] = { 0xe0,0x45,0x9b,0x34,0x74,0xbd,0xd0,0xe4,0x4a,0x41,0xc1,0x44 };
+  static const uint8_t hp[] = {
+    0x25,0xa2,0x82,0xb9,0xe8,0x2f,0x06,0xf2,0x1f,0x48,0x89,0x17,0xa4,0xfc,0x8f,0x1b,
+    0x73,0x57,0x36,0x85,0x60,0x85,0x97,0xd0,0xef,0xcb,0x07,0x6b,0x0a,0xb7,0xa7,0xa4 };
+  static const uint8_t expected_packet[] = {
+    0x4c,0xfe,0x41,0x89,0x65,0x5e,0x5c,0xd5,0x5c,0x41,0xf6,0x90,0x80,0x57,0x5d,0x79,
+    0x99,0xc2,0x5a,0x5b,0xfb };
+  uint8_t packet[sizeof(expected_packet)] = { 0x42, 0x00, 0x00, 0x00, 0x01 };
+  quic_packet p;
+  quic_key *key;
+  int result;
+
+  result = quic_crypto_create(&key, TLS_aead_CHACHA20_POLY1305, key_bytes, iv, hp);
+  assert(result != 0);
+
+  p.base = packet;
+  p.pn_offset = 1;
+  p.payload_len = 1;
+  p.packet_len = sizeof(packet) - 1;
+  p.pn = 654360564;
+  result = quic_crypto_protect_packet(key, &p);
+  assert(result == 0 && packet[1] == 0);
+  p.packet_len = sizeof(packet);
+  result = quic_crypto_protect_packet(key, &p);
+  assert(result != 0 && p.packet_len == sizeof(expected_packet));
+  check_result("quic_crypto_protect_packet", packet, expected_packet, sizeof(packet));
+
+  memset(&p, 0, sizeof(p));
+  p.base = packet;
+  p.pn_offset = 1;
+  p.packet_len = sizeof(packet);
+  result = quic_crypto_unprotect_packet(key, &p, 654360563);
+  assert(result != 0 && p.pn == 654360564 && p.payload_len == 1 && packet[4] == 0x01);
+  quic_crypto_free_key(key);
+
+  /* Batches of AES-128-GCM long header packets, against the single packet functions */
+  enum { N = 21, LEN = 300 };
+  static uint8_t raw[32], buf1[N][LEN], buf2[N][LEN];
+  quic_packet p1[N], p2[N];
+  int ok[N];
+  uint64_t largest = 1000;
+
+  for (size_t i=0; i<sizeof(raw); ++i) raw[i] = (uint8_t)(3 * i);
+  result = quic_crypto_create(&key, TLS_aead_AES_128_GCM, raw, raw + 16, raw + 12);
+  assert(result != 0);
+
+  for (int i=0; i<N; ++i) {
+    for (int j=0; j<LEN; ++j) buf1[i][j] = (uint8_t)(i + 7 * j);
+    buf1[i][0] = 0xc0 | (i & 3);
+    p1[i].base = buf1[i];
+    p1[i].pn_offset = 18;
+    p1[i].payload_len = 3 + 11 * i;
+    p1[i].packet_len = LEN;
+    p1[i].pn = 1001 + i;
+    p2[i] = p1[i];
+    p2[i].base = buf2[i];
+    memcpy(buf2[i], buf1[i], LEN);
+    result = quic_crypto_protect_packet(key, &p1[i]);
+    assert(result != 0);
+  }
+  // A packet whose buffer is too small fails the batch before any packet is written
+  p2[N - 1].packet_len = 18 + ((N - 1) & 3) + 1 + p2[N - 1].payload_len + 15;
+  result = quic_crypto_protect_packets(key, N, p2);
+  assert(result == 0);
+  for (int i=0; i<N; ++i) assert(buf2[i][18] == (uint8_t)(i + 7 * 18));
+  p2[N - 1].packet_len = LEN;
+  result = quic_crypto_protect_packets(key, N, p2);
+  assert(result != 0);
+  for (int i=0; i<N; ++i) {
+    assert(p2[i].packet_len == p1[i].packet_len);
+    check_result("quic_crypto_protect_packets", buf2[i], buf1[i], p1[i].packet_len);
+  }
+
+  buf2[5][p2[5].packet_len - 1] ^= 1;
+  for (int i=0; i<N; ++i) p2[i].pn = 0;
+  result = quic_crypto_unprotect_packets(key, N, p2, &largest, ok);
+  assert(result == 0 && largest == 1000 + N);
+  for (int i=0; i<N; ++i) {
+    assert(ok[i] == (i != 5) && p2[i].pn == (uint64_t)(1001 + i));
+    assert(p2[i].payload_len == (uint32_t)(3 + 11 * i));
+    if (ok[i]) {
+      result = quic_crypto_unprotect_packet(key, &p1[i], 1000);
+      assert(result != 0);
+      check_result("quic_crypto_unprotect_packets", buf2[i], buf1[i], p1[i].packet_len - 16);
+    }
+  }
+  quic_crypto_free_key(key);
+
+  printf("==== PASS: test_packet_protection ==== \n");
+}
+
+void test_key_phase()
+{
+  printf("==== test_key_phase() ====\n");
+
+  quic_secret s0, s1, s2;
+  quic_key_phase *kp;
+  quic_key *k0, *k1, *k2;
+  static const unsigned char plain[] = "key update";
+  unsigned char expected[sizeof(plain) + 16], cipher[sizeof(plain) + 16];
+  int result;
+
+  s0.hash = TLS_hash_SHA256;
+  s0.ae = TLS_aead_AES_128_GCM;
+  for (unsigned char i=0; i<sizeof(s0.secret); ++i) s0.secret[i] = i;
+  result = quic_crypto_tls_derive_secret(&s1, &s0, "quic ku");
+  assert(result != 0);
+  result = quic_crypto_tls_derive_secret(&s2, &s1, "quic ku");
+  assert(result != 0);
+  result = quic_crypto_derive_key(&k0, &s0) && quic_crypto_derive_key(&k1, &s1) && quic_crypto_derive_key(&k2, &s2);
+  assert(result != 0);
+
+  result = quic_crypto_key_phase_create(&kp, &s0, "quic ku");
+  assert(result != 0);
+  assert(quic_crypto_key_phase_generation(kp) == 0);
+  assert(quic_crypto_key_phase_key(kp, -1) == NULL);
+
+  quic_key *cur = quic_crypto_key_phase_key(kp, 0);
+  quic_crypto_encrypt(k0, expected, 7, plain, 4, plain, sizeof(plain));
+  quic_crypto_encrypt(cur, cipher, 7, plain, 4, plain, sizeof(plain));
+  check_result("key phase generation 0", cipher, expected, sizeof(cipher));
+  quic_crypto_encrypt(k1, expected, 7, plain, 4, plain, sizeof(plain));
+  quic_crypto_encrypt(quic_crypto_key_phase_key(kp, 1), cipher, 7, plain, 4, plain, sizeof(plain));
+  check_result("key phase generation 1", cipher, expected, sizeof(cipher));
+
+  // The swap needs no derivation; the generation after it is not ready yet
+  result = quic_crypto_key_phase_update(kp);
+  assert(result != 0 && quic_crypto_key_phase_generation(kp) == 1);
+  assert(quic_crypto_key_phase_key(kp, -1) == cur && quic_crypto_key_phase_key(kp, 1) == NULL);
+  result = quic_crypto_key_phase_update(kp);
+  assert(result == 0 && quic_crypto_key_phase_generation(kp) == 1);
+
+  result = quic_crypto_key_phase_prepare(kp);
+  assert(result != 0 && quic_crypto_key_phase_key(kp, -1) == cur);
+  quic_crypto_encrypt(k2, expected, 7, plain, 4, plain, sizeof(plain));
+  quic_crypto_encrypt(quic_crypto_key_phase_key(kp, 1), cipher, 7, plain, 4, plain, sizeof(plain));
+  check_result("key phase generation 2", cipher, expected, sizeof(cipher));
+  result = quic_crypto_key_phase_update(kp);
+  assert(result != 0 && quic_crypto_key_phase_generation(kp) == 2);
+
+  // Packets of later generations keep the header protection of generation 0
+  unsigned char packet[64], header[5], mask[5];
+  quic_packet p;
+  for (uint64_t g=0; g<2; ++g) {
+    memset(packet, 0x33, sizeof(packet));
+    packet[0] = 0x43 | (g << 2);
+    memcpy(header, packet, 1);
+    p.base = packet;
+    p.pn_offset = 1;
+    p.payload_len = 30;
+    p.packet_len = sizeof(packet);
+    p.pn = 0x01020304 + g;
+    result = quic_crypto_protect_packet(quic_crypto_key_phase_key(kp, -1 + (int)g), &p);
+    assert(result != 0);
+    for (int i=0; i<4; ++i) header[1 + i] = (p.pn >> (24 - 8 * i)) & 255;
+    result = quic_crypto_hp_mask(k0, packet + 5, mask);
+    assert(result != 0);
+    assert((packet[0] ^ header[0]) == (mask[0] & 0x1f));
+    for (int i=0; i<4; ++i) assert((packet[1 + i] ^ header[1 + i]) == mask[1 + i]);
+
+    p.packet_len = p.payload_len + 21;
+    result = quic_crypto_unprotect_packet(quic_crypto_key_phase_key(kp, -1 + (int)g), &p, 0x01020300);
+    assert(result != 0 && p.pn == 0x01020304 + g && p.payload_len == 30);
+    check_result("key phase unprotect_packet", packet, header, sizeof(header));
+  }
+
+  quic_crypto_key_phase_free(kp);
+  quic_crypto_free_key(k0);
+  quic_crypto_free_key(k1);
+  quic_crypto_free_key(k2);
+
+  printf("==== PASS: test_key_phase ==== \n");
+}
+
+// Several threads encrypting and decrypting with one key, as a server
+// does: the key must not hold per-call state
+#define SHARED_THREADS 4
+#define SHARED_ROUNDS 2000
+#define SHARED_LEN 77
+
+static quic_key *shared_key;
+static unsigned char shared_expected[SHARED_THREADS][SHARED_LEN + 16];
+
+static void *shared_key_thread(void *arg)
+{
+  int t = (int)(size_t)arg;
+  unsigned char plain[SHARED_LEN], cipher[SHARED_LEN + 16], decrypted[SHARED_LEN];
+  unsigned char ad[13];
+  memset(plain, 'a' + t, sizeof(plain));
+  memset(ad, t, sizeof(ad));
+  for (int r=0; r<SHARED_ROUNDS; ++r) {
+    if (!quic_crypto_encrypt(shared_key, cipher, t, ad, sizeof(ad), plain, sizeof(plain))
+        || memcmp(cipher, shared_expected[t], sizeof(cipher)) != 0
+        || !quic_crypto_decrypt(shared_key, decrypted, t, ad, sizeof(ad), cipher, sizeof(cipher))
+        || memcmp(decrypted, plain, sizeof(plain)) != 0)
+      return (void *)1;
+  }
+  return NULL;
+}
+
+void test_shared_key()
+{
+  printf("==== test_shared_key() ====\n");
+
+  static const mitls_aead algs[3] = { TLS_aead_AES_128_GCM, TLS_aead_AES_256_GCM, TLS_aead_CHACHA20_POLY1305 };
+  unsigned char raw[44];
+  pthread_t threads[SHARED_THREADS];
+  int result;
+
+  for (size_t i=0; i<sizeof(raw); ++i) raw[i] = (unsigned char)(5 * i + 1);
+  for (int a=0; a<3; ++a) {
+    result = quic_crypto_create(&shared_key, algs[a], raw, raw + 32, raw);
+    assert(result != 0);
+    for (int t=0; t<SHARED_THREADS; ++t) {
+      unsigned char plain[SHARED_LEN], ad[13];
+      memset(plain, 'a' + t, sizeof(plain));
+      memset(ad, t, sizeof(ad));
+      result = quic_crypto_encrypt(shared_key, shared_expected[t], t, ad, sizeof(ad), plain, sizeof(plain));
+      assert(result != 0);
+    }
+    for (int t=0; t<SHARED_THREADS; ++t)
+      pthread_create(&threads[t], NULL, shared_key_thread, (void *)(size_t)t);
+    for (int t=0; t<SHARED_THREADS; ++t) {
+      void *failed;
+      pthread_join(threads[t], &failed);
+      if (failed != NULL) {
+        printf("FAIL: thread %d got a wrong result on a shared key\n", t);
+        exit(1);
+      }
+    }
+    quic_crypto_free_key(shared_key);
+  }
+
+  printf("==== PASS: test_shared_key ==== \n");
+}
+
 void exhaustive(void)
 {
     quic_secret secret;
@@ -596,6 +896,9 @@ void exhaustive(void)
 
     test_pn_encrypt();
     test_initial_secrets();
+    test_packet_protection();
+    test_key_phase();
+    test_shared_key();
 }
 
 int CDECL main(int argc, char **argv)
@@ -1,5 +1,7 @@
 #include "Hacl_Frodo_KEM.h"
+#include "EverCrypt_AutoConfig2.h"
 #include <stdio.h>
+#include <stdlib.h>
 #include <stdbool.h>
 
 bool
@@ -24,9 +26,42 @@ test_frodo()
   return true;
 }
 
+bool
+test_frodo_prepared()
+{
+  uint8_t pk[976U];
+  uint8_t sk[2016U];
+  uint8_t ct[1096U];
+  uint8_t ss1[16U];
+  uint8_t ss2[16U];
+  uint8_t ss3[16U];
+
+  Hacl_Frodo_KEM_crypto_kem_keypair(pk, sk);
+  Hacl_Frodo_KEM_prepared_pk_s *p = Hacl_Frodo_KEM_prepare_pk(pk);
+  Hacl_Frodo_KEM_crypto_kem_enc_prepared(ct, ss1, p);
+  Hacl_Frodo_KEM_crypto_kem_dec(ss2, ct, sk);
+  Hacl_Frodo_KEM_crypto_kem_dec_prepared(ss3, ct, sk, p);
+  Hacl_Frodo_KEM_free_prepared_pk(p);
+
+  for (int i = 0; i < 16; i++) {
+      if (ss1[i] != ss2[i] || ss1[i] != ss3[i]) {
+        return false;
+      }
+  }
+
+  return true;
+}
+
 int main()
 {
-  bool pass = test_frodo();
+  EverCrypt_AutoConfig2_init();
+  bool pass = test_frodo() && test_frodo_prepared();
+  if (EverCrypt_AutoConfig2_has_avx2())
+    {
+      // Also exercise the portable matrix kernels.
+      EverCrypt_AutoConfig2_disable_avx2();
+      pass = test_frodo() && test_frodo_prepared() && pass;
+    }
   if (pass)
     {
       printf("[FrodoKEM] Self-test: PASS\n");
@@ -36,5 +71,5 @@ int main()
       printf("[FrodoKEM] Self-test: FAIL\n");
     }
   
-  return 0;
+  return pass ? EXIT_SUCCESS : EXIT_FAILURE;
 }
@@ -0,0 +1,350 @@
+#include "Hacl_Frodo640_cSHAKE.h"
+#include "Hacl_Frodo640_AES.h"
+#include "Hacl_Frodo976_cSHAKE.h"
+#include "Hacl_Frodo976_AES.h"
+#include "Hacl_Frodo_KEM_Vec256.h"
+#include "EverCrypt_AutoConfig2.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <openssl/evp.h>
+
+// Known answers: count = 0 of the round-1 PQCkemKAT_<sk_len>.rsp files. PQCgenKAT_kem seeds the
+// NIST AES-256 CTR_DRBG with the bytes 0..47, draws the 48-byte seed of each count from it, and
+// reseeds it with that seed before keypair and enc. pk, sk and ct are given by their SHA3-256.
+typedef struct {
+  uint8_t pk[32U];
+  uint8_t sk[32U];
+  uint8_t ct[32U];
+  uint8_t ss[24U];
+} frodo_kat;
+
+static const frodo_kat kat_640_cshake = {
+  { 0xc8,0x36,0x79,0x8a,0xa5,0xb7,0x57,0xbe,0x84,0x7e,0x2c,0xbb,0x46,0x9c,0xdb,0xd4,
+    0x9f,0x8c,0x78,0x29,0x11,0xeb,0x5a,0xcc,0xc4,0x21,0x0b,0x14,0x60,0x7a,0x43,0xb9 },
+  { 0x5d,0xa9,0xb3,0xe1,0x65,0x40,0x9c,0xc1,0x00,0xc2,0x76,0xac,0x85,0x6d,0x3a,0xc1,
+    0x35,0xac,0xbc,0xb8,0x79,0x35,0x46,0x71,0xaf,0xcc,0x2d,0x9b,0x9a,0x52,0xd7,0x68 },
+  { 0x3b,0xf1,0x98,0x30,0x61,0xa4,0x26,0x6e,0xab,0xa3,0x68,0x0a,0xe9,0xb9,0x52,0xe3,
+    0x65,0x78,0x4b,0x85,0x22,0xd8,0xf4,0xec,0x60,0xe2,0x4e,0xc1,0x79,0x31,0x8c,0x82 },
+  { 0xd6,0x80,0x9e,0x2d,0xcb,0x2f,0x6e,0x9a,0x31,0x7a,0x18,0xde,0x0d,0x19,0x46,0x30 } };
+
+static const frodo_kat kat_640_aes = {
+  { 0xba,0xd4,0xf8,0x84,0xf0,0x78,0x7b,0x98,0x75,0xe4,0x40,0xc4,0x4e,0x42,0x53,0x9f,
+    0x5c,0x99,0x4b,0x34,0xdb,0x3d,0x73,0x1f,0xde,0x02,0x27,0xf8,0x11,0xd8,0x26,0x74 },
+  { 0x9c,0x52,0x33,0x21,0x64,0xe8,0x47,0x1b,0x64,0xdf,0x56,0x53,0x08,0x37,0xb1,0x4d,
+    0x7a,0x39,0x5d,0x8e,0x40,0x7b,0x56,0x6b,0x90,0xe5,0x1c,0x64,0x19,0xff,0x22,0xcb },
+  { 0x61,0x9d,0xe0,0x70,0x2c,0x50,0x4b,0x41,0x0e,0xd7,0x1c,0xff,0xd8,0x39,0x60,0x82,
+    0xdf,0x43,0x5f,0xb7,0xda,0x40,0x24,0xc1,0x7a,0x8e,0x49,0x3a,0x57,0x33,0xf2,0xd3 },
+  { 0xd3,0x11,0x1b,0xba,0xde,0x3b,0x94,0x71,0xb7,0x72,0x44,0x77,0x90,0x7a,0xbc,0xdb } };
+
+static const frodo_kat kat_976_cshake = {
+  { 0xa1,0x36,0x38,0xde,0xe0,0x74,0x3a,0x85,0xde,0x48,0x3d,0x14,0x71,0x97,0xf9,0xca,
+    0xc2,0x40,0xf6,0x1a,0x39,0x95,0x72,0x0a,0xca,0x40,0xd0,0x67,0x40,0x5d,0x14,0x98 },
+  { 0x5f,0xbd,0x93,0x2d,0xa1,0x90,0x88,0xa2,0x09,0x92,0xa6,0x77,0xc9,0xfb,0x62,0x6f,
+    0x66,0x71,0x24,0xb0,0x9d,0xe8,0x01,0xd6,0xcc,0x42,0x6b,0x98,0x9c,0x73,0xf8,0xeb },
+  { 0x18,0x0b,0x0e,0xce,0x27,0x78,0x95,0xd8,0x47,0xb0,0xff,0xdc,0x73,0x41,0xd4,0x8a,
+    0x6a,0x43,0xd7,0xfa,0xf4,0xa3,0x15,0xc9,0x1e,0x79,0xb0,0xcc,0x45,0xa7,0x80,0x9c },
+  { 0x04,0xfe,0xde,0x17,0x3d,0x41,0x53,0x76,0x8d,0x6d,0x04,0xd7,0x46,0x79,0xcb,0xc8,
+    0xd7,0x7d,0x69,0x2e,0xf8,0xb1,0xbc,0x8d } };
+
+static const frodo_kat kat_976_aes = {
+  { 0x64,0xb6,0x50,0x9b,0x64,0xfc,0xbf,0xec,0x3c,0x9b,0xf9,0x6c,0x2a,0xa2,0x2c,0x90,
+    0x42,0x1f,0xc9,0x0e,0xab,0x8d,0x05,0xaa,0x40,0xa3,0x7b,0x93,0x41,0xe2,0x50,0xfe },
+  { 0x1b,0x6a,0x53,0x40,0x14,0xd9,0x14,0xc7,0x78,0xde,0x8f,0xd3,0x80,0x00,0xd4,0x39,
+    0xba,0x2d,0x09,0xd9,0x36,0x28,0x06,0xbc,0x98,0x92,0xd6,0x24,0xe6,0x92,0xfe,0x9c },
+  { 0x83,0x21,0xa1,0xed,0xa2,0xa9,0x02,0x30,0xa4,0xc5,0x62,0x88,0xbb,0xd0,0x97,0x61,
+    0x7c,0x67,0xe0,0x12,0xce,0x28,0xf5,0x02,0xb5,0xc6,0xb8,0x48,0x59,0xc4,0x0e,0xc8 },
+  { 0x88,0x27,0xdd,0x74,0xd1,0xbe,0x9d,0x22,0x40,0x52,0xa6,0x20,0x24,0x49,0x2e,0x18,
+    0xe7,0x5c,0xaa,0x2a,0x16,0x0c,0xce,0xd2 } };
+
+typedef struct {
+  const char *name;
+  uint32_t (*keypair)(uint8_t *pk, uint8_t *sk);
+  uint32_t (*enc)(uint8_t *ct, uint8_t *ss, uint8_t *pk);
+  uint32_t (*dec)(uint8_t *ss, uint8_t *ct, uint8_t *sk);
+  size_t pk_len;
+  size_t sk_len;
+  size_t ct_len;
+  size_t ss_len;
+  const frodo_kat *kat;
+} frodo_kem;
+
+static frodo_kem kems[] = {
+  { "FrodoKEM-640-cSHAKE", Hacl_Frodo640_cSHAKE_crypto_kem_keypair,
+    Hacl_Frodo640_cSHAKE_crypto_kem_enc, Hacl_Frodo640_cSHAKE_crypto_kem_dec,
+    9616U, 19872U, 9736U, 16U, &kat_640_cshake },
+  { "FrodoKEM-640-AES", Hacl_Frodo640_AES_crypto_kem_keypair,
+    Hacl_Frodo640_AES_crypto_kem_enc, Hacl_Frodo640_AES_crypto_kem_dec,
+    9616U, 19872U, 9736U, 16U, &kat_640_aes },
+  { "FrodoKEM-976-cSHAKE", Hacl_Frodo976_cSHAKE_crypto_kem_keypair,
+    Hacl_Frodo976_cSHAKE_crypto_kem_enc, Hacl_Frodo976_cSHAKE_crypto_kem_dec,
+    15632U, 31272U, 15768U, 24U, &kat_976_cshake },
+  { "FrodoKEM-976-AES", Hacl_Frodo976_AES_crypto_kem_keypair,
+    Hacl_Frodo976_AES_crypto_kem_enc, Hacl_Frodo976_AES_crypto_kem_dec,
+    15632U, 31272U, 15768U, 24U, &kat_976_aes },
+};
+
+// The NIST PQC randombytes (rng.c), which replaces Lib_RandomBuffer_System_randombytes at link
+// time so that the key pairs and encapsulations below are deterministic.
+static uint8_t drbg_key[32U];
+static uint8_t drbg_v[16U];
+
+static void
+drbg_block(uint8_t *out)
+{
+  for (int i = 15; i >= 0 && ++drbg_v[i] == 0U; i--)
+    ;
+  EVP_CIPHER_CTX *ctx = EVP_CIPHER_CTX_new();
+  int out_len;
+  EVP_EncryptInit_ex(ctx, EVP_aes_256_ecb(), NULL, drbg_key, NULL);
+  EVP_EncryptUpdate(ctx, out, &out_len, drbg_v, 16);
+  EVP_CIPHER_CTX_free(ctx);
+}
+
+static void
+drbg_update(const uint8_t *provided)
+{
+  uint8_t tmp[48U];
+  for (int i = 0; i < 3; i++)
+    drbg_block(tmp + 16 * i);
+  if (provided != NULL)
+    for (int i = 0; i < 48; i++)
+      tmp[i] ^= provided[i];
+  memcpy(drbg_key, tmp, 32U);
+  memcpy(drbg_v, tmp + 32U, 16U);
+}
+
+static void
+randombytes_init(const uint8_t *entropy)
+{
+  memset(drbg_key, 0, 32U);
+  memset(drbg_v, 0, 16U);
+  drbg_update(entropy);
+}
+
+bool
+Lib_RandomBuffer_System_randombytes(uint8_t *x, uint32_t len)
+{
+  uint8_t block[16U];
+  while (len > 0U)
+    {
+      uint32_t n = len < 16U ? len : 16U;
+      drbg_block(block);
+      memcpy(x, block, n);
+      x += n;
+      len -= n;
+    }
+  drbg_update(NULL);
+  return true;
+}
+
+bool
+test_kat(frodo_kem *k)
+{
+  uint8_t entropy[48U];
+  uint8_t seed[48U];
+  for (int i = 0; i < 48; i++)
+    entropy[i] = (uint8_t)i;
+  randombytes_init(entropy);
+  Lib_RandomBuffer_System_randombytes(seed, 48U);
+  randombytes_init(seed);
+
+  uint8_t *pk = malloc(k->pk_len);
+  uint8_t *sk = malloc(k->sk_len);
+  uint8_t *ct = malloc(k->ct_len);
+  uint8_t ss1[24U];
+  uint8_t ss2[24U];
+  uint8_t h[32U];
+  bool ok = true;
+
+  k->keypair(pk, sk);
+  k->enc(ct, ss1, pk);
+  k->dec(ss2, ct, sk);
+  EVP_Digest(pk, k->pk_len, h, NULL, EVP_sha3_256(), NULL);
+  ok = ok && memcmp(h, k->kat->pk, 32U) == 0;
+  EVP_Digest(sk, k->sk_len, h, NULL, EVP_sha3_256(), NULL);
+  ok = ok && memcmp(h, k->kat->sk, 32U) == 0;
+  EVP_Digest(ct, k->ct_len, h, NULL, EVP_sha3_256(), NULL);
+  ok = ok && memcmp(h, k->kat->ct, 32U) == 0;
+  ok = ok && memcmp(ss1, k->kat->ss, k->ss_len) == 0;
+  ok = ok && memcmp(ss2, k->kat->ss, k->ss_len) == 0;
+
+  free(pk);
+  free(sk);
+  free(ct);
+  return ok;
+}
+
+bool
+test_frodo(frodo_kem *k)
+{
+  uint8_t *pk = malloc(k->pk_len);
+  uint8_t *sk = malloc(k->sk_len);
+  uint8_t *ct = malloc(k->ct_len);
+  uint8_t ss1[24U];
+  uint8_t ss2[24U];
+
+  k->keypair(pk, sk);
+  k->enc(ct, ss1, pk);
+  k->dec(ss2, ct, sk);
+  bool ok = memcmp(ss1, ss2, k->ss_len) == 0;
+
+  // A corrupted ciphertext must be implicitly rejected.
+  ct[0U] ^= 1U;
+  k->dec(ss2, ct, sk);
+  ok = ok && memcmp(ss1, ss2, k->ss_len) != 0;
+
+  free(pk);
+  free(sk);
+  free(ct);
+  return ok;
+}
+
+// Encapsulations and decapsulations through a prepared public key must agree
+// with the plain ones.
+#define TEST_PREPARED(M, pk_len, sk_len, ct_len, ss_len)                  \
+  bool                                                                     \
+  test_prepared_##M()                                                      \
+  {                                                                        \
+    uint8_t *pk = malloc(pk_len);                                          \
+    uint8_t *sk = malloc(sk_len);                                          \
+    uint8_t *ct = malloc(ct_len);                                          \
+    uint8_t ss1[24U];                                                      \
+    uint8_t ss2[24U];                                                      \
+    uint8_t ss3[24U];                                                      \
+    M##_crypto_kem_keypair(pk, sk);                                        \
+    M##_prepared_pk_s *p = M##_prepare_pk(pk);                             \
+    M##_crypto_kem_enc_prepared(ct, ss1, p);                               \
+    M##_crypto_kem_dec(ss2, ct, sk);                                       \
+    M##_crypto_kem_dec_prepared(ss3, ct, sk, p);                           \
+    bool ok = memcmp(ss1, ss2, ss_len) == 0;                               \
+    ok = ok && memcmp(ss1, ss3, ss_len) == 0;                              \
+    M##_crypto_kem_enc(ct, ss1, pk);                                       \
+    M##_crypto_kem_dec_prepared(ss2, ct, sk, p);                           \
+    ok = ok && memcmp(ss1, ss2, ss_len) == 0;                              \
+    M##_free_prepared_pk(p);                                               \
+    free(pk);                                                              \
+    free(sk);                                                              \
+    free(ct);                                                              \
+    if (!ok)                                                               \
+      {                                                                    \
+        printf("[%s] prepared: FAIL\n", #M);                               \
+      }                                                                    \
+    return ok;                                                             \
+  }
+
+TEST_PREPARED(Hacl_Frodo640_cSHAKE, 9616U, 19872U, 9736U, 16U)
+TEST_PREPARED(Hacl_Frodo640_AES, 9616U, 19872U, 9736U, 16U)
+TEST_PREPARED(Hacl_Frodo976_cSHAKE, 15632U, 31272U, 15768U, 24U)
+TEST_PREPARED(Hacl_Frodo976_AES, 15632U, 31272U, 15768U, 24U)
+
+// Reference bit-by-bit packing, most significant bit first.
+void
+pack_ref(size_t len, uint32_t d, uint16_t *a, uint8_t *res)
+{
+  memset(res, 0, len * d / 8);
+  for (size_t i = 0; i < len * d; i++)
+    {
+      uint16_t bit = (a[i / d] >> (d - 1 - i % d)) & 1U;
+      res[i / 8] |= (uint8_t)(bit << (7 - i % 8));
+    }
+}
+
+uint16_t
+sample_ref(uint16_t r, uint32_t bound, const uint16_t *cdf)
+{
+  uint16_t t = 0;
+  for (uint32_t i = 0; i < bound; i++)
+    t += (r >> 1) > cdf[i];
+  return r & 1U ? (uint16_t)-t : t;
+}
+
+bool
+test_vec256_kernels()
+{
+  static const uint16_t cdf[11U] =
+    { 5638, 15915, 23689, 28571, 31116, 32217, 32613, 32731, 32760, 32766, 32767 };
+  uint16_t a[128U];
+  uint16_t b[128U];
+  uint8_t r[256U];
+  uint8_t p1[256U];
+  uint8_t p2[256U];
+  bool ok = true;
+  for (int i = 0; i < 256; i++)
+    r[i] = (uint8_t)(i * 73 + 11);
+  for (int i = 0; i < 128; i++)
+    a[i] = (uint16_t)(r[2 * i] | r[(2 * i + 1)] << 8);
+  for (uint32_t d = 15U; d <= 16U; d++)
+    {
+      Hacl_Impl_Frodo_Vec256_pack(128U, d, a, p1);
+      pack_ref(128U, d, a, p2);
+      ok = ok && memcmp(p1, p2, 16U * d) == 0;
+      Hacl_Impl_Frodo_Vec256_unpack(128U, d, p1, b);
+      for (int i = 0; i < 128; i++)
+        ok = ok && b[i] == (uint16_t)(a[i] & ((1U << d) - 1U));
+    }
+  Hacl_Impl_Frodo_Vec256_sample(128U, 10U, cdf, r, b);
+  for (int i = 0; i < 128; i++)
+    ok = ok && b[i] == sample_ref(a[i], 10U, cdf);
+  printf("FrodoKEM AVX2 sample/pack/unpack: %s\n", ok ? "PASS" : "FAIL");
+  return ok;
+}
+
+bool
+test_all()
+{
+  bool pass = true;
+  for (size_t i = 0; i < sizeof kems / sizeof kems[0]; i++)
+    {
+      bool ok = test_frodo(&kems[i]);
+      if (!ok)
+        {
+          printf("[%s] FAIL\n", kems[i].name);
+        }
+      pass = ok && pass;
+      ok = test_kat(&kems[i]);
+      if (!ok)
+        {
+          printf("[%s] KAT: FAIL\n", kems[i].name);
+        }
+      pass = ok && pass;
+    }
+  pass = test_prepared_Hacl_Frodo640_cSHAKE() && pass;
+  pass = test_prepared_Hacl_Frodo640_AES() && pass;
+  pass = test_prepared_Hacl_Frodo976_cSHAKE() && pass;
+  pass = test_prepared_Hacl_Frodo976_AES() && pass;
+  return pass;
+}
+
+int main()
+{
+  EverCrypt_AutoConfig2_init();
+  bool pass = test_all();
+  if (EverCrypt_AutoConfig2_has_avx2())
+    {
+      pass = test_vec256_kernels() && pass;
+    }
+  if (EverCrypt_AutoConfig2_has_avx2())
+    {
+      // Also exercise the portable matrix kernels.
+      EverCrypt_AutoConfig2_disable_avx2();
+      pass = test_all() && pass;
+    }
+  if (EverCrypt_AutoConfig2_has_aesni())
+    {
+      // And the portable AES fallback used to expand A.
+      EverCrypt_AutoConfig2_disable_aesni();
+      pass = test_all() && pass;
+    }
+  if (pass)
+    {
+      printf("[FrodoKEM] Self-test: PASS\n");
+    }
+  else
+    {
+      printf("[FrodoKEM] Self-test: FAIL\n");
+    }
+
+  return pass ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,690 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <pthread.h>
+
+#include <openssl/evp.h>
+
+#include "EverCrypt_AEAD.h"
+#include "EverCrypt_AutoConfig2.h"
+
+#define NTHREADS 4
+#define ROUNDS   2000
+#define MAX_LEN  1024
+#define AD_LEN   37
+#define MAX_SEGS 64
+
+typedef struct {
+  const char *name;
+  Spec_Agile_AEAD_alg alg;
+  const EVP_CIPHER *(*openssl)(void);
+  uint32_t iv_len;
+  // For XChaCha20-Poly1305, the key and nonce that OpenSSL's ChaCha20-Poly1305 runs under.
+  void (*derive)(uint8_t *k1, uint8_t *n1, uint8_t *k, uint8_t *n);
+} aead;
+
+static aead aeads[] = {
+  { "AES128-GCM", Spec_Agile_AEAD_AES128_GCM, EVP_aes_128_gcm, 12U, NULL },
+  { "AES256-GCM", Spec_Agile_AEAD_AES256_GCM, EVP_aes_256_gcm, 12U, NULL },
+  { "Chacha20-Poly1305", Spec_Agile_AEAD_CHACHA20_POLY1305, EVP_chacha20_poly1305, 12U, NULL },
+  { "XChacha20-Poly1305", Spec_Agile_AEAD_XCHACHA20_POLY1305, EVP_chacha20_poly1305, 24U,
+    EverCrypt_Chacha20Poly1305_xchacha20_derive },
+};
+
+static uint8_t key[32U];
+static uint8_t iv[24U];
+static uint8_t ad[AD_LEN];
+static uint8_t plain[MAX_LEN];
+
+// Lengths that exercise the 6-block bulk path, the single block path and a
+// partial last block.
+static uint32_t lens[] = { 0U, 1U, 15U, 16U, 17U, 95U, 96U, 289U, 300U, MAX_LEN };
+
+void
+openssl_encrypt(
+  aead *a,
+  uint8_t *ad,
+  uint8_t *plain,
+  uint32_t len,
+  uint8_t *cipher,
+  uint8_t *tag
+)
+{
+  EVP_CIPHER_CTX *ctx = EVP_CIPHER_CTX_new();
+  int out_len;
+  uint8_t k1[32U];
+  uint8_t n1[12U];
+  if (a->derive != NULL)
+    a->derive(k1, n1, key, iv);
+  else
+    {
+      memcpy(k1, key, 32U);
+      memcpy(n1, iv, 12U);
+    }
+  EVP_EncryptInit_ex(ctx, a->openssl(), NULL, k1, n1);
+  EVP_EncryptUpdate(ctx, NULL, &out_len, ad, AD_LEN);
+  EVP_EncryptUpdate(ctx, cipher, &out_len, plain, len);
+  EVP_EncryptFinal_ex(ctx, cipher + out_len, &out_len);
+  EVP_CIPHER_CTX_ctrl(ctx, EVP_CTRL_AEAD_GET_TAG, 16, tag);
+  EVP_CIPHER_CTX_free(ctx);
+}
+
+bool
+test_vs_openssl(aead *a, EverCrypt_AEAD_state_s *s)
+{
+  uint8_t cipher[MAX_LEN];
+  uint8_t expected[MAX_LEN];
+  uint8_t decrypted[MAX_LEN];
+  uint8_t tag[16U];
+  uint8_t expected_tag[16U];
+  bool ok = true;
+  for (size_t i = 0; i < sizeof lens / sizeof lens[0]; i++)
+    {
+      uint32_t len = lens[i];
+      openssl_encrypt(a, ad, plain, len, expected, expected_tag);
+      EverCrypt_AEAD_encrypt(s, iv, a->iv_len, ad, AD_LEN, plain, len, cipher, tag);
+      ok = ok && memcmp(cipher, expected, len) == 0;
+      ok = ok && memcmp(tag, expected_tag, 16U) == 0;
+      EverCrypt_Error_error_code
+        r = EverCrypt_AEAD_decrypt(s, iv, a->iv_len, ad, AD_LEN, cipher, len, tag, decrypted);
+      ok = ok && r == EverCrypt_Error_Success && memcmp(decrypted, plain, len) == 0;
+      tag[0U] ^= 1U;
+      r = EverCrypt_AEAD_decrypt(s, iv, a->iv_len, ad, AD_LEN, cipher, len, tag, decrypted);
+      ok = ok && r == EverCrypt_Error_AuthenticationFailure;
+    }
+  return ok;
+}
+
+// Encryption and decryption with the output buffer equal to the input buffer, through the
+// key object and through the _expand variants.
+bool
+test_aliased(aead *a, EverCrypt_AEAD_state_s *s)
+{
+  uint8_t buf[MAX_LEN];
+  uint8_t expected[MAX_LEN];
+  uint8_t tag[16U];
+  uint8_t expected_tag[16U];
+  bool ok = true;
+  for (size_t i = 0; i < sizeof lens / sizeof lens[0]; i++)
+    {
+      uint32_t len = lens[i];
+      openssl_encrypt(a, ad, plain, len, expected, expected_tag);
+      memcpy(buf, plain, len);
+      EverCrypt_AEAD_encrypt(s, iv, a->iv_len, ad, AD_LEN, buf, len, buf, tag);
+      ok = ok && memcmp(buf, expected, len) == 0;
+      ok = ok && memcmp(tag, expected_tag, 16U) == 0;
+      EverCrypt_Error_error_code
+        r = EverCrypt_AEAD_decrypt(s, iv, a->iv_len, ad, AD_LEN, buf, len, tag, buf);
+      ok = ok && r == EverCrypt_Error_Success && memcmp(buf, plain, len) == 0;
+      EverCrypt_AEAD_encrypt_expand(a->alg, key, iv, a->iv_len, ad, AD_LEN, buf, len, buf, tag);
+      ok = ok && memcmp(buf, expected, len) == 0;
+      ok = ok && memcmp(tag, expected_tag, 16U) == 0;
+      r = EverCrypt_AEAD_decrypt_expand(a->alg, key, iv, a->iv_len, ad, AD_LEN, buf, len, tag, buf);
+      ok = ok && r == EverCrypt_Error_Success && memcmp(buf, plain, len) == 0;
+    }
+  return ok;
+}
+
+// Cuts len bytes at buf into segments of pseudo-random lengths, some of them empty.
+uint32_t
+split(uint8_t *buf, uint32_t len, uint32_t seed, EverCrypt_Helpers_iovec *segs)
+{
+  uint32_t n = 0U;
+  uint32_t off = 0U;
+  while (off < len && n < MAX_SEGS - 1U)
+    {
+      seed = seed * 1103515245U + 12345U;
+      uint32_t l = (seed >> 16) % 150U;
+      if (l > len - off)
+        l = len - off;
+      segs[n].base = buf + off;
+      segs[n].len = l;
+      off += l;
+      n++;
+    }
+  segs[n].base = buf + off;
+  segs[n].len = len - off;
+  return n + 1U;
+}
+
+// The scatter/gather variants, with segment boundaries that do not line up between the
+// input and the output.
+bool
+test_iov(aead *a, EverCrypt_AEAD_state_s *s)
+{
+  uint8_t cipher[MAX_LEN];
+  uint8_t expected[MAX_LEN];
+  uint8_t decrypted[MAX_LEN];
+  uint8_t tag[16U];
+  uint8_t expected_tag[16U];
+  EverCrypt_Helpers_iovec ad_v[MAX_SEGS];
+  EverCrypt_Helpers_iovec in_v[MAX_SEGS];
+  EverCrypt_Helpers_iovec out_v[MAX_SEGS];
+  bool ok = true;
+  for (size_t i = 0; i < sizeof lens / sizeof lens[0]; i++)
+    {
+      uint32_t len = lens[i];
+      openssl_encrypt(a, ad, plain, len, expected, expected_tag);
+      for (uint32_t seed = 0U; seed < 8U; seed++)
+        {
+          uint32_t ad_n = split(ad, AD_LEN, seed, ad_v);
+          uint32_t in_n = split(plain, len, seed + 100U, in_v);
+          uint32_t out_n = split(cipher, len, seed + 200U, out_v);
+          EverCrypt_Error_error_code
+            r = EverCrypt_AEAD_encrypt_iov(s, iv, a->iv_len, ad_n, ad_v, in_n, in_v, out_n, out_v, tag);
+          ok = ok && r == EverCrypt_Error_Success;
+          ok = ok && memcmp(cipher, expected, len) == 0;
+          ok = ok && memcmp(tag, expected_tag, 16U) == 0;
+          in_n = split(cipher, len, seed + 300U, in_v);
+          out_n = split(decrypted, len, seed + 400U, out_v);
+          r = EverCrypt_AEAD_decrypt_iov(s, iv, a->iv_len, ad_n, ad_v, in_n, in_v, tag, out_n, out_v);
+          ok = ok && r == EverCrypt_Error_Success && memcmp(decrypted, plain, len) == 0;
+          tag[0U] ^= 1U;
+          r = EverCrypt_AEAD_decrypt_iov(s, iv, a->iv_len, ad_n, ad_v, in_n, in_v, tag, out_n, out_v);
+          ok = ok && r == EverCrypt_Error_AuthenticationFailure;
+          for (uint32_t j = 0U; j < len; j++)
+            ok = ok && decrypted[j] == 0U;
+        }
+    }
+  // Mismatched plaintext and ciphertext lengths are rejected.
+  in_v[0U].base = plain;
+  in_v[0U].len = 16U;
+  out_v[0U].base = cipher;
+  out_v[0U].len = 15U;
+  EverCrypt_Error_error_code
+    r = EverCrypt_AEAD_encrypt_iov(s, iv, a->iv_len, 0U, ad_v, 1U, in_v, 1U, out_v, tag);
+  ok = ok && r == EverCrypt_Error_DecodeError;
+  return ok;
+}
+
+// The incremental API, fed with chunks of pseudo-random lengths that differ between
+// encryption and decryption.
+bool
+test_stream(aead *a, EverCrypt_AEAD_state_s *s)
+{
+  uint8_t cipher[MAX_LEN];
+  uint8_t expected[MAX_LEN];
+  uint8_t decrypted[MAX_LEN];
+  uint8_t tag[16U];
+  uint8_t expected_tag[16U];
+  EverCrypt_Helpers_iovec chunks[MAX_SEGS];
+  EverCrypt_AEAD_stream st;
+  bool ok = true;
+  for (size_t i = 0; i < sizeof lens / sizeof lens[0]; i++)
+    {
+      uint32_t len = lens[i];
+      openssl_encrypt(a, ad, plain, len, expected, expected_tag);
+      for (uint32_t seed = 0U; seed < 8U; seed++)
+        {
+          ok = ok && EverCrypt_AEAD_encrypt_init(&st, s, iv, a->iv_len, ad, AD_LEN) == 0U;
+          uint32_t n = split(plain, len, seed, chunks);
+          for (uint32_t j = 0U; j < n; j++)
+            {
+              uint8_t *c = cipher + (chunks[j].base - plain);
+              ok = ok && EverCrypt_AEAD_encrypt_update(&st, chunks[j].base, chunks[j].len, c) == 0U;
+            }
+          ok = ok && EverCrypt_AEAD_encrypt_finish(&st, tag) == EverCrypt_Error_Success;
+          ok = ok && memcmp(cipher, expected, len) == 0;
+          ok = ok && memcmp(tag, expected_tag, 16U) == 0;
+          // The context must be initialized again after finish.
+          EverCrypt_Error_error_code r = EverCrypt_AEAD_encrypt_update(&st, plain, 1U, cipher);
+          ok = ok && r == EverCrypt_Error_DecodeError;
+
+          ok = ok && EverCrypt_AEAD_decrypt_init(&st, s, iv, a->iv_len, ad, AD_LEN) == 0U;
+          r = EverCrypt_AEAD_encrypt_update(&st, plain, 1U, cipher);
+          ok = ok && r == EverCrypt_Error_DecodeError;
+          n = split(cipher, len, seed + 100U, chunks);
+          for (uint32_t j = 0U; j < n; j++)
+            {
+              uint8_t *d = decrypted + (chunks[j].base - cipher);
+              ok = ok && EverCrypt_AEAD_decrypt_update(&st, chunks[j].base, chunks[j].len, d) == 0U;
+            }
+          ok = ok && EverCrypt_AEAD_decrypt_finish(&st, tag) == EverCrypt_Error_Success;
+          ok = ok && memcmp(decrypted, plain, len) == 0;
+
+          tag[15U] ^= 0x80U;
+          EverCrypt_AEAD_decrypt_init(&st, s, iv, a->iv_len, ad, AD_LEN);
+          EverCrypt_AEAD_decrypt_update(&st, cipher, len, decrypted);
+          r = EverCrypt_AEAD_decrypt_finish(&st, tag);
+          ok = ok && r == EverCrypt_Error_AuthenticationFailure;
+        }
+    }
+  return ok;
+}
+
+typedef struct {
+  EverCrypt_AEAD_state_s *s;
+  uint8_t ad[AD_LEN];
+  uint8_t plain[MAX_LEN - 1U];
+  uint8_t expected[MAX_LEN - 1U];
+  uint8_t expected_tag[16U];
+  uint32_t iv_len;
+  bool ok;
+} worker;
+
+// Each thread encrypts and decrypts its own message with the same key object.
+// The messages end with partial blocks, which the AES-GCM code buffers in
+// scratch space; that space must not live in the shared key.
+void *
+work(void *arg)
+{
+  worker *w = arg;
+  uint32_t len = MAX_LEN - 1U;
+  uint8_t cipher[MAX_LEN - 1U];
+  uint8_t decrypted[MAX_LEN - 1U];
+  uint8_t tag[16U];
+  w->ok = true;
+  for (int i = 0; i < ROUNDS; i++)
+    {
+      EverCrypt_AEAD_encrypt(w->s, iv, w->iv_len, w->ad, AD_LEN, w->plain, len, cipher, tag);
+      w->ok = w->ok && memcmp(cipher, w->expected, len) == 0;
+      w->ok = w->ok && memcmp(tag, w->expected_tag, 16U) == 0;
+      EverCrypt_Error_error_code
+        r = EverCrypt_AEAD_decrypt(w->s, iv, w->iv_len, w->ad, AD_LEN, cipher, len, tag, decrypted);
+      w->ok = w->ok && r == EverCrypt_Error_Success;
+      w->ok = w->ok && memcmp(decrypted, w->plain, len) == 0;
+    }
+  return NULL;
+}
+
+bool
+test_shared_key(aead *a, EverCrypt_AEAD_state_s *s)
+{
+  pthread_t threads[NTHREADS];
+  worker *workers = malloc(NTHREADS * sizeof (worker));
+  for (int i = 0; i < NTHREADS; i++)
+    {
+      worker *w = &workers[i];
+      w->s = s;
+      w->iv_len = a->iv_len;
+      for (int j = 0; j < AD_LEN; j++)
+        w->ad[j] = (uint8_t)(i * 31 + j);
+      for (int j = 0; j < MAX_LEN - 1; j++)
+        w->plain[j] = (uint8_t)(i * 57 + j * 5);
+      openssl_encrypt(a, w->ad, w->plain, MAX_LEN - 1U, w->expected, w->expected_tag);
+    }
+  for (int i = 0; i < NTHREADS; i++)
+    {
+      pthread_create(&threads[i], NULL, work, &workers[i]);
+    }
+  bool ok = true;
+  for (int i = 0; i < NTHREADS; i++)
+    {
+      pthread_join(threads[i], NULL);
+      ok = ok && workers[i].ok;
+    }
+  free(workers);
+  return ok;
+}
+
+// Records sealed in sequence, from just below 2^32, against nonces built by hand as in
+// RFC 8446, 5.3; then opened out of order.
+bool
+test_seq(aead *a, EverCrypt_AEAD_state_s *s)
+{
+  EverCrypt_AEAD_seq ctx;
+  EverCrypt_Error_error_code r = EverCrypt_AEAD_seq_init(&ctx, s, iv, 0xfffffffeULL);
+  if (a->iv_len != 12U)
+    return r == EverCrypt_Error_InvalidIVLength;
+  bool ok = r == EverCrypt_Error_Success;
+  uint8_t cipher[3U][MAX_LEN];
+  uint8_t tags[3U][16U];
+  uint8_t expected[MAX_LEN];
+  uint8_t tag[16U];
+  for (int i = 0; i < 3; i++)
+    {
+      uint32_t len = lens[i + 5];
+      uint64_t seq = 0xfffffffeULL + (uint64_t)i;
+      uint8_t nonce[12U];
+      memcpy(nonce, iv, 12U);
+      for (int j = 0; j < 8; j++)
+        nonce[4 + j] ^= (uint8_t)(seq >> (56 - 8 * j));
+      ok = ok && EverCrypt_AEAD_seal_next(&ctx, ad, AD_LEN, plain, len, cipher[i], tags[i])
+        == EverCrypt_Error_Success;
+      EverCrypt_AEAD_encrypt(s, nonce, 12U, ad, AD_LEN, plain, len, expected, tag);
+      ok = ok && memcmp(cipher[i], expected, len) == 0 && memcmp(tags[i], tag, 16U) == 0;
+    }
+  ok = ok && ctx.seq == 0x100000001ULL;
+  for (int i = 2; i >= 0; i--)
+    {
+      uint32_t len = lens[i + 5];
+      r = EverCrypt_AEAD_open_at(&ctx, 0xfffffffeULL + (uint64_t)i, ad, AD_LEN, cipher[i], len,
+        tags[i], expected);
+      ok = ok && r == EverCrypt_Error_Success && memcmp(expected, plain, len) == 0;
+    }
+  // The wrong record number.
+  r = EverCrypt_AEAD_open_at(&ctx, 0ULL, ad, AD_LEN, cipher[0U], lens[5], tags[0U], expected);
+  ok = ok && r == EverCrypt_Error_AuthenticationFailure;
+  // The last sequence number is never used.
+  ctx.seq = UINT64_MAX - 1U;
+  ok = ok && EverCrypt_AEAD_seal_next(&ctx, ad, AD_LEN, plain, 16U, cipher[0U], tag)
+    == EverCrypt_Error_Success;
+  ok = ok && EverCrypt_AEAD_seal_next(&ctx, ad, AD_LEN, plain, 16U, cipher[0U], tag)
+    == EverCrypt_Error_MaximumLengthExceeded;
+  return ok && ctx.seq == UINT64_MAX;
+}
+
+bool
+test_aead(aead *a)
+{
+  EverCrypt_AEAD_state_s *s = NULL;
+  if (EverCrypt_AEAD_create_in(a->alg, &s, key) != EverCrypt_Error_Success)
+    {
+      // All the algorithms have a portable implementation.
+      printf("[%s] create_in: FAIL\n", a->name);
+      return false;
+    }
+  bool pass = true;
+  bool ok = test_vs_openssl(a, s);
+  printf("[%s] vs. OpenSSL: %s\n", a->name, ok ? "PASS" : "FAIL");
+  pass = ok && pass;
+  ok = test_aliased(a, s);
+  printf("[%s] cipher == plain: %s\n", a->name, ok ? "PASS" : "FAIL");
+  pass = ok && pass;
+  ok = test_iov(a, s);
+  printf("[%s] scatter/gather: %s\n", a->name, ok ? "PASS" : "FAIL");
+  pass = ok && pass;
+  ok = test_stream(a, s);
+  printf("[%s] incremental: %s\n", a->name, ok ? "PASS" : "FAIL");
+  pass = ok && pass;
+  ok = test_seq(a, s);
+  printf("[%s] record sequence: %s\n", a->name, ok ? "PASS" : "FAIL");
+  pass = ok && pass;
+  ok = test_shared_key(a, s);
+  printf("[%s] key shared by %d threads: %s\n", a->name, NTHREADS, ok ? "PASS" : "FAIL");
+  pass = ok && pass;
+  EverCrypt_AEAD_free(s);
+
+  // The same key, built in caller-provided storage.
+  _Alignas(16) uint8_t mem[512U];
+  ok = EverCrypt_AEAD_size(a->alg) <= sizeof mem;
+  ok = ok && EverCrypt_AEAD_init_in_place(a->alg, mem, &s, key) == EverCrypt_Error_Success;
+  ok = ok && (uint8_t *)s == mem && test_vs_openssl(a, s);
+  printf("[%s] in place: %s\n", a->name, ok ? "PASS" : "FAIL");
+  return ok && pass;
+}
+
+// Batches mixing algorithms, keys, and lengths of text and additional data, against the
+// single-packet API. Decryption is in place, with two of the tags corrupted.
+#define BATCH 21
+
+bool
+test_batch()
+{
+  Spec_Agile_AEAD_alg algs[] = {
+    Spec_Agile_AEAD_AES128_GCM, Spec_Agile_AEAD_AES256_GCM, Spec_Agile_AEAD_AES128_GCM,
+    Spec_Agile_AEAD_CHACHA20_POLY1305
+  };
+  EverCrypt_AEAD_state_s *keys[4U];
+  uint8_t k[32U];
+  for (int i = 0; i < 4; i++)
+    {
+      for (int j = 0; j < 32; j++)
+        k[j] = (uint8_t)(key[j] + i * 41);
+      EverCrypt_AEAD_create_in(algs[i], &keys[i], k);
+    }
+  EverCrypt_AEAD_state_s *s[BATCH];
+  uint8_t ivs[BATCH][12U];
+  uint8_t *ivp[BATCH];
+  uint8_t *adp[BATCH];
+  uint32_t ad_len[BATCH];
+  uint8_t *plainp[BATCH];
+  uint32_t len[BATCH];
+  uint8_t *buf[BATCH];
+  uint8_t *tagp[BATCH];
+  uint8_t tags[BATCH][16U];
+  EverCrypt_Error_error_code res[BATCH];
+  bool ok = true;
+  for (int i = 0; i < BATCH; i++)
+    {
+      s[i] = keys[(i * 5 / 3) % 4];
+      for (int j = 0; j < 12; j++)
+        ivs[i][j] = (uint8_t)(iv[j] + i);
+      ivp[i] = ivs[i];
+      adp[i] = ad;
+      ad_len[i] = (uint32_t)(i * 7) % (AD_LEN + 1U);
+      plainp[i] = plain;
+      len[i] = lens[i % (sizeof lens / sizeof lens[0])];
+      buf[i] = malloc(MAX_LEN);
+      tagp[i] = tags[i];
+    }
+  ok = EverCrypt_AEAD_encrypt_batch(BATCH, s, ivp, 12U, adp, ad_len, plainp, len, buf, tagp, res)
+    == EverCrypt_Error_Success;
+  uint8_t cipher[MAX_LEN];
+  uint8_t tag[16U];
+  for (int i = 0; i < BATCH; i++)
+    {
+      EverCrypt_AEAD_encrypt(s[i], ivs[i], 12U, ad, ad_len[i], plain, len[i], cipher, tag);
+      ok = ok && res[i] == EverCrypt_Error_Success;
+      ok = ok && memcmp(buf[i], cipher, len[i]) == 0 && memcmp(tags[i], tag, 16U) == 0;
+    }
+  tags[3U][0U] ^= 1U;
+  tags[BATCH - 1][15U] ^= 0x80U;
+  EverCrypt_Error_error_code
+  r = EverCrypt_AEAD_decrypt_batch(BATCH, s, ivp, 12U, adp, ad_len, buf, len, tagp, buf, res);
+  ok = ok && r == EverCrypt_Error_AuthenticationFailure;
+  for (int i = 0; i < BATCH; i++)
+    {
+      if (i == 3 || i == BATCH - 1)
+        ok = ok && res[i] == EverCrypt_Error_AuthenticationFailure;
+      else
+        ok = ok && res[i] == EverCrypt_Error_Success && memcmp(buf[i], plain, len[i]) == 0;
+      free(buf[i]);
+    }
+  for (int i = 0; i < 4; i++)
+    EverCrypt_AEAD_free(keys[i]);
+  printf("[AEAD] batch of %d packets: %s\n", BATCH, ok ? "PASS" : "FAIL");
+  return ok;
+}
+
+// HChaCha20 and XChaCha20-Poly1305 test vectors from draft-irtf-cfrg-xchacha-03, 2.2.1 and
+// A.3.1: the OpenSSL comparison above goes through the same subkey derivation.
+bool
+test_xchacha20_kat()
+{
+  uint8_t k[32U];
+  uint8_t n[24U];
+  uint8_t aad[12U] = { 0x50, 0x51, 0x52, 0x53, 0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7 };
+  uint8_t m[] = "Ladies and Gentlemen of the class of '99: If I could offer you only one tip for "
+    "the future, sunscreen would be it.";
+  uint32_t len = sizeof m - 1U;
+  uint8_t subkey[32U];
+  uint8_t expected_subkey[32U] = {
+    0x82, 0x41, 0x3b, 0x42, 0x27, 0xb2, 0x7b, 0xfe, 0xd3, 0x0e, 0x42, 0x50, 0x8a, 0x87, 0x7d, 0x73,
+    0xa0, 0xf9, 0xe4, 0xd5, 0x8a, 0x74, 0xa8, 0x53, 0xc1, 0x2e, 0xc4, 0x13, 0x26, 0xd3, 0xec, 0xdc
+  };
+  uint8_t expected_head[16U] = {
+    0xbd, 0x6d, 0x17, 0x9d, 0x3e, 0x83, 0xd4, 0x3b, 0x95, 0x76, 0x57, 0x94, 0x93, 0xc0, 0xe9, 0x39
+  };
+  uint8_t expected_tag[16U] = {
+    0xc0, 0x87, 0x59, 0x24, 0xc1, 0xc7, 0x98, 0x79, 0x47, 0xde, 0xaf, 0xd8, 0x78, 0x0a, 0xcf, 0x49
+  };
+  uint8_t cipher[sizeof m];
+  uint8_t decrypted[sizeof m];
+  uint8_t tag[16U];
+  for (int i = 0; i < 32; i++)
+    k[i] = (uint8_t)i;
+  uint8_t hn[16U] = { 0, 0, 0, 0x09, 0, 0, 0, 0x4a, 0, 0, 0, 0, 0x31, 0x41, 0x59, 0x27 };
+  Hacl_Chacha20_hchacha20(subkey, k, hn);
+  bool ok = memcmp(subkey, expected_subkey, 32U) == 0;
+
+  for (int i = 0; i < 32; i++)
+    k[i] = (uint8_t)(0x80 + i);
+  for (int i = 0; i < 24; i++)
+    n[i] = (uint8_t)(0x40 + i);
+  Spec_Agile_AEAD_alg a = Spec_Agile_AEAD_XCHACHA20_POLY1305;
+  EverCrypt_Error_error_code
+    r = EverCrypt_AEAD_encrypt_expand(a, k, n, 24U, aad, 12U, m, len, cipher, tag);
+  ok = ok && r == EverCrypt_Error_Success;
+  ok = ok && memcmp(cipher, expected_head, 16U) == 0 && memcmp(tag, expected_tag, 16U) == 0;
+  r = EverCrypt_AEAD_decrypt_expand(a, k, n, 24U, aad, 12U, cipher, len, tag, decrypted);
+  ok = ok && r == EverCrypt_Error_Success && memcmp(decrypted, m, len) == 0;
+  // A 96-bit nonce is rejected.
+  r = EverCrypt_AEAD_encrypt_expand(a, k, n, 12U, aad, 12U, m, len, cipher, tag);
+  ok = ok && r == EverCrypt_Error_InvalidIVLength;
+  printf("[XChacha20-Poly1305] draft-irtf-cfrg-xchacha vectors: %s\n", ok ? "PASS" : "FAIL");
+  return ok;
+}
+
+// AES-256-GCM-SIV has no OpenSSL counterpart to compare with: the first two messages are from
+// RFC 8452, appendix C.2; the long ones, which go through the 8-block POLYVAL and CTR paths
+// and end with a full or a partial block, were checked with a direct implementation of the RFC.
+typedef struct {
+  uint32_t ad_len;
+  uint32_t len;
+  const char *tail;
+  const char *tag;
+} siv_vector;
+
+static void
+unhex(const char *s, uint8_t *out)
+{
+  for (size_t i = 0; s[2 * i] != 0; i++)
+    sscanf(s + 2 * i, "%2hhx", &out[i]);
+}
+
+bool
+test_gcm_siv()
+{
+  Spec_Agile_AEAD_alg a = Spec_Agile_AEAD_AES256_GCM_SIV;
+  EverCrypt_AEAD_state_s *s = NULL;
+  EverCrypt_Error_error_code r = EverCrypt_AEAD_create_in(a, &s, key);
+  if (r == EverCrypt_Error_UnsupportedAlgorithm)
+    {
+      printf("[AES256-GCM-SIV] no AES-NI and PCLMULQDQ: SKIP\n");
+      return true;
+    }
+  uint8_t k[32U] = { 1U };
+  uint8_t n[12U] = { 3U };
+  uint8_t m[8U] = { 1U };
+  uint8_t cipher[MAX_LEN];
+  uint8_t decrypted[MAX_LEN];
+  uint8_t tag[16U];
+  uint8_t expected[16U];
+  r = EverCrypt_AEAD_encrypt_expand(a, k, n, 12U, ad, 0U, m, 0U, cipher, tag);
+  unhex("07f5f4169bbf55a8400cd47ea6fd400f", expected);
+  bool ok = r == EverCrypt_Error_Success && memcmp(tag, expected, 16U) == 0;
+  r = EverCrypt_AEAD_encrypt_expand(a, k, n, 12U, ad, 0U, m, 8U, cipher, tag);
+  unhex("c2ef328e5c71c83b", expected);
+  ok = ok && r == EverCrypt_Error_Success && memcmp(cipher, expected, 8U) == 0;
+  unhex("843122130f7364b761e0b97427e3df28", expected);
+  ok = ok && memcmp(tag, expected, 16U) == 0;
+  r = EverCrypt_AEAD_decrypt_expand(a, k, n, 12U, ad, 0U, cipher, 8U, tag, decrypted);
+  ok = ok && r == EverCrypt_Error_Success && memcmp(decrypted, m, 8U) == 0;
+
+  siv_vector vectors[] = {
+    { AD_LEN, MAX_LEN, "adaf320fa2ec9e79f569daa4c27f39de", "f49f31101a600c1c23b93a232ee6aca4" },
+    { AD_LEN, MAX_LEN - 1U, "5083b287392066ae4f1ab9889ac6fe0d", "cf53615f83324cd00a0af30796dddf4d" },
+  };
+  for (size_t i = 0; i < sizeof vectors / sizeof vectors[0]; i++)
+    {
+      siv_vector *v = &vectors[i];
+      r = EverCrypt_AEAD_encrypt(s, iv, 12U, ad, v->ad_len, plain, v->len, cipher, tag);
+      unhex(v->tail, expected);
+      ok = ok && r == EverCrypt_Error_Success && memcmp(cipher + v->len - 16U, expected, 16U) == 0;
+      unhex(v->tag, expected);
+      ok = ok && memcmp(tag, expected, 16U) == 0;
+    }
+
+  for (size_t i = 0; i < sizeof lens / sizeof lens[0]; i++)
+    {
+      uint32_t len = lens[i];
+      EverCrypt_AEAD_encrypt(s, iv, 12U, ad, AD_LEN, plain, len, cipher, expected);
+      r = EverCrypt_AEAD_decrypt(s, iv, 12U, ad, AD_LEN, cipher, len, expected, decrypted);
+      ok = ok && r == EverCrypt_Error_Success && memcmp(decrypted, plain, len) == 0;
+      // In place, through the _expand variants.
+      memcpy(decrypted, plain, len);
+      EverCrypt_AEAD_encrypt_expand(a, key, iv, 12U, ad, AD_LEN, decrypted, len, decrypted, tag);
+      ok = ok && memcmp(decrypted, cipher, len) == 0 && memcmp(tag, expected, 16U) == 0;
+      r = EverCrypt_AEAD_decrypt_expand(a, key, iv, 12U, ad, AD_LEN, decrypted, len, tag,
+        decrypted);
+      ok = ok && r == EverCrypt_Error_Success && memcmp(decrypted, plain, len) == 0;
+      // A forged message is rejected, and the plaintext wiped.
+      cipher[len / 2U] ^= (uint8_t)(len != 0U);
+      tag[0U] ^= (uint8_t)(len == 0U);
+      r = EverCrypt_AEAD_decrypt(s, iv, 12U, ad, AD_LEN, cipher, len, tag, decrypted);
+      ok = ok && r == EverCrypt_Error_AuthenticationFailure;
+      for (uint32_t j = 0U; j < len; j++)
+        ok = ok && decrypted[j] == 0U;
+    }
+  r = EverCrypt_AEAD_encrypt(s, iv, 16U, ad, AD_LEN, plain, 16U, cipher, tag);
+  ok = ok && r == EverCrypt_Error_InvalidIVLength;
+  EverCrypt_AEAD_stream st;
+  r = EverCrypt_AEAD_encrypt_init(&st, s, iv, 12U, ad, AD_LEN);
+  ok = ok && r == EverCrypt_Error_UnsupportedAlgorithm;
+  EverCrypt_AEAD_free(s);
+
+  _Alignas(16) uint8_t mem[512U];
+  ok = ok && EverCrypt_AEAD_size(a) <= sizeof mem;
+  ok = ok && EverCrypt_AEAD_init_in_place(a, mem, &s, key) == EverCrypt_Error_Success;
+  r = EverCrypt_AEAD_encrypt(s, iv, 12U, ad, AD_LEN, plain, MAX_LEN, cipher, tag);
+  unhex(vectors[0U].tag, expected);
+  ok = ok && r == EverCrypt_Error_Success && memcmp(tag, expected, 16U) == 0;
+  printf("[AES256-GCM-SIV] RFC 8452 and long vectors, round trips, forgeries: %s\n",
+    ok ? "PASS" : "FAIL");
+  return ok;
+}
+
+int main()
+{
+  EverCrypt_AutoConfig2_init();
+  for (int i = 0; i < 32; i++)
+    key[i] = (uint8_t)(i * 7 + 1);
+  for (int i = 0; i < 24; i++)
+    iv[i] = (uint8_t)(i * 13 + 5);
+  for (int i = 0; i < AD_LEN; i++)
+    ad[i] = (uint8_t)(i * 3);
+  for (int i = 0; i < MAX_LEN; i++)
+    plain[i] = (uint8_t)(i * 11 + 17);
+
+  bool pass = true;
+  for (size_t i = 0; i < sizeof aeads / sizeof aeads[0]; i++)
+    {
+      pass = test_aead(&aeads[i]) && pass;
+    }
+  pass = test_xchacha20_kat() && pass;
+  pass = test_gcm_siv() && pass;
+  pass = test_batch() && pass;
+
+  // The streaming Chacha20-Poly1305 code dispatches on its own: also run it on the AVX and
+  // portable backends.
+  aead *chacha = &aeads[2U];
+  EverCrypt_AEAD_state_s *s = NULL;
+  EverCrypt_AEAD_create_in(chacha->alg, &s, key);
+  EverCrypt_AutoConfig2_disable_avx2();
+  bool ok = test_iov(chacha, s) && test_stream(chacha, s);
+  EverCrypt_AutoConfig2_disable_avx();
+  ok = test_iov(chacha, s) && test_stream(chacha, s) && ok;
+  printf("[%s] scatter/gather and incremental, without AVX2: %s\n", chacha->name,
+    ok ? "PASS" : "FAIL");
+  pass = ok && pass;
+  EverCrypt_AEAD_free(s);
+
+  // Without Vale (nor AVX, at this point), AES-GCM runs on the AES-NI and PCLMULQDQ intrinsics.
+  EverCrypt_AutoConfig2_disable_vale();
+  printf("Without Vale:\n");
+  pass = test_aead(&aeads[0U]) && pass;
+  pass = test_aead(&aeads[1U]) && pass;
+  pass = test_batch() && pass;
+
+  // Without AES-NI and PCLMULQDQ, AES-GCM falls back onto the portable constant-time code.
+  EverCrypt_AutoConfig2_disable_aesni();
+  EverCrypt_AutoConfig2_disable_pclmulqdq();
+  printf("Without AES-NI and PCLMULQDQ:\n");
+  pass = test_aead(&aeads[0U]) && pass;
+  pass = test_aead(&aeads[1U]) && pass;
+  pass = test_batch() && pass;
+
+  if (pass)
+    {
+      printf("[AEAD] Self-test: PASS\n");
+    }
+  else
+    {
+      printf("[AEAD] Self-test: FAIL\n");
+    }
+
+  return pass ? EXIT_SUCCESS : EXIT_FAILURE;
+}
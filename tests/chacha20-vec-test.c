@@ -13,6 +13,7 @@
 #include "Hacl_Chacha20_Vec128.h"
 #include "Hacl_Chacha20_Vec256.h"
 #include "EverCrypt_AutoConfig2.h"
+#include "EverCrypt_Cipher.h"
 
 #include "test_helpers.h"
 #include "chacha20_vectors.h"
@@ -45,6 +46,50 @@ bool print_test(int in_len, uint8_t* in, uint8_t* key, uint8_t* nonce, uint8_t*
   return ok;
 }
 
+// EverCrypt_Cipher_chacha20 must agree with the scalar implementation whichever implementation
+// the length selects, and every header-protection mask must be the first 5 bytes of the scalar
+// key stream block given by its sample.
+bool test_cipher(){
+  uint8_t key[32];
+  uint8_t nonce[12];
+  uint8_t in[600];
+  uint8_t expected[600];
+  uint8_t out[600];
+  uint8_t samples[20 * 16];
+  uint8_t masks[20 * 5];
+  uint8_t masks_vec[20 * 5];
+  uint8_t zero[5] = { 0 };
+  for (int i = 0; i < 32; i++) key[i] = i * 3 + 1;
+  for (int i = 0; i < 12; i++) nonce[i] = i * 5;
+  for (int i = 0; i < 600; i++) in[i] = i * 7 + 11;
+  for (int i = 0; i < 20 * 16; i++) samples[i] = i * 13 + 5;
+
+  bool ok = true;
+  for (uint32_t len = 0; len <= 600; len++) {
+    Hacl_Chacha20_chacha20_encrypt(len, expected, in, key, nonce, 7);
+    EverCrypt_Cipher_chacha20(len, out, in, key, nonce, 7);
+    ok = ok && memcmp(out, expected, len) == 0;
+    memcpy(out, in, len);
+    EverCrypt_Cipher_chacha20(len, out, out, key, nonce, 7);
+    ok = ok && memcmp(out, expected, len) == 0;
+  }
+  for (uint32_t n = 0; n <= 20; n++) {
+    for (uint32_t i = 0; i < n; i++) {
+      uint8_t *s = samples + 16 * i;
+      uint32_t ctr = s[0] | s[1] << 8 | s[2] << 16 | (uint32_t)s[3] << 24;
+      Hacl_Chacha20_chacha20_encrypt(5, masks + 5 * i, zero, key, s + 4, ctr);
+    }
+    EverCrypt_Cipher_chacha20_hp_masks(n, masks_vec, key, samples);
+    ok = ok && memcmp(masks_vec, masks, 5 * n) == 0;
+    Hacl_Chacha20_Vec128_chacha20_hp_masks_128(n, masks_vec, key, samples);
+    ok = ok && memcmp(masks_vec, masks, 5 * n) == 0;
+    if (EverCrypt_AutoConfig2_has_avx2()) {
+      Hacl_Chacha20_Vec256_chacha20_hp_masks_256(n, masks_vec, key, samples);
+      ok = ok && memcmp(masks_vec, masks, 5 * n) == 0;
+    }
+  }
+  return ok;
+}
 
 int main() {
   EverCrypt_AutoConfig2_init();
@@ -125,6 +170,19 @@ int main() {
     printf("256-bit Chacha20\n"); print_time(count,diff3,cyc3);
   }
 
+
+  bool cipher = test_cipher();
+  if (EverCrypt_AutoConfig2_has_avx2()) {
+    EverCrypt_AutoConfig2_disable_avx2();
+    cipher = test_cipher() && cipher;
+  }
+  if (EverCrypt_AutoConfig2_has_avx()) {
+    EverCrypt_AutoConfig2_disable_avx();
+    cipher = test_cipher() && cipher;
+  }
+  printf("EverCrypt_Cipher chacha20 and header protection masks: %s\n", cipher ? "PASS" : "FAIL");
+  ok = ok && cipher;
+
   if (ok) return EXIT_SUCCESS;
   else return EXIT_FAILURE;
 }
@@ -13,6 +13,7 @@
 #include "Hacl_Chacha20Poly1305_128.h"
 #include "Hacl_Chacha20Poly1305_256.h"
 #include "EverCrypt_AutoConfig2.h"
+#include "EverCrypt_Chacha20Poly1305.h"
 
 #include "test_helpers.h"
 #include "chacha20poly1305_vectors.h"
@@ -71,6 +72,125 @@ bool print_test(int in_len, uint8_t* in, uint8_t* key, uint8_t* nonce, int aad_l
   return ok;
 }
 
+typedef void (*aead_encrypt_t)(uint8_t*, uint8_t*, uint32_t, uint8_t*, uint32_t, uint8_t*, uint8_t*, uint8_t*);
+typedef uint32_t (*aead_decrypt_t)(uint8_t*, uint8_t*, uint32_t, uint8_t*, uint32_t, uint8_t*, uint8_t*, uint8_t*);
+
+// Encrypting and decrypting in place (cipher == m) must agree with the separate-buffer results,
+// for every length up to a few 256-bit blocks.
+bool test_in_place(aead_encrypt_t enc, aead_decrypt_t dec){
+  uint8_t key[32];
+  uint8_t nonce[12];
+  uint8_t aad[13];
+  uint8_t in[1100];
+  uint8_t expected[1100];
+  uint8_t buf[1100];
+  uint8_t expected_mac[16];
+  uint8_t mac[16];
+  for (int i = 0; i < 32; i++) key[i] = i * 3 + 1;
+  for (int i = 0; i < 12; i++) nonce[i] = i * 5;
+  for (int i = 0; i < 13; i++) aad[i] = i;
+  for (int i = 0; i < 1100; i++) in[i] = i * 7 + 11;
+
+  bool ok = true;
+  for (uint32_t len = 0; len <= 1100; len++) {
+    enc(key, nonce, 13, aad, len, in, expected, expected_mac);
+    memcpy(buf, in, len);
+    enc(key, nonce, 13, aad, len, buf, buf, mac);
+    ok = ok && memcmp(buf, expected, len) == 0 && memcmp(mac, expected_mac, 16) == 0;
+    ok = ok && dec(key, nonce, 13, aad, len, buf, buf, mac) == 0 && memcmp(buf, in, len) == 0;
+  }
+  return ok;
+}
+
+// Above 2KB the 256-bit encryption MACs each chunk as it is produced; its output must match the
+// portable implementation across chunk boundaries, including in place.
+bool test_single_pass(){
+  uint8_t key[32];
+  uint8_t nonce[12];
+  uint8_t aad[13];
+  uint8_t in[6200];
+  uint8_t expected[6200];
+  uint8_t buf[6200];
+  uint8_t expected_mac[16];
+  uint8_t mac[16];
+  for (int i = 0; i < 32; i++) key[i] = i * 3 + 1;
+  for (int i = 0; i < 12; i++) nonce[i] = i * 5;
+  for (int i = 0; i < 13; i++) aad[i] = i;
+  for (int i = 0; i < 6200; i++) in[i] = i * 7 + 11;
+
+  bool ok = true;
+  for (uint32_t len = 2000; len <= 6200; len++) {
+    Hacl_Chacha20Poly1305_32_aead_encrypt(key, nonce, 13, aad, len, in, expected, expected_mac);
+    Hacl_Chacha20Poly1305_256_aead_encrypt(key, nonce, 13, aad, len, in, buf, mac);
+    ok = ok && memcmp(buf, expected, len) == 0 && memcmp(mac, expected_mac, 16) == 0;
+    memcpy(buf, in, len);
+    Hacl_Chacha20Poly1305_256_aead_encrypt(key, nonce, 13, aad, len, buf, buf, mac);
+    ok = ok && memcmp(buf, expected, len) == 0 && memcmp(mac, expected_mac, 16) == 0;
+  }
+  return ok;
+}
+
+#define BATCH 19
+
+// Batches of packets with distinct keys, nonces and lengths, sealed in place, must match
+// sealing each packet on its own; opening them must reject exactly the tampered packets.
+bool test_batch(){
+  uint8_t keys[BATCH][32];
+  uint8_t nonces[BATCH][12];
+  uint8_t aads[BATCH][40];
+  uint8_t in[BATCH][1400];
+  uint8_t bufs[BATCH][1400];
+  uint8_t macs[BATCH][16];
+  uint8_t expected[1400];
+  uint8_t expected_mac[16];
+  uint8_t *k[BATCH], *n[BATCH], *aad[BATCH], *m[BATCH], *mac[BATCH];
+  uint32_t aad_len[BATCH], len[BATCH], res[BATCH];
+  for (int i = 0; i < BATCH; i++) {
+    for (int j = 0; j < 32; j++) keys[i][j] = i * 31 + j;
+    for (int j = 0; j < 12; j++) nonces[i][j] = i + j * 3;
+    for (int j = 0; j < 40; j++) aads[i][j] = i ^ j;
+    for (int j = 0; j < 1400; j++) in[i][j] = i * 5 + j * 7;
+    k[i] = keys[i];
+    n[i] = nonces[i];
+    aad[i] = aads[i];
+    m[i] = bufs[i];
+    mac[i] = macs[i];
+    aad_len[i] = (i * 7) % 41;
+    len[i] = i == 3 ? 0 : (i * 173 + 29) % 1400;
+  }
+
+  bool ok = true;
+  for (int pass = 0; pass < 2; pass++) {
+    for (int i = 0; i < BATCH; i++) memcpy(bufs[i], in[i], len[i]);
+    if (pass == 0)
+      Hacl_Chacha20Poly1305_256_aead_encrypt_batch(BATCH, k, n, aad_len, aad, len, m, m, mac);
+    else
+      EverCrypt_Chacha20Poly1305_aead_encrypt_batch(BATCH, k, n, aad_len, aad, len, m, m, mac);
+    for (int i = 0; i < BATCH; i++) {
+      Hacl_Chacha20Poly1305_32_aead_encrypt(k[i], n[i], aad_len[i], aad[i], len[i], in[i],
+        expected, expected_mac);
+      ok = ok && memcmp(bufs[i], expected, len[i]) == 0 && memcmp(macs[i], expected_mac, 16) == 0;
+    }
+    macs[2][0] ^= 1;
+    macs[11][15] ^= 0x80;
+    uint32_t failed;
+    if (pass == 0)
+      failed = Hacl_Chacha20Poly1305_256_aead_decrypt_batch(BATCH, k, n, aad_len, aad, len, m, m,
+        mac, res);
+    else
+      failed = EverCrypt_Chacha20Poly1305_aead_decrypt_batch(BATCH, k, n, aad_len, aad, len, m, m,
+        mac, res);
+    ok = ok && failed == 2;
+    for (int i = 0; i < BATCH; i++) {
+      bool bad = i == 2 || i == 11;
+      ok = ok && res[i] == (bad ? 1 : 0);
+      if (!bad)
+        ok = ok && memcmp(bufs[i], in[i], len[i]) == 0;
+    }
+  }
+  return ok;
+}
+
 int main(){
   EverCrypt_AutoConfig2_init();
 
@@ -79,6 +199,22 @@ int main(){
     ok &= print_test(vectors[i].input_len,vectors[i].input,vectors[i].key,vectors[i].nonce,vectors[i].aad_len,vectors[i].aad,vectors[i].tag,vectors[i].cipher);
   }
 
+  bool in_place = test_in_place(Hacl_Chacha20Poly1305_32_aead_encrypt, Hacl_Chacha20Poly1305_32_aead_decrypt);
+  in_place = in_place && test_in_place(Hacl_Chacha20Poly1305_128_aead_encrypt, Hacl_Chacha20Poly1305_128_aead_decrypt);
+  if (EverCrypt_AutoConfig2_has_avx2())
+    in_place = in_place && test_in_place(Hacl_Chacha20Poly1305_256_aead_encrypt, Hacl_Chacha20Poly1305_256_aead_decrypt);
+  printf("Chacha20Poly1305 in place: %s\n", in_place ? "PASS" : "FAIL");
+  ok = ok && in_place;
+
+  if (EverCrypt_AutoConfig2_has_avx2()) {
+    bool single_pass = test_single_pass();
+    printf("Chacha20Poly1305 single-pass (256-bit): %s\n", single_pass ? "PASS" : "FAIL");
+    ok = ok && single_pass;
+    bool batch = test_batch();
+    printf("Chacha20Poly1305 batch (256-bit): %s\n", batch ? "PASS" : "FAIL");
+    ok = ok && batch;
+  }
+
   uint8_t plain[SIZE];
   uint8_t cipher[SIZE];
   uint8_t aead_key[32];
@@ -0,0 +1,175 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <stdbool.h>
+#include <openssl/evp.h>
+
+#include "EverCrypt_AutoConfig2.h"
+#include "EverCrypt_CTR.h"
+
+#include "test_helpers.h"
+
+#define LEN 1000
+
+static uint8_t key[32] = {
+  0x60,0x3d,0xeb,0x10,0x15,0xca,0x71,0xbe,0x2b,0x73,0xae,0xf0,0x85,0x7d,0x77,0x81,
+  0x1f,0x35,0x2c,0x07,0x3b,0x61,0x08,0xd7,0x2d,0x98,0x10,0xa3,0x09,0x14,0xdf,0xf4 };
+
+static const char *alg_name(Spec_Agile_Cipher_cipher_alg a) {
+  switch (a) {
+    case Spec_Agile_Cipher_AES128: return "AES-128";
+    case Spec_Agile_Cipher_AES256: return "AES-256";
+    default: return "ChaCha20";
+  }
+}
+
+static uint32_t block_len(Spec_Agile_Cipher_cipher_alg a) {
+  return a == Spec_Agile_Cipher_CHACHA20 ? 64 : 16;
+}
+
+// OpenSSL runs the same stream from counter block c: for AES, the 16-byte counter block is the
+// zero-padded IV plus c, as a 128-bit big-endian integer; for ChaCha20, the IV is the 32-bit
+// little-endian block counter followed by the 12-byte nonce.
+static void ossl_ctr(Spec_Agile_Cipher_cipher_alg a, uint8_t *iv, uint32_t iv_len, uint32_t c,
+  uint8_t *dst, uint8_t *src, int len)
+{
+  uint8_t ossl_iv[16] = { 0 };
+  const EVP_CIPHER *cipher;
+  if (a == Spec_Agile_Cipher_CHACHA20) {
+    cipher = EVP_chacha20();
+    ossl_iv[0] = c; ossl_iv[1] = c >> 8; ossl_iv[2] = c >> 16; ossl_iv[3] = c >> 24;
+    memcpy(ossl_iv + 4, iv, 12);
+  } else {
+    cipher = a == Spec_Agile_Cipher_AES128 ? EVP_aes_128_ctr() : EVP_aes_256_ctr();
+    memcpy(ossl_iv, iv, iv_len);
+    uint64_t carry = c;
+    for (int i = 15; i >= 0; i--) {
+      carry += ossl_iv[i];
+      ossl_iv[i] = (uint8_t)carry;
+      carry >>= 8;
+    }
+  }
+  EVP_CIPHER_CTX *ctx = EVP_CIPHER_CTX_new();
+  int out_len;
+  EVP_EncryptInit_ex(ctx, cipher, NULL, key, ossl_iv);
+  EVP_EncryptUpdate(ctx, dst, &out_len, src, len);
+  EVP_CIPHER_CTX_free(ctx);
+}
+
+// Encrypts src with len-byte chunks taken in turn from chunks, which must end with 0
+static void chunked(EverCrypt_CTR_state_s *s, uint8_t *dst, uint8_t *src, const uint32_t *chunks)
+{
+  uint32_t off = 0, k = 0;
+  while (off < LEN) {
+    uint32_t n = chunks[k] == 0 ? LEN - off : chunks[k++];
+    if (n > LEN - off) n = LEN - off;
+    EverCrypt_CTR_update(s, dst + off, src + off, n);
+    off += n;
+  }
+}
+
+static bool test_alg(Spec_Agile_Cipher_cipher_alg a, uint8_t *iv, uint32_t iv_len, uint32_t c,
+  bool with_openssl, const char *what)
+{
+  static const uint32_t chunks[][12] = {
+    { 0 },
+    { 1, 0 },
+    { 15, 1, 17, 0 },
+    { 7, 63, 64, 65, 3, 128, 0 },
+    { 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 0 },
+    { 300, 0, 200, 0 },
+  };
+  uint8_t plain[LEN], expected[LEN], ossl[LEN], out[LEN];
+  uint32_t bl = block_len(a);
+  EverCrypt_CTR_state_s *s = NULL;
+  bool ok = true;
+
+  for (int i = 0; i < LEN; i++)
+    plain[i] = (uint8_t)(i * 13 + 5);
+
+  // The reference: whole blocks through update_block, then the tail from one more block.
+  // update_block does not advance the ChaCha20 counter, hence the explicit init.
+  EverCrypt_CTR_create_in(a, &s, key, iv, iv_len, c);
+  uint32_t nb = LEN / bl;
+  for (uint32_t b = 0; b < nb; b++) {
+    EverCrypt_CTR_init(s, key, iv, iv_len, c + b);
+    EverCrypt_CTR_update_block(s, expected + b * bl, plain + b * bl);
+  }
+  uint8_t last[64] = { 0 };
+  memcpy(last, plain + nb * bl, LEN - nb * bl);
+  EverCrypt_CTR_init(s, key, iv, iv_len, c + nb);
+  EverCrypt_CTR_update_block(s, last, last);
+  memcpy(expected + nb * bl, last, LEN - nb * bl);
+  EverCrypt_CTR_free(s);
+
+  if (with_openssl) {
+    ossl_ctr(a, iv, iv_len, c, ossl, plain, LEN);
+    ok &= memcmp(ossl, expected, LEN) == 0;
+  }
+
+  for (size_t k = 0; k < sizeof chunks / sizeof chunks[0]; k++) {
+    EverCrypt_CTR_create_in(a, &s, key, iv, iv_len, c);
+    chunked(s, out, plain, chunks[k]);
+    ok &= memcmp(out, expected, LEN) == 0;
+    EverCrypt_CTR_free(s);
+  }
+
+  // Byte by byte, and in place
+  EverCrypt_CTR_create_in(a, &s, key, iv, iv_len, c);
+  memcpy(out, plain, LEN);
+  for (uint32_t i = 0; i < LEN; i++)
+    EverCrypt_CTR_update(s, out + i, out + i, 1);
+  ok &= memcmp(out, expected, LEN) == 0;
+  EverCrypt_CTR_free(s);
+
+  // A state in caller-provided storage
+  _Alignas(16) uint8_t mem[512];
+  ok &= EverCrypt_CTR_size(a) > 0 && EverCrypt_CTR_size(a) <= sizeof mem;
+  ok &= EverCrypt_CTR_init_in_place(a, mem, &s, key, iv, iv_len, c) == EverCrypt_Error_Success;
+  ok &= (uint8_t *)s == mem;
+  chunked(s, out, plain, chunks[3]);
+  ok &= memcmp(out, expected, LEN) == 0;
+
+  printf("%s %s: %s\n", alg_name(a), what, ok ? "Success!" : "**FAILED**");
+  return ok;
+}
+
+int main() {
+  EverCrypt_AutoConfig2_init();
+  bool ok = true;
+
+  uint8_t iv12[12] = { 0xf0,0xf1,0xf2,0xf3,0xf4,0xf5,0xf6,0xf7,0xf8,0xf9,0xfa,0xfb };
+  uint8_t iv16[16] = {
+    0x00,0x01,0x02,0x03,0x04,0x05,0x06,0x07,0x08,0x09,0x0a,0x0b,0xff,0xff,0xff,0xfd };
+  Spec_Agile_Cipher_cipher_alg aes[2] = { Spec_Agile_Cipher_AES128, Spec_Agile_Cipher_AES256 };
+
+  for (int i = 0; i < 2; i++) {
+    EverCrypt_CTR_state_s *s = NULL;
+    if (EverCrypt_CTR_create_in(aes[i], &s, key, iv12, 12, 0) != EverCrypt_Error_Success) {
+      printf("%s: not supported on this machine, skipping\n", alg_name(aes[i]));
+      continue;
+    }
+    EverCrypt_CTR_free(s);
+    ok &= test_alg(aes[i], iv12, 12, 0, true, "12-byte IV");
+    ok &= test_alg(aes[i], iv12, 12, 7, true, "12-byte IV from counter 7");
+    // The low 32-bit word of the counter block wraps after 3 blocks, and carries into the
+    // upper words; a single pipelined Vale call would not carry
+    ok &= test_alg(aes[i], iv16, 16, 0, true, "32-bit counter wrap");
+  }
+
+  ok &= test_alg(Spec_Agile_Cipher_CHACHA20, iv12, 12, 0, true, "from counter 0");
+  ok &= test_alg(Spec_Agile_Cipher_CHACHA20, iv12, 12, 1, true, "from counter 1");
+  // The 32-bit block counter wraps to 0 without carrying into the nonce, unlike OpenSSL: only
+  // compare with update_block
+  ok &= test_alg(Spec_Agile_Cipher_CHACHA20, iv12, 12, 0xfffffffeU, false, "32-bit counter wrap");
+
+  bool unsupported = EverCrypt_CTR_size((Spec_Agile_Cipher_cipher_alg)42) == 0;
+  printf("EverCrypt_CTR_size of an unsupported algorithm: %s\n",
+    unsupported ? "Success!" : "**FAILED**");
+  ok &= unsupported;
+
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
@@ -0,0 +1,66 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <stdbool.h>
+#include "EverCrypt_AutoConfig2.h"
+#include "EverCrypt_DRBG.h"
+
+#include "test_helpers.h"
+
+static bool all_zero(uint8_t *b, uint32_t len) {
+  uint8_t acc = 0;
+  for (uint32_t i = 0; i < len; i++)
+    acc |= b[i];
+  return acc == 0;
+}
+
+// A DRBG in caller-provided storage: generate, reseed, then uninstantiate_in_place, which must
+// clear k, v and the reseed counter, the 2 * kv_len + 4 bytes at the end of the storage
+static bool test_in_place(Spec_Hash_Definitions_hash_alg a, uint32_t kv_len, const char *name) {
+  _Alignas(16) uint8_t mem[256];
+  uint8_t out1[100], out2[100];
+  uint8_t pers[] = "in-place DRBG test";
+  uint32_t size = EverCrypt_DRBG_size(a);
+  bool ok = size > 0 && size <= sizeof mem;
+
+  memset(mem, 0xff, sizeof mem);
+  EverCrypt_DRBG_state_s *st = EverCrypt_DRBG_init_in_place(a, mem);
+  ok &= (uint8_t *)st == mem;
+  ok &= EverCrypt_DRBG_instantiate(st, pers, sizeof pers);
+  ok &= EverCrypt_DRBG_generate(out1, st, sizeof out1, NULL, 0);
+  ok &= EverCrypt_DRBG_reseed(st, pers, sizeof pers);
+  ok &= EverCrypt_DRBG_generate(out2, st, sizeof out2, pers, sizeof pers);
+  ok &= memcmp(out1, out2, sizeof out1) != 0;
+  ok &= !all_zero(mem + size - 2 * kv_len - 4, 2 * kv_len + 4);
+
+  EverCrypt_DRBG_uninstantiate_in_place(st);
+  ok &= all_zero(mem + size - 2 * kv_len - 4, 2 * kv_len + 4);
+  // Storage past the state is untouched
+  for (uint32_t i = size; i < sizeof mem; i++)
+    ok &= mem[i] == 0xff;
+
+  printf("In-place DRBG %s: %s\n", name, ok ? "Success!" : "**FAILED**");
+  return ok;
+}
+
+int main() {
+  EverCrypt_AutoConfig2_init();
+  bool ok = true;
+
+  ok &= test_in_place(Spec_Hash_Definitions_SHA1, 20, "SHA1");
+  ok &= test_in_place(Spec_Hash_Definitions_SHA2_256, 32, "SHA2-256");
+  ok &= test_in_place(Spec_Hash_Definitions_SHA2_384, 48, "SHA2-384");
+  ok &= test_in_place(Spec_Hash_Definitions_SHA2_512, 64, "SHA2-512");
+
+  // HMAC-DRBG is not defined over MD5 or SHA2-224
+  bool unsupported = EverCrypt_DRBG_size(Spec_Hash_Definitions_MD5) == 0
+    && EverCrypt_DRBG_size(Spec_Hash_Definitions_SHA2_224) == 0;
+  printf("EverCrypt_DRBG_size of unsupported algorithms: %s\n",
+    unsupported ? "Success!" : "**FAILED**");
+  ok &= unsupported;
+
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
@@ -0,0 +1,103 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <stdbool.h>
+#include "EverCrypt_AutoConfig2.h"
+#include "EverCrypt_HMAC.h"
+
+#include "test_helpers.h"
+
+// RFC 4231, test cases 2 (short key) and 6 (key longer than the block size of SHA2-256)
+static uint8_t key2[] = "Jefe";
+static uint8_t data2[] = "what do ya want for nothing?";
+static uint8_t tag2_256[32] = {
+  0x5b,0xdc,0xc1,0x46,0xbf,0x60,0x75,0x4e,0x6a,0x04,0x24,0x26,0x08,0x95,0x75,0xc7,
+  0x5a,0x00,0x3f,0x08,0x9d,0x27,0x39,0x83,0x9d,0xec,0x58,0xb9,0x64,0xec,0x38,0x43 };
+static uint8_t tag2_512[64] = {
+  0x16,0x4b,0x7a,0x7b,0xfc,0xf8,0x19,0xe2,0xe3,0x95,0xfb,0xe7,0x3b,0x56,0xe0,0xa3,
+  0x87,0xbd,0x64,0x22,0x2e,0x83,0x1f,0xd6,0x10,0x27,0x0c,0xd7,0xea,0x25,0x05,0x54,
+  0x97,0x58,0xbf,0x75,0xc0,0x5a,0x99,0x4a,0x6d,0x03,0x4f,0x65,0xf8,0xf0,0xe6,0xfd,
+  0xca,0xea,0xb1,0xa3,0x4d,0x4a,0x6b,0x4b,0x63,0x6e,0x07,0x0a,0x38,0xbc,0xe7,0x37 };
+static uint8_t data6[] = "Test Using Larger Than Block-Size Key - Hash Key First";
+static uint8_t tag6_256[32] = {
+  0x60,0xe4,0x31,0x59,0x1e,0xe0,0xb6,0x7f,0x0d,0x8a,0x26,0xaa,0xcb,0xf5,0xb7,0x7f,
+  0x8e,0x0b,0xc6,0x21,0x37,0x28,0xc5,0x14,0x05,0x46,0x04,0x0f,0x0e,0xe3,0x7f,0x54 };
+
+static uint32_t tag_len(Spec_Hash_Definitions_hash_alg a) {
+  switch (a) {
+    case Spec_Hash_Definitions_SHA1: return 20;
+    case Spec_Hash_Definitions_SHA2_256: return 32;
+    case Spec_Hash_Definitions_SHA2_384: return 48;
+    default: return 64;
+  }
+}
+
+#define ROUNDS 1000000
+
+int main() {
+  EverCrypt_AutoConfig2_init();
+  bool ok = true;
+  EverCrypt_HMAC_ctx ctx;
+  uint8_t comp[64];
+  uint8_t exp[64];
+  uint8_t key6[131];
+  memset(key6, 0xaa, sizeof key6);
+
+  printf("HMAC-SHA2-256 RFC 4231 case 2:\n");
+  EverCrypt_HMAC_init_ctx(&ctx, Spec_Hash_Definitions_SHA2_256, key2, 4);
+  EverCrypt_HMAC_compute_with_ctx(&ctx, comp, data2, 28);
+  ok &= compare_and_print(32, comp, tag2_256);
+
+  printf("HMAC-SHA2-512 RFC 4231 case 2:\n");
+  EverCrypt_HMAC_init_ctx(&ctx, Spec_Hash_Definitions_SHA2_512, key2, 4);
+  EverCrypt_HMAC_compute_with_ctx(&ctx, comp, data2, 28);
+  ok &= compare_and_print(64, comp, tag2_512);
+
+  printf("HMAC-SHA2-256 RFC 4231 case 6:\n");
+  EverCrypt_HMAC_init_ctx(&ctx, Spec_Hash_Definitions_SHA2_256, key6, sizeof key6);
+  EverCrypt_HMAC_compute_with_ctx(&ctx, comp, data6, 54);
+  ok &= compare_and_print(32, comp, tag6_256);
+
+  // Against the one-shot functions, for all algorithms, key lengths around the block sizes,
+  // and message lengths around the block boundaries
+  Spec_Hash_Definitions_hash_alg algs[4] = {
+    Spec_Hash_Definitions_SHA1, Spec_Hash_Definitions_SHA2_256,
+    Spec_Hash_Definitions_SHA2_384, Spec_Hash_Definitions_SHA2_512 };
+  uint32_t key_lens[5] = { 0, 20, 64, 128, 131 };
+  uint8_t data[300];
+  for (size_t i = 0; i < sizeof data; i++)
+    data[i] = (uint8_t)(i * 7 + 1);
+  bool same = true;
+  for (int a = 0; a < 4; a++)
+    for (int k = 0; k < 5; k++) {
+      EverCrypt_HMAC_init_ctx(&ctx, algs[a], key6, key_lens[k]);
+      for (uint32_t len = 0; len <= sizeof data; len++) {
+        EverCrypt_HMAC_compute(algs[a], exp, key6, key_lens[k], data, len);
+        EverCrypt_HMAC_compute_with_ctx(&ctx, comp, data, len);
+        same &= memcmp(comp, exp, tag_len(algs[a])) == 0;
+      }
+    }
+  printf("EverCrypt_HMAC_compute_with_ctx against EverCrypt_HMAC_compute: %s\n",
+    same ? "Success!" : "**FAILED**");
+  ok &= same;
+
+  clock_t t1, t2;
+  EverCrypt_HMAC_init_ctx(&ctx, Spec_Hash_Definitions_SHA2_256, key2, 4);
+  t1 = clock();
+  for (int j = 0; j < ROUNDS; j++)
+    EverCrypt_HMAC_compute(Spec_Hash_Definitions_SHA2_256, data, key2, 4, data, 64);
+  t2 = clock();
+  printf("HMAC-SHA2-256, 64 bytes, one-shot: %.1f ns\n",
+    (double)(t2 - t1) * 1e9 / CLOCKS_PER_SEC / ROUNDS);
+  t1 = clock();
+  for (int j = 0; j < ROUNDS; j++)
+    EverCrypt_HMAC_compute_with_ctx(&ctx, data, data, 64);
+  t2 = clock();
+  printf("HMAC-SHA2-256, 64 bytes, with context: %.1f ns\n",
+    (double)(t2 - t1) * 1e9 / CLOCKS_PER_SEC / ROUNDS);
+
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
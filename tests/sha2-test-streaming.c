@@ -10,6 +10,8 @@
 #include <time.h>
 
 #include "Hacl_Streaming_SHA2_256.h"
+#include "EverCrypt_Hash.h"
+#include "EverCrypt_AutoConfig2.h"
 
 #include "test_helpers.h"
 #include "sha2_vectors.h"
@@ -49,6 +51,28 @@ int main() {
 
   Hacl_Streaming_SHA2_256_free(s);
 
+  // The agile streaming API, with its state in caller-provided storage.
+  EverCrypt_AutoConfig2_init();
+  uint8_t tag512[64] = {};
+  _Alignas(16) uint8_t mem[512];
+  ok &= EverCrypt_Hash_Incremental_size(Spec_Hash_Definitions_SHA2_512) <= sizeof mem;
+  Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____ *e =
+    EverCrypt_Hash_Incremental_init_in_place(Spec_Hash_Definitions_SHA2_512, mem);
+  EverCrypt_Hash_Incremental_update(e, v->input, 16);
+  EverCrypt_Hash_Incremental_update(e, v->input+16, v->input_len - 16);
+  EverCrypt_Hash_Incremental_finish(e, tag512);
+  ok &= compare_and_print(64, tag512, v->tag_512);
+
+  ok &= EverCrypt_Hash_Incremental_size(Spec_Hash_Definitions_SHA2_256) <= sizeof mem;
+  e = EverCrypt_Hash_Incremental_init_in_place(Spec_Hash_Definitions_SHA2_256, mem);
+  EverCrypt_Hash_Incremental_update(e, v->input, v->input_len);
+  EverCrypt_Hash_Incremental_finish(e, tag);
+  ok &= compare_and_print(32, tag, v->tag_256);
+
+  // Size queries return 0 rather than abort on algorithms they do not know
+  ok &= EverCrypt_Hash_size((Spec_Hash_Definitions_hash_alg)42) == 0;
+  ok &= EverCrypt_Hash_Incremental_size((Spec_Hash_Definitions_hash_alg)42) == 0;
+
   if (ok)
     return EXIT_SUCCESS;
   else
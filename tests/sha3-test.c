@@ -0,0 +1,142 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <time.h>
+#include <stdbool.h>
+#include "Hacl_SHA3.h"
+#include <openssl/evp.h>
+
+#include "sha3_vectors.h"
+#include "test_helpers.h"
+
+
+void ossl_sha3_256(uint8_t* hash, uint8_t* input, int len){
+  EVP_MD_CTX *ctx = EVP_MD_CTX_new();
+  EVP_DigestInit_ex(ctx, EVP_sha3_256(), NULL);
+  EVP_DigestUpdate(ctx, input, len);
+  EVP_DigestFinal_ex(ctx, hash, NULL);
+  EVP_MD_CTX_free(ctx);
+}
+
+
+#define ROUNDS 4096
+#define SIZE   16384
+
+
+bool print_result(uint8_t* comp, uint8_t* exp, int len) {
+  return compare_and_print(len, comp, exp);
+}
+
+bool print_test(uint8_t* in, int in_len, sha3_test_vector* v){
+  uint8_t comp[64] = {0};
+
+  Hacl_SHA3_sha3_224(in_len,in,comp);
+  printf("SHA3-224 Result:\n");
+  bool ok = print_result(comp, v->tag_224,28);
+
+  Hacl_SHA3_sha3_256(in_len,in,comp);
+  printf("SHA3-256 Result:\n");
+  ok = print_result(comp, v->tag_256,32) && ok;
+
+  Hacl_SHA3_sha3_384(in_len,in,comp);
+  printf("SHA3-384 Result:\n");
+  ok = print_result(comp, v->tag_384,48) && ok;
+
+  Hacl_SHA3_sha3_512(in_len,in,comp);
+  printf("SHA3-512 Result:\n");
+  ok = print_result(comp, v->tag_512,64) && ok;
+
+  Hacl_SHA3_shake128_hacl(in_len,in,32,comp);
+  printf("SHAKE128 Result:\n");
+  ok = print_result(comp, v->shake128,32) && ok;
+
+  Hacl_SHA3_shake256_hacl(in_len,in,64,comp);
+  printf("SHAKE256 Result:\n");
+  ok = print_result(comp, v->shake256,64) && ok;
+
+  return ok;
+}
+
+// Exercises every padding position around the SHA3-256 rate (136 bytes).
+bool test_rate_boundaries(){
+  uint8_t msg[3 * 136];
+  uint8_t comp[32];
+  uint8_t exp[32];
+  bool ok = true;
+  for (int i = 0; i < sizeof msg; i++)
+    msg[i] = (uint8_t)i;
+  for (int len = 0; len <= sizeof msg; len++) {
+    Hacl_SHA3_sha3_256(len,msg,comp);
+    ossl_sha3_256(exp,msg,len);
+    ok = ok && memcmp(comp,exp,32) == 0;
+  }
+  printf("SHA3-256 vs. OpenSSL, lengths 0..%d: %s\n", (int)sizeof msg, ok ? "Success!" : "**FAILED**");
+  return ok;
+}
+
+int main(){
+
+  bool ok = true;
+  for (int i = 0; i < sizeof(vectors)/sizeof(sha3_test_vector); ++i) {
+    ok &= print_test(vectors[i].input,vectors[i].input_len,&vectors[i]);
+  }
+  ok &= test_rate_boundaries();
+
+  uint8_t plain[SIZE];
+  cycles a,b;
+  clock_t t1,t2;
+  memset(plain,'P',SIZE);
+
+  for (int j = 0; j < ROUNDS; j++) {
+    Hacl_SHA3_sha3_256(SIZE,plain,plain);
+  }
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    Hacl_SHA3_sha3_256(SIZE,plain,plain);
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  double cdiff1 = b - a;
+  double tdiff1 = t2 - t1;
+
+  for (int j = 0; j < ROUNDS; j++) {
+    ossl_sha3_256(plain,plain,SIZE);
+  }
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    ossl_sha3_256(plain,plain,SIZE);
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  double cdiff2 = b - a;
+  double tdiff2 = t2 - t1;
+
+  for (int j = 0; j < ROUNDS; j++) {
+    Hacl_SHA3_shake128_hacl(SIZE,plain,32,plain);
+  }
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    Hacl_SHA3_shake128_hacl(SIZE,plain,32,plain);
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  double cdiff3 = b - a;
+  double tdiff3 = t2 - t1;
+
+  uint8_t res = plain[0];
+  uint64_t count = ROUNDS * SIZE;
+  printf("SHA3-256 PERF: %d\n",(int)res); print_time(count,tdiff1,cdiff1);
+  printf("OpenSSL SHA3-256 PERF: %d\n",(int)res); print_time(count,tdiff2,cdiff2);
+  printf("SHAKE128 PERF: %d\n",(int)res); print_time(count,tdiff3,cdiff3);
+
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
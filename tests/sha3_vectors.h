@@ -0,0 +1,249 @@
+#pragma once
+
+typedef struct {
+  uint8_t *input;
+  size_t input_len;
+  uint8_t tag_224[28];
+  uint8_t tag_256[32];
+  uint8_t tag_384[48];
+  uint8_t tag_512[64];
+  uint8_t shake128[32];
+  uint8_t shake256[64];
+} sha3_test_vector;
+
+static uint8_t input1[] = {
+  0x61U, 0x62U, 0x63U
+};
+
+static uint8_t input2[] = {
+};
+
+static uint8_t input3[] = {
+  0x61U, 0x62U, 0x63U, 0x64U, 0x62U, 0x63U, 0x64U, 0x65U,
+  0x63U, 0x64U, 0x65U, 0x66U, 0x64U, 0x65U, 0x66U, 0x67U,
+  0x65U, 0x66U, 0x67U, 0x68U, 0x66U, 0x67U, 0x68U, 0x69U,
+  0x67U, 0x68U, 0x69U, 0x6aU, 0x68U, 0x69U, 0x6aU, 0x6bU,
+  0x69U, 0x6aU, 0x6bU, 0x6cU, 0x6aU, 0x6bU, 0x6cU, 0x6dU,
+  0x6bU, 0x6cU, 0x6dU, 0x6eU, 0x6cU, 0x6dU, 0x6eU, 0x6fU,
+  0x6dU, 0x6eU, 0x6fU, 0x70U, 0x6eU, 0x6fU, 0x70U, 0x71U
+};
+
+static uint8_t input4[] = {
+  0x61U, 0x62U, 0x63U, 0x64U, 0x65U, 0x66U, 0x67U, 0x68U,
+  0x62U, 0x63U, 0x64U, 0x65U, 0x66U, 0x67U, 0x68U, 0x69U,
+  0x63U, 0x64U, 0x65U, 0x66U, 0x67U, 0x68U, 0x69U, 0x6aU,
+  0x64U, 0x65U, 0x66U, 0x67U, 0x68U, 0x69U, 0x6aU, 0x6bU,
+  0x65U, 0x66U, 0x67U, 0x68U, 0x69U, 0x6aU, 0x6bU, 0x6cU,
+  0x66U, 0x67U, 0x68U, 0x69U, 0x6aU, 0x6bU, 0x6cU, 0x6dU,
+  0x67U, 0x68U, 0x69U, 0x6aU, 0x6bU, 0x6cU, 0x6dU, 0x6eU,
+  0x68U, 0x69U, 0x6aU, 0x6bU, 0x6cU, 0x6dU, 0x6eU, 0x6fU,
+  0x69U, 0x6aU, 0x6bU, 0x6cU, 0x6dU, 0x6eU, 0x6fU, 0x70U,
+  0x6aU, 0x6bU, 0x6cU, 0x6dU, 0x6eU, 0x6fU, 0x70U, 0x71U,
+  0x6bU, 0x6cU, 0x6dU, 0x6eU, 0x6fU, 0x70U, 0x71U, 0x72U,
+  0x6cU, 0x6dU, 0x6eU, 0x6fU, 0x70U, 0x71U, 0x72U, 0x73U,
+  0x6dU, 0x6eU, 0x6fU, 0x70U, 0x71U, 0x72U, 0x73U, 0x74U,
+  0x6eU, 0x6fU, 0x70U, 0x71U, 0x72U, 0x73U, 0x74U, 0x75U
+};
+
+static sha3_test_vector vectors[] = {
+  {
+    .input = input1,
+    .input_len = sizeof(input1),
+    .tag_224 = {
+      0xe6U, 0x42U, 0x82U, 0x4cU, 0x3fU, 0x8cU, 0xf2U, 0x4aU,
+      0xd0U, 0x92U, 0x34U, 0xeeU, 0x7dU, 0x3cU, 0x76U, 0x6fU,
+      0xc9U, 0xa3U, 0xa5U, 0x16U, 0x8dU, 0x0cU, 0x94U, 0xadU,
+      0x73U, 0xb4U, 0x6fU, 0xdfU
+    },
+    .tag_256 = {
+      0x3aU, 0x98U, 0x5dU, 0xa7U, 0x4fU, 0xe2U, 0x25U, 0xb2U,
+      0x04U, 0x5cU, 0x17U, 0x2dU, 0x6bU, 0xd3U, 0x90U, 0xbdU,
+      0x85U, 0x5fU, 0x08U, 0x6eU, 0x3eU, 0x9dU, 0x52U, 0x5bU,
+      0x46U, 0xbfU, 0xe2U, 0x45U, 0x11U, 0x43U, 0x15U, 0x32U
+    },
+    .tag_384 = {
+      0xecU, 0x01U, 0x49U, 0x82U, 0x88U, 0x51U, 0x6fU, 0xc9U,
+      0x26U, 0x45U, 0x9fU, 0x58U, 0xe2U, 0xc6U, 0xadU, 0x8dU,
+      0xf9U, 0xb4U, 0x73U, 0xcbU, 0x0fU, 0xc0U, 0x8cU, 0x25U,
+      0x96U, 0xdaU, 0x7cU, 0xf0U, 0xe4U, 0x9bU, 0xe4U, 0xb2U,
+      0x98U, 0xd8U, 0x8cU, 0xeaU, 0x92U, 0x7aU, 0xc7U, 0xf5U,
+      0x39U, 0xf1U, 0xedU, 0xf2U, 0x28U, 0x37U, 0x6dU, 0x25U
+    },
+    .tag_512 = {
+      0xb7U, 0x51U, 0x85U, 0x0bU, 0x1aU, 0x57U, 0x16U, 0x8aU,
+      0x56U, 0x93U, 0xcdU, 0x92U, 0x4bU, 0x6bU, 0x09U, 0x6eU,
+      0x08U, 0xf6U, 0x21U, 0x82U, 0x74U, 0x44U, 0xf7U, 0x0dU,
+      0x88U, 0x4fU, 0x5dU, 0x02U, 0x40U, 0xd2U, 0x71U, 0x2eU,
+      0x10U, 0xe1U, 0x16U, 0xe9U, 0x19U, 0x2aU, 0xf3U, 0xc9U,
+      0x1aU, 0x7eU, 0xc5U, 0x76U, 0x47U, 0xe3U, 0x93U, 0x40U,
+      0x57U, 0x34U, 0x0bU, 0x4cU, 0xf4U, 0x08U, 0xd5U, 0xa5U,
+      0x65U, 0x92U, 0xf8U, 0x27U, 0x4eU, 0xecU, 0x53U, 0xf0U
+    },
+    .shake128 = {
+      0x58U, 0x81U, 0x09U, 0x2dU, 0xd8U, 0x18U, 0xbfU, 0x5cU,
+      0xf8U, 0xa3U, 0xddU, 0xb7U, 0x93U, 0xfbU, 0xcbU, 0xa7U,
+      0x40U, 0x97U, 0xd5U, 0xc5U, 0x26U, 0xa6U, 0xd3U, 0x5fU,
+      0x97U, 0xb8U, 0x33U, 0x51U, 0x94U, 0x0fU, 0x2cU, 0xc8U
+    },
+    .shake256 = {
+      0x48U, 0x33U, 0x66U, 0x60U, 0x13U, 0x60U, 0xa8U, 0x77U,
+      0x1cU, 0x68U, 0x63U, 0x08U, 0x0cU, 0xc4U, 0x11U, 0x4dU,
+      0x8dU, 0xb4U, 0x45U, 0x30U, 0xf8U, 0xf1U, 0xe1U, 0xeeU,
+      0x4fU, 0x94U, 0xeaU, 0x37U, 0xe7U, 0x8bU, 0x57U, 0x39U,
+      0xd5U, 0xa1U, 0x5bU, 0xefU, 0x18U, 0x6aU, 0x53U, 0x86U,
+      0xc7U, 0x57U, 0x44U, 0xc0U, 0x52U, 0x7eU, 0x1fU, 0xaaU,
+      0x9fU, 0x87U, 0x26U, 0xe4U, 0x62U, 0xa1U, 0x2aU, 0x4fU,
+      0xebU, 0x06U, 0xbdU, 0x88U, 0x01U, 0xe7U, 0x51U, 0xe4U
+    },
+  },
+  {
+    .input = input2,
+    .input_len = sizeof(input2),
+    .tag_224 = {
+      0x6bU, 0x4eU, 0x03U, 0x42U, 0x36U, 0x67U, 0xdbU, 0xb7U,
+      0x3bU, 0x6eU, 0x15U, 0x45U, 0x4fU, 0x0eU, 0xb1U, 0xabU,
+      0xd4U, 0x59U, 0x7fU, 0x9aU, 0x1bU, 0x07U, 0x8eU, 0x3fU,
+      0x5bU, 0x5aU, 0x6bU, 0xc7U
+    },
+    .tag_256 = {
+      0xa7U, 0xffU, 0xc6U, 0xf8U, 0xbfU, 0x1eU, 0xd7U, 0x66U,
+      0x51U, 0xc1U, 0x47U, 0x56U, 0xa0U, 0x61U, 0xd6U, 0x62U,
+      0xf5U, 0x80U, 0xffU, 0x4dU, 0xe4U, 0x3bU, 0x49U, 0xfaU,
+      0x82U, 0xd8U, 0x0aU, 0x4bU, 0x80U, 0xf8U, 0x43U, 0x4aU
+    },
+    .tag_384 = {
+      0x0cU, 0x63U, 0xa7U, 0x5bU, 0x84U, 0x5eU, 0x4fU, 0x7dU,
+      0x01U, 0x10U, 0x7dU, 0x85U, 0x2eU, 0x4cU, 0x24U, 0x85U,
+      0xc5U, 0x1aU, 0x50U, 0xaaU, 0xaaU, 0x94U, 0xfcU, 0x61U,
+      0x99U, 0x5eU, 0x71U, 0xbbU, 0xeeU, 0x98U, 0x3aU, 0x2aU,
+      0xc3U, 0x71U, 0x38U, 0x31U, 0x26U, 0x4aU, 0xdbU, 0x47U,
+      0xfbU, 0x6bU, 0xd1U, 0xe0U, 0x58U, 0xd5U, 0xf0U, 0x04U
+    },
+    .tag_512 = {
+      0xa6U, 0x9fU, 0x73U, 0xccU, 0xa2U, 0x3aU, 0x9aU, 0xc5U,
+      0xc8U, 0xb5U, 0x67U, 0xdcU, 0x18U, 0x5aU, 0x75U, 0x6eU,
+      0x97U, 0xc9U, 0x82U, 0x16U, 0x4fU, 0xe2U, 0x58U, 0x59U,
+      0xe0U, 0xd1U, 0xdcU, 0xc1U, 0x47U, 0x5cU, 0x80U, 0xa6U,
+      0x15U, 0xb2U, 0x12U, 0x3aU, 0xf1U, 0xf5U, 0xf9U, 0x4cU,
+      0x11U, 0xe3U, 0xe9U, 0x40U, 0x2cU, 0x3aU, 0xc5U, 0x58U,
+      0xf5U, 0x00U, 0x19U, 0x9dU, 0x95U, 0xb6U, 0xd3U, 0xe3U,
+      0x01U, 0x75U, 0x85U, 0x86U, 0x28U, 0x1dU, 0xcdU, 0x26U
+    },
+    .shake128 = {
+      0x7fU, 0x9cU, 0x2bU, 0xa4U, 0xe8U, 0x8fU, 0x82U, 0x7dU,
+      0x61U, 0x60U, 0x45U, 0x50U, 0x76U, 0x05U, 0x85U, 0x3eU,
+      0xd7U, 0x3bU, 0x80U, 0x93U, 0xf6U, 0xefU, 0xbcU, 0x88U,
+      0xebU, 0x1aU, 0x6eU, 0xacU, 0xfaU, 0x66U, 0xefU, 0x26U
+    },
+    .shake256 = {
+      0x46U, 0xb9U, 0xddU, 0x2bU, 0x0bU, 0xa8U, 0x8dU, 0x13U,
+      0x23U, 0x3bU, 0x3fU, 0xebU, 0x74U, 0x3eU, 0xebU, 0x24U,
+      0x3fU, 0xcdU, 0x52U, 0xeaU, 0x62U, 0xb8U, 0x1bU, 0x82U,
+      0xb5U, 0x0cU, 0x27U, 0x64U, 0x6eU, 0xd5U, 0x76U, 0x2fU,
+      0xd7U, 0x5dU, 0xc4U, 0xddU, 0xd8U, 0xc0U, 0xf2U, 0x00U,
+      0xcbU, 0x05U, 0x01U, 0x9dU, 0x67U, 0xb5U, 0x92U, 0xf6U,
+      0xfcU, 0x82U, 0x1cU, 0x49U, 0x47U, 0x9aU, 0xb4U, 0x86U,
+      0x40U, 0x29U, 0x2eU, 0xacU, 0xb3U, 0xb7U, 0xc4U, 0xbeU
+    },
+  },
+  {
+    .input = input3,
+    .input_len = sizeof(input3),
+    .tag_224 = {
+      0x8aU, 0x24U, 0x10U, 0x8bU, 0x15U, 0x4aU, 0xdaU, 0x21U,
+      0xc9U, 0xfdU, 0x55U, 0x74U, 0x49U, 0x44U, 0x79U, 0xbaU,
+      0x5cU, 0x7eU, 0x7aU, 0xb7U, 0x6eU, 0xf2U, 0x64U, 0xeaU,
+      0xd0U, 0xfcU, 0xceU, 0x33U
+    },
+    .tag_256 = {
+      0x41U, 0xc0U, 0xdbU, 0xa2U, 0xa9U, 0xd6U, 0x24U, 0x08U,
+      0x49U, 0x10U, 0x03U, 0x76U, 0xa8U, 0x23U, 0x5eU, 0x2cU,
+      0x82U, 0xe1U, 0xb9U, 0x99U, 0x8aU, 0x99U, 0x9eU, 0x21U,
+      0xdbU, 0x32U, 0xddU, 0x97U, 0x49U, 0x6dU, 0x33U, 0x76U
+    },
+    .tag_384 = {
+      0x99U, 0x1cU, 0x66U, 0x57U, 0x55U, 0xebU, 0x3aU, 0x4bU,
+      0x6bU, 0xbdU, 0xfbU, 0x75U, 0xc7U, 0x8aU, 0x49U, 0x2eU,
+      0x8cU, 0x56U, 0xa2U, 0x2cU, 0x5cU, 0x4dU, 0x7eU, 0x42U,
+      0x9bU, 0xfdU, 0xbcU, 0x32U, 0xb9U, 0xd4U, 0xadU, 0x5aU,
+      0xa0U, 0x4aU, 0x1fU, 0x07U, 0x6eU, 0x62U, 0xfeU, 0xa1U,
+      0x9eU, 0xefU, 0x51U, 0xacU, 0xd0U, 0x65U, 0x7cU, 0x22U
+    },
+    .tag_512 = {
+      0x04U, 0xa3U, 0x71U, 0xe8U, 0x4eU, 0xcfU, 0xb5U, 0xb8U,
+      0xb7U, 0x7cU, 0xb4U, 0x86U, 0x10U, 0xfcU, 0xa8U, 0x18U,
+      0x2dU, 0xd4U, 0x57U, 0xceU, 0x6fU, 0x32U, 0x6aU, 0x0fU,
+      0xd3U, 0xd7U, 0xecU, 0x2fU, 0x1eU, 0x91U, 0x63U, 0x6dU,
+      0xeeU, 0x69U, 0x1fU, 0xbeU, 0x0cU, 0x98U, 0x53U, 0x02U,
+      0xbaU, 0x1bU, 0x0dU, 0x8dU, 0xc7U, 0x8cU, 0x08U, 0x63U,
+      0x46U, 0xb5U, 0x33U, 0xb4U, 0x9cU, 0x03U, 0x0dU, 0x99U,
+      0xa2U, 0x7dU, 0xafU, 0x11U, 0x39U, 0xd6U, 0xe7U, 0x5eU
+    },
+    .shake128 = {
+      0x1aU, 0x96U, 0x18U, 0x2bU, 0x50U, 0xfbU, 0x8cU, 0x7eU,
+      0x74U, 0xe0U, 0xa7U, 0x07U, 0x78U, 0x8fU, 0x55U, 0xe9U,
+      0x82U, 0x09U, 0xb8U, 0xd9U, 0x1fU, 0xadU, 0xe8U, 0xf3U,
+      0x2fU, 0x8dU, 0xd5U, 0xcfU, 0xf7U, 0xbfU, 0x21U, 0xf5U
+    },
+    .shake256 = {
+      0x4dU, 0x8cU, 0x2dU, 0xd2U, 0x43U, 0x5aU, 0x01U, 0x28U,
+      0xeeU, 0xfbU, 0xb8U, 0xc3U, 0x6fU, 0x6fU, 0x87U, 0x13U,
+      0x3aU, 0x79U, 0x11U, 0xe1U, 0x8dU, 0x97U, 0x9eU, 0xe1U,
+      0xaeU, 0x6bU, 0xe5U, 0xd4U, 0xfdU, 0x2eU, 0x33U, 0x29U,
+      0x40U, 0xd8U, 0x68U, 0x8aU, 0x4eU, 0x6aU, 0x59U, 0xaaU,
+      0x80U, 0x60U, 0xf1U, 0xf9U, 0xbcU, 0x99U, 0x6cU, 0x05U,
+      0xacU, 0xa3U, 0xc6U, 0x96U, 0xa8U, 0xb6U, 0x62U, 0x79U,
+      0xdcU, 0x67U, 0x2cU, 0x74U, 0x0bU, 0xb2U, 0x24U, 0xecU
+    },
+  },
+  {
+    .input = input4,
+    .input_len = sizeof(input4),
+    .tag_224 = {
+      0x54U, 0x3eU, 0x68U, 0x68U, 0xe1U, 0x66U, 0x6cU, 0x1aU,
+      0x64U, 0x36U, 0x30U, 0xdfU, 0x77U, 0x36U, 0x7aU, 0xe5U,
+      0xa6U, 0x2aU, 0x85U, 0x07U, 0x0aU, 0x51U, 0xc1U, 0x4cU,
+      0xbfU, 0x66U, 0x5cU, 0xbcU
+    },
+    .tag_256 = {
+      0x91U, 0x6fU, 0x60U, 0x61U, 0xfeU, 0x87U, 0x97U, 0x41U,
+      0xcaU, 0x64U, 0x69U, 0xb4U, 0x39U, 0x71U, 0xdfU, 0xdbU,
+      0x28U, 0xb1U, 0xa3U, 0x2dU, 0xc3U, 0x6cU, 0xb3U, 0x25U,
+      0x4eU, 0x81U, 0x2bU, 0xe2U, 0x7aU, 0xadU, 0x1dU, 0x18U
+    },
+    .tag_384 = {
+      0x79U, 0x40U, 0x7dU, 0x3bU, 0x59U, 0x16U, 0xb5U, 0x9cU,
+      0x3eU, 0x30U, 0xb0U, 0x98U, 0x22U, 0x97U, 0x47U, 0x91U,
+      0xc3U, 0x13U, 0xfbU, 0x9eU, 0xccU, 0x84U, 0x9eU, 0x40U,
+      0x6fU, 0x23U, 0x59U, 0x2dU, 0x04U, 0xf6U, 0x25U, 0xdcU,
+      0x8cU, 0x70U, 0x9bU, 0x98U, 0xb4U, 0x3bU, 0x38U, 0x52U,
+      0xb3U, 0x37U, 0x21U, 0x61U, 0x79U, 0xaaU, 0x7fU, 0xc7U
+    },
+    .tag_512 = {
+      0xafU, 0xebU, 0xb2U, 0xefU, 0x54U, 0x2eU, 0x65U, 0x79U,
+      0xc5U, 0x0cU, 0xadU, 0x06U, 0xd2U, 0xe5U, 0x78U, 0xf9U,
+      0xf8U, 0xddU, 0x68U, 0x81U, 0xd7U, 0xdcU, 0x82U, 0x4dU,
+      0x26U, 0x36U, 0x0fU, 0xeeU, 0xbfU, 0x18U, 0xa4U, 0xfaU,
+      0x73U, 0xe3U, 0x26U, 0x11U, 0x22U, 0x94U, 0x8eU, 0xfcU,
+      0xfdU, 0x49U, 0x2eU, 0x74U, 0xe8U, 0x2eU, 0x21U, 0x89U,
+      0xedU, 0x0fU, 0xb4U, 0x40U, 0xd1U, 0x87U, 0xf3U, 0x82U,
+      0x27U, 0x0cU, 0xb4U, 0x55U, 0xf2U, 0x1dU, 0xd1U, 0x85U
+    },
+    .shake128 = {
+      0x7bU, 0x6dU, 0xf6U, 0xffU, 0x18U, 0x11U, 0x73U, 0xb6U,
+      0xd7U, 0x89U, 0x8dU, 0x7fU, 0xf6U, 0x3fU, 0xb0U, 0x7bU,
+      0x7cU, 0x23U, 0x7dU, 0xafU, 0x47U, 0x1aU, 0x5aU, 0xe5U,
+      0x60U, 0x2aU, 0xdbU, 0xccU, 0xefU, 0x9cU, 0xcfU, 0x4bU
+    },
+    .shake256 = {
+      0x98U, 0xbeU, 0x04U, 0x51U, 0x6cU, 0x04U, 0xccU, 0x73U,
+      0x59U, 0x3fU, 0xefU, 0x3eU, 0xd0U, 0x35U, 0x2eU, 0xa9U,
+      0xf6U, 0x44U, 0x39U, 0x42U, 0xd6U, 0x95U, 0x0eU, 0x29U,
+      0xa3U, 0x72U, 0xa6U, 0x81U, 0xc3U, 0xdeU, 0xafU, 0x45U,
+      0x35U, 0x42U, 0x37U, 0x09U, 0xb0U, 0x28U, 0x43U, 0x94U,
+      0x86U, 0x84U, 0xe0U, 0x29U, 0x01U, 0x0bU, 0xadU, 0xccU,
+      0x0aU, 0xcdU, 0x83U, 0x03U, 0xfcU, 0x85U, 0xfdU, 0xadU,
+      0x3eU, 0xabU, 0xf4U, 0xf7U, 0x8cU, 0xaeU, 0x16U, 0x56U
+    },
+  }
+};
@@ -0,0 +1,146 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <time.h>
+
+#include "Hacl_SHA3.h"
+#include "Hacl_SHA3_Vec256.h"
+#include "Hacl_SP800_185.h"
+#include "EverCrypt_SP800_185.h"
+#include "EverCrypt_AutoConfig2.h"
+
+#include "test_helpers.h"
+#include "sp800_185_vectors.h"
+
+#define ROUNDS 256
+#define SIZE   (1024 * 1024)
+
+bool print_result(int in_len, uint8_t* comp, uint8_t* exp) {
+  return compare_and_print(in_len, comp, exp);
+}
+
+bool test_kmac(kmac_test_vector* v) {
+  uint8_t comp[64] = {0};
+  if (v->bits == 128) {
+    Hacl_SP800_185_kmac128(v->key_len, v->key, v->input_len, v->input, v->custom_len, v->custom, v->tag_len, comp);
+    printf("KMAC128 Result:\n");
+  } else {
+    Hacl_SP800_185_kmac256(v->key_len, v->key, v->input_len, v->input, v->custom_len, v->custom, v->tag_len, comp);
+    printf("KMAC256 Result:\n");
+  }
+  return print_result(v->tag_len, comp, v->tag);
+}
+
+bool test_parallelhash(parallelhash_test_vector* v) {
+  uint8_t comp[200] = {0};
+  bool ok;
+  if (v->bits == 128) {
+    ok = Hacl_SP800_185_parallelhash128(v->block_len, v->input_len, v->input, v->custom_len, v->custom, v->tag_len, comp);
+    printf("ParallelHash128 Result:\n");
+  } else {
+    ok = Hacl_SP800_185_parallelhash256(v->block_len, v->input_len, v->input, v->custom_len, v->custom, v->tag_len, comp);
+    printf("ParallelHash256 Result:\n");
+  }
+  ok = print_result(v->tag_len, comp, v->tag) && ok;
+
+  memset(comp, 0, sizeof comp);
+  if (v->bits == 128)
+    ok &= EverCrypt_SP800_185_parallelhash128(v->block_len, v->input_len, v->input, v->custom_len, v->custom, v->tag_len, comp);
+  else
+    ok &= EverCrypt_SP800_185_parallelhash256(v->block_len, v->input_len, v->input, v->custom_len, v->custom, v->tag_len, comp);
+  printf("(EverCrypt):\n");
+  ok = print_result(v->tag_len, comp, v->tag) && ok;
+  return ok;
+}
+
+// SP 800-185 requires B > 0: a zero block size is rejected, and the output left as it was.
+bool test_parallelhash_zero_block() {
+  uint8_t in[16] = {0};
+  uint8_t comp[64], exp[64];
+  memset(comp, 0xa5, sizeof comp);
+  memset(exp, 0xa5, sizeof exp);
+  bool ok = !Hacl_SP800_185_parallelhash128(0, sizeof in, in, 0, NULL, 32, comp);
+  ok &= !Hacl_SP800_185_parallelhash256(0, sizeof in, in, 0, NULL, 64, comp);
+  ok &= !Hacl_SP800_185_parallelhash128(0, 0, in, 0, NULL, 32, comp);
+  ok &= !EverCrypt_SP800_185_parallelhash128(0, sizeof in, in, 0, NULL, 32, comp);
+  ok &= !EverCrypt_SP800_185_parallelhash256(0, sizeof in, in, 0, NULL, 64, comp);
+  if (EverCrypt_AutoConfig2_has_avx2()) {
+    ok &= !Hacl_SP800_185_parallelhash128_vec256(0, sizeof in, in, 0, NULL, 32, comp);
+    ok &= !Hacl_SP800_185_parallelhash256_vec256(0, sizeof in, in, 0, NULL, 64, comp);
+  }
+  ok &= memcmp(comp, exp, sizeof comp) == 0;
+  printf("ParallelHash with a zero block size: %s\n", ok ? "Success!" : "**FAILED**");
+  return ok;
+}
+
+// The four lanes of the vectorized SHAKE must agree with the scalar one.
+bool test_shake_4() {
+  uint8_t in[4][300];
+  uint8_t out[4][200];
+  uint8_t exp[200];
+  bool ok = true;
+  for (int i = 0; i < 4; i++)
+    for (int j = 0; j < 300; j++)
+      in[i][j] = (uint8_t)(i * 31 + j);
+  for (uint32_t len = 0; len <= 300; len += 15) {
+    Hacl_SHA3_Vec256_shake128_4(len, in[0], in[1], in[2], in[3], 200, out[0], out[1], out[2], out[3]);
+    for (int i = 0; i < 4; i++) {
+      Hacl_SHA3_shake128_hacl(len, in[i], 200, exp);
+      ok = ok && memcmp(out[i], exp, 200) == 0;
+    }
+    Hacl_SHA3_Vec256_shake256_4(len, in[0], in[1], in[2], in[3], 200, out[0], out[1], out[2], out[3]);
+    for (int i = 0; i < 4; i++) {
+      Hacl_SHA3_shake256_hacl(len, in[i], 200, exp);
+      ok = ok && memcmp(out[i], exp, 200) == 0;
+    }
+  }
+  printf("SHAKE (4-way) vs. SHAKE (scalar): %s\n", ok ? "Success!" : "**FAILED**");
+  return ok;
+}
+
+int main() {
+  EverCrypt_AutoConfig2_init();
+
+  bool ok = true;
+  for (int i = 0; i < sizeof(kmac_vectors)/sizeof(kmac_test_vector); ++i)
+    ok &= test_kmac(&kmac_vectors[i]);
+  for (int i = 0; i < sizeof(parallelhash_vectors)/sizeof(parallelhash_test_vector); ++i)
+    ok &= test_parallelhash(&parallelhash_vectors[i]);
+  if (EverCrypt_AutoConfig2_has_avx2())
+    ok &= test_shake_4();
+  ok &= test_parallelhash_zero_block();
+
+  uint8_t *plain = malloc(SIZE);
+  uint8_t tag[32];
+  cycles a,b;
+  clock_t t1,t2;
+  memset(plain, 'P', SIZE);
+
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++)
+    Hacl_SP800_185_parallelhash128(8192, SIZE, plain, 0, NULL, 32, tag);
+  b = cpucycles_end();
+  t2 = clock();
+  double cdiff1 = b - a;
+  double tdiff1 = t2 - t1;
+
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++)
+    EverCrypt_SP800_185_parallelhash128(8192, SIZE, plain, 0, NULL, 32, tag);
+  b = cpucycles_end();
+  t2 = clock();
+  double cdiff2 = b - a;
+  double tdiff2 = t2 - t1;
+
+  uint64_t count = (uint64_t)ROUNDS * SIZE;
+  printf("ParallelHash128 (scalar) PERF:\n"); print_time(count, tdiff1, cdiff1);
+  printf("ParallelHash128 (EverCrypt) PERF:\n"); print_time(count, tdiff2, cdiff2);
+  free(plain);
+
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
@@ -0,0 +1,375 @@
+#pragma once
+
+typedef struct {
+  uint32_t bits;
+  uint8_t *key;
+  uint32_t key_len;
+  uint8_t *input;
+  uint32_t input_len;
+  uint8_t *custom;
+  uint32_t custom_len;
+  uint8_t *tag;
+  uint32_t tag_len;
+} kmac_test_vector;
+
+typedef struct {
+  uint32_t bits;
+  uint32_t block_len;
+  uint8_t *input;
+  uint32_t input_len;
+  uint8_t *custom;
+  uint32_t custom_len;
+  uint8_t *tag;
+  uint32_t tag_len;
+} parallelhash_test_vector;
+
+static uint8_t key[32] = {
+  0x40U, 0x41U, 0x42U, 0x43U, 0x44U, 0x45U, 0x46U, 0x47U,
+  0x48U, 0x49U, 0x4aU, 0x4bU, 0x4cU, 0x4dU, 0x4eU, 0x4fU,
+  0x50U, 0x51U, 0x52U, 0x53U, 0x54U, 0x55U, 0x56U, 0x57U,
+  0x58U, 0x59U, 0x5aU, 0x5bU, 0x5cU, 0x5dU, 0x5eU, 0x5fU
+};
+
+static uint8_t data4[4] = {
+  0x00U, 0x01U, 0x02U, 0x03U
+};
+
+static uint8_t data200[200] = {
+  0x00U, 0x01U, 0x02U, 0x03U, 0x04U, 0x05U, 0x06U, 0x07U,
+  0x08U, 0x09U, 0x0aU, 0x0bU, 0x0cU, 0x0dU, 0x0eU, 0x0fU,
+  0x10U, 0x11U, 0x12U, 0x13U, 0x14U, 0x15U, 0x16U, 0x17U,
+  0x18U, 0x19U, 0x1aU, 0x1bU, 0x1cU, 0x1dU, 0x1eU, 0x1fU,
+  0x20U, 0x21U, 0x22U, 0x23U, 0x24U, 0x25U, 0x26U, 0x27U,
+  0x28U, 0x29U, 0x2aU, 0x2bU, 0x2cU, 0x2dU, 0x2eU, 0x2fU,
+  0x30U, 0x31U, 0x32U, 0x33U, 0x34U, 0x35U, 0x36U, 0x37U,
+  0x38U, 0x39U, 0x3aU, 0x3bU, 0x3cU, 0x3dU, 0x3eU, 0x3fU,
+  0x40U, 0x41U, 0x42U, 0x43U, 0x44U, 0x45U, 0x46U, 0x47U,
+  0x48U, 0x49U, 0x4aU, 0x4bU, 0x4cU, 0x4dU, 0x4eU, 0x4fU,
+  0x50U, 0x51U, 0x52U, 0x53U, 0x54U, 0x55U, 0x56U, 0x57U,
+  0x58U, 0x59U, 0x5aU, 0x5bU, 0x5cU, 0x5dU, 0x5eU, 0x5fU,
+  0x60U, 0x61U, 0x62U, 0x63U, 0x64U, 0x65U, 0x66U, 0x67U,
+  0x68U, 0x69U, 0x6aU, 0x6bU, 0x6cU, 0x6dU, 0x6eU, 0x6fU,
+  0x70U, 0x71U, 0x72U, 0x73U, 0x74U, 0x75U, 0x76U, 0x77U,
+  0x78U, 0x79U, 0x7aU, 0x7bU, 0x7cU, 0x7dU, 0x7eU, 0x7fU,
+  0x80U, 0x81U, 0x82U, 0x83U, 0x84U, 0x85U, 0x86U, 0x87U,
+  0x88U, 0x89U, 0x8aU, 0x8bU, 0x8cU, 0x8dU, 0x8eU, 0x8fU,
+  0x90U, 0x91U, 0x92U, 0x93U, 0x94U, 0x95U, 0x96U, 0x97U,
+  0x98U, 0x99U, 0x9aU, 0x9bU, 0x9cU, 0x9dU, 0x9eU, 0x9fU,
+  0xa0U, 0xa1U, 0xa2U, 0xa3U, 0xa4U, 0xa5U, 0xa6U, 0xa7U,
+  0xa8U, 0xa9U, 0xaaU, 0xabU, 0xacU, 0xadU, 0xaeU, 0xafU,
+  0xb0U, 0xb1U, 0xb2U, 0xb3U, 0xb4U, 0xb5U, 0xb6U, 0xb7U,
+  0xb8U, 0xb9U, 0xbaU, 0xbbU, 0xbcU, 0xbdU, 0xbeU, 0xbfU,
+  0xc0U, 0xc1U, 0xc2U, 0xc3U, 0xc4U, 0xc5U, 0xc6U, 0xc7U
+};
+
+static uint8_t custom[21] = {
+  0x4dU, 0x79U, 0x20U, 0x54U, 0x61U, 0x67U, 0x67U, 0x65U,
+  0x64U, 0x20U, 0x41U, 0x70U, 0x70U, 0x6cU, 0x69U, 0x63U,
+  0x61U, 0x74U, 0x69U, 0x6fU, 0x6eU
+};
+
+static uint8_t empty[1] = {
+  0x00U
+};
+
+static uint8_t ph_data24[24] = {
+  0x00U, 0x01U, 0x02U, 0x03U, 0x04U, 0x05U, 0x06U, 0x07U,
+  0x10U, 0x11U, 0x12U, 0x13U, 0x14U, 0x15U, 0x16U, 0x17U,
+  0x20U, 0x21U, 0x22U, 0x23U, 0x24U, 0x25U, 0x26U, 0x27U
+};
+
+static uint8_t ph_data1000[1000] = {
+  0x03U, 0x0aU, 0x11U, 0x18U, 0x1fU, 0x26U, 0x2dU, 0x34U,
+  0x3bU, 0x42U, 0x49U, 0x50U, 0x57U, 0x5eU, 0x65U, 0x6cU,
+  0x73U, 0x7aU, 0x81U, 0x88U, 0x8fU, 0x96U, 0x9dU, 0xa4U,
+  0xabU, 0xb2U, 0xb9U, 0xc0U, 0xc7U, 0xceU, 0xd5U, 0xdcU,
+  0xe3U, 0xeaU, 0xf1U, 0xf8U, 0xffU, 0x06U, 0x0dU, 0x14U,
+  0x1bU, 0x22U, 0x29U, 0x30U, 0x37U, 0x3eU, 0x45U, 0x4cU,
+  0x53U, 0x5aU, 0x61U, 0x68U, 0x6fU, 0x76U, 0x7dU, 0x84U,
+  0x8bU, 0x92U, 0x99U, 0xa0U, 0xa7U, 0xaeU, 0xb5U, 0xbcU,
+  0xc3U, 0xcaU, 0xd1U, 0xd8U, 0xdfU, 0xe6U, 0xedU, 0xf4U,
+  0xfbU, 0x02U, 0x09U, 0x10U, 0x17U, 0x1eU, 0x25U, 0x2cU,
+  0x33U, 0x3aU, 0x41U, 0x48U, 0x4fU, 0x56U, 0x5dU, 0x64U,
+  0x6bU, 0x72U, 0x79U, 0x80U, 0x87U, 0x8eU, 0x95U, 0x9cU,
+  0xa3U, 0xaaU, 0xb1U, 0xb8U, 0xbfU, 0xc6U, 0xcdU, 0xd4U,
+  0xdbU, 0xe2U, 0xe9U, 0xf0U, 0xf7U, 0xfeU, 0x05U, 0x0cU,
+  0x13U, 0x1aU, 0x21U, 0x28U, 0x2fU, 0x36U, 0x3dU, 0x44U,
+  0x4bU, 0x52U, 0x59U, 0x60U, 0x67U, 0x6eU, 0x75U, 0x7cU,
+  0x83U, 0x8aU, 0x91U, 0x98U, 0x9fU, 0xa6U, 0xadU, 0xb4U,
+  0xbbU, 0xc2U, 0xc9U, 0xd0U, 0xd7U, 0xdeU, 0xe5U, 0xecU,
+  0xf3U, 0xfaU, 0x01U, 0x08U, 0x0fU, 0x16U, 0x1dU, 0x24U,
+  0x2bU, 0x32U, 0x39U, 0x40U, 0x47U, 0x4eU, 0x55U, 0x5cU,
+  0x63U, 0x6aU, 0x71U, 0x78U, 0x7fU, 0x86U, 0x8dU, 0x94U,
+  0x9bU, 0xa2U, 0xa9U, 0xb0U, 0xb7U, 0xbeU, 0xc5U, 0xccU,
+  0xd3U, 0xdaU, 0xe1U, 0xe8U, 0xefU, 0xf6U, 0xfdU, 0x04U,
+  0x0bU, 0x12U, 0x19U, 0x20U, 0x27U, 0x2eU, 0x35U, 0x3cU,
+  0x43U, 0x4aU, 0x51U, 0x58U, 0x5fU, 0x66U, 0x6dU, 0x74U,
+  0x7bU, 0x82U, 0x89U, 0x90U, 0x97U, 0x9eU, 0xa5U, 0xacU,
+  0xb3U, 0xbaU, 0xc1U, 0xc8U, 0xcfU, 0xd6U, 0xddU, 0xe4U,
+  0xebU, 0xf2U, 0xf9U, 0x00U, 0x07U, 0x0eU, 0x15U, 0x1cU,
+  0x23U, 0x2aU, 0x31U, 0x38U, 0x3fU, 0x46U, 0x4dU, 0x54U,
+  0x5bU, 0x62U, 0x69U, 0x70U, 0x77U, 0x7eU, 0x85U, 0x8cU,
+  0x93U, 0x9aU, 0xa1U, 0xa8U, 0xafU, 0xb6U, 0xbdU, 0xc4U,
+  0xcbU, 0xd2U, 0xd9U, 0xe0U, 0xe7U, 0xeeU, 0xf5U, 0xfcU,
+  0x03U, 0x0aU, 0x11U, 0x18U, 0x1fU, 0x26U, 0x2dU, 0x34U,
+  0x3bU, 0x42U, 0x49U, 0x50U, 0x57U, 0x5eU, 0x65U, 0x6cU,
+  0x73U, 0x7aU, 0x81U, 0x88U, 0x8fU, 0x96U, 0x9dU, 0xa4U,
+  0xabU, 0xb2U, 0xb9U, 0xc0U, 0xc7U, 0xceU, 0xd5U, 0xdcU,
+  0xe3U, 0xeaU, 0xf1U, 0xf8U, 0xffU, 0x06U, 0x0dU, 0x14U,
+  0x1bU, 0x22U, 0x29U, 0x30U, 0x37U, 0x3eU, 0x45U, 0x4cU,
+  0x53U, 0x5aU, 0x61U, 0x68U, 0x6fU, 0x76U, 0x7dU, 0x84U,
+  0x8bU, 0x92U, 0x99U, 0xa0U, 0xa7U, 0xaeU, 0xb5U, 0xbcU,
+  0xc3U, 0xcaU, 0xd1U, 0xd8U, 0xdfU, 0xe6U, 0xedU, 0xf4U,
+  0xfbU, 0x02U, 0x09U, 0x10U, 0x17U, 0x1eU, 0x25U, 0x2cU,
+  0x33U, 0x3aU, 0x41U, 0x48U, 0x4fU, 0x56U, 0x5dU, 0x64U,
+  0x6bU, 0x72U, 0x79U, 0x80U, 0x87U, 0x8eU, 0x95U, 0x9cU,
+  0xa3U, 0xaaU, 0xb1U, 0xb8U, 0xbfU, 0xc6U, 0xcdU, 0xd4U,
+  0xdbU, 0xe2U, 0xe9U, 0xf0U, 0xf7U, 0xfeU, 0x05U, 0x0cU,
+  0x13U, 0x1aU, 0x21U, 0x28U, 0x2fU, 0x36U, 0x3dU, 0x44U,
+  0x4bU, 0x52U, 0x59U, 0x60U, 0x67U, 0x6eU, 0x75U, 0x7cU,
+  0x83U, 0x8aU, 0x91U, 0x98U, 0x9fU, 0xa6U, 0xadU, 0xb4U,
+  0xbbU, 0xc2U, 0xc9U, 0xd0U, 0xd7U, 0xdeU, 0xe5U, 0xecU,
+  0xf3U, 0xfaU, 0x01U, 0x08U, 0x0fU, 0x16U, 0x1dU, 0x24U,
+  0x2bU, 0x32U, 0x39U, 0x40U, 0x47U, 0x4eU, 0x55U, 0x5cU,
+  0x63U, 0x6aU, 0x71U, 0x78U, 0x7fU, 0x86U, 0x8dU, 0x94U,
+  0x9bU, 0xa2U, 0xa9U, 0xb0U, 0xb7U, 0xbeU, 0xc5U, 0xccU,
+  0xd3U, 0xdaU, 0xe1U, 0xe8U, 0xefU, 0xf6U, 0xfdU, 0x04U,
+  0x0bU, 0x12U, 0x19U, 0x20U, 0x27U, 0x2eU, 0x35U, 0x3cU,
+  0x43U, 0x4aU, 0x51U, 0x58U, 0x5fU, 0x66U, 0x6dU, 0x74U,
+  0x7bU, 0x82U, 0x89U, 0x90U, 0x97U, 0x9eU, 0xa5U, 0xacU,
+  0xb3U, 0xbaU, 0xc1U, 0xc8U, 0xcfU, 0xd6U, 0xddU, 0xe4U,
+  0xebU, 0xf2U, 0xf9U, 0x00U, 0x07U, 0x0eU, 0x15U, 0x1cU,
+  0x23U, 0x2aU, 0x31U, 0x38U, 0x3fU, 0x46U, 0x4dU, 0x54U,
+  0x5bU, 0x62U, 0x69U, 0x70U, 0x77U, 0x7eU, 0x85U, 0x8cU,
+  0x93U, 0x9aU, 0xa1U, 0xa8U, 0xafU, 0xb6U, 0xbdU, 0xc4U,
+  0xcbU, 0xd2U, 0xd9U, 0xe0U, 0xe7U, 0xeeU, 0xf5U, 0xfcU,
+  0x03U, 0x0aU, 0x11U, 0x18U, 0x1fU, 0x26U, 0x2dU, 0x34U,
+  0x3bU, 0x42U, 0x49U, 0x50U, 0x57U, 0x5eU, 0x65U, 0x6cU,
+  0x73U, 0x7aU, 0x81U, 0x88U, 0x8fU, 0x96U, 0x9dU, 0xa4U,
+  0xabU, 0xb2U, 0xb9U, 0xc0U, 0xc7U, 0xceU, 0xd5U, 0xdcU,
+  0xe3U, 0xeaU, 0xf1U, 0xf8U, 0xffU, 0x06U, 0x0dU, 0x14U,
+  0x1bU, 0x22U, 0x29U, 0x30U, 0x37U, 0x3eU, 0x45U, 0x4cU,
+  0x53U, 0x5aU, 0x61U, 0x68U, 0x6fU, 0x76U, 0x7dU, 0x84U,
+  0x8bU, 0x92U, 0x99U, 0xa0U, 0xa7U, 0xaeU, 0xb5U, 0xbcU,
+  0xc3U, 0xcaU, 0xd1U, 0xd8U, 0xdfU, 0xe6U, 0xedU, 0xf4U,
+  0xfbU, 0x02U, 0x09U, 0x10U, 0x17U, 0x1eU, 0x25U, 0x2cU,
+  0x33U, 0x3aU, 0x41U, 0x48U, 0x4fU, 0x56U, 0x5dU, 0x64U,
+  0x6bU, 0x72U, 0x79U, 0x80U, 0x87U, 0x8eU, 0x95U, 0x9cU,
+  0xa3U, 0xaaU, 0xb1U, 0xb8U, 0xbfU, 0xc6U, 0xcdU, 0xd4U,
+  0xdbU, 0xe2U, 0xe9U, 0xf0U, 0xf7U, 0xfeU, 0x05U, 0x0cU,
+  0x13U, 0x1aU, 0x21U, 0x28U, 0x2fU, 0x36U, 0x3dU, 0x44U,
+  0x4bU, 0x52U, 0x59U, 0x60U, 0x67U, 0x6eU, 0x75U, 0x7cU,
+  0x83U, 0x8aU, 0x91U, 0x98U, 0x9fU, 0xa6U, 0xadU, 0xb4U,
+  0xbbU, 0xc2U, 0xc9U, 0xd0U, 0xd7U, 0xdeU, 0xe5U, 0xecU,
+  0xf3U, 0xfaU, 0x01U, 0x08U, 0x0fU, 0x16U, 0x1dU, 0x24U,
+  0x2bU, 0x32U, 0x39U, 0x40U, 0x47U, 0x4eU, 0x55U, 0x5cU,
+  0x63U, 0x6aU, 0x71U, 0x78U, 0x7fU, 0x86U, 0x8dU, 0x94U,
+  0x9bU, 0xa2U, 0xa9U, 0xb0U, 0xb7U, 0xbeU, 0xc5U, 0xccU,
+  0xd3U, 0xdaU, 0xe1U, 0xe8U, 0xefU, 0xf6U, 0xfdU, 0x04U,
+  0x0bU, 0x12U, 0x19U, 0x20U, 0x27U, 0x2eU, 0x35U, 0x3cU,
+  0x43U, 0x4aU, 0x51U, 0x58U, 0x5fU, 0x66U, 0x6dU, 0x74U,
+  0x7bU, 0x82U, 0x89U, 0x90U, 0x97U, 0x9eU, 0xa5U, 0xacU,
+  0xb3U, 0xbaU, 0xc1U, 0xc8U, 0xcfU, 0xd6U, 0xddU, 0xe4U,
+  0xebU, 0xf2U, 0xf9U, 0x00U, 0x07U, 0x0eU, 0x15U, 0x1cU,
+  0x23U, 0x2aU, 0x31U, 0x38U, 0x3fU, 0x46U, 0x4dU, 0x54U,
+  0x5bU, 0x62U, 0x69U, 0x70U, 0x77U, 0x7eU, 0x85U, 0x8cU,
+  0x93U, 0x9aU, 0xa1U, 0xa8U, 0xafU, 0xb6U, 0xbdU, 0xc4U,
+  0xcbU, 0xd2U, 0xd9U, 0xe0U, 0xe7U, 0xeeU, 0xf5U, 0xfcU,
+  0x03U, 0x0aU, 0x11U, 0x18U, 0x1fU, 0x26U, 0x2dU, 0x34U,
+  0x3bU, 0x42U, 0x49U, 0x50U, 0x57U, 0x5eU, 0x65U, 0x6cU,
+  0x73U, 0x7aU, 0x81U, 0x88U, 0x8fU, 0x96U, 0x9dU, 0xa4U,
+  0xabU, 0xb2U, 0xb9U, 0xc0U, 0xc7U, 0xceU, 0xd5U, 0xdcU,
+  0xe3U, 0xeaU, 0xf1U, 0xf8U, 0xffU, 0x06U, 0x0dU, 0x14U,
+  0x1bU, 0x22U, 0x29U, 0x30U, 0x37U, 0x3eU, 0x45U, 0x4cU,
+  0x53U, 0x5aU, 0x61U, 0x68U, 0x6fU, 0x76U, 0x7dU, 0x84U,
+  0x8bU, 0x92U, 0x99U, 0xa0U, 0xa7U, 0xaeU, 0xb5U, 0xbcU,
+  0xc3U, 0xcaU, 0xd1U, 0xd8U, 0xdfU, 0xe6U, 0xedU, 0xf4U,
+  0xfbU, 0x02U, 0x09U, 0x10U, 0x17U, 0x1eU, 0x25U, 0x2cU,
+  0x33U, 0x3aU, 0x41U, 0x48U, 0x4fU, 0x56U, 0x5dU, 0x64U,
+  0x6bU, 0x72U, 0x79U, 0x80U, 0x87U, 0x8eU, 0x95U, 0x9cU,
+  0xa3U, 0xaaU, 0xb1U, 0xb8U, 0xbfU, 0xc6U, 0xcdU, 0xd4U,
+  0xdbU, 0xe2U, 0xe9U, 0xf0U, 0xf7U, 0xfeU, 0x05U, 0x0cU,
+  0x13U, 0x1aU, 0x21U, 0x28U, 0x2fU, 0x36U, 0x3dU, 0x44U,
+  0x4bU, 0x52U, 0x59U, 0x60U, 0x67U, 0x6eU, 0x75U, 0x7cU,
+  0x83U, 0x8aU, 0x91U, 0x98U, 0x9fU, 0xa6U, 0xadU, 0xb4U,
+  0xbbU, 0xc2U, 0xc9U, 0xd0U, 0xd7U, 0xdeU, 0xe5U, 0xecU,
+  0xf3U, 0xfaU, 0x01U, 0x08U, 0x0fU, 0x16U, 0x1dU, 0x24U,
+  0x2bU, 0x32U, 0x39U, 0x40U, 0x47U, 0x4eU, 0x55U, 0x5cU,
+  0x63U, 0x6aU, 0x71U, 0x78U, 0x7fU, 0x86U, 0x8dU, 0x94U,
+  0x9bU, 0xa2U, 0xa9U, 0xb0U, 0xb7U, 0xbeU, 0xc5U, 0xccU,
+  0xd3U, 0xdaU, 0xe1U, 0xe8U, 0xefU, 0xf6U, 0xfdU, 0x04U,
+  0x0bU, 0x12U, 0x19U, 0x20U, 0x27U, 0x2eU, 0x35U, 0x3cU,
+  0x43U, 0x4aU, 0x51U, 0x58U, 0x5fU, 0x66U, 0x6dU, 0x74U,
+  0x7bU, 0x82U, 0x89U, 0x90U, 0x97U, 0x9eU, 0xa5U, 0xacU,
+  0xb3U, 0xbaU, 0xc1U, 0xc8U, 0xcfU, 0xd6U, 0xddU, 0xe4U,
+  0xebU, 0xf2U, 0xf9U, 0x00U, 0x07U, 0x0eU, 0x15U, 0x1cU,
+  0x23U, 0x2aU, 0x31U, 0x38U, 0x3fU, 0x46U, 0x4dU, 0x54U
+};
+
+static uint8_t ph_custom[13] = {
+  0x50U, 0x61U, 0x72U, 0x61U, 0x6cU, 0x6cU, 0x65U, 0x6cU,
+  0x20U, 0x44U, 0x61U, 0x74U, 0x61U
+};
+
+static uint8_t kmac_tag0[32] = {
+  0xe5U, 0x78U, 0x0bU, 0x0dU, 0x3eU, 0xa6U, 0xf7U, 0xd3U,
+  0xa4U, 0x29U, 0xc5U, 0x70U, 0x6aU, 0xa4U, 0x3aU, 0x00U,
+  0xfaU, 0xdbU, 0xd7U, 0xd4U, 0x96U, 0x28U, 0x83U, 0x9eU,
+  0x31U, 0x87U, 0x24U, 0x3fU, 0x45U, 0x6eU, 0xe1U, 0x4eU
+};
+
+static uint8_t kmac_tag1[32] = {
+  0x3bU, 0x1fU, 0xbaU, 0x96U, 0x3cU, 0xd8U, 0xb0U, 0xb5U,
+  0x9eU, 0x8cU, 0x1aU, 0x6dU, 0x71U, 0x88U, 0x8bU, 0x71U,
+  0x43U, 0x65U, 0x1aU, 0xf8U, 0xbaU, 0x0aU, 0x70U, 0x70U,
+  0xc0U, 0x97U, 0x9eU, 0x28U, 0x11U, 0x32U, 0x4aU, 0xa5U
+};
+
+static uint8_t kmac_tag2[32] = {
+  0x1fU, 0x5bU, 0x4eU, 0x6cU, 0xcaU, 0x02U, 0x20U, 0x9eU,
+  0x0dU, 0xcbU, 0x5cU, 0xa6U, 0x35U, 0xb8U, 0x9aU, 0x15U,
+  0xe2U, 0x71U, 0xecU, 0xc7U, 0x60U, 0x07U, 0x1dU, 0xfdU,
+  0x80U, 0x5fU, 0xaaU, 0x38U, 0xf9U, 0x72U, 0x92U, 0x30U
+};
+
+static uint8_t kmac_tag3[64] = {
+  0x20U, 0xc5U, 0x70U, 0xc3U, 0x13U, 0x46U, 0xf7U, 0x03U,
+  0xc9U, 0xacU, 0x36U, 0xc6U, 0x1cU, 0x03U, 0xcbU, 0x64U,
+  0xc3U, 0x97U, 0x0dU, 0x0cU, 0xfcU, 0x78U, 0x7eU, 0x9bU,
+  0x79U, 0x59U, 0x9dU, 0x27U, 0x3aU, 0x68U, 0xd2U, 0xf7U,
+  0xf6U, 0x9dU, 0x4cU, 0xc3U, 0xdeU, 0x9dU, 0x10U, 0x4aU,
+  0x35U, 0x16U, 0x89U, 0xf2U, 0x7cU, 0xf6U, 0xf5U, 0x95U,
+  0x1fU, 0x01U, 0x03U, 0xf3U, 0x3fU, 0x4fU, 0x24U, 0x87U,
+  0x10U, 0x24U, 0xd9U, 0xc2U, 0x77U, 0x73U, 0xa8U, 0xddU
+};
+
+static uint8_t kmac_tag4[64] = {
+  0x75U, 0x35U, 0x8cU, 0xf3U, 0x9eU, 0x41U, 0x49U, 0x4eU,
+  0x94U, 0x97U, 0x07U, 0x92U, 0x7cU, 0xeeU, 0x0aU, 0xf2U,
+  0x0aU, 0x3fU, 0xf5U, 0x53U, 0x90U, 0x4cU, 0x86U, 0xb0U,
+  0x8fU, 0x21U, 0xccU, 0x41U, 0x4bU, 0xcfU, 0xd6U, 0x91U,
+  0x58U, 0x9dU, 0x27U, 0xcfU, 0x5eU, 0x15U, 0x36U, 0x9cU,
+  0xbbU, 0xffU, 0x8bU, 0x9aU, 0x4cU, 0x2eU, 0xb1U, 0x78U,
+  0x00U, 0x85U, 0x5dU, 0x02U, 0x35U, 0xffU, 0x63U, 0x5dU,
+  0xa8U, 0x25U, 0x33U, 0xecU, 0x6bU, 0x75U, 0x9bU, 0x69U
+};
+
+static uint8_t kmac_tag5[64] = {
+  0xb5U, 0x86U, 0x18U, 0xf7U, 0x1fU, 0x92U, 0xe1U, 0xd5U,
+  0x6cU, 0x1bU, 0x8cU, 0x55U, 0xddU, 0xd7U, 0xcdU, 0x18U,
+  0x8bU, 0x97U, 0xb4U, 0xcaU, 0x4dU, 0x99U, 0x83U, 0x1eU,
+  0xb2U, 0x69U, 0x9aU, 0x83U, 0x7dU, 0xa2U, 0xe4U, 0xd9U,
+  0x70U, 0xfbU, 0xacU, 0xfdU, 0xe5U, 0x00U, 0x33U, 0xaeU,
+  0xa5U, 0x85U, 0xf1U, 0xa2U, 0x70U, 0x85U, 0x10U, 0xc3U,
+  0x2dU, 0x07U, 0x88U, 0x08U, 0x01U, 0xbdU, 0x18U, 0x28U,
+  0x98U, 0xfeU, 0x47U, 0x68U, 0x76U, 0xfcU, 0x89U, 0x65U
+};
+
+static uint8_t ph_tag0[32] = {
+  0xbaU, 0x8dU, 0xc1U, 0xd1U, 0xd9U, 0x79U, 0x33U, 0x1dU,
+  0x3fU, 0x81U, 0x36U, 0x03U, 0xc6U, 0x7fU, 0x72U, 0x60U,
+  0x9aU, 0xb5U, 0xe4U, 0x4bU, 0x94U, 0xa0U, 0xb8U, 0xf9U,
+  0xafU, 0x46U, 0x51U, 0x44U, 0x54U, 0xa2U, 0xb4U, 0xf5U
+};
+
+static uint8_t ph_tag1[32] = {
+  0xfcU, 0x48U, 0x4dU, 0xcbU, 0x3fU, 0x84U, 0xdcU, 0xeeU,
+  0xdcU, 0x35U, 0x34U, 0x38U, 0x15U, 0x1bU, 0xeeU, 0x58U,
+  0x15U, 0x7dU, 0x6eU, 0xfeU, 0xd0U, 0x44U, 0x5aU, 0x81U,
+  0xf1U, 0x65U, 0xe4U, 0x95U, 0x79U, 0x5bU, 0x72U, 0x06U
+};
+
+static uint8_t ph_tag2[64] = {
+  0xbcU, 0x1eU, 0xf1U, 0x24U, 0xdaU, 0x34U, 0x49U, 0x5eU,
+  0x94U, 0x8eU, 0xadU, 0x20U, 0x7dU, 0xd9U, 0x84U, 0x22U,
+  0x35U, 0xdaU, 0x43U, 0x2dU, 0x2bU, 0xbcU, 0x54U, 0xb4U,
+  0xc1U, 0x10U, 0xe6U, 0x4cU, 0x45U, 0x11U, 0x05U, 0x53U,
+  0x1bU, 0x7fU, 0x2aU, 0x3eU, 0x0cU, 0xe0U, 0x55U, 0xc0U,
+  0x28U, 0x05U, 0xe7U, 0xc2U, 0xdeU, 0x1fU, 0xb7U, 0x46U,
+  0xafU, 0x97U, 0xa1U, 0xddU, 0x01U, 0xf4U, 0x3bU, 0x82U,
+  0x4eU, 0x31U, 0xb8U, 0x76U, 0x12U, 0x41U, 0x04U, 0x29U
+};
+
+static uint8_t ph_tag3[64] = {
+  0xcdU, 0xf1U, 0x52U, 0x89U, 0xb5U, 0x4fU, 0x62U, 0x12U,
+  0xb4U, 0xbcU, 0x27U, 0x05U, 0x28U, 0xb4U, 0x95U, 0x26U,
+  0x00U, 0x6dU, 0xd9U, 0xb5U, 0x4eU, 0x2bU, 0x6aU, 0xddU,
+  0x1eU, 0xf6U, 0x90U, 0x0dU, 0xdaU, 0x39U, 0x63U, 0xbbU,
+  0x33U, 0xa7U, 0x24U, 0x91U, 0xf2U, 0x36U, 0x96U, 0x9cU,
+  0xa8U, 0xafU, 0xaeU, 0xa2U, 0x9cU, 0x68U, 0x2dU, 0x47U,
+  0xa3U, 0x93U, 0xc0U, 0x65U, 0xb3U, 0x8eU, 0x29U, 0xfaU,
+  0xe6U, 0x51U, 0xa2U, 0x09U, 0x1cU, 0x83U, 0x31U, 0x10U
+};
+
+static uint8_t ph_tag4[32] = {
+  0x2bU, 0x0bU, 0x92U, 0x96U, 0x74U, 0x60U, 0x1bU, 0x46U,
+  0xcdU, 0x70U, 0x6aU, 0xa6U, 0xf3U, 0xfdU, 0xa8U, 0x1fU,
+  0xc0U, 0x2aU, 0x43U, 0xe1U, 0xa4U, 0x46U, 0x19U, 0xd5U,
+  0x84U, 0xb8U, 0x54U, 0xd8U, 0x14U, 0x66U, 0x35U, 0x0cU
+};
+
+static uint8_t ph_tag5[64] = {
+  0x2dU, 0x99U, 0x47U, 0x14U, 0xfdU, 0x56U, 0x2aU, 0x48U,
+  0x9bU, 0x67U, 0x68U, 0x08U, 0x07U, 0x0dU, 0x9fU, 0x04U,
+  0x71U, 0xa2U, 0xb8U, 0x39U, 0x23U, 0x63U, 0x59U, 0xbdU,
+  0x8bU, 0xc0U, 0xa4U, 0xb6U, 0x60U, 0x50U, 0xd4U, 0x8fU,
+  0x3aU, 0x77U, 0xa2U, 0x33U, 0x90U, 0xf8U, 0x64U, 0x3fU,
+  0xfbU, 0x6dU, 0xd0U, 0xf7U, 0x6bU, 0xe5U, 0x5fU, 0x61U,
+  0xbbU, 0x13U, 0x56U, 0x21U, 0x31U, 0xc0U, 0x5fU, 0x50U,
+  0x85U, 0x3cU, 0xddU, 0x94U, 0xe7U, 0xafU, 0x08U, 0xfaU
+};
+
+static uint8_t ph_tag6[200] = {
+  0xe1U, 0xf2U, 0x8fU, 0x11U, 0xe0U, 0x6eU, 0x8dU, 0x3dU,
+  0x9eU, 0x4bU, 0x9cU, 0x86U, 0x33U, 0x52U, 0xcaU, 0xf8U,
+  0x6eU, 0x93U, 0x9fU, 0x5aU, 0xbaU, 0x1eU, 0x91U, 0x49U,
+  0xb0U, 0xb7U, 0x57U, 0x2bU, 0x79U, 0x95U, 0xa5U, 0xa2U,
+  0x66U, 0x50U, 0xd1U, 0x3fU, 0x1bU, 0x68U, 0x33U, 0xe2U,
+  0x81U, 0x14U, 0xe9U, 0x5eU, 0xf7U, 0x8dU, 0x54U, 0xa8U,
+  0x47U, 0x19U, 0xe0U, 0xd6U, 0x2fU, 0x00U, 0x71U, 0xddU,
+  0xb4U, 0x0bU, 0x87U, 0x53U, 0x87U, 0x6eU, 0x47U, 0x6bU,
+  0xa5U, 0x46U, 0xb2U, 0xceU, 0x56U, 0xbeU, 0x66U, 0x4cU,
+  0x4aU, 0x6eU, 0x1dU, 0x57U, 0x89U, 0x6eU, 0x76U, 0x29U,
+  0x1dU, 0xc1U, 0xd9U, 0x6eU, 0x4bU, 0xb2U, 0xa5U, 0x75U,
+  0x65U, 0x43U, 0x65U, 0xbcU, 0x9dU, 0x1bU, 0x1eU, 0xd2U,
+  0x93U, 0x1fU, 0xadU, 0x66U, 0xd3U, 0x0cU, 0x60U, 0xa7U,
+  0xd4U, 0xe3U, 0x2bU, 0x41U, 0x23U, 0xeeU, 0x3fU, 0xfdU,
+  0x94U, 0xf7U, 0xf5U, 0xf1U, 0x47U, 0xdcU, 0x51U, 0xf8U,
+  0x01U, 0xb6U, 0xcaU, 0xcbU, 0xbcU, 0x70U, 0xd1U, 0xa7U,
+  0x30U, 0xf0U, 0x1dU, 0x6cU, 0x59U, 0x93U, 0xaaU, 0xd9U,
+  0xc1U, 0x56U, 0xd3U, 0xc7U, 0xd9U, 0x84U, 0x1dU, 0xa2U,
+  0x69U, 0xf1U, 0x99U, 0x09U, 0xb3U, 0x60U, 0x0bU, 0x11U,
+  0xa2U, 0xa5U, 0xc3U, 0xbbU, 0xf3U, 0xb2U, 0xafU, 0x64U,
+  0x18U, 0xe8U, 0x98U, 0xcfU, 0xa5U, 0x94U, 0x0cU, 0xd6U,
+  0xd5U, 0x0dU, 0xdbU, 0xdcU, 0x79U, 0x13U, 0x5dU, 0x11U,
+  0xe3U, 0xb5U, 0x32U, 0xb3U, 0xf3U, 0x96U, 0xe2U, 0xbbU,
+  0x6eU, 0x31U, 0x3dU, 0x06U, 0x61U, 0x7eU, 0xd1U, 0x50U,
+  0x25U, 0x8eU, 0x03U, 0x12U, 0x5dU, 0x66U, 0x3eU, 0x50U
+};
+
+static uint8_t ph_tag7[32] = {
+  0x05U, 0xe2U, 0xbaU, 0x46U, 0x8aU, 0x7fU, 0x24U, 0x43U,
+  0x49U, 0x6dU, 0xa4U, 0xbfU, 0x4dU, 0x85U, 0x51U, 0x16U,
+  0xfcU, 0x1cU, 0x82U, 0x90U, 0x12U, 0xf5U, 0xcbU, 0x29U,
+  0xf2U, 0x5aU, 0x73U, 0x80U, 0xf2U, 0x24U, 0xcdU, 0xedU
+};
+
+static kmac_test_vector kmac_vectors[] = {
+  { 128, key, 32, data4, 4, empty, 0, kmac_tag0, 32 },
+  { 128, key, 32, data4, 4, custom, 21, kmac_tag1, 32 },
+  { 128, key, 32, data200, 200, custom, 21, kmac_tag2, 32 },
+  { 256, key, 32, data4, 4, custom, 21, kmac_tag3, 64 },
+  { 256, key, 32, data200, 200, empty, 0, kmac_tag4, 64 },
+  { 256, key, 32, data200, 200, custom, 21, kmac_tag5, 64 }
+};
+
+static parallelhash_test_vector parallelhash_vectors[] = {
+  { 128, 8, ph_data24, 24, empty, 0, ph_tag0, 32 },
+  { 128, 8, ph_data24, 24, ph_custom, 13, ph_tag1, 32 },
+  { 256, 8, ph_data24, 24, empty, 0, ph_tag2, 64 },
+  { 256, 8, ph_data24, 24, ph_custom, 13, ph_tag3, 64 },
+  { 128, 64, ph_data1000, 1000, ph_custom, 13, ph_tag4, 32 },
+  { 256, 64, ph_data1000, 1000, empty, 0, ph_tag5, 64 },
+  { 128, 40, ph_data1000, 1000, empty, 0, ph_tag6, 200 },
+  { 256, 100, ph_data1000, 1000, ph_custom, 13, ph_tag7, 32 }
+};